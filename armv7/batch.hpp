@@ -0,0 +1,137 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file defines an execution engine running several independent
+ * cores on the same code in lockstep. Their registers are stored as a
+ * structure of arrays, so that an instruction executed by all of them
+ * at once works on one array per register, which the compiler turns
+ * into vector operations (8 lanes fit an AVX2 register).
+ */
+
+#ifndef __ARMV7_BATCH_HPP__
+#define __ARMV7_BATCH_HPP__
+
+#include "predecode.hpp"
+#include "processor.hpp"
+#include "profile.hpp"
+#include "unpredictable.hpp"
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+
+namespace arm {
+
+
+    /**
+     * Register bank of one lane of a batch_core: register i is
+     * element "i * lanes" of the column it points to.
+     */
+    template< unsigned int lanes >
+    struct batch_bank
+    {
+        uint32_t* column; /// Register 0 of the lane
+
+        uint32_t& operator[]( uint32_t i ) const
+        {
+            return column[ i * lanes ];
+        }
+    };
+
+
+    /**
+     * Group of "lanes" cores. The general-purpose registers of all
+     * cores are stored in R, one row per register. Each lane also has
+     * its own armv7_core, with a packed CPSR, its PC and its memories,
+     * whose register bank is its column of R. A lane can therefore be
+     * used on its own like any other core, e.g. to set it up or to
+     * read its results.
+     */
+    template< typename mem_type,
+              unsigned int lanes = 8,
+              typename profile_type = armv7a_profile,
+              typename unpredictable_type = unpredictable_warn >
+    struct batch_core : boost::noncopyable
+    {
+        typedef armv7_core< packed_cpsr, uint32_t, batch_bank< lanes >,
+                            mem_type, profile_type,
+                            unpredictable_type > lane_type;
+
+        enum { size = lanes };
+
+        batch_core();
+
+        /// General-purpose registers, R[i][l] being register i of lane l
+        alignas( 32 ) uint32_t R[16][ lanes ];
+
+        lane_type lane[ lanes ]; /// Cores
+    };
+
+
+    /**
+     * Engine running the lanes of a batch_core in lockstep.
+     *
+     * The lanes at the lowest PC execute the instruction there
+     * together, so that lanes that took a branch the others did not
+     * wait at the higher address until the others catch up. If the
+     * instruction is a simple data-processing instruction or a branch
+     * (see Predecoded::simple), it is executed once for all of these
+     * lanes, its condition being checked per lane. Otherwise, each
+     * lane executes it on its own with run().
+     *
+     * All lanes must run the same code: instructions executed in
+     * lockstep are fetched from the iMem of the first lane and cached.
+     * Entries must be invalidated by the client when the instruction
+     * memory is modified.
+     */
+    template< typename batch_type >
+    class batch_cache : boost::noncopyable
+    {
+    public:
+        typedef typename batch_type::lane_type lane_type;
+
+        /**
+         * Executes at most max_instrs instructions in each lane,
+         * starting at its PC. A lane stops early before an
+         * instruction without a behavior function, or when it leaves
+         * the ARM instruction set. All lanes stop if the
+         * unpredictable policy stops one (see UnpredictableRaised()).
+         * Returns the number of instructions executed by all lanes.
+         */
+        uint64_t run( batch_type& batch, uint64_t max_instrs );
+
+        /**
+         * Drops the instruction at "address", if cached.
+         */
+        void invalidate( uint32_t address );
+
+        /**
+         * Drops all cached instructions.
+         */
+        void flush();
+
+    private:
+        bool execute( batch_type& batch, const Predecoded& p,
+                      uint32_t pc, const bool* group );
+
+        predecode_cache< lane_type, 10 > cache;
+    };
+
+
+} // namespace arm
+
+#endif // __ARMV7_BATCH_HPP__
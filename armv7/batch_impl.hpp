@@ -0,0 +1,384 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_BATCH_IMPL_HPP__
+#define __ARMV7_BATCH_IMPL_HPP__
+
+#include "batch.hpp"
+#include "function_impl.hpp"
+#include "predecode_impl.hpp"
+#include "run_impl.hpp"
+#include "unpredictable_impl.hpp"
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace arm {
+namespace detail {
+
+    /*
+     * Lane operations of batch_cache::execute(). Each of them is a
+     * single loop over all lanes without branches, so that it can be
+     * vectorized. "pass" is all ones for the lanes that execute the
+     * instruction and zero for the others, which keep their registers
+     * and flags.
+     */
+
+    // R[d] = R[n] + y + carry_in, setting NZCV if setflags
+    template< unsigned int lanes >
+    void BatchAdd( uint32_t ( &R )[16][ lanes ], uint32_t* cpsr,
+                   const uint32_t* pass, const Predecoded& p,
+                   const uint32_t* y, uint32_t carry_in, bool write )
+    {
+        const uint32_t flags = p.setflags ? 0xF0000000 : 0;
+
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            const uint32_t x      = R[ p.n ][l];
+            const uint64_t sum    = (uint64_t)x + y[l] + carry_in;
+            const uint32_t result = (uint32_t)sum;
+            const uint32_t nzcv   = ( result & 0x80000000 ) |
+                                    ( result == 0 ? 0x40000000 : 0 ) |
+                                    ( (uint32_t)( sum >> 32 ) << 29 ) |
+                                    ( ( ~( x ^ y[l] ) & ( x ^ result ) ) >>
+                                      31 << 28 );
+            const uint32_t mask   = pass[l] & flags;
+
+            if( write )
+            {
+                R[ p.d ][l] = ( result & pass[l] ) | ( R[ p.d ][l] & ~pass[l] );
+            }
+            cpsr[l] = ( nzcv & mask ) | ( cpsr[l] & ~mask );
+        }
+    }
+
+    // R[d] = result, setting NZC (C from the shifter) if setflags
+    template< unsigned int lanes >
+    void BatchLogical( uint32_t ( &R )[16][ lanes ], uint32_t* cpsr,
+                       const uint32_t* pass, const Predecoded& p,
+                       const uint32_t* result, const uint32_t* carry,
+                       bool write )
+    {
+        const uint32_t flags = p.setflags ? 0xE0000000 : 0;
+
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            const uint32_t nzc  = ( result[l] & 0x80000000 ) |
+                                  ( result[l] == 0 ? 0x40000000 : 0 ) |
+                                  ( carry[l] << 29 );
+            const uint32_t mask = pass[l] & flags;
+
+            if( write )
+            {
+                R[ p.d ][l] = ( result[l] & pass[l] ) |
+                              ( R[ p.d ][l] & ~pass[l] );
+            }
+            cpsr[l] = ( nzc & mask ) | ( cpsr[l] & ~mask );
+        }
+    }
+
+} // namespace detail
+} // namespace arm
+
+
+template< typename mem_type, unsigned int lanes,
+          typename profile_type, typename unpredictable_type >
+arm::batch_core< mem_type, lanes, profile_type,
+                 unpredictable_type >::batch_core() : lane()
+{
+    memset( R, 0, sizeof( R ) );
+
+    for( unsigned int l = 0; l < lanes; ++l )
+    {
+        lane[l].R.column = &R[0][l];
+    }
+}
+
+
+template< typename batch_type >
+uint64_t arm::batch_cache< batch_type >::run( batch_type& batch,
+                                              uint64_t max_instrs )
+{
+    const unsigned int lanes = batch_type::size;
+
+    uint64_t count[ lanes ];
+    bool     active[ lanes ];
+    bool     group[ lanes ];
+    uint64_t total = 0;
+
+    for( unsigned int l = 0; l < lanes; ++l )
+    {
+        count[l]  = 0;
+        active[l] = max_instrs > 0 &&
+                    CurrentInstrSet( batch.lane[l] ) == InstrSet_ARM;
+    }
+
+    for( ;; )
+    {
+        // Lanes at the lowest PC go first
+        unsigned int first = lanes;
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            if( active[l] && ( first == lanes ||
+                               batch.lane[l].PC < batch.lane[ first ].PC ) )
+            {
+                first = l;
+            }
+        }
+
+        if( first == lanes )
+        {
+            return total;
+        }
+
+        const uint32_t pc = batch.lane[ first ].PC;
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            group[l] = active[l] && batch.lane[l].PC == pc;
+        }
+
+        const Predecoded& p = cache.lookup( batch.lane[ first ], pc );
+
+        if( p.simple && execute( batch, p, pc, group ) )
+        {
+            for( unsigned int l = 0; l < lanes; ++l )
+            {
+                count[l] += group[l];
+                total    += group[l];
+            }
+        }
+        else
+        {
+            for( unsigned int l = 0; l < lanes; ++l )
+            {
+                if( group[l] )
+                {
+                    const uint64_t n = arm::run( batch.lane[l], 1 );
+                    count[l] += n;
+                    total    += n;
+
+                    if( n == 0 )
+                    {
+                        active[l] = false;
+                    }
+                    if( UnpredictableRaised( batch.lane[l] ) )
+                    {
+                        return total;
+                    }
+                }
+            }
+        }
+
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            if( group[l] &&
+                ( count[l] == max_instrs ||
+                  CurrentInstrSet( batch.lane[l] ) != InstrSet_ARM ) )
+            {
+                active[l] = false;
+            }
+        }
+    }
+}
+
+
+/*
+ * Executes the instruction at "pc" in the lanes of "group". Returns
+ * false, without executing it, if it has no lane operation.
+ */
+template< typename batch_type >
+bool arm::batch_cache< batch_type >::execute( batch_type& batch,
+                                              const Predecoded& p,
+                                              uint32_t pc,
+                                              const bool* group )
+{
+    const unsigned int lanes = batch_type::size;
+
+    uint32_t cpsr[ lanes ];
+    uint32_t pass[ lanes ];
+    uint32_t y[ lanes ];
+    uint32_t carry[ lanes ];
+
+    bool imm;
+    switch( p.encoding )
+    {
+    case Encoding_ADD_imm_A1: case Encoding_SUB_imm_A1:
+    case Encoding_AND_imm_A1: case Encoding_ORR_imm_A1:
+    case Encoding_EOR_imm_A1: case Encoding_BIC_imm_A1:
+    case Encoding_MOV_imm_A1: case Encoding_MVN_imm_A1:
+    case Encoding_CMP_imm_A1: case Encoding_CMN_imm_A1:
+    case Encoding_TST_imm_A1: case Encoding_TEQ_imm_A1:
+    case Encoding_B_A1:       case Encoding_BL_A1:
+        imm = true;
+        break;
+
+    case Encoding_ADD_reg_A1: case Encoding_SUB_reg_A1:
+    case Encoding_AND_reg_A1: case Encoding_ORR_reg_A1:
+    case Encoding_EOR_reg_A1: case Encoding_BIC_reg_A1:
+    case Encoding_MOV_reg_A1:
+    case Encoding_CMP_reg_A1: case Encoding_CMN_reg_A1:
+    case Encoding_TST_reg_A1: case Encoding_TEQ_reg_A1:
+        imm = false;
+        break;
+
+    default:
+        return false;
+    }
+
+    for( unsigned int l = 0; l < lanes; ++l )
+    {
+        cpsr[l] = batch.lane[l].CPSR.word;
+        pass[l] = group[l] && ConditionHolds( p.cond, cpsr[l] >> 28 ) ?
+                  0xFFFFFFFF : 0;
+        if( group[l] )
+        {
+            batch.R[15][l] = pc + 8;
+        }
+    }
+
+    // Second operand, and the carry out of the shifter
+    for( unsigned int l = 0; l < lanes; ++l )
+    {
+        const uint32_t c = ( cpsr[l] >> 29 ) & 1;
+        if( imm )
+        {
+            y[l]     = p.imm32;
+            carry[l] = p.imm_carry[c];
+        }
+        else
+        {
+            const UValueCarry s_ = Shift_C( batch.R[ p.m ][l], p.shift_t,
+                                            p.shift_n, c );
+            y[l]     = s_.value;
+            carry[l] = s_.carry;
+        }
+    }
+
+    uint32_t next = pc + 4;
+    uint32_t ( &R )[16][ lanes ] = batch.R;
+
+    switch( p.encoding )
+    {
+    case Encoding_ADD_imm_A1: case Encoding_ADD_reg_A1:
+        detail::BatchAdd( R, cpsr, pass, p, y, 0, true );
+        break;
+
+    case Encoding_CMN_imm_A1: case Encoding_CMN_reg_A1:
+        detail::BatchAdd( R, cpsr, pass, p, y, 0, false );
+        break;
+
+    case Encoding_SUB_imm_A1: case Encoding_SUB_reg_A1:
+    case Encoding_CMP_imm_A1: case Encoding_CMP_reg_A1:
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            y[l] = ~y[l];
+        }
+        detail::BatchAdd( R, cpsr, pass, p, y, 1,
+                          p.encoding == Encoding_SUB_imm_A1 ||
+                          p.encoding == Encoding_SUB_reg_A1 );
+        break;
+
+    case Encoding_AND_imm_A1: case Encoding_AND_reg_A1:
+    case Encoding_TST_imm_A1: case Encoding_TST_reg_A1:
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            y[l] &= R[ p.n ][l];
+        }
+        detail::BatchLogical( R, cpsr, pass, p, y, carry,
+                              p.encoding == Encoding_AND_imm_A1 ||
+                              p.encoding == Encoding_AND_reg_A1 );
+        break;
+
+    case Encoding_EOR_imm_A1: case Encoding_EOR_reg_A1:
+    case Encoding_TEQ_imm_A1: case Encoding_TEQ_reg_A1:
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            y[l] ^= R[ p.n ][l];
+        }
+        detail::BatchLogical( R, cpsr, pass, p, y, carry,
+                              p.encoding == Encoding_EOR_imm_A1 ||
+                              p.encoding == Encoding_EOR_reg_A1 );
+        break;
+
+    case Encoding_ORR_imm_A1: case Encoding_ORR_reg_A1:
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            y[l] |= R[ p.n ][l];
+        }
+        detail::BatchLogical( R, cpsr, pass, p, y, carry, true );
+        break;
+
+    case Encoding_BIC_imm_A1: case Encoding_BIC_reg_A1:
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            y[l] = R[ p.n ][l] & ~y[l];
+        }
+        detail::BatchLogical( R, cpsr, pass, p, y, carry, true );
+        break;
+
+    case Encoding_MOV_imm_A1: case Encoding_MOV_reg_A1:
+        detail::BatchLogical( R, cpsr, pass, p, y, carry, true );
+        break;
+
+    case Encoding_MVN_imm_A1:
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            y[l] = ~y[l];
+        }
+        detail::BatchLogical( R, cpsr, pass, p, y, carry, true );
+        break;
+
+    case Encoding_BL_A1:
+        for( unsigned int l = 0; l < lanes; ++l )
+        {
+            R[14][l] = ( ( pc + 4 ) & pass[l] ) | ( R[14][l] & ~pass[l] );
+        }
+        next = pc + 8 + p.imm32;
+        break;
+
+    default: // Encoding_B_A1
+        next = pc + 8 + p.imm32;
+        break;
+    }
+
+    // Branches only move the lanes whose condition passed
+    for( unsigned int l = 0; l < lanes; ++l )
+    {
+        if( group[l] )
+        {
+            batch.lane[l].CPSR.word = cpsr[l];
+            batch.lane[l].PC = ( next & pass[l] ) | ( ( pc + 4 ) & ~pass[l] );
+        }
+    }
+
+    return true;
+}
+
+
+template< typename batch_type >
+void arm::batch_cache< batch_type >::invalidate( uint32_t address )
+{
+    cache.invalidate( address );
+}
+
+
+template< typename batch_type >
+void arm::batch_cache< batch_type >::flush()
+{
+    cache.flush();
+}
+
+#endif // __ARMV7_BATCH_IMPL_HPP__
@@ -0,0 +1,214 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file defines an execution engine working on basic blocks of
+ * predecoded ARM instructions. Blocks are cached by start address and
+ * linked to the blocks executed after them, so that loops run without
+ * looking blocks up again.
+ */
+
+#ifndef __ARMV7_BLOCK_HPP__
+#define __ARMV7_BLOCK_HPP__
+
+#include "predecode.hpp"
+#include "smc.hpp"
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/unordered_map.hpp>
+#include <vector>
+
+
+namespace arm {
+
+
+    template< typename proc_type > class jit_compiler;
+
+
+    /**
+     * Sequence of instructions executed one after the other. A block
+     * ends after an instruction that writes the PC (see WritesPC()),
+     * before an instruction without a behavior function, at a 4 KB
+     * page boundary or after max_size instructions.
+     *
+     * Conditional instructions are stored with the AL condition, so
+     * that their behavior functions do not check it again. The block
+     * cache checks their original condition (Predecoded::cond)
+     * before executing them, once for a run of instructions with the
+     * same condition that do not set the flags.
+     */
+    template< typename proc_type >
+    struct basic_block
+    {
+        enum { max_size = 64 };
+
+        /// How the condition of an instruction is checked
+        enum check_type
+        {
+            check_none,     /// AL, or an unconditional instruction
+            check_flags,    /// Checked against the flags
+            check_previous  /// Same result as the previous instruction
+        };
+
+        typedef void ( *native_type )( proc_type&,
+                                       const predecoded_instr< proc_type >* );
+
+        uint32_t address;   /// Address of the first instruction
+        bool     branch;    /// True if the last instruction writes the PC
+
+        /// Predecoded instructions
+        std::vector< predecoded_instr< proc_type > > instrs;
+
+        /// Condition check of each instruction (check_type)
+        std::vector< uint8_t > checks;
+
+        /// Block executed after this one when the last instruction does
+        /// not write the PC, and when it does. Links are checked
+        /// against the actual next address before being followed.
+        basic_block* next[2];
+
+        /// Blocks linking to this one, once per link, so that dropping
+        /// it only unlinks them
+        std::vector< basic_block* > preds;
+
+        uint32_t    executions; /// Number of times the block was entered
+
+        /// Native translation of all instructions but a final branch,
+        /// or null
+        native_type native;
+    };
+
+
+    /**
+     * Cache of basic blocks indexed by start address.
+     *
+     * Between calls to run(), proc.PC holds the address of the next
+     * instruction to execute. While an instruction executes, proc.PC
+     * and proc.R[15] hold its address plus 8, as the behavior
+     * functions expect. Instructions are fetched from proc.iMem.
+     * Blocks must be invalidated by the client when the instruction
+     * memory is modified.
+     *
+     * When given a jit_compiler, blocks executed often enough are
+     * translated to native code. The code of invalidated blocks is
+     * released by flush(). When the code buffer is full, all
+     * generated code is released and blocks are translated again
+     * once they get hot.
+     *
+     * When given a code_map, the cache marks the pages of its blocks
+     * and drops the blocks overwritten by the stores reported to the
+     * map, as with a unified_mem. A block overwritten while it runs
+     * is completed as it was translated: the new instructions are
+     * executed from the next block on, as after an ISB.
+     */
+    template< typename proc_type >
+    class block_cache : boost::noncopyable
+    {
+    public:
+        explicit block_cache( jit_compiler< proc_type >* jit = 0,
+                              code_map* code = 0 );
+        ~block_cache();
+
+        /**
+         * Executes at most max_instrs instructions, starting at
+         * proc.PC. Stops early before an instruction without a
+         * behavior function, or when the processor leaves the ARM
+         * instruction set. Returns the number of instructions
+         * executed.
+         */
+        uint64_t run( proc_type& proc, uint64_t max_instrs );
+
+        /**
+         * Returns the block starting at "address", translating it on a
+         * miss.
+         */
+        basic_block< proc_type >* lookup( proc_type& proc,
+                                          uint32_t address );
+
+        /**
+         * Drops the blocks overlapping the instruction at "address".
+         */
+        void invalidate( uint32_t address );
+
+        /**
+         * Drops the blocks overlapping [address, address + size). A
+         * block that ends before an instruction without a behavior
+         * function also covers it, so that writing this instruction
+         * lets the block grow.
+         */
+        void invalidate( uint32_t address, uint32_t size );
+
+        /**
+         * Drops all blocks.
+         */
+        void flush();
+
+        /**
+         * Returns the number of cached blocks.
+         */
+        size_t size() const;
+
+    private:
+        typedef boost::unordered_map< uint32_t,
+                                      basic_block< proc_type >* > map_type;
+
+        /// Blocks of a 4 KB page
+        struct code_page
+        {
+            std::vector< uint32_t > starts; /// Start addresses
+            uint64_t lines; /// 64-byte lines covered by the blocks
+        };
+
+        typedef boost::unordered_map< uint32_t, code_page > page_map;
+
+        basic_block< proc_type >* translate( proc_type& proc,
+                                             uint32_t address );
+
+        // Sets link "k" of block "from" to block "to", or clears it
+        void link( basic_block< proc_type >* from, int k,
+                   basic_block< proc_type >* to );
+
+        // Clears the links to and from a dropped block
+        void unlink( basic_block< proc_type >* block );
+
+        // Drops the blocks of page "page" overlapping the range
+        void invalidate_page( uint32_t page, uint32_t address,
+                              uint32_t size );
+
+        // Deletes the blocks dropped since the last call
+        void release();
+
+        // Drops the generated code of all blocks and counts their
+        // executions again
+        void drop_native();
+
+        // Invalidation callback of the code map
+        static void written( void* cache, uint32_t address, uint32_t size );
+
+        map_type  blocks;
+        page_map  pages;
+        jit_compiler< proc_type >* jit;
+        code_map* code;
+
+        /// Dropped blocks, which may still be running
+        std::vector< basic_block< proc_type >* > retired;
+    };
+
+
+} // namespace arm
+
+#endif // __ARMV7_BLOCK_HPP__
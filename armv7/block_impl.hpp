@@ -0,0 +1,485 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_BLOCK_IMPL_HPP__
+#define __ARMV7_BLOCK_IMPL_HPP__
+
+#include "block.hpp"
+#include "decoder.hpp"
+#include "function.hpp"
+#include "jit_impl.hpp"
+#include "predecode_impl.hpp"
+#include "smc_impl.hpp"
+#include <boost/cstdint.hpp>
+#include <algorithm>
+
+
+namespace arm {
+
+    // Bytes from the start of a block that writes can change it with:
+    // a block ended by an instruction without a behavior function
+    // also covers it
+    template< typename proc_type >
+    uint32_t BlockExtent( const basic_block< proc_type >& block )
+    {
+        const size_t n = block.instrs.size();
+        const bool stopped = !block.branch &&
+                             n < basic_block< proc_type >::max_size &&
+                             ( ( block.address + 4 * n ) & 0xFFF ) != 0;
+        return 4 * n + ( stopped ? 4 : 0 );
+    }
+
+    // Bits of the 64-byte lines of page "page" that bytes
+    // [address, address + size) fall in. Ranges wrapping around the
+    // address space cover all lines.
+    inline uint64_t PageLines( uint32_t page, uint32_t address,
+                               uint32_t size )
+    {
+        const uint64_t begin = address;
+        const uint64_t end   = begin + size;
+        const uint64_t first = (uint64_t)page << 12;
+
+        if( end > ( (uint64_t)1 << 32 ) )
+        {
+            return ~(uint64_t)0;
+        }
+        if( size == 0 || end <= first || begin >= first + 4096 )
+        {
+            return 0;
+        }
+
+        const uint32_t lo = ( std::max( begin, first ) - first ) >> 6;
+        const uint32_t hi = ( std::min( end, first + 4096 ) - 1 - first ) >> 6;
+        return ( ~(uint64_t)0 >> ( 63 - hi ) ) & ( ~(uint64_t)0 << lo );
+    }
+
+}
+
+
+template< typename proc_type >
+arm::block_cache< proc_type >::block_cache(
+    jit_compiler< proc_type >* jit, code_map* code )
+    : jit( jit ), code( code )
+{
+    if( code != 0 )
+    {
+        code->attach( this, &block_cache::written );
+    }
+}
+
+
+template< typename proc_type >
+arm::block_cache< proc_type >::~block_cache()
+{
+    if( code != 0 )
+    {
+        code->detach( this );
+    }
+    flush();
+}
+
+
+template< typename proc_type >
+uint64_t arm::block_cache< proc_type >::run( proc_type& proc,
+                                             uint64_t max_instrs )
+{
+    release();
+
+    uint64_t count = 0;
+    basic_block< proc_type >* block = lookup( proc, proc.PC );
+
+    while( count < max_instrs && !block->instrs.empty() &&
+           CurrentInstrSet( proc ) == InstrSet_ARM )
+    {
+        size_t size = block->instrs.size();
+        if( max_instrs - count < size )
+        {
+            size = max_instrs - count;
+        }
+
+        if( jit != 0 && ++block->executions == jit->threshold &&
+            !jit->compile( proc, *block ) && jit->full() )
+        {
+            // No generated code runs between blocks: the buffer is
+            // refilled with the blocks that get hot again
+            drop_native();
+            jit->reset();
+            block->executions = jit->threshold;
+            jit->compile( proc, *block );
+        }
+
+        // Generated code runs everything but a final branch. It never
+        // raises: blocks that could are not compiled when the
+        // unpredictable policy stops (see jit_compiler::compile()).
+        size_t first = 0;
+        bool   stop  = false;
+        if( block->native != 0 && size == block->instrs.size() )
+        {
+            block->native( proc, &block->instrs[0] );
+            first = size - ( block->branch ? 1 : 0 );
+        }
+
+        // Whether the last instruction writes the PC is known before
+        // executing it, since it cannot change the flags it depends
+        // on. Comparing the PC afterwards would not tell a branch to
+        // the next instruction but one from a fall-through.
+        bool passed = true;
+        for( size_t i = first; i < size; ++i )
+        {
+            const predecoded_instr< proc_type >& p = block->instrs[i];
+            proc.PC    = p.address + 8;
+            proc.R[15] = p.address + 8;
+
+            // The previous result is not known after generated code
+            const uint8_t check = block->checks[i];
+            if( check == basic_block< proc_type >::check_none )
+            {
+                passed = true;
+            }
+            else if( check == basic_block< proc_type >::check_flags ||
+                     i == first )
+            {
+                passed = ConditionHolds( p.cond, ConditionFlags( proc.CPSR ) );
+            }
+
+            if( passed )
+            {
+                p.exec( proc, p );
+            }
+
+            if( UnpredictableRaised( proc ) )
+            {
+                size = i + 1;
+                stop = true;
+            }
+        }
+
+        const bool taken = block->branch && size == block->instrs.size() &&
+                           passed;
+
+        count += size;
+
+        if( !taken )
+        {
+            proc.PC = block->address + 4 * size;
+        }
+
+        if( size < block->instrs.size() || stop )
+        {
+            break;
+        }
+
+        const int k = taken ? 1 : 0;
+        basic_block< proc_type >* next = block->next[k];
+        if( next == 0 || next->address != proc.PC )
+        {
+            next = lookup( proc, proc.PC );
+            link( block, k, next );
+        }
+
+        block = next;
+    }
+
+    return count;
+}
+
+
+template< typename proc_type >
+arm::basic_block< proc_type >*
+arm::block_cache< proc_type >::lookup( proc_type& proc, uint32_t address )
+{
+    typename map_type::iterator it = blocks.find( address );
+    if( it != blocks.end() )
+    {
+        return it->second;
+    }
+
+    basic_block< proc_type >* block = translate( proc, address );
+    blocks[ address ] = block;
+
+    code_page& page = pages[ address >> 12 ];
+    if( page.starts.empty() )
+    {
+        page.lines = 0;
+    }
+    page.starts.push_back( address );
+    page.lines |= PageLines( address >> 12, address, BlockExtent( *block ) );
+
+    // Blocks never cross a page boundary
+    if( code != 0 )
+    {
+        code->mark( address );
+    }
+    return block;
+}
+
+
+template< typename proc_type >
+arm::basic_block< proc_type >*
+arm::block_cache< proc_type >::translate( proc_type& proc,
+                                          uint32_t address )
+{
+    basic_block< proc_type >* block = new basic_block< proc_type >;
+    block->address = address;
+    block->branch  = false;
+    block->next[0] = 0;
+    block->next[1] = 0;
+    block->executions = 0;
+    block->native     = 0;
+
+    uint32_t pc        = address;
+    uint32_t cond      = 0xE;
+    bool     set_flags = true;
+    do
+    {
+        predecoded_instr< proc_type > p =
+            PredecodeInstr< proc_type >( proc.iMem.read_word( pc ) );
+        p.address = pc;
+
+        if( p.encoding == Encoding_Unknown )
+        {
+            break;
+        }
+
+        // A run of instructions with the same condition is checked
+        // once, as long as none of them may set the flags
+        uint8_t check = basic_block< proc_type >::check_none;
+        if( p.cond != 0xE && p.cond != 0xF )
+        {
+            check = ( p.cond == cond && !set_flags ) ?
+                    basic_block< proc_type >::check_previous :
+                    basic_block< proc_type >::check_flags;
+            p.instr = ( p.instr & 0x0FFFFFFF ) | 0xE0000000;
+        }
+        cond      = p.cond;
+        set_flags = !p.simple || p.setflags;
+
+        block->instrs.push_back( p );
+        block->checks.push_back( check );
+
+        if( WritesPC( p.encoding, p.instr ) )
+        {
+            block->branch = true;
+            break;
+        }
+
+        pc += 4;
+    }
+    while( block->instrs.size() < basic_block< proc_type >::max_size &&
+           ( pc & 0xFFF ) != 0 );
+
+    return block;
+}
+
+
+template< typename proc_type >
+void arm::block_cache< proc_type >::invalidate( uint32_t address )
+{
+    invalidate( address, 4 );
+}
+
+
+template< typename proc_type >
+void arm::block_cache< proc_type >::invalidate( uint32_t address,
+                                               uint32_t size )
+{
+    if( size == 0 )
+    {
+        return;
+    }
+
+    // Blocks never cross a page boundary, so only the pages of the
+    // first and last bytes are searched
+    const uint32_t first = address >> 12;
+    const uint32_t last  = ( address + size - 1 ) >> 12;
+    invalidate_page( first, address, size );
+    if( last != first )
+    {
+        invalidate_page( last, address, size );
+    }
+}
+
+
+template< typename proc_type >
+void arm::block_cache< proc_type >::invalidate_page( uint32_t page,
+                                                    uint32_t address,
+                                                    uint32_t size )
+{
+    typename page_map::iterator pit = pages.find( page );
+    if( pit == pages.end() )
+    {
+        return;
+    }
+
+    // Writes to lines without instructions leave the blocks alone
+    code_page& p = pit->second;
+    if( ( p.lines & PageLines( page, address, size ) ) == 0 )
+    {
+        if( code != 0 )
+        {
+            code->mark( page << 12 );
+        }
+        return;
+    }
+
+    std::vector< uint32_t >& starts = p.starts;
+    p.lines = 0;
+    size_t i = 0;
+    while( i < starts.size() )
+    {
+        typename map_type::iterator it = blocks.find( starts[i] );
+        basic_block< proc_type >* block = it->second;
+        const uint32_t extent = BlockExtent( *block );
+
+        // Unsigned differences also handle ranges that wrap around
+        if( block->address - address < size ||
+            address - block->address < extent )
+        {
+            unlink( block );
+            retired.push_back( block );
+            blocks.erase( it );
+            starts[i] = starts.back();
+            starts.pop_back();
+        }
+        else
+        {
+            p.lines |= PageLines( page, block->address, extent );
+            ++i;
+        }
+    }
+
+    if( starts.empty() )
+    {
+        pages.erase( pit );
+    }
+    else if( code != 0 )
+    {
+        code->mark( page << 12 );
+    }
+}
+
+
+template< typename proc_type >
+void arm::block_cache< proc_type >::link( basic_block< proc_type >* from,
+                                         int k,
+                                         basic_block< proc_type >* to )
+{
+    basic_block< proc_type >* old = from->next[k];
+    if( old != 0 )
+    {
+        std::vector< basic_block< proc_type >* >& preds = old->preds;
+        *std::find( preds.begin(), preds.end(), from ) = preds.back();
+        preds.pop_back();
+    }
+
+    from->next[k] = to;
+    if( to != 0 )
+    {
+        to->preds.push_back( from );
+    }
+}
+
+
+template< typename proc_type >
+void arm::block_cache< proc_type >::unlink( basic_block< proc_type >* block )
+{
+    link( block, 0, 0 );
+    link( block, 1, 0 );
+
+    for( size_t i = 0; i < block->preds.size(); ++i )
+    {
+        basic_block< proc_type >* pred = block->preds[i];
+        if( pred->next[0] == block )
+        {
+            pred->next[0] = 0;
+        }
+        if( pred->next[1] == block )
+        {
+            pred->next[1] = 0;
+        }
+    }
+    block->preds.clear();
+}
+
+
+template< typename proc_type >
+void arm::block_cache< proc_type >::release()
+{
+    // A dropped block which was still running linked again when it
+    // ended
+    for( size_t i = 0; i < retired.size(); ++i )
+    {
+        unlink( retired[i] );
+    }
+    for( size_t i = 0; i < retired.size(); ++i )
+    {
+        delete retired[i];
+    }
+    retired.clear();
+}
+
+
+template< typename proc_type >
+void arm::block_cache< proc_type >::written( void* cache, uint32_t address,
+                                            uint32_t size )
+{
+    static_cast< block_cache* >( cache )->invalidate( address, size );
+}
+
+
+template< typename proc_type >
+void arm::block_cache< proc_type >::drop_native()
+{
+    typename map_type::iterator it;
+    for( it = blocks.begin(); it != blocks.end(); ++it )
+    {
+        it->second->native     = 0;
+        it->second->executions = 0;
+    }
+    for( size_t i = 0; i < retired.size(); ++i )
+    {
+        retired[i]->native = 0;
+    }
+}
+
+
+template< typename proc_type >
+void arm::block_cache< proc_type >::flush()
+{
+    typename map_type::iterator it;
+    for( it = blocks.begin(); it != blocks.end(); ++it )
+    {
+        delete it->second;
+    }
+
+    blocks.clear();
+    pages.clear();
+    release();
+
+    if( jit != 0 )
+    {
+        jit->reset();
+    }
+}
+
+
+template< typename proc_type >
+size_t arm::block_cache< proc_type >::size() const
+{
+    return blocks.size();
+}
+
+#endif // __ARMV7_BLOCK_IMPL_HPP__
@@ -0,0 +1,264 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "decoder.hpp"
+#include "function.hpp"
+#include "function_impl.hpp"
+
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+
+namespace {
+
+    const arm::EncodingPattern patterns[ arm::Encoding_Count ] =
+    {
+        { 0x00000000, 0x00000000 },
+#define ARMV7_ENCODING_PATTERN( name, mask, value ) { mask, value },
+        ARMV7_A1_ENCODINGS( ARMV7_ENCODING_PATTERN )
+#undef ARMV7_ENCODING_PATTERN
+    };
+
+    const char* const names[ arm::Encoding_Count ] =
+    {
+        "Unknown",
+#define ARMV7_ENCODING_NAME( name, mask, value ) #name,
+        ARMV7_A1_ENCODINGS( ARMV7_ENCODING_NAME )
+#undef ARMV7_ENCODING_NAME
+    };
+
+    const arm::EncodingPattern unallocated[] =
+    {
+#define ARMV7_UNALLOCATED_PATTERN( mask, value ) { mask, value },
+        ARMV7_A1_UNALLOCATED( ARMV7_UNALLOCATED_PATTERN )
+#undef ARMV7_UNALLOCATED_PATTERN
+    };
+
+
+    // Bits used to select a bucket: [27:20] and [7:4]. Bit 12 of the
+    // bucket index tells whether the condition field is '1111'.
+    const uint32_t key_mask    = 0x0FF000F0;
+    const uint32_t cond_mask   = 0xF0000000;
+    const uint32_t bucket_count = 2 << 12;
+
+    uint32_t BucketIndex( uint32_t instr )
+    {
+        uint32_t uncond = ( instr & cond_mask ) == cond_mask ? 1 : 0;
+        return ( uncond << 12 ) |
+               ( arm::Bits< 27, 20 >( instr ) << 4 ) |
+                 arm::Bits<  7,  4 >( instr );
+    }
+
+    // Builds a representative instruction word for a bucket index.
+    uint32_t BucketInstr( uint32_t index )
+    {
+        uint32_t cond = arm::Bits< 12, 12 >( index ) == 1 ? 0xF : 0xE;
+        return ( cond << 28 ) |
+               ( arm::Bits< 11, 4 >( index ) << 20 ) |
+               ( arm::Bits<  3, 0 >( index ) <<  4 );
+    }
+
+    struct Candidate
+    {
+        uint32_t      mask;
+        uint32_t      value;
+        arm::Encoding encoding;
+    };
+
+    bool MoreSpecific( const Candidate& a, const Candidate& b )
+    {
+        return arm::BitCount( a.mask ) > arm::BitCount( b.mask );
+    }
+
+    // An encoding may match instructions of a bucket if it agrees with
+    // the bucket on the key bits and on the kind of condition field.
+    bool MayMatch( const arm::EncodingPattern& p, uint32_t index )
+    {
+        const uint32_t instr = BucketInstr( index );
+        const bool uncond = ( p.mask & cond_mask ) == cond_mask &&
+                            ( p.value & cond_mask ) == cond_mask;
+
+        if( uncond != ( arm::Bits< 12, 12 >( index ) == 1 ) )
+        {
+            return false;
+        }
+
+        return ( ( instr ^ p.value ) & p.mask & key_mask ) == 0;
+    }
+
+    struct DecodeTable
+    {
+        uint32_t first[ bucket_count + 1 ];
+        std::vector< Candidate > candidates;
+
+        DecodeTable()
+        {
+            for( uint32_t i = 0; i < bucket_count; ++i )
+            {
+                std::vector< Candidate > bucket;
+
+                for( uint32_t e = 1; e < arm::Encoding_Count; ++e )
+                {
+                    if( MayMatch( patterns[e], i ) )
+                    {
+                        Candidate c = { patterns[e].mask, patterns[e].value,
+                                        static_cast< arm::Encoding >( e ) };
+                        bucket.push_back( c );
+                    }
+                }
+
+                for( uint32_t u = 0;
+                     u < sizeof( unallocated ) / sizeof( unallocated[0] );
+                     ++u )
+                {
+                    if( MayMatch( unallocated[u], i ) )
+                    {
+                        Candidate c = { unallocated[u].mask,
+                                        unallocated[u].value,
+                                        arm::Encoding_Unknown };
+                        bucket.push_back( c );
+                    }
+                }
+
+                std::stable_sort( bucket.begin(), bucket.end(),
+                                  MoreSpecific );
+
+                first[i] = candidates.size();
+                candidates.insert( candidates.end(),
+                                   bucket.begin(), bucket.end() );
+            }
+
+            first[ bucket_count ] = candidates.size();
+        }
+    };
+
+    const DecodeTable& GetDecodeTable()
+    {
+        static const DecodeTable table;
+        return table;
+    }
+
+} // namespace
+
+
+arm::Encoding arm::DecodeEncoding( uint32_t instr )
+{
+    const DecodeTable& table = GetDecodeTable();
+    const uint32_t index = BucketIndex( instr );
+
+    for( uint32_t i = table.first[ index ];
+         i < table.first[ index + 1 ]; ++i )
+    {
+        const Candidate& c = table.candidates[i];
+        if( ( instr & c.mask ) == c.value )
+        {
+            return c.encoding;
+        }
+    }
+
+    return Encoding_Unknown;
+}
+
+
+bool arm::WritesPC( Encoding encoding, uint32_t instr )
+{
+    switch( encoding )
+    {
+    case Encoding_B_A1:
+    case Encoding_BL_A1:
+    case Encoding_BLX_imm_A1:
+    case Encoding_BX_A1:
+    case Encoding_BLX_reg_A1:
+        return true;
+
+    // Data-processing instructions calling ALUWritePC() when Rd == 15
+    case Encoding_ADC_imm_A1:
+    case Encoding_ADC_reg_A1:
+    case Encoding_ADD_imm_A1:
+    case Encoding_ADD_reg_A1:
+    case Encoding_ADD_SP_imm_A1:
+    case Encoding_ADD_SP_reg_A1:
+    case Encoding_ADR_A1:
+    case Encoding_ADR_A2:
+    case Encoding_AND_imm_A1:
+    case Encoding_AND_reg_A1:
+    case Encoding_ASR_imm_A1:
+    case Encoding_BIC_imm_A1:
+    case Encoding_BIC_reg_A1:
+    case Encoding_EOR_imm_A1:
+    case Encoding_EOR_reg_A1:
+    case Encoding_LSL_imm_A1:
+    case Encoding_LSR_imm_A1:
+    case Encoding_MOV_imm_A1:
+    case Encoding_MOV_reg_A1:
+    case Encoding_MVN_imm_A1:
+    case Encoding_MVN_reg_A1:
+    case Encoding_ORR_imm_A1:
+    case Encoding_ORR_reg_A1:
+    case Encoding_ROR_IMM_A1:
+    case Encoding_RRX_A1:
+    case Encoding_RSB_IMM_A1:
+    case Encoding_RSB_REG_A1:
+    case Encoding_RSC_IMM_A1:
+    case Encoding_RSC_REG_A1:
+    case Encoding_SBC_IMM_A1:
+    case Encoding_SBC_REG_A1:
+    case Encoding_SUB_imm_A1:
+    case Encoding_SUB_reg_A1:
+        return Bits< 15, 12 >( instr ) == 15 && Bits< 20, 20 >( instr ) == 0;
+
+    // Loads calling LoadWritePC() when Rt == 15
+    case Encoding_LDR_imm_A1:
+    case Encoding_LDR_lit_A1:
+    case Encoding_LDR_reg_A1:
+    case Encoding_POP_A2:
+        return Bits< 15, 12 >( instr ) == 15;
+
+    // Loads calling LoadWritePC() when registers<15> == '1'
+    case Encoding_LDM_A1:
+    case Encoding_LDMDA_A1:
+    case Encoding_LDMDB_A1:
+    case Encoding_LDMIB_A1:
+    case Encoding_POP_A1:
+        return Bits< 15, 15 >( instr ) == 1;
+
+    default:
+        return false;
+    }
+}
+
+
+bool arm::MayWritePC( Encoding encoding )
+{
+    // Rd/Rt == 15, S == 0 and registers<15> == '1'
+    return WritesPC( encoding, 0xFFEFFFFF );
+}
+
+
+const arm::EncodingPattern& arm::GetEncodingPattern( Encoding encoding )
+{
+    assert( encoding < Encoding_Count && "Invalid encoding" );
+    return patterns[ encoding ];
+}
+
+
+const char* arm::EncodingName( Encoding encoding )
+{
+    assert( encoding < Encoding_Count && "Invalid encoding" );
+    return names[ encoding ];
+}
@@ -0,0 +1,406 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file defines a table-driven decoder for the ARM (A1) encodings
+ * implemented in instruction.hpp. Given a 32-bit instruction word, it
+ * returns the behavior function that implements it. All section and
+ * page numbers refer to the ARM Architecture Reference Manual (ARM v7-A
+ * and ARM v7-R edition) unless otherwise noted.
+ */
+
+#ifndef __ARMV7_DECODER_HPP__
+#define __ARMV7_DECODER_HPP__
+
+#include <boost/cstdint.hpp>
+
+/*
+ * Mask/value pairs of every implemented ARM encoding (A5, p.191). An
+ * instruction word "instr" matches an encoding if
+ * (instr & mask) == value. When several encodings match, the one with
+ * the most bits set in its mask wins, so special cases (literal forms,
+ * PUSH/POP, ...) only need to be more specific than the general form.
+ *
+ * Conditional encodings leave bits [31:28] out of their mask; the
+ * unconditional ones (cond == '1111') include them.
+ */
+
+#define ARMV7_A1_ENCODINGS( X )                                         \
+    /* Data-processing (immediate) (A5.2.3, p.199) */                   \
+    X( AND_imm_A1,           0x0FE00000, 0x02000000 )                   \
+    X( EOR_imm_A1,           0x0FE00000, 0x02200000 )                   \
+    X( SUB_imm_A1,           0x0FE00000, 0x02400000 )                   \
+    X( ADR_A2,               0x0FFF0000, 0x024F0000 )                   \
+    X( RSB_IMM_A1,           0x0FE00000, 0x02600000 )                   \
+    X( ADD_imm_A1,           0x0FE00000, 0x02800000 )                   \
+    X( ADR_A1,               0x0FFF0000, 0x028F0000 )                   \
+    X( ADD_SP_imm_A1,        0x0FEF0000, 0x028D0000 )                   \
+    X( ADC_imm_A1,           0x0FE00000, 0x02A00000 )                   \
+    X( SBC_IMM_A1,           0x0FE00000, 0x02C00000 )                   \
+    X( RSC_IMM_A1,           0x0FE00000, 0x02E00000 )                   \
+    X( TST_imm_A1,           0x0FF00000, 0x03100000 )                   \
+    X( TEQ_imm_A1,           0x0FF00000, 0x03300000 )                   \
+    X( CMP_imm_A1,           0x0FF00000, 0x03500000 )                   \
+    X( CMN_imm_A1,           0x0FF00000, 0x03700000 )                   \
+    X( ORR_imm_A1,           0x0FE00000, 0x03800000 )                   \
+    X( MOV_imm_A1,           0x0FE00000, 0x03A00000 )                   \
+    X( BIC_imm_A1,           0x0FE00000, 0x03C00000 )                   \
+    X( MVN_imm_A1,           0x0FE00000, 0x03E00000 )                   \
+    X( MOV_imm_A2,           0x0FF00000, 0x03000000 )                   \
+    X( MOVT_A1,              0x0FF00000, 0x03400000 )                   \
+    /* MSR (immediate) and hints (A5.2.11, p.206) */                    \
+    X( MSR_imm_A1,           0x0FB00000, 0x03200000 )                   \
+    X( NOP_A1,               0x0FFF00FF, 0x03200000 )                   \
+    /* Data-processing (register) (A5.2.1, p.197) */                    \
+    X( AND_reg_A1,           0x0FE00010, 0x00000000 )                   \
+    X( EOR_reg_A1,           0x0FE00010, 0x00200000 )                   \
+    X( SUB_reg_A1,           0x0FE00010, 0x00400000 )                   \
+    X( RSB_REG_A1,           0x0FE00010, 0x00600000 )                   \
+    X( ADD_reg_A1,           0x0FE00010, 0x00800000 )                   \
+    X( ADD_SP_reg_A1,        0x0FEF0010, 0x008D0000 )                   \
+    X( ADC_reg_A1,           0x0FE00010, 0x00A00000 )                   \
+    X( SBC_REG_A1,           0x0FE00010, 0x00C00000 )                   \
+    X( RSC_REG_A1,           0x0FE00010, 0x00E00000 )                   \
+    X( TST_reg_A1,           0x0FF00010, 0x01100000 )                   \
+    X( TEQ_reg_A1,           0x0FF00010, 0x01300000 )                   \
+    X( CMP_reg_A1,           0x0FF00010, 0x01500000 )                   \
+    X( CMN_reg_A1,           0x0FF00010, 0x01700000 )                   \
+    X( ORR_reg_A1,           0x0FE00010, 0x01800000 )                   \
+    X( MOV_reg_A1,           0x0FE00FF0, 0x01A00000 )                   \
+    X( LSL_imm_A1,           0x0FE00070, 0x01A00000 )                   \
+    X( LSR_imm_A1,           0x0FE00070, 0x01A00020 )                   \
+    X( ASR_imm_A1,           0x0FE00070, 0x01A00040 )                   \
+    X( RRX_A1,               0x0FE00FF0, 0x01A00060 )                   \
+    X( ROR_IMM_A1,           0x0FE00070, 0x01A00060 )                   \
+    X( BIC_reg_A1,           0x0FE00010, 0x01C00000 )                   \
+    X( MVN_reg_A1,           0x0FE00010, 0x01E00000 )                   \
+    /* Data-processing (register-shifted register) (A5.2.2, p.198) */   \
+    X( AND_rsr_A1,           0x0FE00090, 0x00000010 )                   \
+    X( EOR_rsr_A1,           0x0FE00090, 0x00200010 )                   \
+    X( SUB_sh_reg_A1,        0x0FE00090, 0x00400010 )                   \
+    X( RSB_REG_SHIFT_REG_A1, 0x0FE00090, 0x00600010 )                   \
+    X( ADD_rsr_A1,           0x0FE00090, 0x00800010 )                   \
+    X( ADC_rsr_A1,           0x0FE00090, 0x00A00010 )                   \
+    X( SBC_REG_SHIFT_REG_A1, 0x0FE00090, 0x00C00010 )                   \
+    X( RSC_REG_SHIFT_REG_A1, 0x0FE00090, 0x00E00010 )                   \
+    X( TST_sh_reg_A1,        0x0FF00090, 0x01100010 )                   \
+    X( TEQ_sh_reg_A1,        0x0FF00090, 0x01300010 )                   \
+    X( CMP_rsr_A1,           0x0FF00090, 0x01500010 )                   \
+    X( CMN_rsr_A1,           0x0FF00090, 0x01700010 )                   \
+    X( ORR_reg_shift_reg_A1, 0x0FE00090, 0x01800010 )                   \
+    X( LSL_reg_A1,           0x0FE000F0, 0x01A00010 )                   \
+    X( LSR_reg_A1,           0x0FE000F0, 0x01A00030 )                   \
+    X( ASR_reg_A1,           0x0FE000F0, 0x01A00050 )                   \
+    X( ROR_REG_A1,           0x0FE000F0, 0x01A00070 )                   \
+    X( BIC_rsr_A1,           0x0FE00090, 0x01C00010 )                   \
+    X( MVN_rsr_A1,           0x0FE00090, 0x01E00010 )                   \
+    /* Multiply and multiply-accumulate (A5.2.5, p.202) */              \
+    X( MUL_A1,               0x0FE000F0, 0x00000090 )                   \
+    X( MLA_A1,               0x0FE000F0, 0x00200090 )                   \
+    X( UMAAL_A1,             0x0FF000F0, 0x00400090 )                   \
+    X( MLS_A1,               0x0FF000F0, 0x00600090 )                   \
+    X( UMULL_A1,             0x0FE000F0, 0x00800090 )                   \
+    X( UMLAL_A1,             0x0FE000F0, 0x00A00090 )                   \
+    X( SMULL_A1,             0x0FE000F0, 0x00C00090 )                   \
+    X( SMLAL_A1,             0x0FE000F0, 0x00E00090 )                   \
+    /* Extra load/store instructions (A5.2.8, p.204) */                 \
+    X( STRH_reg_A1,          0x0E5000F0, 0x000000B0 )                   \
+    X( LDRH_reg_A1,          0x0E5000F0, 0x001000B0 )                   \
+    X( STRH_imm_A1,          0x0E5000F0, 0x004000B0 )                   \
+    X( LDRH_imm_A1,          0x0E5000F0, 0x005000B0 )                   \
+    X( LDRH_lit_A1,          0x0E5F00F0, 0x005F00B0 )                   \
+    X( LDRD_reg_A1,          0x0E5000F0, 0x000000D0 )                   \
+    X( LDRSB_reg_A1,         0x0E5000F0, 0x001000D0 )                   \
+    X( LDRD_imm_A1,          0x0E5000F0, 0x004000D0 )                   \
+    X( LDRD_lit_A1,          0x0E5F00F0, 0x004F00D0 )                   \
+    X( LDRSB_imm_A1,         0x0E5000F0, 0x005000D0 )                   \
+    X( LDRSB_lit_A1,         0x0E5F00F0, 0x005F00D0 )                   \
+    X( STRD_reg_A1,          0x0E5000F0, 0x000000F0 )                   \
+    X( LDRSH_reg_A1,         0x0E5000F0, 0x001000F0 )                   \
+    X( STRD_imm_A1,          0x0E5000F0, 0x004000F0 )                   \
+    X( LDRSH_imm_A1,         0x0E5000F0, 0x005000F0 )                   \
+    X( LDRSH_lit_A1,         0x0E5F00F0, 0x005F00F0 )                   \
+    /* Extra load/store instructions, unprivileged (A5.2.9, p.205) */   \
+    X( STRHT_A2,             0x0F7000F0, 0x002000B0 )                   \
+    X( LDRHT_A2,             0x0F7000F0, 0x003000B0 )                   \
+    X( STRHT_A1,             0x0F7000F0, 0x006000B0 )                   \
+    X( LDRHT_A1,             0x0F7000F0, 0x007000B0 )                   \
+    X( LDRSBT_A2,            0x0F7000F0, 0x003000D0 )                   \
+    X( LDRSBT_A1,            0x0F7000F0, 0x007000D0 )                   \
+    X( LDRSHT_A2,            0x0F7000F0, 0x003000F0 )                   \
+    X( LDRSHT_A1,            0x0F7000F0, 0x007000F0 )                   \
+    /* Synchronization primitives (A5.2.10, p.205) */                  \
+    X( STREX_A1,             0x0FF00FF0, 0x01800F90 )                   \
+    X( LDREX_A1,             0x0FF00FFF, 0x01900F9F )                   \
+    X( STREXD_A1,            0x0FF00FF0, 0x01A00F90 )                   \
+    X( LDREXD_A1,            0x0FF00FFF, 0x01B00F9F )                   \
+    X( STREXB_A1,            0x0FF00FF0, 0x01C00F90 )                   \
+    X( LDREXB_A1,            0x0FF00FFF, 0x01D00F9F )                   \
+    X( STREXH_A1,            0x0FF00FF0, 0x01E00F90 )                   \
+    X( LDREXH_A1,            0x0FF00FFF, 0x01F00F9F )                   \
+    /* Miscellaneous instructions (A5.2.12, p.207) */                   \
+    X( MRS_A1,               0x0FB000F0, 0x01000000 )                   \
+    X( MSR_reg_A1,           0x0FB000F0, 0x01200000 )                   \
+    X( BX_A1,                0x0FF000F0, 0x01200010 )                   \
+    X( BLX_reg_A1,           0x0FF000F0, 0x01200030 )                   \
+    X( CLZ_A1,               0x0FF000F0, 0x01600010 )                   \
+    /* Saturating addition and subtraction (A5.2.6, p.202) */           \
+    X( QADD_A1,              0x0FF000F0, 0x01000050 )                   \
+    X( QSUB_A1,              0x0FF000F0, 0x01200050 )                   \
+    X( QDADD_A1,             0x0FF000F0, 0x01400050 )                   \
+    X( QDSUB_A1,             0x0FF000F0, 0x01600050 )                   \
+    /* Halfword multiply and multiply-accumulate (A5.2.7, p.203) */     \
+    X( SMLAxy_A1,            0x0FF00090, 0x01000080 )                   \
+    X( SMLAWx_A1,            0x0FF000B0, 0x01200080 )                   \
+    X( SMULWx_A1,            0x0FF000B0, 0x012000A0 )                   \
+    X( SMLALxy_A1,           0x0FF00090, 0x01400080 )                   \
+    X( SMULxy_A1,            0x0FF00090, 0x01600080 )                   \
+    /* Load/store word and unsigned byte (A5.3, p.208) */               \
+    X( STR_imm_A1,           0x0E500000, 0x04000000 )                   \
+    X( STR_reg_A1,           0x0E500010, 0x06000000 )                   \
+    X( STRT_A1,              0x0F700000, 0x04200000 )                   \
+    X( STRT_A2,              0x0F700010, 0x06200000 )                   \
+    X( LDR_imm_A1,           0x0E500000, 0x04100000 )                   \
+    X( LDR_lit_A1,           0x0E5F0000, 0x041F0000 )                   \
+    X( LDR_reg_A1,           0x0E500010, 0x06100000 )                   \
+    X( LDRT_A1,              0x0F700000, 0x04300000 )                   \
+    X( LDRT_A2,              0x0F700010, 0x06300000 )                   \
+    X( STRB_imm_A1,          0x0E500000, 0x04400000 )                   \
+    X( STRB_reg_A1,          0x0E500010, 0x06400000 )                   \
+    X( STRBT_A1,             0x0F700000, 0x04600000 )                   \
+    X( STRBT_A2,             0x0F700010, 0x06600000 )                   \
+    X( LDRB_imm_A1,          0x0E500000, 0x04500000 )                   \
+    X( LDRB_lit_A1,          0x0E5F0000, 0x045F0000 )                   \
+    X( LDRB_reg_A1,          0x0E500010, 0x06500000 )                   \
+    X( LDRBT_A1,             0x0F700000, 0x04700000 )                   \
+    X( LDRBT_A2,             0x0F700010, 0x06700000 )                   \
+    X( PUSH_A2,              0x0FFF0FFF, 0x052D0004 )                   \
+    X( POP_A2,               0x0FFF0FFF, 0x049D0004 )                   \
+    /* Parallel addition and subtraction, signed (A5.4.1, p.210) */     \
+    X( SADD16_A1,            0x0FF000F0, 0x06100010 )                   \
+    X( SASX_A1,              0x0FF000F0, 0x06100030 )                   \
+    X( SSAX_A1,              0x0FF000F0, 0x06100050 )                   \
+    X( SSUB16_A1,            0x0FF000F0, 0x06100070 )                   \
+    X( SADD8_A1,             0x0FF000F0, 0x06100090 )                   \
+    X( SSUB8_A1,             0x0FF000F0, 0x061000F0 )                   \
+    X( QADD16_A1,            0x0FF000F0, 0x06200010 )                   \
+    X( QASX_A1,              0x0FF000F0, 0x06200030 )                   \
+    X( QSAX_A1,              0x0FF000F0, 0x06200050 )                   \
+    X( QSUB16_A1,            0x0FF000F0, 0x06200070 )                   \
+    X( QADD8_A1,             0x0FF000F0, 0x06200090 )                   \
+    X( QSUB8_A1,             0x0FF000F0, 0x062000F0 )                   \
+    X( SHADD16_A1,           0x0FF000F0, 0x06300010 )                   \
+    X( SHASX_A1,             0x0FF000F0, 0x06300030 )                   \
+    X( SHSAX_A1,             0x0FF000F0, 0x06300050 )                   \
+    X( SHSUB16_A1,           0x0FF000F0, 0x06300070 )                   \
+    X( SHADD8_A1,            0x0FF000F0, 0x06300090 )                   \
+    X( SHSUB8_A1,            0x0FF000F0, 0x063000F0 )                   \
+    /* Parallel addition and subtraction, unsigned (A5.4.2, p.211) */   \
+    X( UADD16_A1,            0x0FF000F0, 0x06500010 )                   \
+    X( UASX_A1,              0x0FF000F0, 0x06500030 )                   \
+    X( USAX_A1,              0x0FF000F0, 0x06500050 )                   \
+    X( USUB16_A1,            0x0FF000F0, 0x06500070 )                   \
+    X( UADD8_A1,             0x0FF000F0, 0x06500090 )                   \
+    X( USUB8_A1,             0x0FF000F0, 0x065000F0 )                   \
+    X( UQADD16_A1,           0x0FF000F0, 0x06600010 )                   \
+    X( UQASX_A1,             0x0FF000F0, 0x06600030 )                   \
+    X( UQSAX_A1,             0x0FF000F0, 0x06600050 )                   \
+    X( UQSUB16_A1,           0x0FF000F0, 0x06600070 )                   \
+    X( UQADD8_A1,            0x0FF000F0, 0x06600090 )                   \
+    X( UQSUB8_A1,            0x0FF000F0, 0x066000F0 )                   \
+    X( UHADD16_A1,           0x0FF000F0, 0x06700010 )                   \
+    X( UHASX_A1,             0x0FF000F0, 0x06700030 )                   \
+    X( UHSAX_A1,             0x0FF000F0, 0x06700050 )                   \
+    X( UHSUB16_A1,           0x0FF000F0, 0x06700070 )                   \
+    X( UHADD8_A1,            0x0FF000F0, 0x06700090 )                   \
+    X( UHSUB8_A1,            0x0FF000F0, 0x067000F0 )                   \
+    /* Packing, unpacking, saturation and reversal (A5.4.3, p.212) */   \
+    X( PKH_A1,               0x0FF00030, 0x06800010 )                   \
+    X( SXTAB16_A1,           0x0FF000F0, 0x06800070 )                   \
+    X( SXTB16_A1,            0x0FFF00F0, 0x068F0070 )                   \
+    X( SEL_A1,               0x0FF000F0, 0x068000B0 )                   \
+    X( SSAT_A1,              0x0FE00030, 0x06A00010 )                   \
+    X( SSAT16_A1,            0x0FF000F0, 0x06A00030 )                   \
+    X( SXTAB_A1,             0x0FF000F0, 0x06A00070 )                   \
+    X( SXTB_A1,              0x0FFF00F0, 0x06AF0070 )                   \
+    X( REV_A1,               0x0FF000F0, 0x06B00030 )                   \
+    X( SXTAH_A1,             0x0FF000F0, 0x06B00070 )                   \
+    X( SXTH_A1,              0x0FFF00F0, 0x06BF0070 )                   \
+    X( REV16_A1,             0x0FF000F0, 0x06B000B0 )                   \
+    X( UXTAB16_A1,           0x0FF000F0, 0x06C00070 )                   \
+    X( UXTB16_A1,            0x0FFF00F0, 0x06CF0070 )                   \
+    X( USAT_A1,              0x0FE00030, 0x06E00010 )                   \
+    X( USAT16_A1,            0x0FF000F0, 0x06E00030 )                   \
+    X( UXTAB_A1,             0x0FF000F0, 0x06E00070 )                   \
+    X( UXTB_A1,              0x0FFF00F0, 0x06EF0070 )                   \
+    X( RBIT_A1,              0x0FF000F0, 0x06F00030 )                   \
+    X( UXTAH_A1,             0x0FF000F0, 0x06F00070 )                   \
+    X( UXTH_A1,              0x0FFF00F0, 0x06FF0070 )                   \
+    X( REVSH_A1,             0x0FF000F0, 0x06F000B0 )                   \
+    /* Signed multiplies (A5.4.4, p.213) */                             \
+    X( SMLAD_A1,             0x0FF000D0, 0x07000010 )                   \
+    X( SMUAD_A1,             0x0FF0F0D0, 0x0700F010 )                   \
+    X( SMLSD_A1,             0x0FF000D0, 0x07000050 )                   \
+    X( SMUSD_A1,             0x0FF0F0D0, 0x0700F050 )                   \
+    X( SMLALD_A1,            0x0FF000D0, 0x07400010 )                   \
+    X( SMLSLD_A1,            0x0FF000D0, 0x07400050 )                   \
+    X( SMMLA_A1,             0x0FF000D0, 0x07500010 )                   \
+    X( SMMUL_A1,             0x0FF0F0D0, 0x0750F010 )                   \
+    X( SMMLS_A1,             0x0FF000D0, 0x075000D0 )                   \
+    /* Other media instructions (A5.4, p.209) */                        \
+    X( USAD8_A1,             0x0FF0F0F0, 0x0780F010 )                   \
+    X( USADA8_A1,            0x0FF000F0, 0x07800010 )                   \
+    X( SBFX_A1,              0x0FE00070, 0x07A00050 )                   \
+    X( BFC_A1,               0x0FE0007F, 0x07C0001F )                   \
+    X( BFI_A1,               0x0FE00070, 0x07C00010 )                   \
+    X( UBFX_A1,              0x0FE00070, 0x07E00050 )                   \
+    /* Branch, branch with link, and block data transfer (A5.5) */      \
+    X( STMDA_STMED_A1,       0x0FD00000, 0x08000000 )                   \
+    X( LDMDA_A1,             0x0FD00000, 0x08100000 )                   \
+    X( STM_STMIA_STMEA_A1,   0x0FD00000, 0x08800000 )                   \
+    X( LDM_A1,               0x0FD00000, 0x08900000 )                   \
+    X( POP_A1,               0x0FFF0000, 0x08BD0000 )                   \
+    X( STMDB_STMFD_A1,       0x0FD00000, 0x09000000 )                   \
+    X( PUSH_A1,              0x0FFF0000, 0x092D0000 )                   \
+    X( LDMDB_A1,             0x0FD00000, 0x09100000 )                   \
+    X( STMIB_STMFA_A1,       0x0FD00000, 0x09800000 )                   \
+    X( LDMIB_A1,             0x0FD00000, 0x09900000 )                   \
+    X( B_A1,                 0x0F000000, 0x0A000000 )                   \
+    X( BL_A1,                0x0F000000, 0x0B000000 )                   \
+    /* Unconditional instructions (A5.7, p.216) */                      \
+    X( SETEND_A1,            0xFFF100F0, 0xF1010000 )                   \
+    X( CLREX_A1,             0xFFFFFFFF, 0xF57FF01F )                   \
+    X( PLI_imm_lit_A1,       0xFF700000, 0xF4500000 )                   \
+    X( PLD_imm_A1,           0xFF300000, 0xF5100000 )                   \
+    X( PLD_lit_A1,           0xFF3F0000, 0xF51F0000 )                   \
+    X( PLI_reg_A1,           0xFF700010, 0xF6500000 )                   \
+    X( PLD_reg_A1,           0xFF300010, 0xF7100000 )                   \
+    X( BLX_imm_A1,           0xFE000000, 0xFA000000 )
+
+/*
+ * Encodings that decode to Encoding_Unknown even though they overlap
+ * one of the above: allocated encodings without a behavior function,
+ * and encodings whose behavior function needs system registers that
+ * armv7_core does not model.
+ */
+
+#define ARMV7_A1_UNALLOCATED( X )                                       \
+    /* YIELD, WFE, WFI, SEV and DBG hints (A5.2.11, p.206) */           \
+    X( 0x0FFF0000, 0x03200000 )                                         \
+    /* RFE_A1 needs SCTLR, SCR and NSACR (B6.1.10, p.1960) */           \
+    X( 0xFE500000, 0xF8100000 )
+
+
+namespace arm {
+
+
+    /**
+     * Identifiers of the ARM encodings known to the decoder. Each
+     * identifier is named after the behavior function that implements
+     * the encoding, e.g. Encoding_ADD_reg_A1 for ADD_reg_A1().
+     */
+    enum Encoding {
+        Encoding_Unknown,
+#define ARMV7_ENCODING_ENUM( name, mask, value ) Encoding_##name,
+        ARMV7_A1_ENCODINGS( ARMV7_ENCODING_ENUM )
+#undef ARMV7_ENCODING_ENUM
+        Encoding_Count
+    };
+
+
+    /**
+     * Mask/value pair describing one encoding.
+     */
+    struct EncodingPattern
+    {
+        uint32_t mask;
+        uint32_t value;
+    };
+
+
+    /**
+     * Result of decoding an instruction: the behavior function
+     * implementing it and its encoding identifier. The handler is null
+     * when the encoding is unknown.
+     */
+    template< typename proc_type >
+    struct DecodeResult
+    {
+        typedef void ( *handler_type )( proc_type&, uint32_t );
+
+        handler_type handler;
+        Encoding     encoding;
+    };
+
+
+    /**
+     * Returns the encoding of an ARM instruction. The lookup is done
+     * in two levels: bits [27:20] and [7:4] (and whether the condition
+     * is '1111') select a bucket holding the few encodings that can
+     * match, which are then tested most specific first.
+     */
+    Encoding DecodeEncoding( uint32_t instr );
+
+
+    /**
+     * Returns the behavior function and encoding identifier of an ARM
+     * instruction.
+     */
+    template< typename proc_type >
+    DecodeResult< proc_type > decode( uint32_t instr );
+
+
+    /**
+     * Returns the table of behavior functions indexed by Encoding.
+     */
+    template< typename proc_type >
+    const typename DecodeResult< proc_type >::handler_type*
+    EncodingHandlers();
+
+
+    /**
+     * Returns true if an instruction writes the PC when its condition
+     * passes: branches, data-processing instructions with Rd == PC and
+     * S == 0, and loads of the PC. Exception returns (S == 1 with
+     * Rd == PC) are not included since they are not implemented. Such
+     * instructions end a basic block.
+     */
+    bool WritesPC( Encoding encoding, uint32_t instr );
+
+
+    /**
+     * Returns true if some instructions of an encoding write the PC,
+     * i.e. if WritesPC() may return true for it.
+     */
+    bool MayWritePC( Encoding encoding );
+
+
+    /**
+     * Returns the mask/value pair of an encoding.
+     */
+    const EncodingPattern& GetEncodingPattern( Encoding encoding );
+
+
+    /**
+     * Returns the name of an encoding, e.g. "ADD_reg_A1".
+     */
+    const char* EncodingName( Encoding encoding );
+
+
+} // namespace arm
+
+#endif // __ARMV7_DECODER_HPP__
@@ -0,0 +1,52 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_DECODER_IMPL_HPP__
+#define __ARMV7_DECODER_IMPL_HPP__
+
+#include "decoder.hpp"
+#include "instruction.hpp"
+#include <boost/cstdint.hpp>
+
+
+template< typename proc_type >
+const typename arm::DecodeResult< proc_type >::handler_type*
+arm::EncodingHandlers()
+{
+    typedef typename DecodeResult< proc_type >::handler_type handler_type;
+
+    static const handler_type handlers[ Encoding_Count ] =
+    {
+        0,
+#define ARMV7_ENCODING_HANDLER( name, mask, value ) &arm::name< proc_type >,
+        ARMV7_A1_ENCODINGS( ARMV7_ENCODING_HANDLER )
+#undef ARMV7_ENCODING_HANDLER
+    };
+
+    return handlers;
+}
+
+
+template< typename proc_type >
+arm::DecodeResult< proc_type > arm::decode( uint32_t instr )
+{
+    DecodeResult< proc_type > result;
+    result.encoding = DecodeEncoding( instr );
+    result.handler  = EncodingHandlers< proc_type >()[ result.encoding ];
+    return result;
+}
+
+#endif // __ARMV7_DECODER_IMPL_HPP__
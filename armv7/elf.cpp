@@ -0,0 +1,246 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "elf.hpp"
+#include "memory_impl.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <elf.h>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace {
+
+    // Reads a structure of the file, which may be unaligned
+    template< typename data_type >
+    data_type Read( const uint8_t* base, size_t size, size_t offset,
+                    const std::string& path )
+    {
+        if( offset > size || size - offset < sizeof( data_type ) )
+        {
+            throw std::runtime_error( path + ": truncated ELF file" );
+        }
+
+        data_type data;
+        memcpy( &data, base + offset, sizeof( data ) );
+        return data;
+    }
+
+    // Writes "size" zeros at "addr" with the bulk write of the memory
+    template< typename mem_type >
+    void ZeroFill( mem_type& memory, uint32_t addr, size_t size )
+    {
+        static const uint8_t zeros[ 4096 ] = { 0 };
+
+        while( size > 0 )
+        {
+            const size_t n = std::min( size, sizeof( zeros ) );
+            memory.write( addr, zeros, n );
+            addr += n;
+            size -= n;
+        }
+    }
+
+}
+
+
+arm::elf_file::elf_file( const std::string& path )
+    : fd( -1 ), base( 0 ), size( 0 ), entry_point( 0 )
+{
+    struct stat st;
+    fd = open( path.c_str(), O_RDONLY );
+    if( fd < 0 || fstat( fd, &st ) != 0 || st.st_size == 0 )
+    {
+        if( fd >= 0 )
+        {
+            close( fd );
+        }
+        throw std::runtime_error( path + ": cannot read the file" );
+    }
+
+    size = st.st_size;
+    void* p = mmap( 0, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    if( p == MAP_FAILED )
+    {
+        close( fd );
+        throw std::runtime_error( path + ": cannot map the file" );
+    }
+    base = static_cast< const uint8_t* >( p );
+
+    try
+    {
+        parse( path );
+    }
+    catch( ... )
+    {
+        munmap( const_cast< uint8_t* >( base ), size );
+        close( fd );
+        throw;
+    }
+}
+
+
+arm::elf_file::~elf_file()
+{
+    munmap( const_cast< uint8_t* >( base ), size );
+    close( fd );
+}
+
+
+int arm::elf_file::descriptor() const
+{
+    return fd;
+}
+
+
+uint32_t arm::elf_file::entry() const
+{
+    return entry_point;
+}
+
+
+const std::vector< arm::elf_segment >& arm::elf_file::segments() const
+{
+    return segment_list;
+}
+
+
+const std::map< std::string, uint32_t >& arm::elf_file::symbols() const
+{
+    return symbol_table;
+}
+
+
+void arm::elf_file::parse( const std::string& path )
+{
+    const Elf32_Ehdr header = Read< Elf32_Ehdr >( base, size, 0, path );
+
+    if( memcmp( header.e_ident, ELFMAG, SELFMAG ) != 0 ||
+        header.e_ident[ EI_CLASS ] != ELFCLASS32 ||
+        header.e_ident[ EI_DATA ]  != ELFDATA2LSB ||
+        header.e_machine != EM_ARM || header.e_type != ET_EXEC )
+    {
+        throw std::runtime_error( path + ": not an ARM executable" );
+    }
+
+    entry_point = header.e_entry;
+
+    for( size_t i = 0; i < header.e_phnum; ++i )
+    {
+        const Elf32_Phdr ph = Read< Elf32_Phdr >(
+            base, size, header.e_phoff + i * header.e_phentsize, path );
+
+        if( ph.p_type != PT_LOAD || ph.p_memsz == 0 )
+        {
+            continue;
+        }
+        if( ph.p_offset > size || size - ph.p_offset < ph.p_filesz ||
+            ph.p_filesz > ph.p_memsz )
+        {
+            throw std::runtime_error( path + ": invalid segment" );
+        }
+
+        elf_segment segment;
+        segment.vaddr  = ph.p_vaddr;
+        segment.offset = ph.p_offset;
+        segment.filesz = ph.p_filesz;
+        segment.memsz  = ph.p_memsz;
+        segment.data   = base + ph.p_offset;
+        segment_list.push_back( segment );
+    }
+
+    // Symbols are optional: stripped files have none
+    for( size_t i = 0; header.e_shoff != 0 && i < header.e_shnum; ++i )
+    {
+        const Elf32_Shdr sh = Read< Elf32_Shdr >(
+            base, size, header.e_shoff + i * header.e_shentsize, path );
+
+        if( sh.sh_type != SHT_SYMTAB || sh.sh_link >= header.e_shnum )
+        {
+            continue;
+        }
+
+        const Elf32_Shdr strtab = Read< Elf32_Shdr >(
+            base, size, header.e_shoff + sh.sh_link * header.e_shentsize,
+            path );
+        if( strtab.sh_offset > size ||
+            size - strtab.sh_offset < strtab.sh_size )
+        {
+            throw std::runtime_error( path + ": invalid string table" );
+        }
+        const char* names = reinterpret_cast< const char* >(
+            base + strtab.sh_offset );
+
+        for( size_t s = 0; s < sh.sh_size / sizeof( Elf32_Sym ); ++s )
+        {
+            const Elf32_Sym sym = Read< Elf32_Sym >(
+                base, size, sh.sh_offset + s * sizeof( Elf32_Sym ), path );
+
+            if( sym.st_name == 0 || sym.st_name >= strtab.sh_size ||
+                sym.st_shndx == SHN_UNDEF )
+            {
+                continue;
+            }
+
+            const char* name = names + sym.st_name;
+            symbol_table[ std::string( name, strnlen(
+                name, strtab.sh_size - sym.st_name ) ) ] = sym.st_value;
+        }
+    }
+}
+
+
+void arm::LoadSegment( paged_mem& memory, const elf_file&,
+                       const elf_segment& segment )
+{
+    memory.write( segment.vaddr, segment.data, segment.filesz );
+    ZeroFill( memory, segment.vaddr + segment.filesz,
+              segment.memsz - segment.filesz );
+}
+
+
+void arm::LoadSegment( reserved_mem& memory, const elf_file& file,
+                       const elf_segment& segment )
+{
+    uint32_t mapped = 0;
+
+#ifdef ARMV7_RESERVED_MEM
+    // The whole host pages of the segment are mapped from the file,
+    // copy-on-write, and the rest is copied
+    const size_t   page = sysconf( _SC_PAGESIZE );
+    uint8_t* const host = memory.host_page( segment.vaddr ) +
+                          ( segment.vaddr & 0xFFF );
+    const size_t   size = segment.filesz & ~( page - 1 );
+
+    if( size > 0 && reinterpret_cast< uintptr_t >( host ) % page == 0 &&
+        segment.offset % page == 0 &&
+        mmap( host, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+              file.descriptor(), segment.offset ) != MAP_FAILED )
+    {
+        mapped = size;
+    }
+#endif
+
+    memory.write( segment.vaddr + mapped, segment.data + mapped,
+                  segment.filesz - mapped );
+    ZeroFill( memory, segment.vaddr + segment.filesz,
+              segment.memsz - segment.filesz );
+}
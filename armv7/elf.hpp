@@ -0,0 +1,122 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file declares a loader for ARM ELF executables, which places
+ * their loadable segments in guest memory.
+ */
+
+#ifndef __ARMV7_ELF_HPP__
+#define __ARMV7_ELF_HPP__
+
+#include "memory.hpp"
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace arm {
+
+
+    /**
+     * Loadable segment of an ELF file (PT_LOAD program header).
+     */
+    struct elf_segment
+    {
+        uint32_t       vaddr;   /// Guest address of the segment
+        uint32_t       offset;  /// Offset of its data in the file
+        uint32_t       filesz;  /// Bytes read from the file
+        uint32_t       memsz;   /// Bytes in memory, zeros after filesz
+        const uint8_t* data;    /// Its data in the mapped file
+    };
+
+
+    /**
+     * ARM ELF executable mapped read-only in host memory. The
+     * constructor throws std::runtime_error if the file cannot be
+     * read, or is not a 32-bit little-endian ARM executable.
+     */
+    class elf_file : boost::noncopyable
+    {
+    public:
+        explicit elf_file( const std::string& path );
+        ~elf_file();
+
+        int      descriptor() const;  /// Open file descriptor
+        uint32_t entry() const;       /// Entry point
+
+        const std::vector< elf_segment >& segments() const;
+
+        /// Values of the named symbols of the symbol table
+        const std::map< std::string, uint32_t >& symbols() const;
+
+    private:
+        void parse( const std::string& path );
+
+        int                               fd;
+        const uint8_t*                    base;
+        size_t                            size;
+        uint32_t                          entry_point;
+        std::vector< elf_segment >        segment_list;
+        std::map< std::string, uint32_t > symbol_table;
+    };
+
+
+    /**
+     * Entry point and symbol table of a loaded executable.
+     */
+    struct elf_image
+    {
+        uint32_t                          entry;
+        std::map< std::string, uint32_t > symbols;
+    };
+
+
+    /**
+     * Loads the PT_LOAD segments of the ARM ELF executable at "path"
+     * in "memory", and returns its entry point and symbols. Throws
+     * std::runtime_error if the file cannot be loaded.
+     *
+     * The segments are written by LoadSegment(), whose overloads
+     * avoid copying byte by byte: a reserved_mem maps the file
+     * directly where the segment and its file offset are aligned on
+     * host pages, and a paged_mem copies whole pages.
+     */
+    template< typename mem_type >
+    elf_image load_elf( const std::string& path, mem_type& memory );
+
+
+    /**
+     * Writes "segment" of "file" to "memory", followed by zeros up to
+     * its memory size. This version writes one byte at a time, and
+     * works with any memory type.
+     */
+    template< typename mem_type >
+    void LoadSegment( mem_type& memory, const elf_file& file,
+                      const elf_segment& segment );
+
+    void LoadSegment( paged_mem& memory, const elf_file& file,
+                      const elf_segment& segment );
+    void LoadSegment( reserved_mem& memory, const elf_file& file,
+                      const elf_segment& segment );
+
+
+} // namespace arm
+
+#endif // __ARMV7_ELF_HPP__
@@ -0,0 +1,53 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_ELF_IMPL_HPP__
+#define __ARMV7_ELF_IMPL_HPP__
+
+#include "elf.hpp"
+#include <boost/cstdint.hpp>
+#include <string>
+
+
+template< typename mem_type >
+arm::elf_image arm::load_elf( const std::string& path, mem_type& memory )
+{
+    const elf_file file( path );
+
+    for( size_t i = 0; i < file.segments().size(); ++i )
+    {
+        LoadSegment( memory, file, file.segments()[i] );
+    }
+
+    elf_image image;
+    image.entry   = file.entry();
+    image.symbols = file.symbols();
+    return image;
+}
+
+
+template< typename mem_type >
+void arm::LoadSegment( mem_type& memory, const elf_file&,
+                       const elf_segment& segment )
+{
+    for( uint32_t i = 0; i < segment.memsz; ++i )
+    {
+        memory.write_byte( segment.vaddr + i,
+                           i < segment.filesz ? segment.data[i] : 0 );
+    }
+}
+
+#endif // __ARMV7_ELF_IMPL_HPP__
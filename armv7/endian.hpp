@@ -0,0 +1,138 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file declares the data accesses of the load and store
+ * instructions, which reverse the bytes of halfwords and words when
+ * big-endian accesses are selected (BigEndian()). Memory types always
+ * hold little-endian data, as instructions are fetched.
+ *
+ * The profile of the processor fixes the endianness or lets CPSR.E
+ * select it (SETEND). When it is fixed, the test is resolved at
+ * compile time and little-endian accesses cost nothing.
+ *
+ * The accesses also check the alignment of the address, as MemA[]
+ * and MemU[] do (A3.2.1, p.108). An access that must be aligned but
+ * is not calls AlignmentFault(), and then goes on at the aligned
+ * address. Unaligned MemU[] accesses are passed to the memory as they
+ * are when the profile supports them and does not check alignment
+ * (SCTLR.A); both are compile-time constants, so that the check then
+ * costs nothing.
+ */
+
+#ifndef __ARMV7_ENDIAN_HPP__
+#define __ARMV7_ENDIAN_HPP__
+
+#include <boost/cstdint.hpp>
+
+namespace arm {
+
+
+    /**
+     * Reverses the byte order of a value
+     * (A2.5.3, p.51)
+     */
+    uint16_t BigEndianReverse( uint16_t value );
+    uint32_t BigEndianReverse( uint32_t value );
+
+
+    /**
+     * Called on a data access to "address" that must be aligned and
+     * is not. Aborts are not taken: this version does nothing, and
+     * the access is made at the aligned address. Processor types can
+     * provide their own overload, e.g. to stop the engine.
+     */
+    template< typename proc_type >
+    void AlignmentFault( proc_type& proc, uint32_t address );
+
+
+    /**
+     * Reads a halfword or a word of data at "address" from proc.dMem,
+     * in the selected endianness. These are unaligned accesses
+     * (MemU[]), used by LDR, LDRH and the like.
+     */
+    template< typename proc_type >
+    uint16_t MemReadHalf( proc_type& proc, uint32_t address );
+
+    template< typename proc_type >
+    uint32_t MemReadWord( proc_type& proc, uint32_t address );
+
+
+    /**
+     * Writes a halfword or a word of data at "address" to proc.dMem,
+     * in the selected endianness (MemU[]).
+     */
+    template< typename proc_type >
+    void MemWriteHalf( proc_type& proc, uint32_t address, uint16_t value );
+
+    template< typename proc_type >
+    void MemWriteWord( proc_type& proc, uint32_t address, uint32_t value );
+
+
+    /**
+     * Aligned accesses (MemA[]), used by the exclusives and RFE.
+     */
+    template< typename proc_type >
+    uint16_t MemAReadHalf( proc_type& proc, uint32_t address );
+
+    template< typename proc_type >
+    uint32_t MemAReadWord( proc_type& proc, uint32_t address );
+
+    template< typename proc_type >
+    void MemAWriteHalf( proc_type& proc, uint32_t address, uint16_t value );
+
+    template< typename proc_type >
+    void MemAWriteWord( proc_type& proc, uint32_t address, uint32_t value );
+
+
+    /**
+     * Checks the alignment of an aligned access of "size" bytes at
+     * "address", as MemA[] does, and returns the address it accesses.
+     * The store exclusives call it before claiming their granule, as
+     * ExclusiveMonitorsPass() does (A3.4.5, p.121), so that an
+     * AlignmentFault() that does not return leaves the global monitor
+     * unclaimed.
+     */
+    template< typename proc_type >
+    uint32_t MemAAlignedAddress( proc_type& proc, uint32_t address,
+                                 uint32_t size );
+
+
+    /**
+     * Reads "n" consecutive words at "address" with ReadWords(), each
+     * in the selected endianness. The address must be a multiple of
+     * "alignment" (MemA[]): 4 for LDM and LDRD, 8 for the doubleword
+     * of LDREXD.
+     */
+    template< typename proc_type >
+    void MemReadWords( proc_type& proc, uint32_t address, uint32_t* data,
+                       unsigned int n, uint32_t alignment = 4 );
+
+    /**
+     * Writes "n" consecutive words at "address" with WriteWords(),
+     * each in the selected endianness. "data" is reversed in place.
+     * The address must be a multiple of "alignment", as for
+     * MemReadWords().
+     */
+    template< typename proc_type >
+    void MemWriteWords( proc_type& proc, uint32_t address, uint32_t* data,
+                        unsigned int n, uint32_t alignment = 4 );
+
+
+} // namespace arm
+
+#endif // __ARMV7_ENDIAN_HPP__
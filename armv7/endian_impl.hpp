@@ -0,0 +1,224 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_ENDIAN_IMPL_HPP__
+#define __ARMV7_ENDIAN_IMPL_HPP__
+
+#include "endian.hpp"
+#include "function.hpp"
+#include "memory_impl.hpp"
+#include "profile.hpp"
+#include "types.hpp"
+#include <boost/cstdint.hpp>
+
+
+namespace arm {
+    namespace detail {
+
+        // Address of an unaligned access, after its alignment fault if
+        // it has one. Kept out of line, away from the aligned path.
+        template< typename proc_type >
+        ARMV7_COLD
+        uint32_t UnalignedAddress( proc_type& proc, uint32_t address,
+                                   uint32_t size, bool fault )
+        {
+            if( fault )
+            {
+                AlignmentFault( proc, address );
+            }
+            return Align( address, size );
+        }
+
+        // Address accessed by MemA[]
+        template< typename proc_type >
+        inline uint32_t MemAAddress( proc_type& proc, uint32_t address,
+                                     uint32_t size )
+        {
+            if( ARMV7_UNLIKELY( ( address & ( size - 1 ) ) != 0 ) )
+            {
+                return UnalignedAddress( proc, address, size, true );
+            }
+            return address;
+        }
+
+        // Address accessed by MemU[]: without unaligned support, the
+        // aligned address, which LDR then rotates (A3.2.1, p.108)
+        template< typename proc_type >
+        inline uint32_t MemUAddress( proc_type& proc, uint32_t address,
+                                     uint32_t size )
+        {
+            const bool check =
+                isa_profile< proc_type >::type::alignment_check;
+
+            if( ( check || !UnalignedSupport( proc ) ) &&
+                ARMV7_UNLIKELY( ( address & ( size - 1 ) ) != 0 ) )
+            {
+                return UnalignedAddress( proc, address, size, check );
+            }
+            return address;
+        }
+
+    }
+}
+
+
+inline uint16_t arm::BigEndianReverse( uint16_t value )
+{
+#ifdef __GNUC__
+    return __builtin_bswap16( value );
+#else
+    return (uint16_t)( ( value >> 8 ) | ( value << 8 ) );
+#endif
+}
+
+
+inline uint32_t arm::BigEndianReverse( uint32_t value )
+{
+#ifdef __GNUC__
+    return __builtin_bswap32( value );
+#else
+    value = ( ( value >> 8 ) & 0x00FF00FF ) | ( ( value & 0x00FF00FF ) << 8 );
+    return ( value >> 16 ) | ( value << 16 );
+#endif
+}
+
+
+template< typename proc_type >
+inline void arm::AlignmentFault( proc_type&, uint32_t )
+{
+}
+
+
+template< typename proc_type >
+inline uint16_t arm::MemReadHalf( proc_type& proc, uint32_t address )
+{
+    const uint16_t value =
+        proc.dMem.read_half( detail::MemUAddress( proc, address, 2 ) );
+    return BigEndian( proc ) ? BigEndianReverse( value ) : value;
+}
+
+
+template< typename proc_type >
+inline uint32_t arm::MemReadWord( proc_type& proc, uint32_t address )
+{
+    const uint32_t value =
+        proc.dMem.read_word( detail::MemUAddress( proc, address, 4 ) );
+    return BigEndian( proc ) ? BigEndianReverse( value ) : value;
+}
+
+
+template< typename proc_type >
+inline void arm::MemWriteHalf( proc_type& proc, uint32_t address,
+                               uint16_t value )
+{
+    proc.dMem.write_half( detail::MemUAddress( proc, address, 2 ),
+                          BigEndian( proc ) ? BigEndianReverse( value ) :
+                                              value );
+}
+
+
+template< typename proc_type >
+inline void arm::MemWriteWord( proc_type& proc, uint32_t address,
+                               uint32_t value )
+{
+    proc.dMem.write_word( detail::MemUAddress( proc, address, 4 ),
+                          BigEndian( proc ) ? BigEndianReverse( value ) :
+                                              value );
+}
+
+
+template< typename proc_type >
+inline uint16_t arm::MemAReadHalf( proc_type& proc, uint32_t address )
+{
+    const uint16_t value =
+        proc.dMem.read_half( detail::MemAAddress( proc, address, 2 ) );
+    return BigEndian( proc ) ? BigEndianReverse( value ) : value;
+}
+
+
+template< typename proc_type >
+inline uint32_t arm::MemAReadWord( proc_type& proc, uint32_t address )
+{
+    const uint32_t value =
+        proc.dMem.read_word( detail::MemAAddress( proc, address, 4 ) );
+    return BigEndian( proc ) ? BigEndianReverse( value ) : value;
+}
+
+
+template< typename proc_type >
+inline void arm::MemAWriteHalf( proc_type& proc, uint32_t address,
+                                uint16_t value )
+{
+    proc.dMem.write_half( detail::MemAAddress( proc, address, 2 ),
+                          BigEndian( proc ) ? BigEndianReverse( value ) :
+                                              value );
+}
+
+
+template< typename proc_type >
+inline void arm::MemAWriteWord( proc_type& proc, uint32_t address,
+                                uint32_t value )
+{
+    proc.dMem.write_word( detail::MemAAddress( proc, address, 4 ),
+                          BigEndian( proc ) ? BigEndianReverse( value ) :
+                                              value );
+}
+
+
+template< typename proc_type >
+inline uint32_t arm::MemAAlignedAddress( proc_type& proc, uint32_t address,
+                                         uint32_t size )
+{
+    return detail::MemAAddress( proc, address, size );
+}
+
+
+template< typename proc_type >
+inline void arm::MemReadWords( proc_type& proc, uint32_t address,
+                               uint32_t* data, unsigned int n,
+                               uint32_t alignment )
+{
+    ReadWords( proc.dMem, detail::MemAAddress( proc, address, alignment ),
+               data, n );
+
+    if( BigEndian( proc ) )
+    {
+        for( unsigned int i = 0; i < n; ++i )
+        {
+            data[i] = BigEndianReverse( data[i] );
+        }
+    }
+}
+
+
+template< typename proc_type >
+inline void arm::MemWriteWords( proc_type& proc, uint32_t address,
+                                uint32_t* data, unsigned int n,
+                                uint32_t alignment )
+{
+    if( BigEndian( proc ) )
+    {
+        for( unsigned int i = 0; i < n; ++i )
+        {
+            data[i] = BigEndianReverse( data[i] );
+        }
+    }
+
+    WriteWords( proc.dMem, detail::MemAAddress( proc, address, alignment ),
+                data, n );
+}
+
+#endif // __ARMV7_ENDIAN_IMPL_HPP__
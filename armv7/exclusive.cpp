@@ -0,0 +1,163 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "exclusive.hpp"
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+
+
+namespace {
+
+    const uint32_t tag_count = 1024;
+
+    // Each tag has its own cache line, so that cores using different
+    // granules do not contend
+    struct alignas( 64 ) granule_tag
+    {
+        boost::atomic< uint32_t > value;
+    };
+
+    granule_tag tags[ tag_count ];
+
+    // Tag claimed by the store exclusive running on this thread, or
+    // tag_count
+    thread_local uint32_t claimed = tag_count;
+
+    uint32_t TagIndex( uint32_t address )
+    {
+        return ( address / arm::ExclusiveGranuleSize ) % tag_count;
+    }
+
+    boost::atomic< uint32_t >& Tag( uint32_t address )
+    {
+        return tags[ TagIndex( address ) ].value;
+    }
+
+    // Calls f with the index of each tag of the granules of "size"
+    // bytes at "address", once each and in increasing order, so that
+    // threads holding several tags take them in the same order. The
+    // range is computed in 64 bits, since it may end past 4 GB.
+    void ForEachTag( uint32_t address, uint32_t size,
+                     void ( *f )( uint32_t ) )
+    {
+        if( size == 0 )
+        {
+            return;
+        }
+
+        const uint64_t first = address / arm::ExclusiveGranuleSize;
+        const uint64_t last  = ( uint64_t( address ) + size - 1 ) /
+                               arm::ExclusiveGranuleSize;
+        const uint64_t count = std::min< uint64_t >( last - first + 1,
+                                                     tag_count );
+        const uint64_t start = first % tag_count;
+
+        // Tags that wrap around the end of the table come first
+        for( uint64_t i = 0; i + tag_count < start + count; ++i )
+        {
+            f( uint32_t( i ) );
+        }
+        for( uint64_t i = start;
+             i < std::min< uint64_t >( start + count, tag_count ); ++i )
+        {
+            f( uint32_t( i ) );
+        }
+    }
+
+    // Adding 2 leaves a claimed tag odd
+    void ClearTag( uint32_t i )
+    {
+        tags[i].value.fetch_add( 2, boost::memory_order_release );
+    }
+
+    void HoldTag( uint32_t i )
+    {
+        if( i == claimed )
+        {
+            return;
+        }
+
+        boost::atomic< uint32_t >& tag = tags[i].value;
+        uint32_t value = tag.load( boost::memory_order_relaxed );
+        while( ( value & 1 ) ||
+               !tag.compare_exchange_weak( value, value + 1,
+                                           boost::memory_order_acquire ) )
+        {
+            value = tag.load( boost::memory_order_relaxed );
+        }
+    }
+
+    void ReleaseTag( uint32_t i )
+    {
+        if( i != claimed )
+        {
+            tags[i].value.fetch_add( 1, boost::memory_order_release );
+        }
+    }
+
+}
+
+
+uint32_t arm::ExclusiveTagMark( uint32_t address )
+{
+    boost::atomic< uint32_t >& tag = Tag( address );
+
+    uint32_t value = tag.load( boost::memory_order_acquire );
+    while( value & 1 )
+    {
+        value = tag.load( boost::memory_order_acquire );
+    }
+    return value;
+}
+
+
+bool arm::ExclusiveTagClaim( uint32_t address, uint32_t tag )
+{
+    if( !Tag( address ).compare_exchange_strong(
+            tag, tag + 1, boost::memory_order_acquire ) )
+    {
+        return false;
+    }
+    claimed = TagIndex( address );
+    return true;
+}
+
+
+void arm::ExclusiveTagRelease( uint32_t address )
+{
+    claimed = tag_count;
+    Tag( address ).fetch_add( 1, boost::memory_order_release );
+}
+
+
+void arm::ClearExclusiveByAddress( uint32_t address, uint32_t size )
+{
+    ForEachTag( address, size, ClearTag );
+}
+
+
+void arm::ExclusiveHoldByAddress( uint32_t address, uint32_t size )
+{
+    ForEachTag( address, size, HoldTag );
+}
+
+
+void arm::ExclusiveReleaseByAddress( uint32_t address, uint32_t size )
+{
+    ForEachTag( address, size, ReleaseTag );
+}
@@ -0,0 +1,131 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file declares the exclusive monitors used by the
+ * synchronization primitives (A3.4, p.114).
+ *
+ * Each core has a local monitor (armv7_core::Monitor). The global
+ * monitor, shared by all cores and host threads, is a table of tags
+ * indexed by reservation granule. A tag is even when the granule is
+ * idle and odd while a store exclusive writes to it, and it grows
+ * whenever the granule is written. A load exclusive records the tag
+ * of its granule, and the matching store exclusive only passes if it
+ * can change that same tag to odd with a compare-and-swap, so that
+ * contended granules never take a lock. Granules that share a tag may
+ * make a store exclusive fail, which the architecture allows.
+ */
+
+#ifndef __ARMV7_EXCLUSIVE_HPP__
+#define __ARMV7_EXCLUSIVE_HPP__
+
+#include <boost/cstdint.hpp>
+
+namespace arm {
+
+
+    /**
+     * Size of a reservation granule, in bytes: the smallest one
+     * allowed, which holds the doubleword of LDREXD and STREXD.
+     * (A3.4.5, p.121)
+     */
+    const uint32_t ExclusiveGranuleSize = 8;
+
+
+    /**
+     * Returns the tag of the granule of "address", after waiting for
+     * any store exclusive to it to complete.
+     */
+    uint32_t ExclusiveTagMark( uint32_t address );
+
+
+    /**
+     * Makes the tag of the granule of "address" odd if it is still
+     * "tag". Returns false if it has changed.
+     */
+    bool ExclusiveTagClaim( uint32_t address, uint32_t tag );
+
+
+    /**
+     * Makes the tag claimed by ExclusiveTagClaim() even again.
+     */
+    void ExclusiveTagRelease( uint32_t address );
+
+
+    /**
+     * Clears the global monitor for the granules of "size" bytes at
+     * "address", so that the store exclusive of any core that marked
+     * them fails. It does not order a store with the store exclusives
+     * of the other cores; see ExclusiveHoldByAddress().
+     */
+    void ClearExclusiveByAddress( uint32_t address, uint32_t size );
+
+
+    /**
+     * Holds the granules of "size" bytes at "address" for an ordinary
+     * store, as a store exclusive holds its own: waits until no other
+     * store writes to them and makes their tags odd. The store must
+     * be followed by ExclusiveReleaseByAddress(), after which the
+     * store exclusive of any core that marked them fails. Memory
+     * types shared between cores call them around every store, so
+     * that a store exclusive cannot overwrite it with a stale value.
+     *
+     * A granule claimed by the store exclusive running on the calling
+     * thread is already held, so that the store exclusive can write
+     * through such a memory.
+     */
+    void ExclusiveHoldByAddress( uint32_t address, uint32_t size );
+
+
+    /**
+     * Releases the granules held by ExclusiveHoldByAddress().
+     */
+    void ExclusiveReleaseByAddress( uint32_t address, uint32_t size );
+
+
+    /**
+     * Marks the granule of "address" for the core.
+     * (A3.4.1, p.114)
+     */
+    template< typename proc_type >
+    void SetExclusiveMonitors( proc_type& proc, uint32_t address,
+                               uint32_t size );
+
+
+    /**
+     * Returns true if the core marked the granule of "address" and no
+     * store has been made to it since then. The store exclusive must
+     * then write memory and call ClearExclusiveLocal(), which makes
+     * the granule available to the other cores again.
+     * (A3.4.1, p.114)
+     */
+    template< typename proc_type >
+    bool ExclusiveMonitorsPass( proc_type& proc, uint32_t address,
+                                uint32_t size );
+
+
+    /**
+     * Sets the local monitor of the core to the Open Access state.
+     * (A3.4.1, p.114)
+     */
+    template< typename proc_type >
+    void ClearExclusiveLocal( proc_type& proc );
+
+
+} // namespace arm
+
+#endif // __ARMV7_EXCLUSIVE_HPP__
@@ -0,0 +1,64 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_EXCLUSIVE_IMPL_HPP__
+#define __ARMV7_EXCLUSIVE_IMPL_HPP__
+
+#include "exclusive.hpp"
+#include "processor.hpp"
+#include <boost/cstdint.hpp>
+
+
+template< typename proc_type >
+void arm::SetExclusiveMonitors( proc_type& proc, uint32_t address,
+                                uint32_t )
+{
+    ClearExclusiveLocal( proc );
+
+    proc.Monitor.address = address & ~( ExclusiveGranuleSize - 1 );
+    proc.Monitor.tag     = ExclusiveTagMark( address );
+    proc.Monitor.state   = ExclusiveState_Exclusive;
+}
+
+
+template< typename proc_type >
+bool arm::ExclusiveMonitorsPass( proc_type& proc, uint32_t address,
+                                 uint32_t )
+{
+    if( proc.Monitor.state != ExclusiveState_Exclusive ||
+        proc.Monitor.address != ( address & ~( ExclusiveGranuleSize - 1 ) ) ||
+        !ExclusiveTagClaim( address, proc.Monitor.tag ) )
+    {
+        proc.Monitor.state = ExclusiveState_Open;
+        return false;
+    }
+
+    proc.Monitor.state = ExclusiveState_Storing;
+    return true;
+}
+
+
+template< typename proc_type >
+void arm::ClearExclusiveLocal( proc_type& proc )
+{
+    if( proc.Monitor.state == ExclusiveState_Storing )
+    {
+        ExclusiveTagRelease( proc.Monitor.address );
+    }
+    proc.Monitor.state = ExclusiveState_Open;
+}
+
+#endif // __ARMV7_EXCLUSIVE_IMPL_HPP__
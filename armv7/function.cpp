@@ -20,41 +20,45 @@
 
 #include <boost/cstdint.hpp>
 #include <cassert>
-#include <cmath>
 
 
 
-uint32_t arm::Bits( uint32_t s, uint32_t b1, uint32_t b0 )
-{
-    assert( b1 >= b0 );
-    assert( b1 <= 31 );
-    return ( s & ( 0xFFFFFFFF >> ( 31 - b1 ) ) ) >> b0;
-}
-
-
-uint64_t arm::Bits64( uint64_t s, uint64_t b1, uint64_t b0 )
-{
-    assert( b1 >= b0 );
-    assert( b1 <= 63 );
-    return ( s & ( 0xFFFFFFFFFFFFFFFFLL >> ( 63 - b1 ) ) ) >> b0;
-}
-
-
 arm::UValueCarry arm::ARMExpandImm_C( uint32_t imm12, bool carry_in )
 {
     uint64_t unrotated_value = ZeroExtend( (uint64_t)( Bits( imm12, 7, 0 ) ) );
     UValueCarry value = Shift_C( (uint32_t) unrotated_value, SRType_ROR,
-                                 2*UInt( Bits( imm12, 11, 8 ) ), carry_in );
+                                 2*UInt( Bits< 11, 8 >( imm12 ) ), carry_in );
     return value;
 }
 
 
 int arm::CurrentCond( uint32_t instr )
 {
-    return Bits( instr, 31, 28 );
+    return Bits< 31, 28 >( instr );
 }
 
 
+const uint16_t arm::ConditionTable[16] =
+{
+    0xF0F0, // EQ: Z
+    0x0F0F, // NE: !Z
+    0xCCCC, // CS: C
+    0x3333, // CC: !C
+    0xFF00, // MI: N
+    0x00FF, // PL: !N
+    0xAAAA, // VS: V
+    0x5555, // VC: !V
+    0x0C0C, // HI: C && !Z
+    0xF3F3, // LS: !C || Z
+    0xAA55, // GE: N == V
+    0x55AA, // LT: N != V
+    0x0A05, // GT: !Z && N == V
+    0xF5FA, // LE: Z || N != V
+    0xFFFF, // AL
+    0xFFFF  // Unconditional instructions
+};
+
+
 arm::ShiftUValue arm::DecodeImmShift( uint32_t type, uint32_t imm5 )
 {
     SRType   shift_t;
@@ -134,13 +138,13 @@ arm::SRType arm::DecodeRegShift( uint32_t type )
 
 bool arm::HaveSecurityExt()
 {
-    return false;
+    return armv7a_profile::security_ext;
 }
 
 
 bool arm::HaveMPExt()
 {
-    return false;
+    return armv7a_profile::mp_ext;
 }
 
 
@@ -177,275 +181,6 @@ bool arm::IsZero( uint64_t x )
 }
 
 
-/* 
- * Shift operations are performed on 32 bits, if 64 bit versions are
- * necessary, they can be added here.
- */
-
-// ARM's "pseudo-C" implementations of "_C" shift functions are not
-// closely followed here since they make use of a lot of non-C
-// constructs.
-
-arm::UValueCarry arm::LSL_C( uint32_t value, int amount )
-{
-    assert( amount != 0 );
-
-    const uint32_t highestBitMask = 0x80000000;
-    UValueCarry result;
-    result.value = value << ( amount - 1 );
-    result.carry = ( result.value & highestBitMask ) != 0;
-    result.value = result.value << 1;
-    return result;
-}
-
-
-arm::UValueCarry arm::LSR_C( uint32_t value, int amount )
-{
-    assert( amount != 0 );
-
-    const uint32_t lowestBitMask = 0x1;
-    UValueCarry result;
-    result.value = value >> ( amount - 1 );
-    result.carry = ( result.value & lowestBitMask ) != 0;
-    result.value = result.value >> 1;
-    return result;
-}
-    
-
-arm::UValueCarry arm::ASR_C( uint32_t value, int amount )
-{
-    assert( amount != 0 );
-
-    UValueCarry result;
-    bool signBit = Bits( value, 31, 31 ) == 1;
-
-    // Build a mask to set all "new" leftmost bits to the initial sign
-    // bit value.
-    uint32_t shiftMask = 0;
-    for ( int i = 0; i < amount; ++i )
-    {
-        shiftMask |= ( 0x80000000 >> i );
-    }
-
-    shiftMask = signBit ? shiftMask : (~shiftMask);
-
-    result.value = value >> ( amount - 1 );
-
-    result.carry = Bits( result.value, 0, 0 ) == 1;
-    result.value = result.value >> 1;
-
-    if( signBit )
-    {
-        result.value |= shiftMask;
-    }
-
-    return result;
-}
-
-
-arm::UValueCarry arm::ROR_C( uint32_t value, int amount )
-{
-    assert( amount != 0 );
-
-    const uint32_t N = sizeof( value ) * 8;
-    const uint32_t m = amount % N;
-
-    UValueCarry result;
-    result.value = LSR( value, m ) | LSL ( value, N - m );
-    result.carry = Bits( result.value, N-1, N-1 );
-
-    return result;
-}
-
-
-arm::UValueCarry arm::RRX_C( uint32_t value, bool carry_in )
-{
-    const uint32_t lowestBitMask = 0x1;
-    const uint32_t highestBitMask = 0x80000000;
-
-    UValueCarry result;
-    result.carry = ( lowestBitMask & value ) != 0;
-    result.value = value >> 1;
-
-    if ( carry_in )
-    {
-        result.value |= highestBitMask;
-    }
-                     
-    return result;
-}
-
-
-arm::UValueCarry arm::Shift_C( uint32_t value, SRType type,
-                               int amount, bool carry_in )
-{
-    assert( !( type == SRType_RRX && amount != 1) && (amount >= 0) );
-
-    if( amount == 0 )
-    {
-        UValueCarry result;
-        result.value = value;
-        return result;
-    }
-        
-    switch ( type )
-    {
-    case SRType_LSL:
-        return LSL_C( value, amount );
-    case SRType_LSR:
-        return LSR_C( value, amount );
-    case SRType_ASR:
-        return ASR_C( value, amount );
-    case SRType_ROR:
-        return ROR_C( value, amount );
-    case SRType_RRX:
-        return RRX_C( value, carry_in );
-    default:
-        assert( "Invalid shift register type in shift operation" && false );
-    }
-}
-
-
-uint32_t arm::Shift( uint32_t value, SRType type, int amount, bool carry_in )
-{
-    return ( Shift_C( value, type, amount, carry_in ) ).value;
-}
-
-
-uint32_t arm::LSL( uint32_t value, int amount )
-{
-    assert ( amount >= 0 );
-    if ( amount == 0 )
-    {
-        return value;
-    }
-    else
-    {
-        return ( LSL_C( value, amount ) ).value;
-    }
-}
-
-
-uint32_t arm::LSR( uint32_t value, int amount )
-{
-    assert ( amount >= 0 );
-    if ( amount == 0 )
-    {
-        return value;
-    }
-    else
-    {
-        return ( LSR_C( value, amount ) ).value;
-    }
-}
-
-
-uint32_t arm::ASR( uint32_t value, int amount )
-{
-    assert ( amount >= 0 );
-    if ( amount == 0 )
-    {
-        return value;
-    }
-    else
-    {
-        return ( ASR_C( value, amount ) ).value;
-    }
-}
-
-
-uint32_t arm::ROR( uint32_t value, int amount )
-{
-    assert ( amount >= 0 );
-    if ( amount == 0 )
-    {
-        return value;
-    }
-    else
-    {
-        return ( ROR_C( value, amount ) ).value;
-    }
-}
-
-
-uint32_t arm::RRX( uint32_t value, bool carry_in )
-{
-    return ( RRX_C( value, carry_in ) ).value;
-}
-
-
-uint32_t arm::Align( uint32_t value, uint32_t align )
-{
-    assert( align != 0 && ( align % 2 == 0 ) && "Invalid align value" );
-
-    int n = (int)(log2(align));
-    uint32_t mask = 0xFFFFFFFF << n;
-    return value & mask;
-}
-
-
-arm::ValueSat arm::SignedSatQ( int64_t i, unsigned int N )
-{
-    assert( N < 64 && "Saturation of 64+ bit values is not supported" );
-    int64_t maxValue = pow( 2, N-1 );
-
-    ValueSat result;
-
-    if ( i > maxValue - 1 )
-    {
-        result.value = maxValue - 1;
-        result.saturated = true;
-    }
-    else if ( i < -maxValue )
-    {
-        result.value = -maxValue;
-        result.saturated = true;
-    }
-    else
-    {
-        result.value = i;
-    }
-    return result;
-}
-
-
-arm::UValueSat arm::UnsignedSatQ( int64_t i, unsigned int N )
-{
-    assert( N < 63 &&
-            "Unsigned saturation of 63+ bit values is not supported" );
-    int64_t maxValue = pow( 2, N ) - 1;
-
-    UValueSat result;
-
-    if ( i > maxValue )
-    {
-        result.value = (uint64_t)maxValue;
-        result.saturated = true;
-    }
-    else if ( i < 0 )
-    {
-        result.value = (uint64_t)0;
-        result.saturated = true;
-    }
-    else
-    {
-        result.value = (uint64_t)i;
-    }
-    return result;
-}
-
-
-int64_t arm::SignedSat( int64_t i, unsigned int N )
-{
-    return ( SignedSatQ( i, N ) ).value;
-}
-    
-
-uint64_t arm::UnsignedSat( int64_t i, unsigned int N )
-{
-    return ( UnsignedSatQ( i, N ) ).value;
-}
-
 // While uint => uint conversion is a no-op, int => uint conversion
 // must be done before any sign extension happens (such as when
 // converting a signed value to a wider data type).
@@ -468,26 +203,9 @@ int64_t arm::SInt( int64_t  x ) { return static_cast< int64_t >( x ); }
 int64_t arm::SInt( uint64_t x ) { return static_cast< int64_t >( x ); }
 
 
-int arm::LowestSetBit( unsigned int x )
-{
-    int N = sizeof(x) * 8;
-    unsigned int toCompare = 0x1;
-        
-    for (int i = 0; i < N; ++i)
-    {
-        if( (x & (toCompare << i)) !=0 )
-        {
-            return i;
-        }
-    }
-        
-    return N;
-}
-
-
 int arm::ArchVersion()
 {
-    return 7;
+    return armv7a_profile::arch_version;
 }
 
     
@@ -497,7 +215,7 @@ arm::MemArch arm::MemorySystemArchitecture()
     // Memory System Architecture (VMSA)
     // (B2.1.1, p.1236)
         
-    return MemArch_VMSA;
+    return armv7a_profile::memory_arch;
 }
 
 // In C++, unsigned values are automatically zero-extended. Therefore,
@@ -543,7 +261,7 @@ uint64_t arm::SignExtend( uint64_t bitstring, int newSize, int oldSize  )
 
 bool arm::UnalignedSupport()
 {
-    return true;
+    return armv7a_profile::unaligned_support;
 }
 
 uint32_t arm::CountLeadingZeroBits(uint32_t x)
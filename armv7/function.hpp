@@ -26,6 +26,7 @@
 #ifndef __ARMV7_FUNCTION_HPP__
 #define __ARMV7_FUNCTION_HPP__
 
+#include "processor.hpp"
 #include "types.hpp"
 #include <boost/cstdint.hpp>
 
@@ -49,7 +50,16 @@ namespace arm {
      * @param b0 rightmost bit
      * @return   a new bit string with bits b1:b0 at the end
      */
-    uint32_t Bits( uint32_t s, uint32_t b1, uint32_t b0 );
+    constexpr uint32_t Bits( uint32_t s, uint32_t b1, uint32_t b0 );
+
+    /**
+     * Extracts bits hi:lo of a bit string. The mask and shift are
+     * constants and the range is checked at compile time.
+     * @param s  original bit string
+     * @return   a new bit string with bits hi:lo at the end
+     */
+    template< unsigned int hi, unsigned int lo >
+    constexpr uint32_t Bits( uint32_t s );
 
     /**
      * Extracts bits b1:b0 of a 64-bit bit string.
@@ -58,7 +68,13 @@ namespace arm {
      * @param b0 rightmost bit
      * @return   a new bit string with bits b1:b0 at the end
      */
-    uint64_t Bits64( uint64_t s, uint64_t b1, uint64_t b0 );
+    constexpr uint64_t Bits64( uint64_t s, uint64_t b1, uint64_t b0 );
+
+    /**
+     * Extracts bits hi:lo of a 64-bit bit string, as Bits< hi, lo >().
+     */
+    template< unsigned int hi, unsigned int lo >
+    constexpr uint64_t Bits64( uint64_t s );
 
 
 
@@ -99,16 +115,25 @@ namespace arm {
 
 
     /**
-     * Returns true if security extension is implemented
+     * Returns true if security extension is implemented. Without a
+     * processor, the default profile (armv7a_profile) is assumed;
+     * otherwise, the processor's profile (isa_profile) is used. The
+     * same holds for the other implementation-defined features.
      */
     bool HaveSecurityExt();
 
+    template< typename proc_type >
+    bool HaveSecurityExt( const proc_type& proc );
+
 
     /**
      * Returns true if MP extension is implemented
      */
     bool HaveMPExt();
 
+    template< typename proc_type >
+    bool HaveMPExt( const proc_type& proc );
+
 
     /**
      * Returns the instruction's condition specifier
@@ -118,6 +143,23 @@ namespace arm {
 
 
     /**
+     * Bit "flags" of ConditionTable[cond] is set if condition "cond"
+     * passes when the N, Z, C and V flags are bits [3:0] of "flags".
+     * (A8.3, p.288)
+     */
+    extern const uint16_t ConditionTable[16];
+
+
+    /**
+     * Returns true if condition "cond" passes for the N, Z, C and V
+     * flags in bits [3:0] of "flags" (see ConditionFlags()).
+     */
+    bool ConditionHolds( uint32_t cond, uint32_t flags );
+
+
+    /**
+     * Instructions with the AL condition pass without reading the
+     * flags.
      * (A8.3.1, p.321)
      */
     template< typename proc_type >
@@ -132,6 +174,70 @@ namespace arm {
                              flag_type& carry_out, flag_type& overflow );
 
 
+    /**
+     * Sets the N, Z, C and V flags as AddWithCarry( x, y, carry_in )
+     * does. A lazy_cpsr_adaptor only records the operands.
+     */
+    template< typename cpsr_type >
+    void SetAddFlags( cpsr_type& cpsr, uint32_t x, uint32_t y,
+                      uint32_t carry_in );
+
+    template< typename field_type >
+    void SetAddFlags( lazy_cpsr_adaptor< field_type >& cpsr,
+                      uint32_t x, uint32_t y, uint32_t carry_in );
+
+
+    /**
+     * Sets the N and Z flags from the result of a logical operation
+     * and the C flag to its carry. The V flag is unchanged. A
+     * lazy_cpsr_adaptor only records the result and carry.
+     */
+    template< typename cpsr_type >
+    void SetLogicalFlags( cpsr_type& cpsr, uint32_t result, uint32_t carry );
+
+    template< typename field_type >
+    void SetLogicalFlags( lazy_cpsr_adaptor< field_type >& cpsr,
+                          uint32_t result, uint32_t carry );
+
+
+    /**
+     * Returns the N, Z, C and V flags as bits [3:0]. A packed_cpsr
+     * only shifts its word, and a lazy_cpsr_adaptor computes the four
+     * flags from its record once.
+     */
+    template< typename cpsr_type >
+    uint32_t ConditionFlags( const cpsr_type& cpsr );
+
+    uint32_t ConditionFlags( const packed_cpsr& cpsr );
+
+    template< typename field_type >
+    uint32_t ConditionFlags( const lazy_cpsr_adaptor< field_type >& cpsr );
+
+
+    /**
+     * Returns the status register as a 32-bit word. A packed_cpsr
+     * returns its word.
+     */
+    template< typename cpsr_type >
+    uint32_t CPSRValue( const cpsr_type& cpsr );
+
+    uint32_t CPSRValue( const packed_cpsr& cpsr );
+
+
+    /**
+     * Writes the APSR fields selected by MSR: N, Z, C, V and Q from
+     * bits [31:27] of "value" if write_nzcvq is set, GE from bits
+     * [19:16] if write_g is set. A packed_cpsr does a single masked
+     * write.
+     */
+    template< typename cpsr_type >
+    void WriteAPSR( cpsr_type& cpsr, uint32_t value,
+                    bool write_nzcvq, bool write_g );
+
+    void WriteAPSR( packed_cpsr& cpsr, uint32_t value,
+                    bool write_nzcvq, bool write_g );
+
+
     /**
      * (A2.5.1, p.48)
      */
@@ -167,83 +273,87 @@ namespace arm {
 
 
     /**
-     * Left logic shift, with carry output
+     * Left logic shift, with carry output. The shift functions below
+     * are inline and branch-free; amounts of 32 or more shift all the
+     * bits out, as for register-controlled shifts.
      */
-    UValueCarry LSL_C( uint32_t value, int amount );
+    constexpr UValueCarry LSL_C( uint32_t value, int amount );
 
 
     /**
      * Right logic shift, with carry output
      */
-    UValueCarry LSR_C( uint32_t value, int amount );
+    constexpr UValueCarry LSR_C( uint32_t value, int amount );
 
 
     /**
      * Right arithmetic shift, with carry output
      */
-    UValueCarry ASR_C( uint32_t value, int amount );
+    constexpr UValueCarry ASR_C( uint32_t value, int amount );
 
 
     /**
      * Rotate right of a bitstring, with carry output
      */
-    UValueCarry ROR_C( uint32_t value, int amount );
+    constexpr UValueCarry ROR_C( uint32_t value, int amount );
 
 
     /**
      * Rotate right with extend of a bitstring, with carry output
      */
-    UValueCarry RRX_C( uint32_t value, bool carry_in );
+    constexpr UValueCarry RRX_C( uint32_t value, bool carry_in );
 
 
     /**
-     * Shift a value, following SRType method, with carry output
+     * Shift a value, following SRType method, with carry output. The
+     * carry is carry_in if amount is 0.
      * (I.5.3, p.2088)
      */
-    UValueCarry Shift_C( uint32_t value, SRType type,
-                         int amount, bool carry_in );
+    constexpr UValueCarry Shift_C( uint32_t value, SRType type,
+                                   int amount, bool carry_in );
 
 
     /**
      * Shift a value, following the SRType method
      * (I.5.3, p.2088)
      */
-    uint32_t Shift( uint32_t value, SRType type, int amount, bool carry_in );
+    constexpr uint32_t Shift( uint32_t value, SRType type,
+                              int amount, bool carry_in );
 
 
     /**
      * Left arithmetic shift
      * (A2.2.1, p.37)
      */
-    uint32_t LSL( uint32_t value, int amount );
+    constexpr uint32_t LSL( uint32_t value, int amount );
 
 
     /**
      * Right logic shift
      * (A2.2.1, p.38)
      */
-    uint32_t LSR( uint32_t value, int amount );
+    constexpr uint32_t LSR( uint32_t value, int amount );
 
 
     /**
      * Right arithmetic shift
      * (A2.2.1, p.38)
      */
-    uint32_t ASR( uint32_t value, int amount );
+    constexpr uint32_t ASR( uint32_t value, int amount );
 
 
     /**
      * Rotate right of a bitstring
      * (A2.2.1, p.39)
      */
-    uint32_t ROR( uint32_t value, int amount );
+    constexpr uint32_t ROR( uint32_t value, int amount );
 
 
     /**
      * Rotate right with extend of a bitstring
      * (A2.2.1, p.39)
      */
-    uint32_t RRX( uint32_t value, bool carry_in );
+    constexpr uint32_t RRX( uint32_t value, bool carry_in );
 
 
     /**
@@ -283,11 +393,10 @@ namespace arm {
 
 
     /**
-     * Align value to "align". This implementation might not be exact
-     * since the description is very vague.
+     * Align value to "align", which must be a power of 2.
      * (I.5.4, p.2092)
      */
-    uint32_t Align( uint32_t value, uint32_t align );
+    constexpr uint32_t Align( uint32_t value, uint32_t align );
 
 
     /**
@@ -295,7 +404,7 @@ namespace arm {
      * (A2.2.1, p.41)
      * This implementation assumes N < 64
      */
-    ValueSat SignedSatQ( int64_t i, unsigned int N );
+    constexpr ValueSat SignedSatQ( int64_t i, unsigned int N );
 
 
     /**
@@ -303,7 +412,7 @@ namespace arm {
      * (A2.2.1, p.41)
      * This implementation assumes N < 64
      */
-    UValueSat UnsignedSatQ( int64_t i, unsigned int N );
+    constexpr UValueSat UnsignedSatQ( int64_t i, unsigned int N );
 
 
     /**
@@ -312,7 +421,7 @@ namespace arm {
      * This implementation assumes N < 64
      * @return The saturated value as a 64-bit signed integer.
      */
-    int64_t SignedSat( int64_t i, unsigned int N );
+    constexpr int64_t SignedSat( int64_t i, unsigned int N );
 
 
     /**
@@ -320,7 +429,7 @@ namespace arm {
      * (A2.2.1, p.41)
      * This implementation assumes N < 64
      */
-    uint64_t UnsignedSat( int64_t i, unsigned int N );
+    constexpr uint64_t UnsignedSat( int64_t i, unsigned int N );
 
 
     /**
@@ -365,10 +474,10 @@ namespace arm {
 
 
     /**
-     * Position of rightmost 1 in a bitstring
+     * Position of rightmost 1 in a bitstring, 32 if there is none
      * (I.5.3, p.2089)
      */
-    int LowestSetBit( unsigned int x );
+    constexpr int LowestSetBit( unsigned int x );
 
     
     /**
@@ -380,18 +489,47 @@ namespace arm {
     bool NullCheckIfThumbEE( proc_type& proc, int n );
 
 
+    /**
+     * Loads the registers of "registers", bit i standing for R[i],
+     * from consecutive words at "address", lowest register first, as
+     * LDM and POP do. The PC is written with LoadWritePC(). The words
+     * are read at once with MemReadWords().
+     */
+    template< typename proc_type >
+    void LoadMultiple( proc_type& proc, uint32_t address,
+                       uint32_t registers );
+
+    /**
+     * Stores the registers of "registers" to consecutive words at
+     * "address", lowest register first, as STM and PUSH do, and the
+     * PC as PCStoreValue(). Register "unknown" is stored as
+     * "unknown_value" if it is not the lowest register of the list.
+     * The words are written at once with MemWriteWords().
+     */
+    template< typename proc_type >
+    void StoreMultiple( proc_type& proc, uint32_t address,
+                        uint32_t registers, uint32_t unknown,
+                        uint32_t unknown_value );
+
+
     /**
      * This function returns the major version number of the
      * architecture.
      * (I.7.1, p.2098)
      */
     int ArchVersion();
+
+    template< typename proc_type >
+    int ArchVersion( const proc_type& proc );
     
 
     /**
      * (I.7.28, p.2102)
      */
     MemArch MemorySystemArchitecture();
+
+    template< typename proc_type >
+    MemArch MemorySystemArchitecture( const proc_type& proc );
     
 
     /**
@@ -428,9 +566,12 @@ namespace arm {
      */
     bool UnalignedSupport();
 
+    template< typename proc_type >
+    bool UnalignedSupport( const proc_type& proc );
+
     /**
      * This function tests whether big-endian memory accesses are currently
-     * selected.
+     * selected. Profiles with a fixed endianness ignore CPSR.E.
      * (A2.5.3 p.51)
      */
     template< typename proc_type >
@@ -18,14 +18,47 @@
 #define __ARMV7_FUNCTION_IMPL_HPP__
 
 #include "function.hpp"
+#include "endian_impl.hpp"
 #include "types.hpp"
 
 #include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
 #include <cassert>
-#include <cmath>
 
 
 
+constexpr uint32_t arm::Bits( uint32_t s, uint32_t b1, uint32_t b0 )
+{
+    assert( b1 >= b0 );
+    assert( b1 <= 31 );
+    return ( s & ( 0xFFFFFFFF >> ( 31 - b1 ) ) ) >> b0;
+}
+
+
+template< unsigned int hi, unsigned int lo >
+constexpr uint32_t arm::Bits( uint32_t s )
+{
+    BOOST_STATIC_ASSERT( hi >= lo && hi <= 31 );
+    return ( s >> lo ) & ( 0xFFFFFFFF >> ( 31 - hi + lo ) );
+}
+
+
+constexpr uint64_t arm::Bits64( uint64_t s, uint64_t b1, uint64_t b0 )
+{
+    assert( b1 >= b0 );
+    assert( b1 <= 63 );
+    return ( s & ( 0xFFFFFFFFFFFFFFFFULL >> ( 63 - b1 ) ) ) >> b0;
+}
+
+
+template< unsigned int hi, unsigned int lo >
+constexpr uint64_t arm::Bits64( uint64_t s )
+{
+    BOOST_STATIC_ASSERT( hi >= lo && hi <= 63 );
+    return ( s >> lo ) & ( 0xFFFFFFFFFFFFFFFFULL >> ( 63 - hi + lo ) );
+}
+
+
 template< typename proc_type >
 uint32_t arm::ARMExpandImm( proc_type& proc, uint32_t imm12 )
 {
@@ -34,61 +67,53 @@ uint32_t arm::ARMExpandImm( proc_type& proc, uint32_t imm12 )
 
 
 template< typename proc_type >
-bool arm::ConditionPassed( proc_type& proc, uint32_t instr )
+bool arm::HaveSecurityExt( const proc_type& )
 {
-    bool result = false;
-    uint32_t cond = CurrentCond( instr );
+    return isa_profile< proc_type >::type::security_ext;
+}
 
-    switch ( Bits( cond, 3, 1 ) )
-    {
 
-    case 0x0:
-        // EQ or NE
-        result = (proc.CPSR.Z == 1);
-        break;
-    case 0x1:
-        // CS or CC
-        result = (proc.CPSR.C == 1);
-        break;
-    case 0x2:
-        // MI or PL
-        result = (proc.CPSR.N == 1);
-        break;
-    case 0x3:
-        // VS or VC
-        result = (proc.CPSR.V == 1);
-        break;
-    case 0x4:
-        // HI or LS
-        result = (proc.CPSR.C == 1) && (proc.CPSR.Z == 0);
-        break;
-    case 0x5:
-        // GE or LT
-        result = (proc.CPSR.N == proc.CPSR.V);
-        break;
-    case 0x6:
-        // GT or LE
-        result = (proc.CPSR.N == proc.CPSR.V) && (proc.CPSR.Z == 0);
-        break;
-    case 0x7:
-        // AL
-        result = true;
-        break;
-    default:
-        // This is bad
-        assert( false && "unknown condition in instruction" );
-        break;
-    }
+template< typename proc_type >
+bool arm::HaveMPExt( const proc_type& )
+{
+    return isa_profile< proc_type >::type::mp_ext;
+}
 
-    // Check the lowest bit only.
-    int cond_l = cond & 0x1;
 
-    // Condition bits ‘111x’ indicate the instruction is always executed. 
-    // Otherwise, invert condition if necessary.
-    if (cond_l == 1 && cond != 0xF)
-        result = !result;
+template< typename proc_type >
+int arm::ArchVersion( const proc_type& )
+{
+    return isa_profile< proc_type >::type::arch_version;
+}
 
-    return result;
+
+template< typename proc_type >
+arm::MemArch arm::MemorySystemArchitecture( const proc_type& )
+{
+    return isa_profile< proc_type >::type::memory_arch;
+}
+
+
+template< typename proc_type >
+bool arm::UnalignedSupport( const proc_type& )
+{
+    return isa_profile< proc_type >::type::unaligned_support;
+}
+
+
+inline bool arm::ConditionHolds( uint32_t cond, uint32_t flags )
+{
+    return ( ConditionTable[ cond & 0xF ] >> ( flags & 0xF ) ) & 1;
+}
+
+
+template< typename proc_type >
+bool arm::ConditionPassed( proc_type& proc, uint32_t instr )
+{
+    // CurrentCond( instr ), without the call
+    const uint32_t cond = instr >> 28;
+
+    return cond == 0xE || ConditionHolds( cond, ConditionFlags( proc.CPSR ) );
 }
     
 
@@ -115,6 +140,285 @@ value_type arm::AddWithCarry( value_type x, value_type y, flag_type carry_in,
 }
 
 
+template< typename cpsr_type >
+void arm::SetAddFlags( cpsr_type& cpsr, uint32_t x, uint32_t y,
+                       uint32_t carry_in )
+{
+    uint32_t result, carry, overflow;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
+
+    cpsr.N = Bits< 31, 31 >( result );
+    cpsr.Z = IsZeroBit( result );
+    cpsr.C = carry;
+    cpsr.V = overflow;
+}
+
+
+template< typename field_type >
+void arm::SetAddFlags( lazy_cpsr_adaptor< field_type >& cpsr,
+                       uint32_t x, uint32_t y, uint32_t carry_in )
+{
+    cpsr.record_add( x, y, carry_in );
+}
+
+
+template< typename cpsr_type >
+void arm::SetLogicalFlags( cpsr_type& cpsr, uint32_t result, uint32_t carry )
+{
+    cpsr.N = Bits< 31, 31 >( result );
+    cpsr.Z = IsZeroBit( result );
+    cpsr.C = carry;
+}
+
+
+template< typename field_type >
+void arm::SetLogicalFlags( lazy_cpsr_adaptor< field_type >& cpsr,
+                           uint32_t result, uint32_t carry )
+{
+    cpsr.record_logical( result, carry );
+}
+
+
+template< typename cpsr_type >
+uint32_t arm::ConditionFlags( const cpsr_type& cpsr )
+{
+    return ( ( cpsr.N & 1 ) << 3 ) | ( ( cpsr.Z & 1 ) << 2 ) |
+           ( ( cpsr.C & 1 ) << 1 ) |   ( cpsr.V & 1 );
+}
+
+
+template< typename field_type >
+uint32_t arm::ConditionFlags( const lazy_cpsr_adaptor< field_type >& cpsr )
+{
+    return cpsr.flags();
+}
+
+
+template< typename cpsr_type >
+uint32_t arm::CPSRValue( const cpsr_type& cpsr )
+{
+    return ( cpsr.N        << 31 ) |
+           ( cpsr.Z        << 30 ) |
+           ( cpsr.C        << 29 ) |
+           ( cpsr.V        << 28 ) |
+           ( cpsr.Q        << 27 ) |
+           ( cpsr.IT_L     << 25 ) |
+           ( cpsr.J        << 24 ) |
+           ( cpsr.reserved << 20 ) |
+           ( cpsr.GE       << 16 ) |
+           ( cpsr.IT_H     << 10 ) |
+           ( cpsr.E        <<  9 ) |
+           ( cpsr.A        <<  8 ) |
+           ( cpsr.I        <<  7 ) |
+           ( cpsr.F        <<  6 ) |
+           ( cpsr.T        <<  5 ) |
+           cpsr.M;
+}
+
+
+template< typename cpsr_type >
+void arm::WriteAPSR( cpsr_type& cpsr, uint32_t value,
+                     bool write_nzcvq, bool write_g )
+{
+    if( write_nzcvq )
+    {
+        cpsr.N = Bits< 31, 31 >( value );
+        cpsr.Z = Bits< 30, 30 >( value );
+        cpsr.C = Bits< 29, 29 >( value );
+        cpsr.V = Bits< 28, 28 >( value );
+        cpsr.Q = Bits< 27, 27 >( value );
+    }
+
+    if( write_g )
+    {
+        cpsr.GE = Bits< 19, 16 >( value );
+    }
+}
+
+
+inline uint32_t arm::ConditionFlags( const packed_cpsr& cpsr )
+{
+    return cpsr.word >> 28;
+}
+
+
+inline uint32_t arm::CPSRValue( const packed_cpsr& cpsr )
+{
+    return cpsr.word;
+}
+
+
+inline void arm::WriteAPSR( packed_cpsr& cpsr, uint32_t value,
+                            bool write_nzcvq, bool write_g )
+{
+    const uint32_t mask = ( write_nzcvq ? 0xF8000000 : 0 ) |
+                          ( write_g     ? 0x000F0000 : 0 );
+    cpsr.word = ( cpsr.word & ~mask ) | ( value & mask );
+}
+
+
+// The shifts are done on 64 bits so that the carry is the last bit
+// shifted out. Amounts over 33 give the same result as 33.
+
+constexpr arm::UValueCarry arm::LSL_C( uint32_t value, int amount )
+{
+    assert( amount >= 0 );
+    const uint64_t result = (uint64_t)value << ( amount < 33 ? amount : 33 );
+    return UValueCarry( (uint32_t)result, ( result >> 32 ) & 1 );
+}
+
+
+constexpr arm::UValueCarry arm::LSR_C( uint32_t value, int amount )
+{
+    assert( amount >= 0 );
+    const uint64_t result =
+        ( (uint64_t)value << 1 ) >> ( amount < 33 ? amount : 33 );
+    return UValueCarry( (uint32_t)( result >> 1 ), result & 1 );
+}
+
+
+constexpr arm::UValueCarry arm::ASR_C( uint32_t value, int amount )
+{
+    assert( amount >= 0 );
+    const int64_t result =
+        ( (int64_t)(int32_t)value * 2 ) >> ( amount < 33 ? amount : 33 );
+    return UValueCarry( (uint32_t)( result >> 1 ), result & 1 );
+}
+
+
+constexpr arm::UValueCarry arm::ROR_C( uint32_t value, int amount )
+{
+    assert( amount >= 0 );
+    const uint32_t m      = (uint32_t)amount & 31;
+    const uint32_t result = ( value >> m ) | ( value << ( ( 32 - m ) & 31 ) );
+    return UValueCarry( result, result >> 31 );
+}
+
+
+constexpr arm::UValueCarry arm::RRX_C( uint32_t value, bool carry_in )
+{
+    return UValueCarry( ( value >> 1 ) | ( (uint32_t)carry_in << 31 ),
+                        value & 1 );
+}
+
+
+constexpr arm::UValueCarry arm::Shift_C( uint32_t value, SRType type,
+                                         int amount, bool carry_in )
+{
+    assert( !( type == SRType_RRX && amount != 1 ) && ( amount >= 0 ) );
+    assert( type <= SRType_RRX &&
+            "Invalid shift register type in shift operation" );
+
+    // All shifts are computed and the result is selected by indexing,
+    // so that the type costs no branch. An amount of 0 keeps the
+    // value and the carry.
+    const UValueCarry results[] =
+    {
+        LSL_C( value, amount ), LSR_C( value, amount ),
+        ASR_C( value, amount ), ROR_C( value, amount ),
+        RRX_C( value, carry_in )
+    };
+    const UValueCarry r    = results[ type ];
+    const uint32_t    keep = -(uint32_t)( amount == 0 );
+
+    return UValueCarry( ( r.value & ~keep ) | ( value & keep ),
+                        ( r.carry & ~keep ) | ( carry_in & keep ) );
+}
+
+
+constexpr uint32_t arm::Shift( uint32_t value, SRType type,
+                               int amount, bool carry_in )
+{
+    return Shift_C( value, type, amount, carry_in ).value;
+}
+
+
+constexpr uint32_t arm::LSL( uint32_t value, int amount )
+{
+    return LSL_C( value, amount ).value;
+}
+
+
+constexpr uint32_t arm::LSR( uint32_t value, int amount )
+{
+    return LSR_C( value, amount ).value;
+}
+
+
+constexpr uint32_t arm::ASR( uint32_t value, int amount )
+{
+    return ASR_C( value, amount ).value;
+}
+
+
+constexpr uint32_t arm::ROR( uint32_t value, int amount )
+{
+    return ROR_C( value, amount ).value;
+}
+
+
+constexpr uint32_t arm::RRX( uint32_t value, bool carry_in )
+{
+    return RRX_C( value, carry_in ).value;
+}
+
+
+constexpr uint32_t arm::Align( uint32_t value, uint32_t align )
+{
+    assert( align != 0 && ( align & ( align - 1 ) ) == 0 &&
+            "Invalid align value" );
+    return value & ~( align - 1 );
+}
+
+
+constexpr arm::ValueSat arm::SignedSatQ( int64_t i, unsigned int N )
+{
+    assert( N > 0 && N < 64 &&
+            "Saturation of 64+ bit values is not supported" );
+    const int64_t max   = (int64_t)( ( (uint64_t)1 << ( N - 1 ) ) - 1 );
+    const int64_t min   = -max - 1;
+    const int64_t value = i > max ? max : ( i < min ? min : i );
+    return ValueSat( value, value != i );
+}
+
+
+constexpr arm::UValueSat arm::UnsignedSatQ( int64_t i, unsigned int N )
+{
+    assert( N < 63 &&
+            "Unsigned saturation of 63+ bit values is not supported" );
+    const int64_t max   = (int64_t)( ( (uint64_t)1 << N ) - 1 );
+    const int64_t value = i > max ? max : ( i < 0 ? 0 : i );
+    return UValueSat( (uint64_t)value, value != i );
+}
+
+
+constexpr int64_t arm::SignedSat( int64_t i, unsigned int N )
+{
+    return SignedSatQ( i, N ).value;
+}
+
+
+constexpr uint64_t arm::UnsignedSat( int64_t i, unsigned int N )
+{
+    return UnsignedSatQ( i, N ).value;
+}
+
+
+constexpr int arm::LowestSetBit( unsigned int x )
+{
+    // Bit 32 stops the count when x is 0
+#ifdef __GNUC__
+    return __builtin_ctzll( (uint64_t)x | 0x100000000ULL );
+#else
+    int n = 0;
+    for( uint64_t y = (uint64_t)x | 0x100000000ULL; ( y & 1 ) == 0; y >>= 1 )
+    {
+        ++n;
+    }
+    return n;
+#endif
+}
+
 
 template< typename proc_type >
 arm::InstrSet arm::CurrentInstrSet( proc_type& proc )
@@ -177,7 +481,7 @@ void arm::SelectInstrSet( proc_type& proc, InstrSet iset )
 template< typename proc_type >
 void arm::ALUWritePC( proc_type& proc, uint32_t address )
 {
-    if ( ArchVersion() >= 7 && CurrentInstrSet( proc ) == InstrSet_ARM )
+    if ( ArchVersion( proc ) >= 7 && CurrentInstrSet( proc ) == InstrSet_ARM )
     {
         BXWritePC( proc, address );
     }
@@ -190,7 +494,7 @@ void arm::ALUWritePC( proc_type& proc, uint32_t address )
 template< typename proc_type >
 void arm::LoadWritePC( proc_type& proc, uint32_t address)
 {
-    if ( ArchVersion() >= 5 )
+    if ( ArchVersion( proc ) >= 5 )
     {
         BXWritePC( proc, address );
     }
@@ -302,9 +606,61 @@ bool arm::NullCheckIfThumbEE( proc_type& proc, int n )
 }
 
 
+template< typename proc_type >
+void arm::LoadMultiple( proc_type& proc, uint32_t address,
+                        uint32_t registers )
+{
+    uint32_t data[16];
+    MemReadWords( proc, address, data, BitCount( registers ) );
+
+    // The registers are walked from the lowest set bit
+    const uint32_t* word = data;
+    for( uint32_t list = registers & 0x7FFF; list != 0; list &= list - 1 )
+    {
+        proc.R[ LowestSetBit( list ) ] = *word++;
+    }
+
+    if( Bits< 15, 15 >( registers ) == 1 )
+    {
+        LoadWritePC( proc, *word );
+    }
+}
+
+
+template< typename proc_type >
+void arm::StoreMultiple( proc_type& proc, uint32_t address,
+                         uint32_t registers, uint32_t unknown,
+                         uint32_t unknown_value )
+{
+    uint32_t data[16];
+    uint32_t* word = data;
+    for( uint32_t list = registers & 0x7FFF; list != 0; list &= list - 1 )
+    {
+        const int i = LowestSetBit( list );
+        *word++ = ( uint32_t( i ) == unknown &&
+                    i != LowestSetBit( registers ) ) ?
+                  unknown_value : uint32_t( proc.R[i] );
+    }
+
+    if( Bits< 15, 15 >( registers ) == 1 )
+    {
+        *word++ = PCStoreValue( proc );
+    }
+
+    MemWriteWords( proc, address, data, word - data );
+}
+
+
 template< typename proc_type >
 bool arm::BigEndian( proc_type& proc )
 {
+    const Endianness endianness =
+        isa_profile< proc_type >::type::data_endianness;
+
+    if( endianness != Endianness_Selectable )
+    {
+        return endianness == Endianness_Big;
+    }
     return proc.CPSR.E == 0x1;
 }
 
@@ -370,7 +726,7 @@ bool arm::CurrentModeIsPrivileged( proc_type& proc )
 template< typename proc_type >
 bool arm::IsSecure( proc_type& proc )
 {
-    return !HaveSecurityExt() || proc.SCR.NS == 0 || proc.CPSR.M == 0x16;
+    return !HaveSecurityExt( proc ) || proc.SCR.NS == 0 || proc.CPSR.M == 0x16;
 }
 
 template< typename proc_type, typename mask_type, typename value_type >
@@ -380,25 +736,25 @@ void arm::CPSRWriteByInstr( value_type value, mask_type bytemask,
     const bool privileged = CurrentModeIsPrivileged( proc );
     const bool nmfi = proc.SCTLR.NMFI == 1;
 
-    if( Bits( bytemask, 3, 3 ) == 1 )
+    if( Bits< 3, 3 >( bytemask ) == 1 )
     {
         proc.CPSR &= ~(0xF0000000);
-        proc.CPSR |= Bits( value, 31, 27 ) << 28;
+        proc.CPSR |= Bits< 31, 27 >( value ) << 28;
         
         if( affect_execstate )
         {
             proc.CPSR &= ~(0x0F000000);
-            proc.CPSR |= Bits( value, 26, 24 ) << 24;
+            proc.CPSR |= Bits< 26, 24 >( value ) << 24;
         }
     }
 
-    if( Bits( bytemask, 2, 2 ) == 1 )
+    if( Bits< 2, 2 >( bytemask ) == 1 )
     {
         proc.CPSR &= ~(0x000F0000);
-        proc.CPSR |= Bits( value, 19, 16 ) << 16;
+        proc.CPSR |= Bits< 19, 16 >( value ) << 16;
     }
 
-    if( Bits( bytemask, 1, 1 ) == 1 )
+    if( Bits< 1, 1 >( bytemask ) == 1 )
     {
         if( affect_execstate )
         {
@@ -406,59 +762,59 @@ void arm::CPSRWriteByInstr( value_type value, mask_type bytemask,
             proc.CPSR |= Bits( value, 15 , 10 ) << 10;
         }
         proc.CPSR &= ~(0x200);
-        proc.CPSR |= Bits( value, 9, 9 ) << 9;
+        proc.CPSR |= Bits< 9, 9 >( value ) << 9;
         
         if( privileged && ( IsSecure( proc ) || proc.SCR.AW == 1 ) )
         {
             proc.CPSR &= ~(0x100);
-            proc.CPSR |= Bits( value, 8, 8 ) << 8;
+            proc.CPSR |= Bits< 8, 8 >( value ) << 8;
         }
     }
 
-    if( Bits( bytemask, 0, 0 ) == 1 )
+    if( Bits< 0, 0 >( bytemask ) == 1 )
     {
         if( privileged )
         {
             proc.CPSR &= ~(0x80);
-            proc.CPSR |= Bits( value, 7, 7 ) << 7;
+            proc.CPSR |= Bits< 7, 7 >( value ) << 7;
         }
 
         if( privileged && ( IsSecure( proc ) || proc.SCR.FW == 1 ) &&
-            ( !nmfi || Bits( value, 6, 6 ) == 0 ) )
+            ( !nmfi || Bits< 6, 6 >( value ) == 0 ) )
         {
             proc.CPSR &= ~(0x40);
-            proc.CPSR |= Bits( value, 6, 6 ) << 6;
+            proc.CPSR |= Bits< 6, 6 >( value ) << 6;
         }
 
         if( affect_execstate )
         {
             proc.CPSR &= ~(0x20);
-            proc.CPSR |= Bits( value, 5, 5 ) << 5;
+            proc.CPSR |= Bits< 5, 5 >( value ) << 5;
         }
 
         if( privileged )
         {
-            if( BadMode( Bits( value, 4, 0 ) ) )
+            if( BadMode( Bits< 4, 0 >( value ) ) )
             {
                 // Unpredictable
                 return;
             }
             else
             {
-                if( !IsSecure( proc ) && Bits( value, 4, 0 ) == 0x16 )
+                if( !IsSecure( proc ) && Bits< 4, 0 >( value ) == 0x16 )
                 {
                     // Unpredictable
                     return;
                 }
 
-                if( !IsSecure( proc ) && Bits( value, 4, 0 ) == 0x11
+                if( !IsSecure( proc ) && Bits< 4, 0 >( value ) == 0x11
                     && proc.NSACR.RFR == 1 )
                 {
                     // Unpredictable
                     return;
                 }
                 proc.CPSR &= ~(0x1F);
-                proc.CPSR |= Bits( value, 4, 0 );
+                proc.CPSR |= Bits< 4, 0 >( value );
             }
         }
     }
@@ -251,6 +251,14 @@ namespace arm {
     template< typename proc_type >
     void BX_A1( proc_type& proc, uint32_t instr );
 
+    /**
+     * Clear-Exclusive clears the local record of the executing processor
+     * that an address has had a request for an exclusive access.
+     * @brief (A8.6.30, p.382)
+     */
+    template< typename proc_type >
+    void CLREX_A1( proc_type& proc, uint32_t instr );
+
     /**
      * Count Leading Zeros returns the number of binary zero bits before the 
      * first binary one bit in a value.
@@ -512,6 +520,43 @@ namespace arm {
     template< typename proc_type >
     void LDRD_reg_A1( proc_type& proc, uint32_t instr );
 
+    /**
+     * Load Register Exclusive calculates an address from a base register
+     * value and an immediate offset, loads a word from memory, writes it to
+     * a register and updates the exclusive monitors.
+     * @brief (A8.6.69, p.454)
+     */
+    template< typename proc_type >
+    void LDREX_A1( proc_type& proc, uint32_t instr );
+
+    /**
+     * Load Register Exclusive Byte derives an address from a base register
+     * value, loads a byte from memory, zero-extends it to form a 32-bit
+     * word, writes it to a register and updates the exclusive monitors.
+     * @brief (A8.6.70, p.456)
+     */
+    template< typename proc_type >
+    void LDREXB_A1( proc_type& proc, uint32_t instr );
+
+    /**
+     * Load Register Exclusive Doubleword derives an address from a base
+     * register value, loads a 64-bit doubleword from memory, writes it to
+     * two registers and updates the exclusive monitors.
+     * @brief (A8.6.71, p.458)
+     */
+    template< typename proc_type >
+    void LDREXD_A1( proc_type& proc, uint32_t instr );
+
+    /**
+     * Load Register Exclusive Halfword derives an address from a base
+     * register value, loads a halfword from memory, zero-extends it to form
+     * a 32-bit word, writes it to a register and updates the exclusive
+     * monitors.
+     * @brief (A8.6.72, p.460)
+     */
+    template< typename proc_type >
+    void LDREXH_A1( proc_type& proc, uint32_t instr );
+
     /**
      * Load Register Halfword (immediate) calculates an address from a base
      * register value and an immediate offset, loads a halfword from memory,
@@ -1860,6 +1905,54 @@ namespace arm {
     void STRD_reg_A1( proc_type& proc, uint32_t instr );
 
 
+    /**
+     * STREX
+     * Store Register Exclusive calculates an address from a base
+     * register value and an immediate offset, and stores a word from
+     * a register to memory if the executing processor has exclusive
+     * access to the memory addressed.
+     * @brief (A8.6.202, 712)
+     */
+    template< typename proc_type >
+    void STREX_A1( proc_type& proc, uint32_t instr );
+
+
+    /**
+     * STREXB
+     * Store Register Exclusive Byte derives an address from a base
+     * register value, and stores a byte from a register to memory if
+     * the executing processor has exclusive access to the memory
+     * addressed.
+     * @brief (A8.6.203, 714)
+     */
+    template< typename proc_type >
+    void STREXB_A1( proc_type& proc, uint32_t instr );
+
+
+    /**
+     * STREXD
+     * Store Register Exclusive Doubleword derives an address from a
+     * base register value, and stores a 64-bit doubleword from two
+     * registers to memory if the executing processor has exclusive
+     * access to the memory addressed.
+     * @brief (A8.6.204, 716)
+     */
+    template< typename proc_type >
+    void STREXD_A1( proc_type& proc, uint32_t instr );
+
+
+    /**
+     * STREXH
+     * Store Register Exclusive Halfword derives an address from a
+     * base register value, and stores a halfword from a register to
+     * memory if the executing processor has exclusive access to the
+     * memory addressed.
+     * @brief (A8.6.205, 718)
+     */
+    template< typename proc_type >
+    void STREXH_A1( proc_type& proc, uint32_t instr );
+
+
     /**
      * STRH (immediate, ARM)
      * Store Register Halfword (immediate) calculates an address from
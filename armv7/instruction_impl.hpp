@@ -17,22 +17,39 @@
 #ifndef __ARMV7_INSTRUCTION_IMPL_HPP__
 #define __ARMV7_INSTRUCTION_IMPL_HPP__
 
+#include "endian.hpp"
+#include "endian_impl.hpp"
+#include "exclusive.hpp"
+#include "exclusive_impl.hpp"
 #include "function.hpp"
 #include "instruction.hpp"
+#include "parallel.hpp"
+#include "parallel_impl.hpp"
+#include "unpredictable.hpp"
+#include "unpredictable_impl.hpp"
 #include <boost/cstdint.hpp>
 
 /*
- * Emit a warning whenever the "UNPREDICTABLE" state is reached.
+ * Report the "UNPREDICTABLE" state to the processor's policy (see
+ * unpredictable.hpp). "encoding" names the behavior function's
+ * Encoding, or Unknown for those the decoder does not produce, so
+ * that the policies get it without looking the name up.
+ *
+ * A client may replace the policies by defining this macro, or the
+ * UNPREDICTABLE block of earlier versions, which does not take the
+ * encoding.
  */
 
-#ifndef UNPREDICTABLE
-#include <iostream>
-#define UNPREDICTABLE                                                   \
+#ifndef ARMV7_UNPREDICTABLE
+#ifdef UNPREDICTABLE
+#define ARMV7_UNPREDICTABLE( encoding ) UNPREDICTABLE
+#else
+#define ARMV7_UNPREDICTABLE( encoding )                                 \
 {                                                                       \
-    std::cerr << "Warning: arm::" << __func__                           \
-              << "(): entering unpredictable state." << std::endl;      \
+    arm::Unpredictable( proc, arm::Encoding_##encoding, __func__ );     \
 }
 #endif
+#endif
 
 
 template< typename proc_type >
@@ -43,10 +60,10 @@ void arm::ADC_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.1, p.326)
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -60,8 +77,10 @@ void arm::ADC_imm_A1( proc_type& proc, uint32_t instr )
         uint32_t imm32 = ARMExpandImm( proc, imm12 );
 
         uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], imm32, (uint32_t)proc.CPSR.C,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = imm32;
+        const uint32_t carry_in = (uint32_t)proc.CPSR.C;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
         if( d == 15 )
         {
             ALUWritePC( proc, result );
@@ -71,10 +90,7 @@ void arm::ADC_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                proc.CPSR.V = overflow;
+                SetAddFlags( proc.CPSR, x, y, carry_in );
             }
         }
     }
@@ -88,12 +104,12 @@ void arm::ADC_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.2, p.328)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -112,8 +128,10 @@ void arm::ADC_reg_A1( proc_type& proc, uint32_t instr )
         uint32_t shifted = c_.value;
 
         uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], shifted, (uint32_t)proc.CPSR.C,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = shifted;
+        const uint32_t carry_in = (uint32_t)proc.CPSR.C;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
 
         if( d == 15 )
         {
@@ -125,10 +143,7 @@ void arm::ADC_reg_A1( proc_type& proc, uint32_t instr )
 
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                proc.CPSR.V = overflow;
+                SetAddFlags( proc.CPSR, x, y, carry_in );
             }
         }
     }
@@ -142,12 +157,12 @@ void arm::ADC_rsr_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.3, p.330)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t Rs   = Bits( instr, 11,  8 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t Rs   = Bits< 11,  8 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t d = Rd;
         uint32_t n = Rn;
@@ -156,24 +171,24 @@ void arm::ADC_rsr_A1( proc_type& proc, uint32_t instr )
         bool setflags  = (S == 1);
         SRType shift_t = DecodeRegShift( type );
 
-        if( d == 15 || n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 || s == 15 )
+            ARMV7_UNPREDICTABLE( ADC_rsr_A1 );
 
-        uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+        uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry c_ = Shift_C( proc.R[m], shift_t, shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
 
         uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], shifted, (uint32_t)proc.CPSR.C,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = shifted;
+        const uint32_t carry_in = (uint32_t)proc.CPSR.C;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
 
         proc.R[d] = result;
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
     }
 }
@@ -186,10 +201,10 @@ void arm::ADD_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.5, p.334)
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         if( (Rn == 15) && (S == 0) )
         {
@@ -215,8 +230,10 @@ void arm::ADD_imm_A1( proc_type& proc, uint32_t instr )
         uint32_t imm32 = ARMExpandImm( proc, imm12 );
 
         uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], imm32, (uint32_t)0,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = imm32;
+        const uint32_t carry_in = 0;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
         if( d == 15 )
         {
             ALUWritePC( proc, result );
@@ -226,10 +243,7 @@ void arm::ADD_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                proc.CPSR.V = overflow;
+                SetAddFlags( proc.CPSR, x, y, carry_in );
             }
         }
     }
@@ -243,12 +257,12 @@ void arm::ADD_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.6, p.336)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -273,8 +287,10 @@ void arm::ADD_reg_A1( proc_type& proc, uint32_t instr )
         uint32_t shifted = c_.value;
 
         uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], shifted, (uint32_t)0,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = shifted;
+        const uint32_t carry_in = 0;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
 
         if( d == 15 )
         {
@@ -286,10 +302,7 @@ void arm::ADD_reg_A1( proc_type& proc, uint32_t instr )
 
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                proc.CPSR.V = overflow;
+                SetAddFlags( proc.CPSR, x, y, carry_in );
             }
         }
     }
@@ -303,12 +316,12 @@ void arm::ADD_rsr_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.3, p.330)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t Rs   = Bits( instr, 11,  8 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t Rs   = Bits< 11,  8 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t d = Rd;
         uint32_t n = Rn;
@@ -317,23 +330,23 @@ void arm::ADD_rsr_A1( proc_type& proc, uint32_t instr )
         bool setflags  = (S == 1);
         SRType shift_t = DecodeRegShift( type );
 
-        if( d == 15 || n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
-        uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+        if( d == 15 || n == 15 || m == 15 || s == 15 )
+            ARMV7_UNPREDICTABLE( ADD_rsr_A1 );
+        uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry c_ = Shift_C( proc.R[m], shift_t, shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
 
         uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], shifted, (uint32_t)0,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = shifted;
+        const uint32_t carry_in = 0;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
 
         proc.R[d] = result;
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
     }
 }
@@ -346,9 +359,9 @@ void arm::ADD_SP_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.8, p.340)
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -364,8 +377,10 @@ void arm::ADD_SP_imm_A1( proc_type& proc, uint32_t instr )
 
         // FIXME: SP is not always register 13! 
         //        (depends on the proc active mode)
-        result = AddWithCarry( (uint32_t)proc.R[13], imm32, (uint32_t)0,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[13];
+        const uint32_t y        = imm32;
+        const uint32_t carry_in = 0;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
         if( d == 15 )
         {
             ALUWritePC( proc, result );
@@ -375,10 +390,7 @@ void arm::ADD_SP_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                proc.CPSR.V = overflow;
+                SetAddFlags( proc.CPSR, x, y, carry_in );
             }
         }
     }
@@ -392,11 +404,11 @@ void arm::ADD_SP_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.9, p.340)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -416,8 +428,10 @@ void arm::ADD_SP_reg_A1( proc_type& proc, uint32_t instr )
         uint32_t result, carry, overflow;
         // FIXME: SP is not always register 13! 
         //        (depends on the proc active mode)
-        result = AddWithCarry( (uint32_t)proc.R[13], shifted, (uint32_t)0,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[13];
+        const uint32_t y        = shifted;
+        const uint32_t carry_in = 0;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
 
         if( d == 15 )
         {
@@ -429,10 +443,7 @@ void arm::ADD_SP_reg_A1( proc_type& proc, uint32_t instr )
 
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                proc.CPSR.V = overflow;
+                SetAddFlags( proc.CPSR, x, y, carry_in );
             }
         }
     }
@@ -446,8 +457,8 @@ void arm::ADR_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.10, p.344)
         // Encoding-specific operations
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         uint32_t d = Rd;
         bool add = true;
@@ -484,8 +495,8 @@ void arm::ADR_A2( proc_type& proc, uint32_t instr )
     {
         // (A8.6.10, p.344)
         // Encoding-specific operations
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         uint32_t d = Rd;
         bool add = false;
@@ -522,10 +533,10 @@ void arm::AND_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.11, p.346)
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -551,10 +562,7 @@ void arm::AND_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                //proc.CPSR.V = overflow; UNCHANGED
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -568,12 +576,12 @@ void arm::AND_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.12, p.348)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -604,10 +612,7 @@ void arm::AND_reg_A1( proc_type& proc, uint32_t instr )
 
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                //proc.CPSR.V = overflow; UNCHANGED
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -621,12 +626,12 @@ void arm::AND_rsr_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.3, p.330)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t Rs   = Bits( instr, 11,  8 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t Rs   = Bits< 11,  8 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t d = Rd;
         uint32_t n = Rn;
@@ -635,8 +640,9 @@ void arm::AND_rsr_A1( proc_type& proc, uint32_t instr )
         bool setflags  = (S == 1);
         SRType shift_t = DecodeRegShift( type );
 
-        if( d == 15 || n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
-        uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+        if( d == 15 || n == 15 || m == 15 || s == 15 )
+            ARMV7_UNPREDICTABLE( AND_rsr_A1 );
+        uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry c_ = Shift_C( proc.R[m], shift_t, shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
         uint32_t carry = c_.carry;
@@ -647,10 +653,7 @@ void arm::AND_rsr_A1( proc_type& proc, uint32_t instr )
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            //proc.CPSR.V = overflow; UNCHANGED
+            SetLogicalFlags( proc.CPSR, result, carry );
         }
     }
 }
@@ -663,10 +666,10 @@ void arm::ASR_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.14, p.352)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t d = Rd;
         uint32_t m = Rm;
@@ -688,10 +691,7 @@ void arm::ASR_imm_A1( proc_type& proc, uint32_t instr )
 
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                //proc.CPSR.V = overflow; UNCHANGED
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -705,10 +705,10 @@ void arm::ASR_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.15, p.354)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t Rm   = Bits( instr, 11,  8 );
-        uint32_t Rn   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t Rm   = Bits< 11,  8 >( instr );
+        uint32_t Rn   = Bits<  3,  0 >( instr );
 
         uint32_t d = Rd;
         uint32_t n = Rn;
@@ -716,8 +716,8 @@ void arm::ASR_reg_A1( proc_type& proc, uint32_t instr )
 
         bool setflags  = (S == 1);
 
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
-        uint32_t shift_n = Bits( proc.R[m], 7, 0 );
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( ASR_reg_A1 );
+        uint32_t shift_n = Bits< 7, 0 >( proc.R[m] );
         UValueCarry c_ = Shift_C( proc.R[n], arm::SRType_ASR, shift_n, proc.CPSR.C );
         uint32_t result = c_.value;
         bool carry      = c_.carry;
@@ -726,10 +726,7 @@ void arm::ASR_reg_A1( proc_type& proc, uint32_t instr )
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            //proc.CPSR.V = overflow; UNCHANGED
+            SetLogicalFlags( proc.CPSR, result, carry );
         }
     }
 }
@@ -742,7 +739,7 @@ void arm::B_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.16, p.356)
         // Encoding-specific operations
-        uint32_t imm24 = Bits( instr, 23, 0 );
+        uint32_t imm24 = Bits< 23, 0 >( instr );
         // Shift to the right to add two 0 bits.
         // Effective size is 26 bits.
         uint32_t imm32 = (uint32_t)SignExtend( (imm24 << 2), 32, 26 );
@@ -758,15 +755,15 @@ void arm::BFC_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.17, p.358)
         // Encoding-specific operations
-        uint32_t msb = Bits( instr, 20, 16 );
-        uint32_t Rd  = Bits( instr, 15, 12 );
-        uint32_t lsb = Bits( instr, 11,  7 );
+        uint32_t msb = Bits< 20, 16 >( instr );
+        uint32_t Rd  = Bits< 15, 12 >( instr );
+        uint32_t lsb = Bits< 11,  7 >( instr );
 
         uint32_t d = Rd;
         uint32_t msbit = msb;
         uint32_t lsbit = lsb;
 
-        if( d == 15 ) UNPREDICTABLE;
+        if( d == 15 ) ARMV7_UNPREDICTABLE( BFC_A1 );
         if( msbit >= lsbit )
         {
             for(uint32_t i = lsb; i <= msb; ++i )
@@ -776,7 +773,7 @@ void arm::BFC_A1( proc_type& proc, uint32_t instr )
         }
         else
         {
-            UNPREDICTABLE;
+            ARMV7_UNPREDICTABLE( BFC_A1 );
         }
     }
 }
@@ -789,10 +786,10 @@ void arm::BFI_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.18, p.360)
         // Encoding-specific operations
-        uint32_t msb = Bits( instr, 20, 16 );
-        uint32_t Rd  = Bits( instr, 15, 12 );
-        uint32_t lsb = Bits( instr, 11,  7 );
-        uint32_t Rn  = Bits( instr,  3,  0 );
+        uint32_t msb = Bits< 20, 16 >( instr );
+        uint32_t Rd  = Bits< 15, 12 >( instr );
+        uint32_t lsb = Bits< 11,  7 >( instr );
+        uint32_t Rn  = Bits<  3,  0 >( instr );
         
         if( Rn == 15 )
         {
@@ -806,7 +803,7 @@ void arm::BFI_A1( proc_type& proc, uint32_t instr )
         uint32_t lsbit = lsb;
 
 
-        if( d == 15 ) UNPREDICTABLE;
+        if( d == 15 ) ARMV7_UNPREDICTABLE( BFI_A1 );
         if( msbit >= lsbit )
         {
             for(uint32_t i = lsb; i <= msb; ++i )
@@ -824,7 +821,7 @@ void arm::BFI_A1( proc_type& proc, uint32_t instr )
         }
         else
         {
-            UNPREDICTABLE;
+            ARMV7_UNPREDICTABLE( BFI_A1 );
         }
     }
 }
@@ -837,10 +834,10 @@ void arm::BIC_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.19, p.362)
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -866,10 +863,7 @@ void arm::BIC_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                //proc.CPSR.V = overflow; UNCHANGED
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -883,12 +877,12 @@ void arm::BIC_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.20, p.364)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -918,10 +912,7 @@ void arm::BIC_reg_A1( proc_type& proc, uint32_t instr )
 
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                //proc.CPSR.V = overflow; UNCHANGED
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -935,12 +926,12 @@ void arm::BIC_rsr_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.21, p.366)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t Rs   = Bits( instr, 11,  8 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t Rs   = Bits< 11,  8 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t d = Rd;
         uint32_t n = Rn;
@@ -949,8 +940,9 @@ void arm::BIC_rsr_A1( proc_type& proc, uint32_t instr )
         bool setflags  = (S == 1);
         SRType shift_t = DecodeRegShift( type );
 
-        if( d == 15 || n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
-        uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+        if( d == 15 || n == 15 || m == 15 || s == 15 )
+            ARMV7_UNPREDICTABLE( BIC_rsr_A1 );
+        uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry c_ = Shift_C( proc.R[m], shift_t, shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
         uint32_t carry = c_.carry;
@@ -961,10 +953,7 @@ void arm::BIC_rsr_A1( proc_type& proc, uint32_t instr )
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            //proc.CPSR.V = overflow; UNCHANGED
+            SetLogicalFlags( proc.CPSR, result, carry );
         }
     }
 }
@@ -977,7 +966,7 @@ void arm::BL_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.23, p.370)
         // Encoding-specific operations
-        uint32_t imm24 = Bits( instr, 23, 0 );
+        uint32_t imm24 = Bits< 23, 0 >( instr );
 
         // Shift to the right to add two 0 bits.
         // Effective size is 26 bits.
@@ -1018,8 +1007,8 @@ void arm::BLX_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.23, p.370)
         // Encoding-specific operations
-        uint32_t H     = Bits( instr, 24, 24 );
-        uint32_t imm24 = Bits( instr, 23, 0 );
+        uint32_t H     = Bits< 24, 24 >( instr );
+        uint32_t imm24 = Bits< 23, 0 >( instr );
 
         // Shift to the right to add one 0 bits and the H bit.
         // Effective size is 26 bits.
@@ -1060,11 +1049,11 @@ void arm::BLX_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.24, p.372)
         // Encoding-specific operations
-        uint32_t Rm = Bits( instr, 3, 0 );
+        uint32_t Rm = Bits< 3, 0 >( instr );
 
         uint32_t m = Rm;
 
-        if( m == 15 ) UNPREDICTABLE;        
+        if( m == 15 ) ARMV7_UNPREDICTABLE( BLX_reg_A1 );        
         if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
         {
             uint32_t next_instr_addr = proc.PC - 4;
@@ -1090,7 +1079,7 @@ void arm::BX_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.25, p.374)
         // Encoding-specific operations
-        uint32_t Rm = Bits( instr, 3, 0 );
+        uint32_t Rm = Bits< 3, 0 >( instr );
 
         uint32_t m = Rm;
 
@@ -1098,6 +1087,14 @@ void arm::BX_A1( proc_type& proc, uint32_t instr )
     }
 }
 
+template< typename proc_type >
+void arm::CLREX_A1( proc_type& proc, uint32_t )
+{
+    // (A8.6.30, p.382)
+    // Operation
+    ClearExclusiveLocal( proc );
+}
+
 template< typename proc_type >
 void arm::CLZ_A1( proc_type& proc, uint32_t instr )
 {
@@ -1106,13 +1103,13 @@ void arm::CLZ_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.31, p.384)
         // Encoding-specific operations
-        uint32_t Rd = Bits( instr, 15, 12 );
-        uint32_t Rm = Bits( instr,  3,  0 );
+        uint32_t Rd = Bits< 15, 12 >( instr );
+        uint32_t Rm = Bits<  3,  0 >( instr );
 
         uint32_t d = Rd;
         uint32_t m = Rm;
 
-        if( d == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( CLZ_A1 );
         uint32_t result = CountLeadingZeroBits( proc.R[m] );
         proc.R[d] = result;
     }
@@ -1126,21 +1123,18 @@ void arm::CMN_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.32, p.386)
         // Encoding-specific operations
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         uint32_t n = Rn;
 
         uint32_t imm32 = ARMExpandImm( proc, imm12 );
 
-        uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], imm32, (uint32_t)0,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = imm32;
+        const uint32_t carry_in = 0;
 
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        proc.CPSR.V = overflow;
+        SetAddFlags( proc.CPSR, x, y, carry_in );
     }
 }
 
@@ -1152,10 +1146,10 @@ void arm::CMN_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.33, p.388)
         // Encoding-specific operations
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t n = Rn;
         uint32_t m = Rm;
@@ -1166,14 +1160,11 @@ void arm::CMN_reg_A1( proc_type& proc, uint32_t instr )
             Shift_C( proc.R[m], s_.shift_t, s_.shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
 
-        uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], shifted, (uint32_t)0,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = shifted;
+        const uint32_t carry_in = 0;
 
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        proc.CPSR.V = overflow;
+        SetAddFlags( proc.CPSR, x, y, carry_in );
     }
 }
 
@@ -1185,10 +1176,10 @@ void arm::CMN_rsr_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.34, p.390)
         // Encoding-specific operations
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rs   = Bits( instr, 11,  8 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rs   = Bits< 11,  8 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t n = Rn;
         uint32_t m = Rm;
@@ -1196,19 +1187,16 @@ void arm::CMN_rsr_A1( proc_type& proc, uint32_t instr )
 
         SRType shift_t = DecodeRegShift( type );
 
-        if( n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
-        uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+        if( n == 15 || m == 15 || s == 15 ) ARMV7_UNPREDICTABLE( CMN_rsr_A1 );
+        uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry c_ = Shift_C( proc.R[m], shift_t, shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
 
-        uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], shifted, (uint32_t)0,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = shifted;
+        const uint32_t carry_in = 0;
 
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        proc.CPSR.V = overflow;
+        SetAddFlags( proc.CPSR, x, y, carry_in );
     }
 }
 
@@ -1221,21 +1209,18 @@ void arm::CMP_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.35, p.392)
         // Encoding-specific operations
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         uint32_t n = Rn;
 
         uint32_t imm32 = ARMExpandImm( proc, imm12 );
 
-        uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], NOT( imm32 ), (uint32_t)1,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = NOT( imm32 );
+        const uint32_t carry_in = 1;
 
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        proc.CPSR.V = overflow;
+        SetAddFlags( proc.CPSR, x, y, carry_in );
     }
 }
 
@@ -1248,10 +1233,10 @@ void arm::CMP_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.36, p.394)
         // Encoding-specific operations
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t n = Rn;
         uint32_t m = Rm;
@@ -1262,14 +1247,11 @@ void arm::CMP_reg_A1( proc_type& proc, uint32_t instr )
             Shift_C( proc.R[m], s_.shift_t, s_.shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
 
-        uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], NOT( shifted ), (uint32_t)1,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = NOT( shifted );
+        const uint32_t carry_in = 1;
 
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        proc.CPSR.V = overflow;
+        SetAddFlags( proc.CPSR, x, y, carry_in );
     }
 }
 
@@ -1281,10 +1263,10 @@ void arm::CMP_rsr_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.37, p.396)
         // Encoding-specific operations
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rs   = Bits( instr, 11,  8 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rs   = Bits< 11,  8 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t n = Rn;
         uint32_t m = Rm;
@@ -1292,19 +1274,16 @@ void arm::CMP_rsr_A1( proc_type& proc, uint32_t instr )
 
         SRType shift_t = DecodeRegShift( type );
 
-        if( n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
-        uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+        if( n == 15 || m == 15 || s == 15 ) ARMV7_UNPREDICTABLE( CMP_rsr_A1 );
+        uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry c_ = Shift_C( proc.R[m], shift_t, shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
 
-        uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], NOT( shifted ), (uint32_t)1,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = NOT( shifted );
+        const uint32_t carry_in = 1;
 
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        proc.CPSR.V = overflow;
+        SetAddFlags( proc.CPSR, x, y, carry_in );
     }
 }
 
@@ -1316,10 +1295,10 @@ void arm::EOR_imm_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.44, p.406)
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -1345,10 +1324,7 @@ void arm::EOR_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                //proc.CPSR.V = overflow; UNCHANGED
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -1362,12 +1338,12 @@ void arm::EOR_reg_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.45, p.432)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         if( (Rd == 15) && (S == 1) )
         {
@@ -1398,10 +1374,7 @@ void arm::EOR_reg_A1( proc_type& proc, uint32_t instr )
 
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                //proc.CPSR.V = overflow; UNCHANGED
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -1415,12 +1388,12 @@ void arm::EOR_rsr_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.46, p.410)
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t Rn   = Bits( instr, 19, 16 );
-        uint32_t Rd   = Bits( instr, 15, 12 );
-        uint32_t Rs   = Bits( instr, 11,  8 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t Rm   = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t Rn   = Bits< 19, 16 >( instr );
+        uint32_t Rd   = Bits< 15, 12 >( instr );
+        uint32_t Rs   = Bits< 11,  8 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t Rm   = Bits<  3,  0 >( instr );
 
         uint32_t d = Rd;
         uint32_t n = Rn;
@@ -1429,8 +1402,9 @@ void arm::EOR_rsr_A1( proc_type& proc, uint32_t instr )
         bool setflags  = (S == 1);
         SRType shift_t = DecodeRegShift( type );
 
-        if( d == 15 || n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
-        uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+        if( d == 15 || n == 15 || m == 15 || s == 15 )
+            ARMV7_UNPREDICTABLE( EOR_rsr_A1 );
+        uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry c_ = Shift_C( proc.R[m], shift_t, shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
         uint32_t carry = c_.carry;
@@ -1441,10 +1415,7 @@ void arm::EOR_rsr_A1( proc_type& proc, uint32_t instr )
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            //proc.CPSR.V = overflow; UNCHANGED
+            SetLogicalFlags( proc.CPSR, result, carry );
         }
     }
 }
@@ -1457,9 +1428,9 @@ void arm::LDM_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.53, p.422)
         // Encoding-specific operations
-        uint32_t W             = Bits( instr, 21, 21 );
-        uint32_t Rn            = Bits( instr, 19, 16 );
-        uint32_t register_list = Bits( instr, 15,  0 );
+        uint32_t W             = Bits< 21, 21 >( instr );
+        uint32_t Rn            = Bits< 19, 16 >( instr );
+        uint32_t register_list = Bits< 15,  0 >( instr );
 
         if( W == 1 && Rn == 13 
             && ( BitCount( register_list ) >= 2 ) )
@@ -1472,27 +1443,18 @@ void arm::LDM_A1( proc_type& proc, uint32_t instr )
         uint32_t registers = register_list;
         bool wback = (W == 1);
 
-        if( n == 15 || BitCount( registers ) < 1) UNPREDICTABLE;
-        if( wback && (Bits( registers, n, n ) == 1) && ArchVersion() >= 7 )
-            UNPREDICTABLE;
+        if( n == 15 || BitCount( registers ) < 1) ARMV7_UNPREDICTABLE( LDM_A1 );
+        if( wback && (Bits( registers, n, n ) == 1) &&
+            ArchVersion( proc ) >= 7 )
+        {
+            ARMV7_UNPREDICTABLE( LDM_A1 );
+        }
 
         NullCheckIfThumbEE( proc, n );
         uint32_t address = proc.R[n];
 
-        for(uint32_t i = 0; i <= 14; ++i)
-        {
-            if( Bits( registers, i, i ) == 1 )
-            {
-                // MemA
-                proc.R[i] = proc.dMem.read_word( address );
-                address += 4;
-            }
-        }
-
-        if( Bits( registers, 15, 15 ) == 1 )
-        {
-            LoadWritePC( proc, proc.dMem.read_word( address ) );
-        }
+        // MemA
+        LoadMultiple( proc, address, registers );
 
         if( wback && (Bits( registers, n, n ) == 0) )
         {
@@ -1514,33 +1476,27 @@ void arm::LDMDA_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.54, p.424)
         // Encoding-specific operations
-        uint32_t W             = Bits( instr, 21, 21 );
-        uint32_t Rn            = Bits( instr, 19, 16 );
-        uint32_t register_list = Bits( instr, 15,  0 );
+        uint32_t W             = Bits< 21, 21 >( instr );
+        uint32_t Rn            = Bits< 19, 16 >( instr );
+        uint32_t register_list = Bits< 15,  0 >( instr );
 
         uint32_t n = Rn;
         uint32_t registers = register_list;
         bool wback = (W == 1);
 
-        if( n == 15 || BitCount( registers ) < 1) UNPREDICTABLE;
-        if( wback && (Bits( registers, n, n ) == 1) && ArchVersion() >= 7 )
-            UNPREDICTABLE;
-        uint32_t address = proc.R[n] - 4*BitCount( registers ) + 4;
-
-        for(uint32_t i = 0; i <= 14; ++i)
+        if( n == 15 || BitCount( registers ) < 1)
         {
-            if( Bits( registers, i, i ) == 1 )
-            {
-                // MemA
-                proc.R[i] = proc.dMem.read_word( address );
-                address += 4;
-            }
+            ARMV7_UNPREDICTABLE( LDMDA_A1 );
         }
-
-        if( Bits( registers, 15, 15 ) == 1 )
+        if( wback && (Bits( registers, n, n ) == 1) &&
+            ArchVersion( proc ) >= 7 )
         {
-            LoadWritePC( proc, proc.dMem.read_word( address ) );
+            ARMV7_UNPREDICTABLE( LDMDA_A1 );
         }
+        uint32_t address = proc.R[n] - 4*BitCount( registers ) + 4;
+
+        // MemA
+        LoadMultiple( proc, address, registers );
 
         if( wback && (Bits( registers, n, n ) == 0) )
         {
@@ -1563,36 +1519,30 @@ void arm::LDMDB_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.55, p.426)
         // Encoding-specific operations
-        uint32_t W             = Bits( instr, 21, 21 );
-        uint32_t Rn            = Bits( instr, 19, 16 );
-        uint32_t register_list = Bits( instr, 15,  0 );
+        uint32_t W             = Bits< 21, 21 >( instr );
+        uint32_t Rn            = Bits< 19, 16 >( instr );
+        uint32_t register_list = Bits< 15,  0 >( instr );
 
         uint32_t n = Rn;
         uint32_t registers = register_list;
         bool wback = (W == 1);
 
-        if( n == 15 || BitCount( registers ) < 1) UNPREDICTABLE;
-        if( wback && (Bits( registers, n, n ) == 1) && ArchVersion() >= 7 )
-            UNPREDICTABLE;
-
-        NullCheckIfThumbEE( proc, n );
-        uint32_t address = proc.R[n] - 4*BitCount( registers );
-
-        for(uint32_t i = 0; i <= 14; ++i)
+        if( n == 15 || BitCount( registers ) < 1)
         {
-            if( Bits( registers, i, i ) == 1 )
-            {
-                // MemA
-                proc.R[i] = proc.dMem.read_word( address );
-                address += 4;
-            }
+            ARMV7_UNPREDICTABLE( LDMDB_A1 );
         }
-
-        if( Bits( registers, 15, 15 ) == 1 )
+        if( wback && (Bits( registers, n, n ) == 1) &&
+            ArchVersion( proc ) >= 7 )
         {
-            LoadWritePC( proc, proc.dMem.read_word( address ) );
+            ARMV7_UNPREDICTABLE( LDMDB_A1 );
         }
 
+        NullCheckIfThumbEE( proc, n );
+        uint32_t address = proc.R[n] - 4*BitCount( registers );
+
+        // MemA
+        LoadMultiple( proc, address, registers );
+
         if( wback && (Bits( registers, n, n ) == 0) )
         {
             proc.R[n] -= 4*BitCount( registers );
@@ -1613,35 +1563,29 @@ void arm::LDMIB_A1( proc_type& proc, uint32_t instr )
     {
         // (A8.6.56, p.428)
         // Encoding-specific operations
-        uint32_t W             = Bits( instr, 21, 21 );
-        uint32_t Rn            = Bits( instr, 19, 16 );
-        uint32_t register_list = Bits( instr, 15,  0 );
+        uint32_t W             = Bits< 21, 21 >( instr );
+        uint32_t Rn            = Bits< 19, 16 >( instr );
+        uint32_t register_list = Bits< 15,  0 >( instr );
 
         uint32_t n = Rn;
         uint32_t registers = register_list;
         bool wback = (W == 1);
 
-        if( n == 15 || BitCount( registers ) < 1) UNPREDICTABLE;
-        if( wback && (Bits( registers, n, n ) == 1) && ArchVersion() >= 7 )
-            UNPREDICTABLE;
-
-        uint32_t address = proc.R[n] + 4;
-
-        for(uint32_t i = 0; i <= 14; ++i)
+        if( n == 15 || BitCount( registers ) < 1)
         {
-            if( Bits( registers, i, i ) == 1 )
-            {
-                // MemA
-                proc.R[i] = proc.dMem.read_word( address );
-                address += 4;
-            }
+            ARMV7_UNPREDICTABLE( LDMIB_A1 );
         }
-
-        if( Bits( registers, 15, 15 ) == 1 )
+        if( wback && (Bits( registers, n, n ) == 1) &&
+            ArchVersion( proc ) >= 7 )
         {
-            LoadWritePC( proc, proc.dMem.read_word( address ) );
+            ARMV7_UNPREDICTABLE( LDMIB_A1 );
         }
 
+        uint32_t address = proc.R[n] + 4;
+
+        // MemA
+        LoadMultiple( proc, address, registers );
+
         if( wback && (Bits( registers, n, n ) == 0) )
         {
             proc.R[n] += 4*BitCount( registers );
@@ -1662,12 +1606,12 @@ void arm::LDR_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
         
         if( Rn == 0b1111 )
         {
@@ -1679,7 +1623,7 @@ void arm::LDR_imm_A1( proc_type& proc, uint32_t instr )
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRT
-            if( Bits( instr, 25, 25 ) == 0 )
+            if( Bits< 25, 25 >( instr ) == 0 )
             {
                 arm::LDRT_A1( proc, instr );
             }
@@ -1706,7 +1650,7 @@ void arm::LDR_imm_A1( proc_type& proc, uint32_t instr )
         bool add       = (U == 1);
         bool wback     = (P == 0) || (W == 1);
         
-        if( wback && (n == t) ) UNPREDICTABLE;
+        if( wback && (n == t) ) ARMV7_UNPREDICTABLE( LDR_imm_A1 );
     
         uint32_t offset_addr;
         if( add )
@@ -1729,7 +1673,7 @@ void arm::LDR_imm_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemU
-        uint32_t data = proc.dMem.read_word( address );
+        uint32_t data = MemReadWord( proc, address );
         if( wback )
         {
             proc.R[n] = offset_addr;
@@ -1737,20 +1681,20 @@ void arm::LDR_imm_A1( proc_type& proc, uint32_t instr )
 
         if( t == 15 )
         {
-            if( Bits( address, 1, 0 ) == 0 )
+            if( Bits< 1, 0 >( address ) == 0 )
             {
                 LoadWritePC( proc, data );
             }
-            else UNPREDICTABLE
+            else ARMV7_UNPREDICTABLE( LDR_imm_A1 )
         }
-        else if( UnalignedSupport() || (Bits( address, 1, 0 ) == 0) )
+        else if( UnalignedSupport( proc ) || (Bits< 1, 0 >( address ) == 0) )
         {
             proc.R[t] = data;
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = ROR( data, 8*Bits( address, 1, 0 ) );
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = ROR( data, 8*Bits< 1, 0 >( address ) );
+        }
     }
 }
 
@@ -1762,9 +1706,9 @@ void arm::LDR_lit_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         uint32_t t     = Rt;
         uint32_t imm32 = ZeroExtend( imm12 );
@@ -1784,31 +1728,31 @@ void arm::LDR_lit_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemU
-        uint32_t data = proc.dMem.read_word( address );
+        uint32_t data = MemReadWord( proc, address );
 
         if( t == 15 )
         {
-            if( Bits( address, 1,  0 ) == 0 )
+            if( Bits< 1,  0 >( address ) == 0 )
             {
                 LoadWritePC( proc, data );
             }
-            else UNPREDICTABLE
+            else ARMV7_UNPREDICTABLE( LDR_lit_A1 )
         }
-        else if( UnalignedSupport() || (Bits( address, 1,  0 ) == 0) )
+        else if( UnalignedSupport( proc ) || (Bits< 1,  0 >( address ) == 0) )
         {
             proc.R[t] = data;
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
-        //    {
-        //        proc.R[t] = ROR( data, 8*Bits( address, 1, 0 ) );
-        //    }
-        //    else
-        //    {
-        //        proc.R[t] = 0; // UNKNOWN
-        //    }
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
+            {
+                proc.R[t] = ROR( data, 8*Bits< 1, 0 >( address ) );
+            }
+            else
+            {
+                proc.R[t] = 0; // UNKNOWN
+            }
+        }
     }
 }
 
@@ -1820,19 +1764,19 @@ void arm::LDR_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm5  = Bits( instr, 11,  7 );
-        uint32_t type  = Bits( instr,  6,  5 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm5  = Bits< 11,  7 >( instr );
+        uint32_t type  = Bits<  6,  5 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRT
-            if( Bits( instr, 25, 25 ) == 0 )
+            if( Bits< 25, 25 >( instr ) == 0 )
             {
                 arm::LDRT_A1( proc, instr );
             }
@@ -1851,9 +1795,13 @@ void arm::LDR_reg_A1( proc_type& proc, uint32_t instr )
         bool wback = (P == 0) || (W == 1);
         ShiftUValue s_ = DecodeImmShift( type, imm5 );
     
-        if( m == 15 ) UNPREDICTABLE;
-        if( wback && ((n == 15) || (n == t)) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && wback && (m == n) ) UNPREDICTABLE;
+        if( m == 15 ) ARMV7_UNPREDICTABLE( LDR_reg_A1 );
+        if( wback && ((n == 15) || (n == t)) )
+        {
+            ARMV7_UNPREDICTABLE( LDR_reg_A1 );
+        }
+        if( (ArchVersion( proc ) < 6) && wback && (m == n) )
+            ARMV7_UNPREDICTABLE( LDR_reg_A1 );
     
         NullCheckIfThumbEE( proc, n );
 
@@ -1879,7 +1827,7 @@ void arm::LDR_reg_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemU
-        uint32_t data = proc.dMem.read_word( address );
+        uint32_t data = MemReadWord( proc, address );
         if( wback )
         {
             proc.R[n] = offset_addr;
@@ -1887,27 +1835,27 @@ void arm::LDR_reg_A1( proc_type& proc, uint32_t instr )
 
         if( t == 15 )
         {
-            if( Bits( address, 1,  0 ) == 0 )
+            if( Bits< 1,  0 >( address ) == 0 )
             {
                 LoadWritePC( proc, data );
             }
-            else UNPREDICTABLE
+            else ARMV7_UNPREDICTABLE( LDR_reg_A1 )
         }
-        else if( UnalignedSupport() || (Bits( address, 1,  0 ) == 0) )
+        else if( UnalignedSupport( proc ) || (Bits< 1,  0 >( address ) == 0) )
         {
             proc.R[t] = data;
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
-        //    {
-        //        proc.R[t] = ROR( data, 8*Bits( address, 1, 0 ) );
-        //    }
-        //    else
-        //    {
-        //        proc.R[t] = 0; // UNKNOWN
-        //    }
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
+            {
+                proc.R[t] = ROR( data, 8*Bits< 1, 0 >( address ) );
+            }
+            else
+            {
+                proc.R[t] = 0; // UNKNOWN
+            }
+        }
     }
 }
 
@@ -1920,12 +1868,12 @@ void arm::LDRB_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         if( Rn == 0b1111 )
         {
@@ -1937,7 +1885,7 @@ void arm::LDRB_imm_A1( proc_type& proc, uint32_t instr )
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRBT
-            if( Bits( instr, 25, 25 ) == 0 )
+            if( Bits< 25, 25 >( instr ) == 0 )
             {
                 arm::LDRBT_A1( proc, instr );
             }
@@ -1955,7 +1903,10 @@ void arm::LDRB_imm_A1( proc_type& proc, uint32_t instr )
         bool add       = (U == 1);
         bool wback     = (P == 0) || (W == 1);
     
-        if( (t == 15) || (wback && (n == t)) ) UNPREDICTABLE;
+        if( (t == 15) || (wback && (n == t)) )
+        {
+            ARMV7_UNPREDICTABLE( LDRB_imm_A1 );
+        }
         
         uint32_t offset_addr;
         if( add )
@@ -1995,15 +1946,15 @@ void arm::LDRB_lit_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         uint32_t t     = Rt;
         uint32_t imm32 = ZeroExtend( imm12 );
         bool add       = (U == 1);
     
-        if( t == 15 ) UNPREDICTABLE;
+        if( t == 15 ) ARMV7_UNPREDICTABLE( LDRB_lit_A1 );
         NullCheckIfThumbEE( proc, 15 );
 
         uint32_t base = Align( proc.PC, 4 );
@@ -2031,19 +1982,19 @@ void arm::LDRB_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm5  = Bits( instr, 11,  7 );
-        uint32_t type  = Bits( instr,  6,  5 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm5  = Bits< 11,  7 >( instr );
+        uint32_t type  = Bits<  6,  5 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRBT
-            if( Bits( instr, 25, 25 ) == 0 )
+            if( Bits< 25, 25 >( instr ) == 0 )
             {
                 arm::LDRBT_A1( proc, instr );
             }
@@ -2062,9 +2013,13 @@ void arm::LDRB_reg_A1( proc_type& proc, uint32_t instr )
         bool wback = (P == 0) || (W == 1);
         ShiftUValue s_ = DecodeImmShift( type, imm5 );
     
-        if( (t == 15) || (m == 15) ) UNPREDICTABLE;
-        if( wback && ((n == 15) || (n == t)) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && wback && (m == n) ) UNPREDICTABLE;
+        if( (t == 15) || (m == 15) ) ARMV7_UNPREDICTABLE( LDRB_reg_A1 );
+        if( wback && ((n == 15) || (n == t)) )
+        {
+            ARMV7_UNPREDICTABLE( LDRB_reg_A1 );
+        }
+        if( (ArchVersion( proc ) < 6) && wback && (m == n) )
+            ARMV7_UNPREDICTABLE( LDRB_reg_A1 );
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset =
@@ -2108,10 +2063,10 @@ void arm::LDRBT_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -2120,7 +2075,10 @@ void arm::LDRBT_A1( proc_type& proc, uint32_t instr )
         bool register_form = false;
         uint32_t imm32     = ZeroExtend( imm12 );
     
-        if( (t == 15) || (n == 15) || (n == t) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) )
+        {
+            ARMV7_UNPREDICTABLE( LDRBT_A1 );
+        }
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset;
@@ -2173,12 +2131,12 @@ void arm::LDRBT_A2( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm5  = Bits( instr, 11,  7 );
-        uint32_t type  = Bits( instr,  6,  5 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm5  = Bits< 11,  7 >( instr );
+        uint32_t type  = Bits<  6,  5 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -2188,8 +2146,12 @@ void arm::LDRBT_A2( proc_type& proc, uint32_t instr )
         bool register_form = true;
         ShiftUValue s_     = DecodeImmShift( type, imm5 );
     
-        if( (t == 15) || (n == 15) || (n == t) || (m == 15) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && (m == n) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) || (m == 15) )
+            ARMV7_UNPREDICTABLE( LDRBT_A2 );
+        if( (ArchVersion( proc ) < 6) && (m == n) )
+        {
+            ARMV7_UNPREDICTABLE( LDRBT_A2 );
+        }
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset;
@@ -2241,13 +2203,13 @@ void arm::LDRD_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         if( Rn == 0b1111 )
         {
@@ -2256,7 +2218,7 @@ void arm::LDRD_imm_A1( proc_type& proc, uint32_t instr )
             return;
         }
     
-        if( Bits( Rt, 0, 0 ) == 1 );    // UNDEFINED
+        if( Bits< 0, 0 >( Rt ) == 1 );    // UNDEFINED
     
         uint32_t t     = Rt;
         uint32_t t2    = t + 1;
@@ -2266,9 +2228,12 @@ void arm::LDRD_imm_A1( proc_type& proc, uint32_t instr )
         bool add       = (U == 1);
         bool wback     = (P == 0) || (W == 1);
     
-        if( (P == 0) && (W == 1) ) UNPREDICTABLE;
-        if( wback && ((n == t) || (n == t2)) ) UNPREDICTABLE;
-        if( (t2 == 15) ) UNPREDICTABLE;
+        if( (P == 0) && (W == 1) ) ARMV7_UNPREDICTABLE( LDRD_imm_A1 );
+        if( wback && ((n == t) || (n == t2)) )
+        {
+            ARMV7_UNPREDICTABLE( LDRD_imm_A1 );
+        }
+        if( (t2 == 15) ) ARMV7_UNPREDICTABLE( LDRD_imm_A1 );
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset_addr;
@@ -2292,8 +2257,10 @@ void arm::LDRD_imm_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemA
-        proc.R[t] = ZeroExtend( proc.dMem.read_word( address ) );
-        proc.R[t2] = ZeroExtend( proc.dMem.read_word( address + 4 ) );
+        uint32_t data[2];
+        MemReadWords( proc, address, data, 2 );
+        proc.R[t]  = data[0];
+        proc.R[t2] = data[1];
 
         if( wback )
         {
@@ -2311,19 +2278,19 @@ void arm::LDRD_lit_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
-        if( Bits( Rt, 0, 0 ) == 1 );    // UNDEFINED
+        if( Bits< 0, 0 >( Rt ) == 1 );    // UNDEFINED
     
         uint32_t t     = Rt;
         uint32_t t2    = t + 1;
         uint32_t imm32 = ZeroExtend( (imm4H << 4) | imm4L );
         bool add       = (U == 1);
     
-        if( t2 == 15 ) UNPREDICTABLE;
+        if( t2 == 15 ) ARMV7_UNPREDICTABLE( LDRD_lit_A1 );
         NullCheckIfThumbEE( proc, 15 );
 
         uint32_t address;
@@ -2337,8 +2304,10 @@ void arm::LDRD_lit_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemA
-        proc.R[t] = ZeroExtend( proc.dMem.read_word( address ) );
-        proc.R[t2] = ZeroExtend( proc.dMem.read_word( address + 4 ) );
+        uint32_t data[2];
+        MemReadWords( proc, address, data, 2 );
+        proc.R[t]  = data[0];
+        proc.R[t2] = data[1];
     }
 }
 
@@ -2351,14 +2320,14 @@ void arm::LDRD_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
-        if( Bits( Rt, 0, 0 ) == 1 );    // UNDEFINED
+        if( Bits< 0, 0 >( Rt ) == 1 );    // UNDEFINED
     
         uint32_t t     = Rt;
         uint32_t t2    = t + 1;
@@ -2368,10 +2337,13 @@ void arm::LDRD_reg_A1( proc_type& proc, uint32_t instr )
         bool add       = (U == 1);
         bool wback     = (P == 0) || (W == 1);
     
-        if( (P == 0) && (W == 1) ) UNPREDICTABLE;
-        if( (t2 == 15) || (m == 15) || (m == t) || (m == t2) ) UNPREDICTABLE;
-        if( wback && ((n == 15) || (n == t) || (n == t2)) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && wback && (m == n) ) UNPREDICTABLE;
+        if( (P == 0) && (W == 1) ) ARMV7_UNPREDICTABLE( LDRD_reg_A1 );
+        if( (t2 == 15) || (m == 15) || (m == t) || (m == t2) )
+            ARMV7_UNPREDICTABLE( LDRD_reg_A1 );
+        if( wback && ((n == 15) || (n == t) || (n == t2)) )
+            ARMV7_UNPREDICTABLE( LDRD_reg_A1 );
+        if( (ArchVersion( proc ) < 6) && wback && (m == n) )
+            ARMV7_UNPREDICTABLE( LDRD_reg_A1 );
         uint32_t offset_addr;
         if( add )
         {
@@ -2393,8 +2365,10 @@ void arm::LDRD_reg_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemA
-        proc.R[t] = ZeroExtend( proc.dMem.read_word( address ) );
-        proc.R[t2] = ZeroExtend( proc.dMem.read_word( address + 4 ) );
+        uint32_t data[2];
+        MemReadWords( proc, address, data, 2 );
+        proc.R[t]  = data[0];
+        proc.R[t2] = data[1];
 
         if( wback )
         {
@@ -2404,6 +2378,108 @@ void arm::LDRD_reg_A1( proc_type& proc, uint32_t instr )
 }
 
 
+template< typename proc_type >
+void arm::LDREX_A1( proc_type& proc, uint32_t instr )
+{
+    // (A8.6.69, p.454)
+    // Operation
+    if ( ConditionPassed( proc, instr ) )
+    {
+        // Encoding-specific operations
+        uint32_t Rn = Bits< 19, 16 >( instr );
+        uint32_t Rt = Bits< 15, 12 >( instr );
+
+        uint32_t t = Rt;
+        uint32_t n = Rn;
+
+        if( t == 15 || n == 15 ) ARMV7_UNPREDICTABLE( LDREX_A1 );
+
+        uint32_t address = proc.R[n];
+        SetExclusiveMonitors( proc, address, 4 );
+        // MemA
+        proc.R[t] = MemAReadWord( proc, address );
+    }
+}
+
+
+template< typename proc_type >
+void arm::LDREXB_A1( proc_type& proc, uint32_t instr )
+{
+    // (A8.6.70, p.456)
+    // Operation
+    if ( ConditionPassed( proc, instr ) )
+    {
+        // Encoding-specific operations
+        uint32_t Rn = Bits< 19, 16 >( instr );
+        uint32_t Rt = Bits< 15, 12 >( instr );
+
+        uint32_t t = Rt;
+        uint32_t n = Rn;
+
+        if( t == 15 || n == 15 ) ARMV7_UNPREDICTABLE( LDREXB_A1 );
+
+        uint32_t address = proc.R[n];
+        SetExclusiveMonitors( proc, address, 1 );
+        // MemA
+        proc.R[t] = ZeroExtend( proc.dMem.read_byte( address ) );
+    }
+}
+
+
+template< typename proc_type >
+void arm::LDREXD_A1( proc_type& proc, uint32_t instr )
+{
+    // (A8.6.71, p.458)
+    // Operation
+    if ( ConditionPassed( proc, instr ) )
+    {
+        // Encoding-specific operations
+        uint32_t Rn = Bits< 19, 16 >( instr );
+        uint32_t Rt = Bits< 15, 12 >( instr );
+
+        uint32_t t = Rt;
+        uint32_t n = Rn;
+
+        uint32_t t2 = t + 1;
+
+        if( Bits< 0, 0 >( Rt ) == 1 || Rt == 14 || n == 15 )
+            ARMV7_UNPREDICTABLE( LDREXD_A1 );
+
+        uint32_t address = proc.R[n];
+        SetExclusiveMonitors( proc, address, 8 );
+        // MemA[address,8]
+        uint32_t data[2];
+        MemReadWords( proc, address, data, 2, 8 );
+        proc.R[t]  = data[0];
+        proc.R[t2] = data[1];
+    }
+}
+
+
+template< typename proc_type >
+void arm::LDREXH_A1( proc_type& proc, uint32_t instr )
+{
+    // (A8.6.72, p.460)
+    // Operation
+    if ( ConditionPassed( proc, instr ) )
+    {
+        // Encoding-specific operations
+        uint32_t Rn = Bits< 19, 16 >( instr );
+        uint32_t Rt = Bits< 15, 12 >( instr );
+
+        uint32_t t = Rt;
+        uint32_t n = Rn;
+
+        if( t == 15 || n == 15 ) ARMV7_UNPREDICTABLE( LDREXH_A1 );
+
+        uint32_t address = proc.R[n];
+        SetExclusiveMonitors( proc, address, 2 );
+        // MemA
+        proc.R[t] = ZeroExtend( MemAReadHalf( proc, address ) );
+    }
+}
+
+
 template< typename proc_type >
 void arm::LDRH_imm_A1( proc_type& proc, uint32_t instr )
 {
@@ -2412,13 +2488,13 @@ void arm::LDRH_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         if( Rn == 0b1111 )
         {
@@ -2430,7 +2506,7 @@ void arm::LDRH_imm_A1( proc_type& proc, uint32_t instr )
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRHT
-            if( Bits( instr,  22,  22 ) == 1 )
+            if( Bits<  22,  22 >( instr ) == 1 )
             {
                 arm::LDRHT_A1( proc, instr );
             }
@@ -2448,7 +2524,10 @@ void arm::LDRH_imm_A1( proc_type& proc, uint32_t instr )
         bool add       = (U == 1);
         bool wback     = (P == 0) || (W == 1);
     
-        if( (t == 15) || (wback && (n == t)) ) UNPREDICTABLE;
+        if( (t == 15) || (wback && (n == t)) )
+        {
+            ARMV7_UNPREDICTABLE( LDRH_imm_A1 );
+        }
         
         uint32_t offset_addr;
         if( add )
@@ -2471,21 +2550,21 @@ void arm::LDRH_imm_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemU
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
         if( wback )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = ZeroExtend( data );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -2497,16 +2576,16 @@ void arm::LDRH_lit_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         uint32_t t     = Rt;
         uint32_t imm32 = ZeroExtend( (imm4H << 4) | imm4L );
         bool add       = (U == 1);
     
-        if( t == 15 ) UNPREDICTABLE;
+        if( t == 15 ) ARMV7_UNPREDICTABLE( LDRH_lit_A1 );
         NullCheckIfThumbEE( proc, 15 );
 
         uint32_t base = Align( proc.PC, 4 );
@@ -2521,16 +2600,16 @@ void arm::LDRH_lit_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemU
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = ZeroExtend( data );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -2543,17 +2622,17 @@ void arm::LDRH_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRHT
-            if( Bits( instr,  22,  22 ) == 1 )
+            if( Bits<  22,  22 >( instr ) == 1 )
             {
                 arm::LDRHT_A1( proc, instr );
             }
@@ -2574,9 +2653,13 @@ void arm::LDRH_reg_A1( proc_type& proc, uint32_t instr )
         s_.shift_t = arm::SRType_LSL;
         s_.shift_n = 0;
     
-        if( (t == 15) || (m == 15) ) UNPREDICTABLE;
-        if( wback && ((n == 15) || (n == t)) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && wback && (m == n) ) UNPREDICTABLE;
+        if( (t == 15) || (m == 15) ) ARMV7_UNPREDICTABLE( LDRH_reg_A1 );
+        if( wback && ((n == 15) || (n == t)) )
+        {
+            ARMV7_UNPREDICTABLE( LDRH_reg_A1 );
+        }
+        if( (ArchVersion( proc ) < 6) && wback && (m == n) )
+            ARMV7_UNPREDICTABLE( LDRH_reg_A1 );
     
         NullCheckIfThumbEE( proc, n );
 
@@ -2602,21 +2685,21 @@ void arm::LDRH_reg_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemU
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
         if( wback )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = ZeroExtend( data );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -2629,11 +2712,11 @@ void arm::LDRHT_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -2642,7 +2725,10 @@ void arm::LDRHT_A1( proc_type& proc, uint32_t instr )
         //bool register_form = false;
         uint32_t imm32 = ZeroExtend( (imm4H << 4) | imm4L );
     
-        if( (t == 15) || (n == 15) || (n == t) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) )
+        {
+            ARMV7_UNPREDICTABLE( LDRHT_A1 );
+        }
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset;
@@ -2676,21 +2762,21 @@ void arm::LDRHT_A1( proc_type& proc, uint32_t instr )
         //}
 
         // MemU_unpriv
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
         if( postindex )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = ZeroExtend( data );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -2703,10 +2789,10 @@ void arm::LDRHT_A2( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -2715,7 +2801,8 @@ void arm::LDRHT_A2( proc_type& proc, uint32_t instr )
         bool add           = (U == 1);
         bool register_form = true;
     
-        if( (t == 15) || (n == 15) || (n == t) || (m == 15) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) || (m == 15) )
+            ARMV7_UNPREDICTABLE( LDRHT_A2 );
         
         NullCheckIfThumbEE( proc, n );
 
@@ -2750,21 +2837,21 @@ void arm::LDRHT_A2( proc_type& proc, uint32_t instr )
         //}
 
         // MemU_unpriv
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
         if( postindex )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = ZeroExtend( data );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -2777,13 +2864,13 @@ void arm::LDRSB_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         if( Rn == 0b1111 )
         {
@@ -2795,7 +2882,7 @@ void arm::LDRSB_imm_A1( proc_type& proc, uint32_t instr )
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRSBT
-            if( Bits( instr, 22, 22 ) == 0 )
+            if( Bits< 22, 22 >( instr ) == 0 )
             {
                 arm::LDRSBT_A2( proc, instr );
             }
@@ -2813,7 +2900,10 @@ void arm::LDRSB_imm_A1( proc_type& proc, uint32_t instr )
         bool add       = (U == 1);
         bool wback     = (P == 0) || (W == 1);
     
-        if( (t == 15) || (wback && (n == t)) ) UNPREDICTABLE;
+        if( (t == 15) || (wback && (n == t)) )
+        {
+            ARMV7_UNPREDICTABLE( LDRSB_imm_A1 );
+        }
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset_addr;
@@ -2855,16 +2945,16 @@ void arm::LDRSB_lit_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         uint32_t t     = Rt;
         uint32_t imm32 = ZeroExtend( (imm4H << 4) | imm4L );
         bool add       = (U == 1);
     
-        if( t == 15 ) UNPREDICTABLE;
+        if( t == 15 ) ARMV7_UNPREDICTABLE( LDRSB_lit_A1 );
         NullCheckIfThumbEE( proc, 15 );
 
         uint32_t base = Align( proc.PC, 4 );
@@ -2892,17 +2982,17 @@ void arm::LDRSB_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRSBT
-            if( Bits( instr, 22, 22 ) == 0 )
+            if( Bits< 22, 22 >( instr ) == 0 )
             {
                 arm::LDRSBT_A2( proc, instr );
             }
@@ -2923,9 +3013,13 @@ void arm::LDRSB_reg_A1( proc_type& proc, uint32_t instr )
         s_.shift_t = arm::SRType_LSL;
         s_.shift_n = 0;
     
-        if( (t == 15) || (m == 15) ) UNPREDICTABLE;
-        if( wback && ((n == 15) || (n == t)) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && wback && (m == n) ) UNPREDICTABLE;
+        if( (t == 15) || (m == 15) ) ARMV7_UNPREDICTABLE( LDRSB_reg_A1 );
+        if( wback && ((n == 15) || (n == t)) )
+        {
+            ARMV7_UNPREDICTABLE( LDRSB_reg_A1 );
+        }
+        if( (ArchVersion( proc ) < 6) && wback && (m == n) )
+            ARMV7_UNPREDICTABLE( LDRSB_reg_A1 );
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset =
@@ -2968,11 +3062,11 @@ void arm::LDRSBT_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -2981,7 +3075,10 @@ void arm::LDRSBT_A1( proc_type& proc, uint32_t instr )
         //bool register_form = false;
         uint32_t imm32 = ZeroExtend( (imm4H << 4) | imm4L );
     
-        if( (t == 15) || (n == 15) || (n == t) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) )
+        {
+            ARMV7_UNPREDICTABLE( LDRSBT_A1 );
+        }
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset;
@@ -3033,10 +3130,10 @@ void arm::LDRSBT_A2( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -3045,7 +3142,8 @@ void arm::LDRSBT_A2( proc_type& proc, uint32_t instr )
         bool add           = (U == 1);
         bool register_form = true;
     
-        if( (t == 15) || (n == 15) || (n == t) || (m == 15) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) || (m == 15) )
+            ARMV7_UNPREDICTABLE( LDRSBT_A2 );
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset;
@@ -3097,13 +3195,13 @@ void arm::LDRSH_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         if( Rn == 0b1111 )
         {
@@ -3115,7 +3213,7 @@ void arm::LDRSH_imm_A1( proc_type& proc, uint32_t instr )
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRSHT
-            if( Bits( instr, 22, 22 ) == 1 )
+            if( Bits< 22, 22 >( instr ) == 1 )
             {
                 arm::LDRSHT_A1( proc, instr );
             }
@@ -3133,7 +3231,10 @@ void arm::LDRSH_imm_A1( proc_type& proc, uint32_t instr )
         bool add       = (U == 1);
         bool wback     = (P == 0) || (W == 1);
     
-        if( (t == 15) || (wback && (n == t)) ) UNPREDICTABLE;
+        if( (t == 15) || (wback && (n == t)) )
+        {
+            ARMV7_UNPREDICTABLE( LDRSH_imm_A1 );
+        }
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset_addr;
@@ -3157,21 +3258,21 @@ void arm::LDRSH_imm_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemU
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
         if( wback )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = SignExtend( data, 32, 16 );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -3184,16 +3285,16 @@ void arm::LDRSH_lit_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         uint32_t t     = Rt;
         uint32_t imm32 = ZeroExtend( (imm4H << 4) | imm4L );
         bool add       = (U == 1);
     
-        if( t == 15 ) UNPREDICTABLE;
+        if( t == 15 ) ARMV7_UNPREDICTABLE( LDRSH_lit_A1 );
         NullCheckIfThumbEE( proc, 15 );
 
         uint32_t base = Align( proc.PC, 4 );
@@ -3208,16 +3309,16 @@ void arm::LDRSH_lit_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemU
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = SignExtend( data, 32, 16 );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -3230,17 +3331,17 @@ void arm::LDRSH_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         if( (P == 0) && (W == 1) )
         {
             // SEE LDRSHT
-            if( Bits( instr, 22, 22 ) == 1 )
+            if( Bits< 22, 22 >( instr ) == 1 )
             {
                 arm::LDRSHT_A1( proc, instr );
             }
@@ -3261,9 +3362,13 @@ void arm::LDRSH_reg_A1( proc_type& proc, uint32_t instr )
         s_.shift_t = arm::SRType_LSL;
         s_.shift_n = 0;
     
-        if( (t == 15) || (m == 15) ) UNPREDICTABLE;
-        if( wback && ((n == 15) || (n == t)) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && wback && (m == n) ) UNPREDICTABLE;
+        if( (t == 15) || (m == 15) ) ARMV7_UNPREDICTABLE( LDRSH_reg_A1 );
+        if( wback && ((n == 15) || (n == t)) )
+        {
+            ARMV7_UNPREDICTABLE( LDRSH_reg_A1 );
+        }
+        if( (ArchVersion( proc ) < 6) && wback && (m == n) )
+            ARMV7_UNPREDICTABLE( LDRSH_reg_A1 );
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset =
@@ -3289,21 +3394,21 @@ void arm::LDRSH_reg_A1( proc_type& proc, uint32_t instr )
         }
 
         // MemU
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
         if( wback )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = SignExtend( data, 32, 16 );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -3316,11 +3421,11 @@ void arm::LDRSHT_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -3329,7 +3434,10 @@ void arm::LDRSHT_A1( proc_type& proc, uint32_t instr )
         //bool register_form = false;
         uint32_t imm32 = ZeroExtend( (imm4H << 4) | imm4L );
     
-        if( (t == 15) || (n == 15) || (n == t) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) )
+        {
+            ARMV7_UNPREDICTABLE( LDRSHT_A1 );
+        }
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset;
@@ -3363,21 +3471,21 @@ void arm::LDRSHT_A1( proc_type& proc, uint32_t instr )
         //}
 
         // MemU_unpriv
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
         if( postindex )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = SignExtend( data, 32, 16 );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -3390,10 +3498,10 @@ void arm::LDRSHT_A2( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -3402,7 +3510,8 @@ void arm::LDRSHT_A2( proc_type& proc, uint32_t instr )
         bool add           = (U == 1);
         bool register_form = true;
     
-        if( (t == 15) || (n == 15) || (n == t) || (m == 15) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) || (m == 15) )
+            ARMV7_UNPREDICTABLE( LDRSHT_A2 );
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset;
@@ -3436,21 +3545,21 @@ void arm::LDRSHT_A2( proc_type& proc, uint32_t instr )
         //}
 
         // MemU_unpriv
-        uint32_t data = proc.dMem.read_half( address );
+        uint32_t data = MemReadHalf( proc, address );
 
         if( postindex )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 0, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 0, 0 >( address ) == 0) )
         {
             proc.R[t] = SignExtend( data, 32, 16 );
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    proc.R[t] = 0; // UNKNOWN
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            proc.R[t] = 0; // UNKNOWN
+        }
     }
 }
 
@@ -3463,10 +3572,10 @@ void arm::LDRT_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -3475,7 +3584,7 @@ void arm::LDRT_A1( proc_type& proc, uint32_t instr )
         //bool register_form = false;
         uint32_t imm32 = ZeroExtend( imm12 );
     
-        if( (t == 15) || (n == 15) || (n == t) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) ) ARMV7_UNPREDICTABLE( LDRT_A1 );
         NullCheckIfThumbEE( proc, n );
 
         uint32_t offset;
@@ -3509,28 +3618,28 @@ void arm::LDRT_A1( proc_type& proc, uint32_t instr )
         //}
 
         // MemU_unpriv
-        uint32_t data = proc.dMem.read_word( address );
+        uint32_t data = MemReadWord( proc, address );
 
         if( postindex )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 1, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 1, 0 >( address ) == 0) )
         {
             proc.R[t] = data;
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
-        //    {
-        //        proc.R[t] = ROR( data, 8*Bits( address, 1, 0 ) );
-        //    }
-        //    else
-        //    {
-        //        proc.R[t] = 0; // UNKNOWN
-        //    }
-        //}
+        else // Without unaligned support (before ARMv7)
+        {
+            if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
+            {
+                proc.R[t] = ROR( data, 8*Bits< 1, 0 >( address ) );
+            }
+            else
+            {
+                proc.R[t] = 0; // UNKNOWN
+            }
+        }
     }
 }
 
@@ -3543,12 +3652,12 @@ void arm::LDRT_A2( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t Rn    = Bits( instr, 19, 16 );
-        uint32_t Rt    = Bits( instr, 15, 12 );
-        uint32_t imm5  = Bits( instr, 11,  7 );
-        uint32_t type  = Bits( instr,  6,  5 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t Rn    = Bits< 19, 16 >( instr );
+        uint32_t Rt    = Bits< 15, 12 >( instr );
+        uint32_t imm5  = Bits< 11,  7 >( instr );
+        uint32_t type  = Bits<  6,  5 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         uint32_t t         = Rt;
         uint32_t n         = Rn;
@@ -3558,8 +3667,12 @@ void arm::LDRT_A2( proc_type& proc, uint32_t instr )
         bool register_form = true;
         ShiftUValue s_     = DecodeImmShift( type, imm5 );
     
-        if( (t == 15) || (n == 15) || (n == t) || (m == 15) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && (m == n) ) UNPREDICTABLE;
+        if( (t == 15) || (n == 15) || (n == t) || (m == 15) )
+            ARMV7_UNPREDICTABLE( LDRT_A2 );
+        if( (ArchVersion( proc ) < 6) && (m == n) )
+        {
+            ARMV7_UNPREDICTABLE( LDRT_A2 );
+        }
         
         NullCheckIfThumbEE( proc, n );
 
@@ -3594,32 +3707,32 @@ void arm::LDRT_A2( proc_type& proc, uint32_t instr )
         //}
 
         // MemU_unpriv
-        uint32_t data = proc.dMem.read_word( address );
+        uint32_t data = MemReadWord( proc, address );
 
         if( postindex )
         {
             proc.R[n] = offset_addr;
         }
 
-        if( UnalignedSupport() || (Bits( address, 1, 0 ) == 0) )
+        if( UnalignedSupport( proc ) || (Bits< 1, 0 >( address ) == 0) )
         {
             proc.R[t] = data;
         }
-        //else // Can only apply before ARMv7
-        //{
-        //    if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
-        //    {
-        //        proc.R[t] = ROR( data, 8*Bits( address, 1, 0 ) );
-        //    }
-        //    else
-        //    {
-        //        proc.R[t] = 0; // UNKNOWN
-        //    }
-        //}
-    }
-}
-
-
+        else // Without unaligned support (before ARMv7)
+        {
+            if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
+            {
+                proc.R[t] = ROR( data, 8*Bits< 1, 0 >( address ) );
+            }
+            else
+            {
+                proc.R[t] = 0; // UNKNOWN
+            }
+        }
+    }
+}
+
+
 template< typename proc_type >
 void arm::LSL_imm_A1( proc_type& proc, uint32_t instr )
 {
@@ -3628,10 +3741,10 @@ void arm::LSL_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm5  = Bits( instr, 11,  7 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm5  = Bits< 11,  7 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         if( imm5 == 0 )
         {
@@ -3654,10 +3767,7 @@ void arm::LSL_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = c_.value;
             if( setflags )
             {
-                proc.CPSR.N = Bits( c_.value, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( c_.value );
-                proc.CPSR.C = c_.carry;
-                // proc.CPSR.V unchanged
+                SetLogicalFlags( proc.CPSR, c_.value, c_.carry );
             }
         }
     }
@@ -3672,18 +3782,21 @@ void arm::LSL_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr, 11,  8 );
-        uint32_t Rn    = Bits( instr,  3,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits< 11,  8 >( instr );
+        uint32_t Rn    = Bits<  3,  0 >( instr );
     
         uint32_t d         = Rd;
         uint32_t n         = Rn;
         uint32_t m         = Rm;
         bool setflags      = (S == 1);
     
-        if( (d == 15) || (n == 15) || (m == 15) ) UNPREDICTABLE;
-        uint32_t shift_n = Bits( proc.R[m],  7,  0 );
+        if( (d == 15) || (n == 15) || (m == 15) )
+        {
+            ARMV7_UNPREDICTABLE( LSL_reg_A1 );
+        }
+        uint32_t shift_n = Bits<  7,  0 >( proc.R[m] );
         UValueCarry c_;
         c_ = Shift_C( proc.R[n], arm::SRType_LSL, shift_n, proc.CPSR.C );
 
@@ -3691,10 +3804,7 @@ void arm::LSL_reg_A1( proc_type& proc, uint32_t instr )
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( c_.value, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( c_.value );
-            proc.CPSR.C = c_.carry;
-            // proc.CPSR.V unchanged
+            SetLogicalFlags( proc.CPSR, c_.value, c_.carry );
         }
     }
 }
@@ -3708,10 +3818,10 @@ void arm::LSR_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm5  = Bits( instr, 11,  7 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm5  = Bits< 11,  7 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         uint32_t d         = Rd;
         uint32_t m         = Rm;
@@ -3729,10 +3839,7 @@ void arm::LSR_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = c_.value;
             if( setflags )
             {
-                proc.CPSR.N = Bits( c_.value, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( c_.value );
-                proc.CPSR.C = c_.carry;
-                // proc.CPSR.V unchanged
+                SetLogicalFlags( proc.CPSR, c_.value, c_.carry );
             }
         }
     }
@@ -3747,19 +3854,22 @@ void arm::LSR_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr, 11,  8 );
-        uint32_t Rn    = Bits( instr,  3,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits< 11,  8 >( instr );
+        uint32_t Rn    = Bits<  3,  0 >( instr );
     
         uint32_t d         = Rd;
         uint32_t n         = Rn;
         uint32_t m         = Rm;
         bool setflags      = (S == 1);
     
-        if( (d == 15) || (n == 15) || (m == 15) ) UNPREDICTABLE;
+        if( (d == 15) || (n == 15) || (m == 15) )
+        {
+            ARMV7_UNPREDICTABLE( LSR_reg_A1 );
+        }
     
-        uint32_t shift_n = Bits( proc.R[m],  7,  0 );
+        uint32_t shift_n = Bits<  7,  0 >( proc.R[m] );
         UValueCarry c_;
         c_ = Shift_C( proc.R[n], arm::SRType_LSR, shift_n, proc.CPSR.C );
 
@@ -3767,10 +3877,7 @@ void arm::LSR_reg_A1( proc_type& proc, uint32_t instr )
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( c_.value, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( c_.value );
-            proc.CPSR.C = c_.carry;
-            // proc.CPSR.V unchanged
+            SetLogicalFlags( proc.CPSR, c_.value, c_.carry );
         }
     }
 }
@@ -3784,11 +3891,11 @@ void arm::MLA_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 19, 16 );
-        uint32_t Ra    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr, 11,  8 );
-        uint32_t Rn    = Bits( instr,  3,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 19, 16 >( instr );
+        uint32_t Ra    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits< 11,  8 >( instr );
+        uint32_t Rn    = Bits<  3,  0 >( instr );
     
         uint32_t d         = Rd;
         uint32_t n         = Rn;
@@ -3796,8 +3903,12 @@ void arm::MLA_A1( proc_type& proc, uint32_t instr )
         uint32_t a         = Ra;
         bool setflags      = (S == 1);
     
-        if( (d == 15) || (n == 15) || (m == 15) || (a == 15) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && (d == n) ) UNPREDICTABLE;
+        if( (d == 15) || (n == 15) || (m == 15) || (a == 15) )
+            ARMV7_UNPREDICTABLE( MLA_A1 );
+        if( (ArchVersion( proc ) < 6) && (d == n) )
+        {
+            ARMV7_UNPREDICTABLE( MLA_A1 );
+        }
         uint32_t operand1 = SInt( proc.R[n] );
         uint32_t operand2 = SInt( proc.R[m] );
         uint32_t addend   = SInt( proc.R[a] );
@@ -3807,9 +3918,9 @@ void arm::MLA_A1( proc_type& proc, uint32_t instr )
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
+            proc.CPSR.N = Bits< 31, 31 >( result );
             proc.CPSR.Z = IsZeroBit( result );
-            if( ArchVersion() == 4 )
+            if( ArchVersion( proc ) == 4 )
             {
                 proc.CPSR.C = 0; // bit UNKNOWN
             }
@@ -3828,17 +3939,18 @@ void arm::MLS_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t Rd    = Bits( instr, 19, 16 );
-        uint32_t Ra    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr, 11,  8 );
-        uint32_t Rn    = Bits( instr,  3,  0 );
+        uint32_t Rd    = Bits< 19, 16 >( instr );
+        uint32_t Ra    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits< 11,  8 >( instr );
+        uint32_t Rn    = Bits<  3,  0 >( instr );
     
         uint32_t d         = Rd;
         uint32_t n         = Rn;
         uint32_t m         = Rm;
         uint32_t a         = Ra;
     
-        if( (d == 15) || (n == 15) || (m == 15) || (a == 15) ) UNPREDICTABLE;
+        if( (d == 15) || (n == 15) || (m == 15) || (a == 15) )
+            ARMV7_UNPREDICTABLE( MLS_A1 );
     
         uint32_t operand1 = SInt( proc.R[n] );
         uint32_t operand2 = SInt( proc.R[m] );
@@ -3858,9 +3970,9 @@ void arm::MOV_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         if( (Rd == 0b1111) && (S == 1) )
         {
@@ -3885,10 +3997,7 @@ void arm::MOV_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                // proc.CPSR.V unchanged
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -3903,15 +4012,15 @@ void arm::MOV_imm_A2( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t imm4  = Bits( instr, 19, 16 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t imm4  = Bits< 19, 16 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         uint32_t d         = Rd;
         //bool setflags      = false;
         uint32_t imm32     = ZeroExtend( (imm4 << 12) | imm12 );
     
-        if( d == 15 ) UNPREDICTABLE;
+        if( d == 15 ) ARMV7_UNPREDICTABLE( MOV_imm_A2 );
     
         uint32_t result = imm32;
         if( d == 15 )   // Can only occur for encoding A1
@@ -3924,7 +4033,7 @@ void arm::MOV_imm_A2( proc_type& proc, uint32_t instr )
 
             //if( setflags )    // always false
             //{
-            //    proc.CPSR.N = Bits( result, 31, 31 );
+            //    proc.CPSR.N = Bits< 31, 31 >( result );
             //    proc.CPSR.Z = IsZeroBit( result );
             //    proc.CPSR.C = carry;
             //    // proc.CPSR.V unchanged
@@ -3942,9 +4051,9 @@ void arm::MOV_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         if( (Rd == 15) && (S == 1) )
         {
@@ -3968,7 +4077,7 @@ void arm::MOV_reg_A1( proc_type& proc, uint32_t instr )
 
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
+                proc.CPSR.N = Bits< 31, 31 >( result );
                 proc.CPSR.Z = IsZeroBit( result );
                 // proc.CPSR.V unchanged
             }
@@ -3985,16 +4094,16 @@ void arm::MOVT_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t imm4  = Bits( instr, 19, 16 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t imm4  = Bits< 19, 16 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         uint32_t d         = Rd;
         uint32_t imm16     = (imm4 << 12) | imm12;
     
-        if( d == 15 ) UNPREDICTABLE;
+        if( d == 15 ) ARMV7_UNPREDICTABLE( MOVT_A1 );
     
-        proc.R[d] = (imm16 << 16) | Bits( proc.R[d], 15,  0 );
+        proc.R[d] = (imm16 << 16) | Bits< 15,  0 >( proc.R[d] );
     }
 }
 
@@ -4007,29 +4116,13 @@ void arm::MRS_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t Rd    = Bits( instr, 15, 12 );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
     
         uint32_t d         = Rd;
     
-        if( d == 15 ) UNPREDICTABLE;
+        if( d == 15 ) ARMV7_UNPREDICTABLE( MRS_A1 );
     
-        uint32_t cpsr = (proc.CPSR.N        << 31) |
-                        (proc.CPSR.Z        << 30) |
-                        (proc.CPSR.C        << 29) |
-                        (proc.CPSR.V        << 28) |
-                        (proc.CPSR.Q        << 27) |
-                        (proc.CPSR.IT_L     << 25) |
-                        (proc.CPSR.J        << 24) |
-                        (proc.CPSR.reserved << 20) |
-                        (proc.CPSR.GE       << 16) |
-                        (proc.CPSR.IT_H     << 10) |
-                        (proc.CPSR.E        <<  9) |
-                        (proc.CPSR.A        <<  8) |
-                        (proc.CPSR.I        <<  7) |
-                        (proc.CPSR.F        <<  6) |
-                        (proc.CPSR.T        <<  5) |
-                        proc.CPSR.M;
-        proc.R[d] = cpsr;
+        proc.R[d] = CPSRValue( proc.CPSR );
     }
 }
 
@@ -4042,8 +4135,8 @@ void arm::MSR_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t mask  = Bits( instr, 19, 18 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t mask  = Bits< 19, 18 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         if( mask == 0 )
         {
@@ -4053,22 +4146,10 @@ void arm::MSR_imm_A1( proc_type& proc, uint32_t instr )
         }
     
         uint32_t imm32 = ARMExpandImm( proc, imm12 );
-        bool write_nzcvq = (Bits( mask, 1,  1 ) == 1);
-        bool write_g     = (Bits( mask, 0,  0 ) == 1);
+        bool write_nzcvq = (Bits< 1,  1 >( mask ) == 1);
+        bool write_g     = (Bits< 0,  0 >( mask ) == 1);
     
-        if( write_nzcvq )
-        {
-            proc.CPSR.N = Bits( imm32, 31, 31 );
-            proc.CPSR.Z = Bits( imm32, 30, 30 );
-            proc.CPSR.C = Bits( imm32, 29, 29 );
-            proc.CPSR.V = Bits( imm32, 28, 28 );
-            proc.CPSR.Q = Bits( imm32, 27, 27 );
-        }
-
-        if( write_g )
-        {
-            proc.CPSR.GE = Bits( imm32, 19, 16 );
-        }
+        WriteAPSR( proc.CPSR, imm32, write_nzcvq, write_g );
     }
 }
 
@@ -4081,29 +4162,17 @@ void arm::MSR_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t mask  = Bits( instr, 19, 18 );
-        uint32_t Rn    = Bits( instr,  3,  0 );
+        uint32_t mask  = Bits< 19, 18 >( instr );
+        uint32_t Rn    = Bits<  3,  0 >( instr );
     
         uint32_t n         = Rn;
-        bool write_nzcvq   = (Bits( mask, 1,  1 ) == 1);
-        bool write_g       = (Bits( mask, 0,  0 ) == 1);
+        bool write_nzcvq   = (Bits< 1,  1 >( mask ) == 1);
+        bool write_g       = (Bits< 0,  0 >( mask ) == 1);
     
-        if( mask == 0 ) UNPREDICTABLE;
-        if( n == 15 ) UNPREDICTABLE;
+        if( mask == 0 ) ARMV7_UNPREDICTABLE( MSR_reg_A1 );
+        if( n == 15 ) ARMV7_UNPREDICTABLE( MSR_reg_A1 );
     
-        if( write_nzcvq )
-        {
-            proc.CPSR.N = Bits( proc.R[n], 31, 31 );
-            proc.CPSR.Z = Bits( proc.R[n], 30, 30 );
-            proc.CPSR.C = Bits( proc.R[n], 29, 29 );
-            proc.CPSR.V = Bits( proc.R[n], 28, 28 );
-            proc.CPSR.Q = Bits( proc.R[n], 27, 27 );
-        }
-
-        if( write_g )
-        {
-            proc.CPSR.GE = Bits( proc.R[n], 19, 16 );
-        }
+        WriteAPSR( proc.CPSR, proc.R[n], write_nzcvq, write_g );
     }
 }
 
@@ -4116,18 +4185,21 @@ void arm::MUL_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 19, 16 );
-        uint32_t Rm    = Bits( instr, 11,  8 );
-        uint32_t Rn    = Bits( instr,  3,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 19, 16 >( instr );
+        uint32_t Rm    = Bits< 11,  8 >( instr );
+        uint32_t Rn    = Bits<  3,  0 >( instr );
     
         uint32_t d         = Rd;
         uint32_t n         = Rn;
         uint32_t m         = Rm;
         bool setflags      = (S == 1);
     
-        if( (d == 15) || (n == 15) || (m == 15) ) UNPREDICTABLE;
-        if( (ArchVersion() < 6) && (d == n) ) UNPREDICTABLE;
+        if( (d == 15) || (n == 15) || (m == 15) ) ARMV7_UNPREDICTABLE( MUL_A1 );
+        if( (ArchVersion( proc ) < 6) && (d == n) )
+        {
+            ARMV7_UNPREDICTABLE( MUL_A1 );
+        }
         
         uint32_t operand1 = SInt( proc.R[n] );
         uint32_t operand2 = SInt( proc.R[m] );
@@ -4137,9 +4209,9 @@ void arm::MUL_A1( proc_type& proc, uint32_t instr )
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
+            proc.CPSR.N = Bits< 31, 31 >( result );
             proc.CPSR.Z = IsZeroBit( result );
-            if( ArchVersion() == 4 )
+            if( ArchVersion( proc ) == 4 )
             {
                 proc.CPSR.C = 0; // bit UNKNOWN
             }
@@ -4158,9 +4230,9 @@ void arm::MVN_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
     
         if( (Rd == 0b1111) && (S == 1) )
         {
@@ -4184,10 +4256,7 @@ void arm::MVN_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                // proc.CPSR.V unchanged
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -4202,11 +4271,11 @@ void arm::MVN_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t imm5  = Bits( instr, 11,  7 );
-        uint32_t type  = Bits( instr,  6,  5 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t imm5  = Bits< 11,  7 >( instr );
+        uint32_t type  = Bits<  6,  5 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         if( (Rd == 0b1111) && (S == 1) )
         {
@@ -4237,10 +4306,7 @@ void arm::MVN_reg_A1( proc_type& proc, uint32_t instr )
 
             if( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                // proc.CPSR.V unchanged
+                SetLogicalFlags( proc.CPSR, result, carry );
             }
         }
     }
@@ -4255,11 +4321,11 @@ void arm::MVN_rsr_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t Rd    = Bits( instr, 15, 12 );
-        uint32_t Rs    = Bits( instr, 11,  8 );
-        uint32_t type  = Bits( instr,  6,  5 );
-        uint32_t Rm    = Bits( instr,  3,  0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t Rd    = Bits< 15, 12 >( instr );
+        uint32_t Rs    = Bits< 11,  8 >( instr );
+        uint32_t type  = Bits<  6,  5 >( instr );
+        uint32_t Rm    = Bits<  3,  0 >( instr );
     
         uint32_t d         = Rd;
         uint32_t m         = Rm;
@@ -4267,9 +4333,12 @@ void arm::MVN_rsr_A1( proc_type& proc, uint32_t instr )
         bool setflags      = (S == 1);
         SRType shift_t = DecodeRegShift( type );
     
-        if( (d == 15) || (m == 15) || (s == 15) ) UNPREDICTABLE;
+        if( (d == 15) || (m == 15) || (s == 15) )
+        {
+            ARMV7_UNPREDICTABLE( MVN_rsr_A1 );
+        }
     
-        uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+        uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry c_ = Shift_C( proc.R[m], shift_t, shift_n, proc.CPSR.C );
         uint32_t shifted = c_.value;
         bool carry = c_.carry;
@@ -4280,10 +4349,7 @@ void arm::MVN_rsr_A1( proc_type& proc, uint32_t instr )
 
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            // proc.CPSR.V unchanged
+            SetLogicalFlags( proc.CPSR, result, carry );
         }
     }
 }
@@ -4305,10 +4371,10 @@ void arm::ORR_imm_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t    S        = Bits( instr, 20, 20 );
-    const uint32_t    d        = Bits( instr, 15, 12 );
-    const uint32_t    n        = Bits( instr, 19, 16 );
-    const uint32_t    imm12    = Bits( instr, 11,  0 );
+    const uint32_t    S        = Bits< 20, 20 >( instr );
+    const uint32_t    d        = Bits< 15, 12 >( instr );
+    const uint32_t    n        = Bits< 19, 16 >( instr );
+    const uint32_t    imm12    = Bits< 11,  0 >( instr );
     const bool        setflags = ( S == 1 );
     const UValueCarry imm32    = ARMExpandImm_C( imm12, proc.CPSR.C );
 
@@ -4330,9 +4396,7 @@ void arm::ORR_imm_A1( proc_type& proc, uint32_t instr )
         proc.R[d] = result;
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = imm32.carry;
+            SetLogicalFlags( proc.CPSR, result, imm32.carry );
         }
     }
 }
@@ -4347,13 +4411,13 @@ void arm::ORR_reg_A1( proc_type& proc, uint32_t instr )
     }
     
     // Encoding-specific operations
-    const uint32_t    S        = Bits( instr, 20, 20 );
-    const uint32_t    d        = Bits( instr, 15, 12 );
-    const uint32_t    m        = Bits( instr,  3,  0 );
-    const uint32_t    n        = Bits( instr, 19, 16 );
+    const uint32_t    S        = Bits< 20, 20 >( instr );
+    const uint32_t    d        = Bits< 15, 12 >( instr );
+    const uint32_t    m        = Bits<  3,  0 >( instr );
+    const uint32_t    n        = Bits< 19, 16 >( instr );
     const bool        setflags = ( S == 1 );
-    const uint32_t    type     = Bits( instr,  6,  5 );
-    const uint32_t    imm5     = Bits( instr, 11,  7 );
+    const uint32_t    type     = Bits<  6,  5 >( instr );
+    const uint32_t    imm5     = Bits< 11,  7 >( instr );
 
     if( ( d == 0xF ) && ( S == 1 ) )
     {
@@ -4378,9 +4442,7 @@ void arm::ORR_reg_A1( proc_type& proc, uint32_t instr )
         proc.R[d] = result;
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = shifted.carry;
+            SetLogicalFlags( proc.CPSR, result, shifted.carry );
         }
     }
 }
@@ -4395,21 +4457,21 @@ void arm::ORR_reg_shift_reg_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t    S        = Bits( instr, 20, 20 );
-    const uint32_t    d        = Bits( instr, 15, 12 );
-    const uint32_t    m        = Bits( instr,  3,  0 );
-    const uint32_t    n        = Bits( instr, 19, 16 );
-    const uint32_t    s        = Bits( instr, 11,  8 );
-    const uint32_t    type     = Bits( instr,  6,  5 );
+    const uint32_t    S        = Bits< 20, 20 >( instr );
+    const uint32_t    d        = Bits< 15, 12 >( instr );
+    const uint32_t    m        = Bits<  3,  0 >( instr );
+    const uint32_t    n        = Bits< 19, 16 >( instr );
+    const uint32_t    s        = Bits< 11,  8 >( instr );
+    const uint32_t    type     = Bits<  6,  5 >( instr );
 
     const bool        setflags = ( S == 1 );
     const SRType      shift_t  = DecodeRegShift( type );
 
     if( ( d == 15 ) || ( m == 15 ) || ( n == 15 ) || ( s == 15 ) )
-         UNPREDICTABLE;
+         ARMV7_UNPREDICTABLE( ORR_reg_shift_reg_A1 );
 
     // Instruction code
-    uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+    uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
     UValueCarry shifted = Shift_C( proc.R[m], shift_t,
                                    shift_n, proc.CPSR.C );
 
@@ -4418,7 +4480,7 @@ void arm::ORR_reg_shift_reg_A1( proc_type& proc, uint32_t instr )
     proc.R[d] = result;
     if( setflags )
     {
-        proc.CPSR.N = Bits( result, 31, 31 );
+        proc.CPSR.N = Bits< 31, 31 >( result );
         proc.CPSR.Z = IsZeroBit( result );
         proc.CPSR.C = result;
     }
@@ -4433,16 +4495,16 @@ void arm::PKH_A1( proc_type& proc, uint32_t instr )
         return;
     }
 
-    const uint32_t    d        = Bits( instr, 15, 12 );
-    const uint32_t    m        = Bits( instr,  3,  0 );
-    const uint32_t    n        = Bits( instr, 19, 16 );
-    const uint32_t    imm5     = Bits( instr, 11,  7 );
-    const uint32_t    tb       = Bits( instr,  6,  6 );
+    const uint32_t    d        = Bits< 15, 12 >( instr );
+    const uint32_t    m        = Bits<  3,  0 >( instr );
+    const uint32_t    n        = Bits< 19, 16 >( instr );
+    const uint32_t    imm5     = Bits< 11,  7 >( instr );
+    const uint32_t    tb       = Bits<  6,  6 >( instr );
     const bool        tbform   = ( tb == 1 );
 
     ShiftUValue shift = DecodeImmShift( tb << 1 /*append 0*/, imm5 );
     
-    if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+    if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( PKH_A1 );
 
     // Instruction code
     uint32_t operand2 = Shift( proc.R[m], shift.shift_t,
@@ -4482,15 +4544,15 @@ void arm::POP_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t register_list = Bits( instr, 15, 0 );
+    const uint32_t register_list = Bits< 15, 0 >( instr );
 
     if( BitCount( register_list ) < 2 )
     {
         // FIXME: SEE LDM/LDMA/LDMFD      
     }
 
-    if( ( Bits( register_list, 13, 13 ) == 1 ) && ArchVersion() >= 7 )
-         UNPREDICTABLE;
+    if( ( Bits< 13, 13 >( register_list ) == 1 ) && ArchVersion( proc ) >= 7 )
+         ARMV7_UNPREDICTABLE( POP_A1 );
 
     // Instruction code
     if( !NullCheckIfThumbEE( proc, 13 ) )
@@ -4501,21 +4563,8 @@ void arm::POP_A1( proc_type& proc, uint32_t instr )
     // FIXME : SP is not always register 13 (depending on the execution mode)
     uint32_t address = proc.R[13];
     
-    for( int i = 0; i <= 14; ++i )
-    {
-        // Pop selected registers
-        if( Bits( register_list, i, i ) == 1 )
-        {
-            proc.R[i] = proc.dMem.read_word( address );
-            address += 4;
-        }
-    }
-    
-    // PC is handled separatly
-    if( Bits( register_list, 15, 15 ) == 1 )
-    {
-        LoadWritePC( proc, address );
-    }
+    // Pop selected registers, PC included
+    LoadMultiple( proc, address, register_list );
 
     if( Bits( register_list , 13, 13 ) == 0 )
     {
@@ -4540,31 +4589,18 @@ void arm::POP_A2( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t t = Bits( instr, 15, 12 );
+    const uint32_t t = Bits< 15, 12 >( instr );
     uint32_t register_list = 0;
     register_list |= 1 << t;
 
-    if( t == 13 ) UNPREDICTABLE;
+    if( t == 13 ) ARMV7_UNPREDICTABLE( POP_A2 );
 
     // Instruction code
     // FIXME : SP is not always register 13 (depending on the execution mode)
     uint32_t address = proc.R[13];
     
-    for( int i = 0; i <= 14; ++i )
-    {
-        // Pop selected registers
-        if( Bits( register_list, i, i ) == 1 )
-        {
-            proc.R[i] = proc.dMem.read_word( address );
-            address += 4;
-        }
-    }
-    
-    // PC is handled separatly
-    if( Bits( register_list, 15, 15 ) == 1 )
-    {
-        LoadWritePC( proc, address );
-    }
+    // Pop selected registers, PC included
+    LoadMultiple( proc, address, register_list );
 
     /* If registers<13> = 1, SP is unknown... thus it is set to the same value
      * as the "known" case.
@@ -4592,7 +4628,7 @@ void arm::PUSH_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t register_list = Bits( instr, 15, 0 );
+    const uint32_t register_list = Bits< 15, 0 >( instr );
 
     if( BitCount( register_list ) < 2 )
     {
@@ -4608,27 +4644,8 @@ void arm::PUSH_A1( proc_type& proc, uint32_t instr )
     // FIXME : SP is not always register 13 (depending on the execution mode)
     uint32_t address = proc.R[13] - 4 * BitCount( register_list );
     
-    for( int i = 0; i <= 14; ++i )
-    {
-        if( Bits( register_list, i , i ) == 1 )
-        {
-            if( i == 13 && i != LowestSetBit( register_list ) )
-            {
-                // Write an UNKNOWN value
-                proc.dMem.write_word( address, 0xC0DEBEEF );
-            }
-            else
-            {
-                proc.dMem.write_word( address, proc.R[i] );            
-            }
-            address += 4;        
-        }
-    }
-
-    if( Bits( register_list, 15, 15 ) == 1 )
-    {
-        proc.dMem.write_word( address, PCStoreValue( proc ) );
-    }
+    // SP is written as an UNKNOWN value unless it is the lowest
+    StoreMultiple( proc, address, register_list, 13, 0xC0DEBEEF );
 
     // FIXME : SP is not always register 13 (depending on the execution mode)
     proc.R[13] = proc.R[13] - 4*BitCount( register_list );
@@ -4644,11 +4661,11 @@ void arm::PUSH_A2( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t t = Bits( instr, 15, 12 );    
+    const uint32_t t = Bits< 15, 12 >( instr );    
     uint32_t register_list = 0;
     register_list |= 1 << t;
 
-    if( t == 13 ) UNPREDICTABLE;
+    if( t == 13 ) ARMV7_UNPREDICTABLE( PUSH_A2 );
 
     // Instruction code
     if( !NullCheckIfThumbEE( proc, 13 ) )
@@ -4659,27 +4676,8 @@ void arm::PUSH_A2( proc_type& proc, uint32_t instr )
     // FIXME : SP is not always register 13 (depending on the execution mode)
     uint32_t address = proc.R[13] - 4 * BitCount( register_list );
     
-    for( int i = 0; i <= 14; ++i )
-    {
-        if( Bits( register_list, i , i ) == 1 )
-        {
-            if( i == 13 && i != LowestSetBit( register_list ) )
-            {
-                // Write UNKNOWN value
-                proc.dMem.write_word( address, 0xC0DEBEEF );
-            }
-            else
-            {
-                proc.dMem.write_word( address, proc.R[i] );            
-            }
-            address += 4;        
-        }
-    }
-
-    if( Bits( register_list, 15, 15 ) == 1 )
-    {
-        proc.dMem.write_word( address, PCStoreValue( proc ) );
-    }
+    // SP is written as an UNKNOWN value unless it is the lowest
+    StoreMultiple( proc, address, register_list, 13, 0xC0DEBEEF );
 
     // FIXME : SP is not always register 13 (depending on the execution mode)
     proc.R[13] = proc.R[13] - 4*BitCount( register_list );
@@ -4692,11 +4690,17 @@ void arm::QADD_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        const uint32_t d = Bits( instr, 15, 12 );
-        const uint32_t m = Bits( instr,  3,  0 );
-        const uint32_t n = Bits( instr, 19, 16 );
+        const uint32_t d = Bits< 15, 12 >( instr );
+        const uint32_t m = Bits<  3,  0 >( instr );
+        const uint32_t n = Bits< 19, 16 >( instr );
+        
+        if ( d == 15 || m == 15 || n == 15 )
+        
+        {
         
-        if ( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
+            ARMV7_UNPREDICTABLE( QADD_A1 );
+        
+        }
         
         // Instruction code
         ValueSat res = SignedSatQ( (int64_t)SInt( proc.R[m] ) +
@@ -4717,24 +4721,14 @@ void arm::QADD16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        const uint32_t d = Bits( instr, 15, 12 );
-        const uint32_t m = Bits( instr,  3,  0 );
-        const uint32_t n = Bits( instr, 19, 16 );
+        const uint32_t d = Bits< 15, 12 >( instr );
+        const uint32_t m = Bits<  3,  0 >( instr );
+        const uint32_t n = Bits< 19, 16 >( instr );
 
-        if ( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( QADD16_A1 );
 
-        int32_t sum1
-            = (int32_t)SInt( (uint16_t)Bits( proc.R[n], 15,  0 ) )
-            + (int32_t)SInt( (uint16_t)Bits( proc.R[m], 15,  0 ) );
-        int32_t sum2
-            = (int32_t)SInt( (uint16_t)Bits( proc.R[n], 31, 16 ) )
-            + (int32_t)SInt( (uint16_t)Bits( proc.R[m], 31, 16 ) );
-    
-        // Instruction code
-        ValueSat res1 = SignedSatQ( sum1, 16 );
-        ValueSat res2 = SignedSatQ( sum2, 16 );
-        proc.R[d]  = (uint16_t)(res1.value);
-        proc.R[d] |= (uint16_t)(res2.value) << 16;
+        // Operation
+        proc.R[d] = ParallelSatAdd< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -4745,38 +4739,14 @@ void arm::QADD8_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        const uint32_t d = Bits( instr, 15, 12 );
-        const uint32_t m = Bits( instr,  3,  0 );
-        const uint32_t n = Bits( instr, 19, 16 );
+        const uint32_t d = Bits< 15, 12 >( instr );
+        const uint32_t m = Bits<  3,  0 >( instr );
+        const uint32_t n = Bits< 19, 16 >( instr );
 
-        if ( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( QADD8_A1 );
 
-        int16_t sum1
-            = (int16_t)SInt( (uint8_t)Bits( proc.R[n],  7,  0 ) )
-            + (int16_t)SInt( (uint8_t)Bits( proc.R[m],  7,  0 ) );
-
-        int16_t sum2
-            = (int16_t)SInt( (uint8_t)Bits( proc.R[n], 15,  8 ) )
-            + (int16_t)SInt( (uint8_t)Bits( proc.R[m], 15,  8 ) );
-
-        int16_t sum3
-            = (int16_t)SInt( (uint8_t)Bits( proc.R[n], 23, 16 ) )
-            + (int16_t)SInt( (uint8_t)Bits( proc.R[m], 23, 16 ) );
-
-        int16_t sum4
-            = (int16_t)SInt( (uint8_t)Bits( proc.R[n], 31, 24 ) )
-            + (int16_t)SInt( (uint8_t)Bits( proc.R[m], 31, 24 ) );
-    
-        // Instruction code
-        ValueSat res1 = SignedSatQ( sum1, 8 );
-        ValueSat res2 = SignedSatQ( sum2, 8 );
-        ValueSat res3 = SignedSatQ( sum3, 8 );
-        ValueSat res4 = SignedSatQ( sum4, 8 );
-
-        proc.R[d]  =  (uint8_t)(res1.value);
-        proc.R[d] |=  (uint8_t)(res2.value) << 8;
-        proc.R[d] |=  (uint8_t)(res3.value) << 16;
-        proc.R[d] |=  (uint8_t)(res4.value) << 24;
+        // Operation
+        proc.R[d] = ParallelSatAdd< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -4790,23 +4760,16 @@ void arm::QASX_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d = Bits( instr, 15, 12 );
-    const uint32_t m = Bits( instr,  3,  0 );
-    const uint32_t n = Bits( instr, 19, 16 );
-
-    if( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
-
-    // Instruction code
-    int32_t diff = SInt( (uint16_t)Bits( proc.R[n], 15,  0 ) )
-        - SInt( (uint16_t)Bits( proc.R[m], 31, 16 ) );
+    const uint32_t d = Bits< 15, 12 >( instr );
+    const uint32_t m = Bits<  3,  0 >( instr );
+    const uint32_t n = Bits< 19, 16 >( instr );
 
-    int32_t sum  = SInt( (uint16_t)Bits( proc.R[n], 31, 16 ) )
-        + SInt( (uint16_t)Bits( proc.R[m], 15,  0 ) );
+    if( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( QASX_A1 );
 
-    ValueSat low  = SignedSatQ( diff, 16 );
-    ValueSat high = SignedSatQ( sum,  16 );
-    proc.R[d] =  (uint16_t)(low.value);
-    proc.R[d] |= (uint16_t)(high.value) << 16;
+    // Operation
+    const uint32_t x = ROR( proc.R[m], 16 );
+    proc.R[d] = MergeHalfwords( ParallelSatSub< 16 >( proc.R[n], x ),
+                                ParallelSatAdd< 16 >( proc.R[n], x ) );
 }
 
 
@@ -4819,11 +4782,11 @@ void arm::QDADD_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d = Bits( instr, 15, 12 );
-    const uint32_t m = Bits( instr,  3,  0 );
-    const uint32_t n = Bits( instr, 19, 16 );
+    const uint32_t d = Bits< 15, 12 >( instr );
+    const uint32_t m = Bits<  3,  0 >( instr );
+    const uint32_t n = Bits< 19, 16 >( instr );
 
-    if( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
+    if( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( QDADD_A1 );
 
     // Instruction code
     int64_t doubledInt = (int64_t)( (int32_t)proc.R[n] ) * 2;
@@ -4848,11 +4811,11 @@ void arm::QDSUB_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d = Bits( instr, 15, 12 );
-    const uint32_t m = Bits( instr,  3,  0 );
-    const uint32_t n = Bits( instr, 19, 16 );
+    const uint32_t d = Bits< 15, 12 >( instr );
+    const uint32_t m = Bits<  3,  0 >( instr );
+    const uint32_t n = Bits< 19, 16 >( instr );
 
-    if( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
+    if( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( QDSUB_A1 );
 
     // Instruction code
     int64_t doubledInt = (int64_t)( (int32_t)proc.R[n] ) * 2;
@@ -4877,20 +4840,16 @@ void arm::QSAX_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d = Bits( instr, 15, 12 );
-    const uint32_t m = Bits( instr,  3,  0 );
-    const uint32_t n = Bits( instr, 19, 16 );
+    const uint32_t d = Bits< 15, 12 >( instr );
+    const uint32_t m = Bits<  3,  0 >( instr );
+    const uint32_t n = Bits< 19, 16 >( instr );
 
-    if( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
+    if( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( QSAX_A1 );
 
-    // Instruction code
-    int32_t sum  = SInt( (uint16_t)Bits( proc.R[n], 15, 0 ) )
-        + SInt( (uint16_t)Bits( proc.R[m], 31, 16 ) );
-    int32_t diff =  SInt( (uint16_t)Bits( proc.R[n], 31, 16 ) )
-        - SInt( (uint16_t)Bits( proc.R[m], 15,  0 ) );
-                
-    proc.R[d] =  (uint16_t)(SignedSat( sum, 16 ));
-    proc.R[d] |= (uint16_t)(SignedSat( diff, 16 )) << 16;
+    // Operation
+    const uint32_t x = ROR( proc.R[m], 16 );
+    proc.R[d] = MergeHalfwords( ParallelSatAdd< 16 >( proc.R[n], x ),
+                                ParallelSatSub< 16 >( proc.R[n], x ) );
 }
 
 
@@ -4900,11 +4859,11 @@ void arm::QSUB_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        const uint32_t d = Bits( instr, 15, 12 );
-        const uint32_t m = Bits( instr,  3,  0 );
-        const uint32_t n = Bits( instr, 19, 16 );
+        const uint32_t d = Bits< 15, 12 >( instr );
+        const uint32_t m = Bits<  3,  0 >( instr );
+        const uint32_t n = Bits< 19, 16 >( instr );
 
-        if ( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( QSUB_A1 );
     
         // Instruction code
         ValueSat res = SignedSatQ( (int64_t)SInt( proc.R[m] ) -
@@ -4926,23 +4885,14 @@ void arm::QSUB16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        const uint32_t d = Bits( instr, 15, 12 );
-        const uint32_t m = Bits( instr,  3,  0 );
-        const uint32_t n = Bits( instr, 19, 16 );
-
-        if ( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
-    
-        // Instruction code
-        int32_t diff1
-            = (int32_t)SInt( (uint16_t)Bits( proc.R[n], 15,  0 ) )
-            - (int32_t)SInt( (uint16_t)Bits( proc.R[m], 15,  0 ) );
+        const uint32_t d = Bits< 15, 12 >( instr );
+        const uint32_t m = Bits<  3,  0 >( instr );
+        const uint32_t n = Bits< 19, 16 >( instr );
 
-        int32_t diff2
-            = (int32_t)SInt( (uint16_t)Bits( proc.R[n], 31, 16 ) )
-            - (int32_t)SInt( (uint16_t)Bits( proc.R[m], 31, 16 ) );
+        if ( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( QSUB16_A1 );
 
-        proc.R[d]  = (uint16_t)(SignedSat( diff1, 16 ));
-        proc.R[d] |= (uint16_t)(SignedSat( diff2, 16 )) << 16;
+        // Operation
+        proc.R[d] = ParallelSatSub< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -4953,33 +4903,14 @@ void arm::QSUB8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        const uint32_t d = Bits( instr, 15, 12 );
-        const uint32_t m = Bits( instr,  3,  0 );
-        const uint32_t n = Bits( instr, 19, 16 );
-
-        if ( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
-    
-        // Instruction code
-        int16_t diff1
-            = (int16_t)SInt( (uint8_t)Bits( proc.R[n],  7,  0 ) )
-            - (int16_t)SInt( (uint8_t)Bits( proc.R[m],  7,  0 ) );
+        const uint32_t d = Bits< 15, 12 >( instr );
+        const uint32_t m = Bits<  3,  0 >( instr );
+        const uint32_t n = Bits< 19, 16 >( instr );
 
-        int16_t diff2
-            = (int16_t)SInt( (uint8_t)Bits( proc.R[n], 15,  8 ) )
-            - (int16_t)SInt( (uint8_t)Bits( proc.R[m], 15,  8 ) );
+        if ( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( QSUB8_A1 );
 
-        int16_t diff3
-            = (int16_t)SInt( (uint8_t)Bits( proc.R[n], 23, 16 ) )
-            - (int16_t)SInt( (uint8_t)Bits( proc.R[m], 23, 16 ) );
-
-        int16_t diff4
-            = (int16_t)SInt( (uint8_t)Bits( proc.R[n], 31, 24 ) )
-            - (int16_t)SInt( (uint8_t)Bits( proc.R[m], 31, 24 ) );
-
-        proc.R[d]  = (uint8_t)(SignedSat( diff1,  8 ));
-        proc.R[d] |= (uint8_t)(SignedSat( diff2,  8 )) << 8;
-        proc.R[d] |= (uint8_t)(SignedSat( diff3,  8 )) << 16;
-        proc.R[d] |= (uint8_t)(SignedSat( diff4,  8 )) << 24;
+        // Operation
+        proc.R[d] = ParallelSatSub< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -4993,10 +4924,10 @@ void arm::RBIT_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d = Bits( instr, 15, 12 );
-    const uint32_t m = Bits( instr,  3,  0 );
+    const uint32_t d = Bits< 15, 12 >( instr );
+    const uint32_t m = Bits<  3,  0 >( instr );
 
-    if( d == 15 || m == 15 ) UNPREDICTABLE;
+    if( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( RBIT_A1 );
 
     // Instruction code
     uint32_t result = 0;
@@ -5017,16 +4948,16 @@ void arm::REV_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d = Bits( instr, 15, 12 );
-    const uint32_t m = Bits( instr,  3,  0 );
+    const uint32_t d = Bits< 15, 12 >( instr );
+    const uint32_t m = Bits<  3,  0 >( instr );
 
-    if( d == 15 || m == 15 ) UNPREDICTABLE;
+    if( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( REV_A1 );
 
     // Instruction code
-    proc.R[d]  = Bits( proc.R[m],  7,  0 ) << 24;
-    proc.R[d] |= Bits( proc.R[m], 15,  8 ) << 16;
-    proc.R[d] |= Bits( proc.R[m], 23, 16 ) << 8;
-    proc.R[d] |= Bits( proc.R[m], 31, 24 );
+    proc.R[d]  = Bits<  7,  0 >( proc.R[m] ) << 24;
+    proc.R[d] |= Bits< 15,  8 >( proc.R[m] ) << 16;
+    proc.R[d] |= Bits< 23, 16 >( proc.R[m] ) << 8;
+    proc.R[d] |= Bits< 31, 24 >( proc.R[m] );
 }
 
 
@@ -5039,16 +4970,16 @@ void arm::REV16_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d = Bits( instr, 15, 12 );
-    const uint32_t m = Bits( instr,  3,  0 );
+    const uint32_t d = Bits< 15, 12 >( instr );
+    const uint32_t m = Bits<  3,  0 >( instr );
 
-    if( d == 15 || m == 15 ) UNPREDICTABLE;
+    if( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( REV16_A1 );
  
     // Instruction code
-    proc.R[d]  = Bits( proc.R[m], 15,  8 );
-    proc.R[d] |= Bits( proc.R[m],  7,  0 ) << 8;
-    proc.R[d] |= Bits( proc.R[m], 31, 24 ) << 16;
-    proc.R[d] |= Bits( proc.R[m], 23, 16 ) << 24;
+    proc.R[d]  = Bits< 15,  8 >( proc.R[m] );
+    proc.R[d] |= Bits<  7,  0 >( proc.R[m] ) << 8;
+    proc.R[d] |= Bits< 31, 24 >( proc.R[m] ) << 16;
+    proc.R[d] |= Bits< 23, 16 >( proc.R[m] ) << 24;
 }
 
 
@@ -5061,15 +4992,15 @@ void arm::REVSH_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d = Bits( instr, 15, 12 );
-    const uint32_t m = Bits( instr,  3,  0 );
+    const uint32_t d = Bits< 15, 12 >( instr );
+    const uint32_t m = Bits<  3,  0 >( instr );
 
-    if( d == 15 || m == 15 ) UNPREDICTABLE;
+    if( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( REVSH_A1 );
     
     // Instruction code
-    int32_t result = SignExtend( Bits( proc.R[m], 7, 0 ), 24, 8 );
+    int32_t result = SignExtend( Bits< 7, 0 >( proc.R[m] ), 24, 8 );
     result = result << 8;
-    result |= Bits( proc.R[m], 15, 8 );
+    result |= Bits< 15, 8 >( proc.R[m] );
     proc.R[d] = result;
 }
 
@@ -5083,11 +5014,11 @@ void arm::RFE_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const bool wback = Bits( instr, 21, 21 ) == 1;
-    const bool inc   = Bits( instr, 23, 23 ) == 1;
-    const bool P     = Bits( instr, 24, 24 ) == 1;
+    const bool wback = Bits< 21, 21 >( instr ) == 1;
+    const bool inc   = Bits< 23, 23 >( instr ) == 1;
+    const bool P     = Bits< 24, 24 >( instr ) == 1;
     const bool wordhigher = P == inc;
-    const uint32_t n = Bits( instr, 19, 16 );
+    const uint32_t n = Bits< 19, 16 >( instr );
 
     if( n == 15 )
     {
@@ -5099,16 +5030,16 @@ void arm::RFE_A1( proc_type& proc, uint32_t instr )
     if( !CurrentModeIsPrivileged( proc ) || 
         CurrentInstrSet( proc ) == InstrSet_ThumbEE )
     {
-        UNPREDICTABLE;
+        ARMV7_UNPREDICTABLE( Unknown );
     }
     else
     {
         uint32_t address = inc ? proc.R[n] : proc.R[n] - 8;
         address += wordhigher ? 4 : 0;
 
-        CPSRWriteByInstr( proc.dMem.read_word( address+4 ), 0xF, true, proc );
+        CPSRWriteByInstr( MemAReadWord( proc, address+4 ), 0xF, true, proc );
         
-        BranchWritePC( proc, proc.dMem.read_word( address ) );
+        BranchWritePC( proc, MemAReadWord( proc, address ) );
         
         if( wback )
         {
@@ -5127,10 +5058,10 @@ void arm::ROR_IMM_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t imm5 = Bits( instr, 11,  7 );
-    const bool setflags = Bits( instr, 20, 20 ) == 1;
-    const uint32_t d    = Bits( instr, 15, 12 );
-    const uint32_t m    = Bits( instr,  3,  0 );
+    const uint32_t imm5 = Bits< 11,  7 >( instr );
+    const bool setflags = Bits< 20, 20 >( instr ) == 1;
+    const uint32_t d    = Bits< 15, 12 >( instr );
+    const uint32_t m    = Bits<  3,  0 >( instr );
 
     uint32_t shift_n = DecodeImmShift( 3, imm5 ).shift_n;
     SRType   shift_t = SRType_ROR;
@@ -5153,9 +5084,7 @@ void arm::ROR_IMM_A1( proc_type& proc, uint32_t instr )
         proc.R[d] = result.value;
         if( setflags )
         {
-            proc.CPSR.N = Bits( result.value, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result.value );
-            proc.CPSR.C = result.carry;
+            SetLogicalFlags( proc.CPSR, result.value, result.carry );
         }
     }
 }
@@ -5170,23 +5099,21 @@ void arm::ROR_REG_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d    = Bits( instr, 15, 12 );
-    const uint32_t m    = Bits( instr, 11,  8 );
-    const uint32_t n    = Bits( instr,  3,  0 );
-    const bool setflags = Bits( instr, 20, 20 ) == 1;
+    const uint32_t d    = Bits< 15, 12 >( instr );
+    const uint32_t m    = Bits< 11,  8 >( instr );
+    const uint32_t n    = Bits<  3,  0 >( instr );
+    const bool setflags = Bits< 20, 20 >( instr ) == 1;
 
-    if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+    if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( ROR_REG_A1 );
 
     // Instruction code
-    uint32_t shift_n = Bits( proc.R[m],  7,  0 );
+    uint32_t shift_n = Bits<  7,  0 >( proc.R[m] );
     UValueCarry result = Shift_C( proc.R[m], SRType_ROR, shift_n, proc.CPSR.C );
 
     proc.R[d] = result.value;
     if( setflags )
     {
-        proc.CPSR.N = Bits( result.value, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result.value );
-        proc.CPSR.C = result.carry;
+        SetLogicalFlags( proc.CPSR, result.value, result.carry );
     }    
 }
 
@@ -5200,9 +5127,9 @@ void arm::RRX_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d    = Bits( instr, 15, 12 );
-    const uint32_t m    = Bits( instr,  3,  0 );
-    const bool setflags = Bits( instr, 20, 20 ) == 1;
+    const uint32_t d    = Bits< 15, 12 >( instr );
+    const uint32_t m    = Bits<  3,  0 >( instr );
+    const bool setflags = Bits< 20, 20 >( instr ) == 1;
 
     // Instruction code
     UValueCarry result = Shift_C( proc.R[m], SRType_RRX, 1, proc.CPSR.C );
@@ -5215,9 +5142,7 @@ void arm::RRX_A1( proc_type& proc, uint32_t instr )
         proc.R[d] = result.value;
         if( setflags )
         {
-            proc.CPSR.N = Bits( result.value, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result.value );
-            proc.CPSR.C = result.carry;
+            SetLogicalFlags( proc.CPSR, result.value, result.carry );
         }
     }
     
@@ -5233,10 +5158,10 @@ void arm::RSB_IMM_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d     = Bits( instr, 15, 12 );
-    const uint32_t n     = Bits( instr, 19, 16 );
-    const uint32_t imm12 = Bits( instr, 11,  0 );
-    const bool setflags  = Bits( instr, 20, 20 ) == 1;
+    const uint32_t d     = Bits< 15, 12 >( instr );
+    const uint32_t n     = Bits< 19, 16 >( instr );
+    const uint32_t imm12 = Bits< 11,  0 >( instr );
+    const bool setflags  = Bits< 20, 20 >( instr ) == 1;
     const uint32_t imm32 = ARMExpandImm( proc, imm12 );
 
     if( d == 0xF && setflags )
@@ -5246,9 +5171,11 @@ void arm::RSB_IMM_A1( proc_type& proc, uint32_t instr )
     }
 
     // Instruction code
-    uint8_t carry;
-    uint8_t overflow;
-    uint32_t result = AddWithCarry( NOT(proc.R[n]), imm32, 1, carry, overflow );
+    uint32_t result, carry, overflow;
+    const uint32_t x        = (uint32_t)NOT( proc.R[n] );
+    const uint32_t y        = imm32;
+    const uint32_t carry_in = 1;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
     if( d == 15 )
     {
         ALUWritePC( proc, result );
@@ -5258,10 +5185,7 @@ void arm::RSB_IMM_A1( proc_type& proc, uint32_t instr )
         proc.R[d] = result;
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
     }
 }
@@ -5276,12 +5200,12 @@ void arm::RSB_REG_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d     = Bits( instr, 15, 12 );
-    const uint32_t m     = Bits( instr,  3,  0 );
-    const uint32_t n     = Bits( instr, 19, 16 );
-    const uint32_t imm5  = Bits( instr, 11,  7 );
-    const bool setflags  = Bits( instr, 20, 20 ) == 1;
-    const uint32_t type  = Bits( instr,  6,  5 );
+    const uint32_t d     = Bits< 15, 12 >( instr );
+    const uint32_t m     = Bits<  3,  0 >( instr );
+    const uint32_t n     = Bits< 19, 16 >( instr );
+    const uint32_t imm5  = Bits< 11,  7 >( instr );
+    const bool setflags  = Bits< 20, 20 >( instr ) == 1;
+    const uint32_t type  = Bits<  6,  5 >( instr );
 
     const ShiftUValue shift = DecodeImmShift( type, imm5 );
 
@@ -5295,9 +5219,11 @@ void arm::RSB_REG_A1( proc_type& proc, uint32_t instr )
     uint32_t shifted = Shift( proc.R[m], shift.shift_t,
                               shift.shift_n, proc.CPSR.C );
 
-    uint8_t carry;
-    uint8_t overflow;
-    uint32_t result = AddWithCarry( NOT(proc.R[n]), shifted, 1, carry, overflow );
+    uint32_t result, carry, overflow;
+    const uint32_t x        = (uint32_t)NOT( proc.R[n] );
+    const uint32_t y        = shifted;
+    const uint32_t carry_in = 1;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
     if( d == 15 )
     {
         ALUWritePC( proc, result );
@@ -5307,10 +5233,7 @@ void arm::RSB_REG_A1( proc_type& proc, uint32_t instr )
         proc.R[d] = result;
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
     }
 }
@@ -5325,32 +5248,32 @@ void arm::RSB_REG_SHIFT_REG_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d     = Bits( instr, 15, 12 );
-    const uint32_t m     = Bits( instr,  3,  0 );
-    const uint32_t n     = Bits( instr, 19, 16 );
-    const uint32_t s     = Bits( instr, 11,  8 );
-    const bool setflags  = Bits( instr, 20, 20 ) == 1;
-    const uint32_t type  = Bits( instr,  6,  5 );
+    const uint32_t d     = Bits< 15, 12 >( instr );
+    const uint32_t m     = Bits<  3,  0 >( instr );
+    const uint32_t n     = Bits< 19, 16 >( instr );
+    const uint32_t s     = Bits< 11,  8 >( instr );
+    const bool setflags  = Bits< 20, 20 >( instr ) == 1;
+    const uint32_t type  = Bits<  6,  5 >( instr );
 
     const SRType shift_t = DecodeRegShift( type );
 
-    if( d == 15 || m == 15 || n == 15 || s == 15 ) UNPREDICTABLE;
+    if( d == 15 || m == 15 || n == 15 || s == 15 )
+        ARMV7_UNPREDICTABLE( RSB_REG_SHIFT_REG_A1 );
 
     // Instruction code
-    const uint32_t shift_n = Bits( proc.R[s], 7, 0 );
+    const uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
     
     uint32_t shifted = Shift( proc.R[m], shift_t, shift_n, proc.CPSR.C );
 
-    uint8_t carry;
-    uint8_t overflow;
-    uint32_t result = AddWithCarry( NOT(proc.R[n]), shifted, 1, carry, overflow );
+    uint32_t result, carry, overflow;
+    const uint32_t x        = (uint32_t)NOT( proc.R[n] );
+    const uint32_t y        = shifted;
+    const uint32_t carry_in = 1;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
     proc.R[d] = result;
     if( setflags )
     {
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        proc.CPSR.V = overflow;
+        SetAddFlags( proc.CPSR, x, y, carry_in );
     }
 }
 
@@ -5364,10 +5287,10 @@ void arm::RSC_IMM_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d     = Bits( instr, 15, 12 );
-    const uint32_t n     = Bits( instr, 19, 16 );
-    const uint32_t imm12 = Bits( instr, 11,  0 );
-    const bool setflags  = Bits( instr, 20, 20 ) == 1;
+    const uint32_t d     = Bits< 15, 12 >( instr );
+    const uint32_t n     = Bits< 19, 16 >( instr );
+    const uint32_t imm12 = Bits< 11,  0 >( instr );
+    const bool setflags  = Bits< 20, 20 >( instr ) == 1;
     const uint32_t imm32 = ARMExpandImm( proc, imm12 );
 
     if( d == 0xF && setflags )
@@ -5378,7 +5301,10 @@ void arm::RSC_IMM_A1( proc_type& proc, uint32_t instr )
 
     // Instruction code
     uint32_t result, carry, overflow;
-    result = AddWithCarry( NOT(proc.R[n]), imm32, 1, carry, overflow );
+    const uint32_t x        = (uint32_t)NOT( proc.R[n] );
+    const uint32_t y        = imm32;
+    const uint32_t carry_in = (uint32_t)proc.CPSR.C;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
 
     if( d == 15 )
     {
@@ -5389,10 +5315,7 @@ void arm::RSC_IMM_A1( proc_type& proc, uint32_t instr )
         proc.R[d] = result;
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
     }
 }
@@ -5407,12 +5330,12 @@ void arm::RSC_REG_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d     = Bits( instr, 15, 12 );
-    const uint32_t m     = Bits( instr,  3,  0 );
-    const uint32_t n     = Bits( instr, 19, 16 );
-    const uint32_t imm5  = Bits( instr, 11,  7 );
-    const uint32_t type  = Bits( instr,  6,  5 );
-    const bool setflags  = Bits( instr, 20, 20 ) == 1;
+    const uint32_t d     = Bits< 15, 12 >( instr );
+    const uint32_t m     = Bits<  3,  0 >( instr );
+    const uint32_t n     = Bits< 19, 16 >( instr );
+    const uint32_t imm5  = Bits< 11,  7 >( instr );
+    const uint32_t type  = Bits<  6,  5 >( instr );
+    const bool setflags  = Bits< 20, 20 >( instr ) == 1;
     const ShiftUValue shift = DecodeImmShift( type, imm5 );
 
     if( d == 0xF && setflags )
@@ -5422,12 +5345,14 @@ void arm::RSC_REG_A1( proc_type& proc, uint32_t instr )
     }
 
     // Instruction code
-    uint32_t shifted = Shift( proc.R[m]. shift.shift_t, 
+    uint32_t shifted = Shift( proc.R[m], shift.shift_t,
                               shift.shift_n, proc.CPSR.C );
 
     uint32_t result, carry, overflow;
-    result = AddWithCarry( NOT(proc.R[n]), shifted, proc.CPSR.C,
-                           carry, overflow );
+    const uint32_t x        = (uint32_t)NOT( proc.R[n] );
+    const uint32_t y        = shifted;
+    const uint32_t carry_in = (uint32_t)proc.CPSR.C;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
 
     if( d == 15 )
     {
@@ -5438,10 +5363,7 @@ void arm::RSC_REG_A1( proc_type& proc, uint32_t instr )
         proc.R[d] = result;
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
     }
 }
@@ -5456,33 +5378,33 @@ void arm::RSC_REG_SHIFT_REG_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d     = Bits( instr, 15, 12 );
-    const uint32_t m     = Bits( instr,  3,  0 );
-    const uint32_t n     = Bits( instr, 19, 16 );
-    const uint32_t s     = Bits( instr, 11,  8 );
-    const uint32_t type  = Bits( instr,  6,  5 );
-    const bool setflags  = Bits( instr, 20, 20 ) == 1;
+    const uint32_t d     = Bits< 15, 12 >( instr );
+    const uint32_t m     = Bits<  3,  0 >( instr );
+    const uint32_t n     = Bits< 19, 16 >( instr );
+    const uint32_t s     = Bits< 11,  8 >( instr );
+    const uint32_t type  = Bits<  6,  5 >( instr );
+    const bool setflags  = Bits< 20, 20 >( instr ) == 1;
 
     const SRType shift_t = DecodeRegShift( type );
 
-    if( d == 15 || m == 15 || n == 15 || s == 15 ) UNPREDICTABLE;
+    if( d == 15 || m == 15 || n == 15 || s == 15 )
+        ARMV7_UNPREDICTABLE( RSC_REG_SHIFT_REG_A1 );
 
     // Instruction code
-    const uint32_t shift_n = Bits( proc.R[s], 7, 0 );
-    uint32_t shifted = Shift( proc.R[m]. shift_t, 
+    const uint32_t shift_n = Bits< 7, 0 >( proc.R[s] );
+    uint32_t shifted = Shift( proc.R[m], shift_t,
                               shift_n, proc.CPSR.C );
 
     uint32_t result, carry, overflow;
-    result = AddWithCarry( NOT(proc.R[n]), shifted, proc.CPSR.C,
-                           carry, overflow );
+    const uint32_t x        = (uint32_t)NOT( proc.R[n] );
+    const uint32_t y        = shifted;
+    const uint32_t carry_in = (uint32_t)proc.CPSR.C;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
 
     proc.R[d] = result;
     if( setflags )
     {
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        proc.CPSR.V = overflow;
+        SetAddFlags( proc.CPSR, x, y, carry_in );
     }
 }
 
@@ -5496,26 +5418,16 @@ void arm::SADD16_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d     = Bits( instr, 15, 12 );
-    const uint32_t m     = Bits( instr,  3,  0 );
-    const uint32_t n     = Bits( instr, 19, 16 );
-
-    if( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
+    const uint32_t d     = Bits< 15, 12 >( instr );
+    const uint32_t m     = Bits<  3,  0 >( instr );
+    const uint32_t n     = Bits< 19, 16 >( instr );
 
-    int32_t sum1 = (int32_t)(SignExtend( Bits( proc.R[n], 15, 0 ), 32, 16 ))
-        + (int32_t)(SignExtend( Bits( proc.R[m], 15, 0 ), 32, 16 ));
+    if( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( SADD16_A1 );
 
-    int32_t sum2 = (int32_t)(SignExtend( Bits( proc.R[n], 31, 16 ), 32, 16 ))
-        + (int32_t)(SignExtend( Bits( proc.R[m], 31, 16 ), 32, 16 ));
-
-    // Pack results in the destination register
-    proc.R[d]  = (int16_t)(Bits( sum1, 15, 0 ));
-    proc.R[d] |= ((int16_t)(Bits( sum2, 15, 0 ))) << 16;
-
-    // Set GE <1:0>
-    proc.CPSR.GE  = sum1 >= 0 ? (0x3) : 0;
-    // Set GE <3:2>
-    proc.CPSR.GE |= ( sum2 >= 0 ? (0x3) : 0 ) << 2;
+    // Operation
+    proc.CPSR.GE = GEFromSigns< 16 >(
+        ~ParallelSignedHalvingAdd< 16 >( proc.R[n], proc.R[m] ) );
+    proc.R[d]    = ParallelAdd< 16 >( proc.R[n], proc.R[m] );
 }
 
 
@@ -5528,35 +5440,16 @@ void arm::SADD8_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d     = Bits( instr, 15, 12 );
-    const uint32_t m     = Bits( instr,  3,  0 );
-    const uint32_t n     = Bits( instr, 19, 16 );
-
-    if( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
-
-    int32_t sum1 = (int32_t)(SignExtend( Bits( proc.R[n], 7, 0 ), 32, 8 ))
-        + (int32_t)(SignExtend( Bits( proc.R[m], 7, 0 ), 32, 8 ));
+    const uint32_t d     = Bits< 15, 12 >( instr );
+    const uint32_t m     = Bits<  3,  0 >( instr );
+    const uint32_t n     = Bits< 19, 16 >( instr );
 
-    int32_t sum2 = (int32_t)(SignExtend( Bits( proc.R[n], 15, 8 ), 32, 8 ))
-        + (int32_t)(SignExtend( Bits( proc.R[m], 15, 8 ), 32, 8 ));
+    if( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( SADD8_A1 );
 
-    int32_t sum3 = (int32_t)(SignExtend( Bits( proc.R[n], 23, 16 ), 32, 8 ))
-        + (int32_t)(SignExtend( Bits( proc.R[m], 23, 16 ), 32, 8 ));
-
-    int32_t sum4 = (int32_t)(SignExtend( Bits( proc.R[n], 31, 24 ), 32, 8 ))
-        + (int32_t)(SignExtend( Bits( proc.R[m], 31, 24 ), 32, 8 ));
-
-    // Pack results in the destination register
-    proc.R[d]  =  (int8_t)(Bits( sum1, 7, 0 ));
-    proc.R[d] |= ((int8_t)(Bits( sum2, 7, 0 ))) << 8;
-    proc.R[d] |= ((int8_t)(Bits( sum3, 7, 0 ))) << 16;
-    proc.R[d] |= ((int8_t)(Bits( sum4, 7, 0 ))) << 24;
-
-    // Set GE values
-    proc.CPSR.GE  = sum1 >= 0 ? 1 : 0;
-    proc.CPSR.GE |= ( sum2 >= 0 ? 1 : 0 ) << 1;
-    proc.CPSR.GE |= ( sum3 >= 0 ? 1 : 0 ) << 2;
-    proc.CPSR.GE |= ( sum4 >= 0 ? 1 : 0 ) << 3;
+    // Operation
+    proc.CPSR.GE = GEFromSigns< 8 >(
+        ~ParallelSignedHalvingAdd< 8 >( proc.R[n], proc.R[m] ) );
+    proc.R[d]    = ParallelAdd< 8 >( proc.R[n], proc.R[m] );
 }
 
 
@@ -5569,25 +5462,19 @@ void arm::SASX_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d     = Bits( instr, 15, 12 );
-    const uint32_t m     = Bits( instr,  3,  0 );
-    const uint32_t n     = Bits( instr, 19, 16 );
-
-    if( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
+    const uint32_t d     = Bits< 15, 12 >( instr );
+    const uint32_t m     = Bits<  3,  0 >( instr );
+    const uint32_t n     = Bits< 19, 16 >( instr );
 
-    int32_t diff = (int32_t)(SignExtend( Bits( proc.R[n], 15, 0 ), 32, 16 ))
-        - (int32_t)(SignExtend( Bits( proc.R[m], 31, 16 ), 32, 16 ));
+    if( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( SASX_A1 );
 
-    int32_t sum = (int32_t)(SignExtend( Bits( proc.R[n], 31, 16 ), 32, 16 ))
-        + (int32_t)(SignExtend( Bits( proc.R[m], 15, 0 ), 32, 16 ));
-
-    // Pack results in the destination register
-    proc.R[d]  =  (int16_t)(Bits( diff, 15, 0 ));
-    proc.R[d] |= ((int16_t)(Bits( sum, 15, 0 ))) << 16;
-
-    // Set GE values
-    proc.CPSR.GE  = diff >= 0 ? (0x3) : 0;
-    proc.CPSR.GE |= ( sum >= 0 ? (0x3) : 0 ) << 2;
+    // Operation
+    const uint32_t x = ROR( proc.R[m], 16 );
+    proc.CPSR.GE = GEFromSigns< 16 >(
+        ~MergeHalfwords( ParallelSignedHalvingSub< 16 >( proc.R[n], x ),
+                         ParallelSignedHalvingAdd< 16 >( proc.R[n], x ) ) );
+    proc.R[d]    = MergeHalfwords( ParallelSub< 16 >( proc.R[n], x ),
+                                   ParallelAdd< 16 >( proc.R[n], x ) );
 }
 
 
@@ -5600,10 +5487,10 @@ void arm::SBC_IMM_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d        = Bits( instr, 15, 12 );
-    const uint32_t n        = Bits( instr, 19, 16 );
-    const uint32_t imm12    = Bits( instr, 11,  0 );
-    const bool     setflags = Bits( instr, 20, 20 ) == 1;
+    const uint32_t d        = Bits< 15, 12 >( instr );
+    const uint32_t n        = Bits< 19, 16 >( instr );
+    const uint32_t imm12    = Bits< 11,  0 >( instr );
+    const bool     setflags = Bits< 20, 20 >( instr ) == 1;
     const uint32_t imm32    = ARMExpandImm( proc, imm12 );
 
     if( d == 0xF )
@@ -5612,8 +5499,10 @@ void arm::SBC_IMM_A1( proc_type& proc, uint32_t instr )
     }
 
     uint32_t result, carry, overflow;
-    result = AddWithCarry( (uint32_t)proc.R[n], NOT( imm32 ), proc.CPSR.C,
-                           carry, overflow );
+    const uint32_t x        = (uint32_t)proc.R[n];
+    const uint32_t y        = NOT( imm32 );
+    const uint32_t carry_in = proc.CPSR.C;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
 
     if( d == 0xF )
     {
@@ -5625,10 +5514,7 @@ void arm::SBC_IMM_A1( proc_type& proc, uint32_t instr )
         
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;            
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
     }
 }
@@ -5643,12 +5529,12 @@ void arm::SBC_REG_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d        = Bits( instr, 15, 12 );
-    const uint32_t m        = Bits( instr,  3,  0 );
-    const uint32_t n        = Bits( instr, 19, 16 );
-    const uint32_t imm5     = Bits( instr, 11,  7 );
-    const bool     setflags = Bits( instr, 20, 20 ) == 1;
-    const uint32_t type     = Bits( instr,  6,  5 );
+    const uint32_t d        = Bits< 15, 12 >( instr );
+    const uint32_t m        = Bits<  3,  0 >( instr );
+    const uint32_t n        = Bits< 19, 16 >( instr );
+    const uint32_t imm5     = Bits< 11,  7 >( instr );
+    const bool     setflags = Bits< 20, 20 >( instr ) == 1;
+    const uint32_t type     = Bits<  6,  5 >( instr );
 
     ShiftUValue shift = DecodeImmShift( type, imm5 );
 
@@ -5657,12 +5543,14 @@ void arm::SBC_REG_A1( proc_type& proc, uint32_t instr )
         // FIXME : SEE SUBS PC, LR
     }
 
-    uint32_t shifted = Shift( proc.R[m], shift.shift_n, shift.shift_t,
+    uint32_t shifted = Shift( proc.R[m], shift.shift_t, shift.shift_n,
                               proc.CPSR.C );
 
     uint32_t result, carry, overflow;
-    result = AddWithCarry( (uint32_t)proc.R[n], NOT( shifted ), proc.CPSR.C,
-                           carry, overflow );
+    const uint32_t x        = (uint32_t)proc.R[n];
+    const uint32_t y        = NOT( shifted );
+    const uint32_t carry_in = proc.CPSR.C;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
 
     if( d == 0xF )
     {
@@ -5674,10 +5562,7 @@ void arm::SBC_REG_A1( proc_type& proc, uint32_t instr )
         
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;            
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
     }
 }
@@ -5692,28 +5577,30 @@ void arm::SBC_REG_SHIFT_REG_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d        = Bits( instr, 15, 12 );
-    const uint32_t m        = Bits( instr,  3,  0 );
-    const uint32_t n        = Bits( instr, 19, 16 );
-    const uint32_t s        = Bits( instr, 11,  8 );
-    const bool     setflags = Bits( instr, 20, 20 ) == 1;
-    const uint32_t type     = Bits( instr,  6,  5 );
+    const uint32_t d        = Bits< 15, 12 >( instr );
+    const uint32_t m        = Bits<  3,  0 >( instr );
+    const uint32_t n        = Bits< 19, 16 >( instr );
+    const uint32_t s        = Bits< 11,  8 >( instr );
+    const bool     setflags = Bits< 20, 20 >( instr ) == 1;
+    const uint32_t type     = Bits<  6,  5 >( instr );
 
     ShiftUValue shift;
     shift.shift_t = DecodeRegShift( type );
-    shift.shift_n = Bits( proc.R[s], 7, 0 );
+    shift.shift_n = Bits< 7, 0 >( proc.R[s] );
 
     if( d == 0xF )
     {
         // FIXME : SEE SUBS PC, LR
     }
 
-    uint32_t shifted = Shift( proc.R[m], shift.shift_n, shift.shift_t,
+    uint32_t shifted = Shift( proc.R[m], shift.shift_t, shift.shift_n,
                               proc.CPSR.C );
 
     uint32_t result, carry, overflow;
-    result = AddWithCarry( (uint32_t)proc.R[n], NOT( shifted ), proc.CPSR.C,
-                           carry, overflow );
+    const uint32_t x        = (uint32_t)proc.R[n];
+    const uint32_t y        = NOT( shifted );
+    const uint32_t carry_in = proc.CPSR.C;
+    result = AddWithCarry( x, y, carry_in, carry, overflow );
 
     if( d == 0xF )
     {
@@ -5725,10 +5612,7 @@ void arm::SBC_REG_SHIFT_REG_A1( proc_type& proc, uint32_t instr )
         
         if( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;            
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
     }
 }
@@ -5743,14 +5627,14 @@ void arm::SBFX_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d            = Bits( instr, 15, 12 );
-    const uint32_t n            = Bits( instr, 19, 16 );
-    const uint32_t lsbit        = Bits( instr, 11,  7 );
-    const uint32_t widthminus1  = Bits( instr, 20, 16 );
+    const uint32_t d            = Bits< 15, 12 >( instr );
+    const uint32_t n            = Bits< 19, 16 >( instr );
+    const uint32_t lsbit        = Bits< 11,  7 >( instr );
+    const uint32_t widthminus1  = Bits< 20, 16 >( instr );
 
     if( d == 15 || n == 15 )
     {
-         UNPREDICTABLE;
+         ARMV7_UNPREDICTABLE( SBFX_A1 );
     }
     
     uint32_t msbit = lsbit + widthminus1;
@@ -5762,7 +5646,7 @@ void arm::SBFX_A1( proc_type& proc, uint32_t instr )
     }
     else
     {
-         UNPREDICTABLE;
+         ARMV7_UNPREDICTABLE( SBFX_A1 );
     }
 }
 
@@ -5776,30 +5660,22 @@ void arm::SEL_A1( proc_type& proc, uint32_t instr )
     }
 
     // Encoding-specific operations
-    const uint32_t d            = Bits( instr, 15, 12 );
-    const uint32_t m            = Bits( instr,  3,  0 );
-    const uint32_t n            = Bits( instr, 19, 16 );
-
-    if( d == 15 || m == 15 || n == 15 ) UNPREDICTABLE;
-    
-    proc.R[d] =  ( proc.CPSR.GE & 0x1 ) == 1 ? Bits( proc.R[n], 7, 0 ) :
-                                               Bits( proc.R[m], 7, 0 );
+    const uint32_t d            = Bits< 15, 12 >( instr );
+    const uint32_t m            = Bits<  3,  0 >( instr );
+    const uint32_t n            = Bits< 19, 16 >( instr );
 
-    proc.R[d] |= (( proc.CPSR.GE & 0x2 ) == 1 ? Bits( proc.R[n], 15, 8 ) :
-                                                Bits( proc.R[m], 15, 8 )) << 8;
+    if( d == 15 || m == 15 || n == 15 ) ARMV7_UNPREDICTABLE( SEL_A1 );
 
-    proc.R[d] |= (( proc.CPSR.GE & 0x4 ) == 1 ? Bits( proc.R[n], 23, 16 ) :
-                                                Bits( proc.R[m], 23, 16 )) << 16;
-
-    proc.R[d] |= (( proc.CPSR.GE & 0x8 ) == 1 ? Bits( proc.R[n], 31, 24 ) :
-                                                Bits( proc.R[m], 31, 24 )) << 24;
+    // Operation
+    const uint32_t mask = GEByteMask( proc.CPSR.GE );
+    proc.R[d] = ( proc.R[n] & mask ) | ( proc.R[m] & ~mask );
 }
 
 
 template< typename proc_type >
 void arm::SETEND_A1( proc_type& proc, uint32_t instr )
 {
-    const uint32_t set_bigend = Bits( instr, 9, 9 );
+    const uint32_t set_bigend = Bits< 9, 9 >( instr );
     proc.CPSR.E = set_bigend;
 }
 
@@ -5810,24 +5686,14 @@ void arm::SHADD16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SHADD16_A1 );
 
         // Operation
-        int32_t sum1
-            = int16_t( Bits( proc.R[n], 15, 0 ) )
-            + int16_t( Bits( proc.R[m], 15, 0 ) );
-        int32_t sum2
-            = int16_t( Bits( proc.R[n], 31, 16 ) )
-            + int16_t( Bits( proc.R[m], 31, 16 ) );
-
-
-        proc.R[d]  = 0x00000000;
-        proc.R[d] |= Bits( sum1, 16, 1 );
-        proc.R[d] |= Bits( sum2, 16, 1 ) << 16;
+        proc.R[d] = ParallelSignedHalvingAdd< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -5838,31 +5704,20 @@ void arm::SHADD8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
         
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 )
+        
+        {
+        
+            ARMV7_UNPREDICTABLE( SHADD8_A1 );
+        
+        }
 
         // Operation
-        int16_t sum1
-            = int8_t( Bits( proc.R[n], 7, 0 ) )
-            + int8_t( Bits( proc.R[m], 7, 0 ) );
-        int16_t sum2
-            = int8_t( Bits( proc.R[n], 15, 8 ) )
-            + int8_t( Bits( proc.R[m], 15, 8 ) );
-        int16_t sum3
-            = int8_t( Bits( proc.R[n], 23, 16 ) )
-            + int8_t( Bits( proc.R[m], 23, 16 ) );
-        int16_t sum4
-            = int8_t( Bits( proc.R[n], 31, 24 ) )
-            + int8_t( Bits( proc.R[m], 31, 24 ) );
-
-        proc.R[d] = 0x0;
-        proc.R[d] |= ( Bits( sum1, 8, 1 ) );
-        proc.R[d] |= ( Bits( sum2, 8, 1 ) << 8  );
-        proc.R[d] |= ( Bits( sum3, 8, 1 ) << 16 );
-        proc.R[d] |= ( Bits( sum4, 8, 1 ) << 24 );
+        proc.R[d] = ParallelSignedHalvingAdd< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -5873,22 +5728,17 @@ void arm::SHASX_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
-        
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
         
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SHASX_A1 );
+
         // Operation
-        int32_t diff = int16_t( Bits( proc.R[n], 15,  0 ) )
-                     - int16_t( Bits( proc.R[m], 31, 16 ) );
-                     
-        int32_t sum = int16_t( Bits( proc.R[n], 31, 16 ) ) 
-                    + int16_t( Bits( proc.R[m], 15,  0 ) );
-        
-        proc.R[d] = 0x0;
-        proc.R[d] |= Bits( diff, 16, 1 );
-        proc.R[d] |= Bits( sum, 16, 1 ) << 16;
+        const uint32_t x = ROR( proc.R[m], 16 );
+        proc.R[d] =
+            MergeHalfwords( ParallelSignedHalvingSub< 16 >( proc.R[n], x ),
+                            ParallelSignedHalvingAdd< 16 >( proc.R[n], x ) );
     }
 }
 
@@ -5899,22 +5749,17 @@ void arm::SHSAX_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SHSAX_A1 );
 
         // Operation
-        int32_t sum  = int16_t( Bits( proc.R[n], 15, 0  ) ) 
-                     + int16_t( Bits( proc.R[m], 31, 16 ) );
-                     
-        int32_t diff = int16_t( Bits( proc.R[n], 31, 16 ) )
-                     - int16_t( Bits( proc.R[m], 15, 0  ) );
-        
-        proc.R[d] = 0x0;
-        proc.R[d] |= Bits( sum,  16, 1 );
-        proc.R[d] |= Bits( diff, 16, 1 ) << 16;
+        const uint32_t x = ROR( proc.R[m], 16 );
+        proc.R[d] =
+            MergeHalfwords( ParallelSignedHalvingAdd< 16 >( proc.R[n], x ),
+                            ParallelSignedHalvingSub< 16 >( proc.R[n], x ) );
     }
 }
 
@@ -5925,22 +5770,14 @@ void arm::SHSUB16_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
-        
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
         
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SHSUB16_A1 );
+
         // Operation
-        int32_t diff1 = int16_t( Bits( proc.R[n], 15, 0 ) )
-                      - int16_t( Bits( proc.R[m], 15, 0 ) );
-                      
-        int32_t diff2 = int16_t( Bits( proc.R[n], 31, 16 ) )
-                      - int16_t( Bits( proc.R[m], 31, 16 ) );
-    
-        proc.R[d] = 0x0;
-        proc.R[d] |= Bits( diff1, 16, 1 );
-        proc.R[d] |= Bits( diff2, 16, 1 ) << 16;
+        proc.R[d] = ParallelSignedHalvingSub< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -5951,30 +5788,14 @@ void arm::SHSUB8_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SHSUB8_A1 );
 
         // Operation
-        int16_t diff1 = int8_t( Bits( proc.R[n], 7 , 0 ) ) 
-                     - int8_t( Bits( proc.R[m], 7 , 0 ) );
-                     
-        int16_t diff2 = int8_t( Bits( proc.R[n], 15, 8 ) )
-                     - int8_t( Bits( proc.R[m], 15, 8 ) );
-                     
-        int16_t diff3 = int8_t( Bits( proc.R[n], 23, 16 ) ) 
-                     - int8_t( Bits( proc.R[m], 23, 16 ) );
-                     
-        int16_t diff4 = int8_t( Bits( proc.R[n], 31, 24 ) )
-                     - int8_t( Bits( proc.R[m], 31, 24 ) );
-        
-        proc.R[d] = 0x0;
-        proc.R[d] |= Bits( diff1, 8 , 1 );
-        proc.R[d] |= Bits( diff2, 8 , 1 ) << 8;
-        proc.R[d] |= Bits( diff3, 8 , 1 ) << 16;
-        proc.R[d] |= Bits( diff4, 8 , 1 ) << 24;
+        proc.R[d] = ParallelSignedHalvingSub< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -5984,37 +5805,38 @@ void arm::SMLAxy_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t a = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t M = Bits( instr,  6,  6 );
-        uint32_t N = Bits( instr,  5,  5 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t a = Bits< 15, 12 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t M = Bits<  6,  6 >( instr );
+        uint32_t N = Bits<  5,  5 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
         
         bool n_high = ( N == 1 );
         bool m_high = ( M == 1 );
         
-        if( d == 15 || n == 15 || m == 15 || a == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 || a == 15 )
+            ARMV7_UNPREDICTABLE( SMLAxy_A1 );
         
         // Operation
         int16_t operand1, operand2;
 
         if( n_high )
-            operand1 = Bits( proc.R[n], 31, 16 );
+            operand1 = Bits< 31, 16 >( proc.R[n] );
         else
-            operand1 = Bits( proc.R[n], 15,  0 );
+            operand1 = Bits< 15,  0 >( proc.R[n] );
 
         if( m_high )
-            operand2 = Bits( proc.R[m], 31, 16 );
+            operand2 = Bits< 31, 16 >( proc.R[m] );
         else
-            operand2 = Bits( proc.R[m], 15,  0 );
+            operand2 = Bits< 15,  0 >( proc.R[m] );
         
         int64_t result = int64_t( operand1 ) * operand2
                        + int32_t( proc.R[a] );
 
-        proc.R[d] = Bits64( result, 31, 0 );
+        proc.R[d] = Bits64< 31, 0 >( result );
         
-        if( result != int32_t( Bits64( result, 31, 0 )) ) // Signed overflow
+        if( result != int32_t( Bits64< 31, 0 >( result )) ) // Signed overflow
             proc.CPSR.Q = 1;
     }
 }
@@ -6026,11 +5848,11 @@ void arm::SMLAD_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t a = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t M = Bits( instr,  5,  5 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t a = Bits< 15, 12 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t M = Bits<  5,  5 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
         
         bool m_swap = (M == 1);
         
@@ -6040,22 +5862,22 @@ void arm::SMLAD_A1( proc_type& proc, uint32_t instr )
             return;
         }
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SMLAD_A1 );
 
         // Operation
         int32_t operand2 = ( m_swap ? ROR(proc.R[m],16) : uint32_t( proc.R[m] ) );
             
-        int64_t product1 = int32_t( int16_t( Bits( proc.R[n], 15, 0 ) ) ) 
-                         * int16_t( Bits( operand2,  15, 0 ) );
+        int64_t product1 = int32_t( int16_t( Bits< 15, 0 >( proc.R[n] ) ) ) 
+                         * int16_t( Bits<  15, 0 >( operand2 ) );
                             
-        int64_t product2 = int32_t( int16_t( Bits( proc.R[n], 31, 16 ) ) )
-                         * int16_t( Bits( operand2,  31, 16 ) );
+        int64_t product2 = int32_t( int16_t( Bits< 31, 16 >( proc.R[n] ) ) )
+                         * int16_t( Bits<  31, 16 >( operand2 ) );
         
         int64_t result = product1 + product2 + int32_t(proc.R[a]);
         
-        proc.R[d] = Bits64( result, 31, 0 );
+        proc.R[d] = Bits64< 31, 0 >( result );
         
-        if( result != int32_t( Bits64( result, 31, 0 ) ) ) // Signed overflow
+        if( result != int32_t( Bits64< 31, 0 >( result ) ) ) // Signed overflow
             proc.CPSR.Q = 1;
     }
 }
@@ -6067,17 +5889,19 @@ void arm::SMLAL_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S   = Bits( instr, 20, 20 );
-        uint32_t dHi = Bits( instr, 19, 16 );
-        uint32_t dLo = Bits( instr, 15, 12 );
-        uint32_t m   = Bits( instr, 11,  8 );
-        uint32_t n   = Bits( instr,  3,  0 );
+        uint32_t S   = Bits< 20, 20 >( instr );
+        uint32_t dHi = Bits< 19, 16 >( instr );
+        uint32_t dLo = Bits< 15, 12 >( instr );
+        uint32_t m   = Bits< 11,  8 >( instr );
+        uint32_t n   = Bits<  3,  0 >( instr );
 
         bool setflags = ( S == 0x1 );
 
-        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
-        if ( dHi == dLo ) UNPREDICTABLE;
-        if ( ArchVersion() < 6 && ( dHi == n || dLo == n ) ) UNPREDICTABLE;
+        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 )
+            ARMV7_UNPREDICTABLE( SMLAL_A1 );
+        if ( dHi == dLo ) ARMV7_UNPREDICTABLE( SMLAL_A1 );
+        if ( ArchVersion( proc ) < 6 && ( dHi == n || dLo == n ) )
+            ARMV7_UNPREDICTABLE( SMLAL_A1 );
         
         // Operation
         int64_t result = int64_t( int32_t( proc.R[n] ) ) 
@@ -6085,12 +5909,12 @@ void arm::SMLAL_A1( proc_type& proc, uint32_t instr )
                        + int64_t( ( int64_t( proc.R[dHi] ) << 32 )
                          | proc.R[dLo] );
         
-        proc.R[dHi] = Bits64( result, 63, 32 );
-        proc.R[dLo] = Bits64( result, 31,  0 );
+        proc.R[dHi] = Bits64< 63, 32 >( result );
+        proc.R[dLo] = Bits64< 31,  0 >( result );
         
         if( setflags )
         {
-            proc.CPSR.N = Bits64( result, 63, 63 );
+            proc.CPSR.N = Bits64< 63, 63 >( result );
             proc.CPSR.Z = IsZeroBit( result );
         }
     }
@@ -6103,40 +5927,41 @@ void arm::SMLALxy_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t dHi = Bits( instr, 19, 16 );
-        uint32_t dLo = Bits( instr, 15, 12 );
-        uint32_t m   = Bits( instr, 11,  8 );
-        uint32_t M   = Bits( instr,  6,  6 );
-        uint32_t N   = Bits( instr,  5,  5 );
-        uint32_t n   = Bits( instr,  3,  0 );
+        uint32_t dHi = Bits< 19, 16 >( instr );
+        uint32_t dLo = Bits< 15, 12 >( instr );
+        uint32_t m   = Bits< 11,  8 >( instr );
+        uint32_t M   = Bits<  6,  6 >( instr );
+        uint32_t N   = Bits<  5,  5 >( instr );
+        uint32_t n   = Bits<  3,  0 >( instr );
         
         bool n_high = ( N == 1 );
         bool m_high = ( M == 1 );
         
-        if( dHi == 15 || dLo == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
-        if( dHi == dLo ) UNPREDICTABLE;
+        if( dHi == 15 || dLo == 15 || n == 15 || m == 15 )
+            ARMV7_UNPREDICTABLE( SMLALxy_A1 );
+        if( dHi == dLo ) ARMV7_UNPREDICTABLE( SMLALxy_A1 );
        
         // Operation
         int16_t operand1;
         int16_t operand2;
         
         if( n_high )
-            operand1 = Bits( proc.R[n], 31, 16 );
+            operand1 = Bits< 31, 16 >( proc.R[n] );
         else
-            operand1 = Bits( proc.R[n], 15,  0 );
+            operand1 = Bits< 15,  0 >( proc.R[n] );
 
         if( m_high )
-            operand2 = Bits( proc.R[m], 31, 16 );
+            operand2 = Bits< 31, 16 >( proc.R[m] );
         else
-            operand2 = Bits( proc.R[m], 15,  0 );
+            operand2 = Bits< 15,  0 >( proc.R[m] );
         
         int64_t result = int64_t( operand1 ) 
                        * int64_t( operand2 ) 
                        + int64_t( ( int64_t( proc.R[dHi] ) << 32 )
                          | proc.R[dLo] );
         
-        proc.R[dHi] = Bits64( result, 63, 32 );
-        proc.R[dLo] = Bits64( result, 31,  0 );
+        proc.R[dHi] = Bits64< 63, 32 >( result );
+        proc.R[dLo] = Bits64< 31,  0 >( result );
     }
 }
 
@@ -6147,33 +5972,34 @@ void arm::SMLALD_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t dHi = Bits( instr, 19, 16 );
-        uint32_t dLo = Bits( instr, 15, 12 );
-        uint32_t m   = Bits( instr, 11,  8 );
-        uint32_t M   = Bits( instr,  5,  5 );
-        uint32_t n   = Bits( instr,  3,  0 );
+        uint32_t dHi = Bits< 19, 16 >( instr );
+        uint32_t dLo = Bits< 15, 12 >( instr );
+        uint32_t m   = Bits< 11,  8 >( instr );
+        uint32_t M   = Bits<  5,  5 >( instr );
+        uint32_t n   = Bits<  3,  0 >( instr );
          
         bool m_swap = (M == 1);
         
-        if( dLo == 15 || dHi == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
-        if( dHi == dLo ) UNPREDICTABLE;
+        if( dLo == 15 || dHi == 15 || n == 15 || m == 15 )
+            ARMV7_UNPREDICTABLE( SMLALD_A1 );
+        if( dHi == dLo ) ARMV7_UNPREDICTABLE( SMLALD_A1 );
         
         // Operation
         int32_t operand2 = ( m_swap ? ROR(proc.R[m],16) : uint32_t( proc.R[m] ) );
             
-        int32_t product1 = int32_t( int16_t( Bits( proc.R[n], 15, 0 ) )  )
-                         * int32_t( int16_t( Bits( operand2,  15, 0 ) ) );
+        int32_t product1 = int32_t( int16_t( Bits< 15, 0 >( proc.R[n] ) )  )
+                         * int32_t( int16_t( Bits<  15, 0 >( operand2 ) ) );
                          
-        int32_t product2 = int32_t( int16_t( Bits( proc.R[n], 31, 16 ) ) )
-                         * int32_t( int16_t( Bits( operand2,  31, 16 ) ) );
+        int32_t product2 = int32_t( int16_t( Bits< 31, 16 >( proc.R[n] ) ) )
+                         * int32_t( int16_t( Bits<  31, 16 >( operand2 ) ) );
         
         int64_t result = int64_t( product1 )
                        + int64_t( product2 ) 
                        + int64_t( ( int64_t( proc.R[dHi] ) << 32 )
                          | proc.R[dLo]);
         
-        proc.R[dHi] = Bits64( result, 63, 32 );
-        proc.R[dLo] = Bits64( result, 31,  0 );
+        proc.R[dHi] = Bits64< 63, 32 >( result );
+        proc.R[dLo] = Bits64< 31,  0 >( result );
     }
 }
 
@@ -6184,29 +6010,30 @@ void arm::SMLAWx_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t a = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t M = Bits( instr,  6,  6 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t a = Bits< 15, 12 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t M = Bits<  6,  6 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
 
         bool m_high = ( M == 1 );
         
-        if( d == 15 || n == 15 || m == 15 || a == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 || a == 15 )
+            ARMV7_UNPREDICTABLE( SMLAWx_A1 );
         
         // Operation
         int16_t operand2;
         
         if( m_high )
-            operand2 = Bits( proc.R[m], 31, 16 );
+            operand2 = Bits< 31, 16 >( proc.R[m] );
         else
-            operand2 = Bits( proc.R[m], 15,  0 );
+            operand2 = Bits< 15,  0 >( proc.R[m] );
         
         int64_t result = int64_t( int32_t(proc.R[n]) ) 
                        * int64_t( operand2 )
                        + ( int64_t( int32_t( proc.R[a] ) ) << 16 );
         
-        proc.R[d] = Bits64( result, 47, 16 );
+        proc.R[d] = Bits64< 47, 16 >( result );
         
         if( (result >> 16) != proc.R[d] ) // Signed overflow
             proc.CPSR.Q = 1;
@@ -6220,11 +6047,11 @@ void arm::SMLSD_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t a = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t M = Bits( instr,  5,  5 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t a = Bits< 15, 12 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t M = Bits<  5,  5 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
         
         bool m_swap = (M == 1);
 
@@ -6234,24 +6061,24 @@ void arm::SMLSD_A1( proc_type& proc, uint32_t instr )
             return;
         }
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SMLSD_A1 );
         
         // Operation
         int32_t operand2 = ( m_swap ? ROR(proc.R[m],16) : uint32_t( proc.R[m] ) );
         
-        int32_t product1 = int32_t( int16_t( Bits( proc.R[n], 15, 0 ) ) )
-                         * int16_t( Bits( operand2,  15, 0 ) );
+        int32_t product1 = int32_t( int16_t( Bits< 15, 0 >( proc.R[n] ) ) )
+                         * int16_t( Bits<  15, 0 >( operand2 ) );
 
-        int32_t product2 = int32_t( int16_t( Bits( proc.R[n], 31, 16 ) ) )
-                         * int16_t( Bits( operand2,   31, 16 ) );
+        int32_t product2 = int32_t( int16_t( Bits< 31, 16 >( proc.R[n] ) ) )
+                         * int16_t( Bits<   31, 16 >( operand2 ) );
         
         int64_t result = int64_t( product1 ) 
                        - int64_t( product2 )
                        + int64_t( int32_t( proc.R[a] ) );
         
-        proc.R[d] = Bits64( result, 31, 0 );
+        proc.R[d] = Bits64< 31, 0 >( result );
         
-        if( result != int32_t( Bits64( result, 31, 0 ) ) ) // Signed overflow
+        if( result != int32_t( Bits64< 31, 0 >( result ) ) ) // Signed overflow
             proc.CPSR.Q = 1;
     }
 }
@@ -6263,33 +6090,34 @@ void arm::SMLSLD_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t dHi = Bits( instr, 19, 16 );
-        uint32_t dLo = Bits( instr, 15, 12 );
-        uint32_t m   = Bits( instr, 11,  8 );
-        uint32_t M   = Bits( instr,  5,  5 );
-        uint32_t n   = Bits( instr,  3,  0 );
+        uint32_t dHi = Bits< 19, 16 >( instr );
+        uint32_t dLo = Bits< 15, 12 >( instr );
+        uint32_t m   = Bits< 11,  8 >( instr );
+        uint32_t M   = Bits<  5,  5 >( instr );
+        uint32_t n   = Bits<  3,  0 >( instr );
          
         bool m_swap = (M == 1);
         
-        if( dLo == 15 || dHi == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
-        if( dHi == dLo ) UNPREDICTABLE;
+        if( dLo == 15 || dHi == 15 || n == 15 || m == 15 )
+            ARMV7_UNPREDICTABLE( SMLSLD_A1 );
+        if( dHi == dLo ) ARMV7_UNPREDICTABLE( SMLSLD_A1 );
         
         // Operation
         int32_t operand2 = ( m_swap ? ROR(proc.R[m],16) : uint32_t( proc.R[m] ) );
         
-        int32_t product1 = int32_t( int16_t( Bits( proc.R[n], 15, 0 ) ) )
-                         * int32_t( int16_t( Bits( operand2,  15, 0 ) ) );
+        int32_t product1 = int32_t( int16_t( Bits< 15, 0 >( proc.R[n] ) ) )
+                         * int32_t( int16_t( Bits<  15, 0 >( operand2 ) ) );
 
-        int32_t product2 = int32_t( int16_t( Bits( proc.R[n], 31, 16 ) ) )
-                         * int32_t( int16_t( Bits( operand2,  31, 16 ) ) );
+        int32_t product2 = int32_t( int16_t( Bits< 31, 16 >( proc.R[n] ) ) )
+                         * int32_t( int16_t( Bits<  31, 16 >( operand2 ) ) );
         
         int64_t result = int64_t( product1 )
                        - int64_t( product2 )
                        + int64_t( ( int64_t( proc.R[dHi] ) << 32 )
                          | proc.R[dLo] );
         
-        proc.R[dHi] = Bits64( result, 63, 32 );
-        proc.R[dLo] = Bits64( result, 31,  0 ); 
+        proc.R[dHi] = Bits64< 63, 32 >( result );
+        proc.R[dLo] = Bits64< 31,  0 >( result ); 
     }
 }
 
@@ -6300,11 +6128,11 @@ void arm::SMMLA_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t a = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t R = Bits( instr,  5,  5 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t a = Bits< 15, 12 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t R = Bits<  5,  5 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
         
         bool round = (R == 1);
 
@@ -6314,7 +6142,7 @@ void arm::SMMLA_A1( proc_type& proc, uint32_t instr )
             return;
         }
 
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SMMLA_A1 );
         
         // Operation
         int64_t result = ( int64_t( proc.R[a] ) << 32 ) 
@@ -6324,7 +6152,7 @@ void arm::SMMLA_A1( proc_type& proc, uint32_t instr )
         if( round )
             result = result + 0x80000000;
         
-        proc.R[d] = Bits64( result, 63, 32 );
+        proc.R[d] = Bits64< 63, 32 >( result );
     }
 }
 
@@ -6335,15 +6163,16 @@ void arm::SMMLS_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t a = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t R = Bits( instr,  5,  5 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t a = Bits< 15, 12 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t R = Bits<  5,  5 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
         
         bool round = (R == 1);
         
-        if( d == 15 || n == 15 || m == 15 || a == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 || a == 15 )
+            ARMV7_UNPREDICTABLE( SMMLS_A1 );
     
         // Operation
         int64_t result = ( int64_t( proc.R[a] ) << 32 )
@@ -6353,7 +6182,7 @@ void arm::SMMLS_A1( proc_type& proc, uint32_t instr )
         if( round )
             result = result + 0x80000000;
             
-        proc.R[d] = Bits64( result, 63, 32 );
+        proc.R[d] = Bits64< 63, 32 >( result );
     }
 }
 
@@ -6364,14 +6193,14 @@ void arm::SMMUL_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t R = Bits( instr,  5,  5 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t R = Bits<  5,  5 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
         
         bool round = (R == 1);
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SMMUL_A1 );
         
         // Operation
         int64_t result = int64_t( int32_t( proc.R[n] ) )
@@ -6380,7 +6209,7 @@ void arm::SMMUL_A1( proc_type& proc, uint32_t instr )
         if( round )
             result = result + 0x80000000;
             
-        proc.R[d] = Bits64( result, 63, 32 );
+        proc.R[d] = Bits64< 63, 32 >( result );
     }
 }
 
@@ -6391,29 +6220,29 @@ void arm::SMUAD_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t M = Bits( instr,  5,  5 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t M = Bits<  5,  5 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
         
         bool m_swap = (M == 1);
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SMUAD_A1 );
 
         // Operation
         int32_t operand2 = ( m_swap ? ROR(proc.R[m],16) : uint32_t( proc.R[m] ) );
             
-        int32_t product1 = int32_t( int16_t( Bits( proc.R[n], 15, 0 ) ) )
-                         * int32_t( int16_t( Bits( operand2,  15, 0 ) ) );
+        int32_t product1 = int32_t( int16_t( Bits< 15, 0 >( proc.R[n] ) ) )
+                         * int32_t( int16_t( Bits<  15, 0 >( operand2 ) ) );
                             
-        int32_t product2 = int32_t( int16_t( Bits( proc.R[n], 31, 16 ) ) )
-                         * int32_t( int16_t( Bits( operand2,  31, 16 ) ) );
+        int32_t product2 = int32_t( int16_t( Bits< 31, 16 >( proc.R[n] ) ) )
+                         * int32_t( int16_t( Bits<  31, 16 >( operand2 ) ) );
         
         int64_t result = int64_t( product1 ) + int64_t( product2 );
         
-        proc.R[d] = Bits64( result, 31, 0 );
+        proc.R[d] = Bits64< 31, 0 >( result );
         
-        if( result != int32_t(Bits64( result, 31, 0 )) ) // Signed overflow
+        if( result != int32_t(Bits64< 31, 0 >( result )) ) // Signed overflow
             proc.CPSR.Q = 1;
     
     }
@@ -6426,34 +6255,34 @@ void arm::SMULxy_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t M = Bits( instr,  6,  6 );
-        uint32_t N = Bits( instr,  5,  5 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t M = Bits<  6,  6 >( instr );
+        uint32_t N = Bits<  5,  5 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
 
         bool n_high = ( N == 1 );
         bool m_high = ( M == 1 );
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SMULxy_A1 );
 
         // Operation
         int16_t operand1;
         int16_t operand2;
         
         if( n_high )
-            operand1 = Bits( proc.R[n], 31, 16 );
+            operand1 = Bits< 31, 16 >( proc.R[n] );
         else
-            operand1 = Bits( proc.R[n], 15,  0 );
+            operand1 = Bits< 15,  0 >( proc.R[n] );
 
         if( m_high )
-            operand2 = Bits( proc.R[m], 31, 16 );
+            operand2 = Bits< 31, 16 >( proc.R[m] );
         else
-            operand2 = Bits( proc.R[m], 15,  0 );
+            operand2 = Bits< 15,  0 >( proc.R[m] );
         
         int64_t result = int64_t( operand1 ) * int64_t( operand2 );
         
-        proc.R[d] = Bits64( result, 31, 0 ); 
+        proc.R[d] = Bits64< 31, 0 >( result ); 
         // Signed overflow cannot occur
     }
 }
@@ -6465,28 +6294,30 @@ void arm::SMULL_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S   = Bits( instr, 20, 20 );
-        uint32_t dHi = Bits( instr, 19, 16 );
-        uint32_t dLo = Bits( instr, 15, 12 );
-        uint32_t m   = Bits( instr, 11,  8 );
-        uint32_t n   = Bits( instr,  3,  0 );
+        uint32_t S   = Bits< 20, 20 >( instr );
+        uint32_t dHi = Bits< 19, 16 >( instr );
+        uint32_t dLo = Bits< 15, 12 >( instr );
+        uint32_t m   = Bits< 11,  8 >( instr );
+        uint32_t n   = Bits<  3,  0 >( instr );
 
         bool setflags = ( S == 0x1 );
 
-        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
-        if ( dHi == dLo ) UNPREDICTABLE;
-        if ( ArchVersion() < 6 && ( dHi == n || dLo == n ) ) UNPREDICTABLE;
+        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 )
+            ARMV7_UNPREDICTABLE( SMULL_A1 );
+        if ( dHi == dLo ) ARMV7_UNPREDICTABLE( SMULL_A1 );
+        if ( ArchVersion( proc ) < 6 && ( dHi == n || dLo == n ) )
+            ARMV7_UNPREDICTABLE( SMULL_A1 );
         
         // Operation        
         int64_t result = int64_t( int32_t( proc.R[n] ) )
                        * int64_t( int32_t( proc.R[m] ) );
         
-        proc.R[dHi] = Bits64( result, 63, 32 );
-        proc.R[dLo] = Bits64( result, 31,  0 );
+        proc.R[dHi] = Bits64< 63, 32 >( result );
+        proc.R[dLo] = Bits64< 31,  0 >( result );
         
         if( setflags )
         {
-            proc.CPSR.N = Bits64( result, 63, 63 );
+            proc.CPSR.N = Bits64< 63, 63 >( result );
             proc.CPSR.Z = IsZeroBit( result );
         }
     }
@@ -6499,27 +6330,27 @@ void arm::SMULWx_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t M = Bits( instr,  6,  6 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t M = Bits<  6,  6 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
 
         bool m_high = ( M == 1 );
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SMULWx_A1 );
         
         // Operation
         int16_t operand2;
         
         if( m_high )
-            operand2 = Bits( proc.R[m], 31, 16 );
+            operand2 = Bits< 31, 16 >( proc.R[m] );
         else
-            operand2 = Bits( proc.R[m], 15,  0 );
+            operand2 = Bits< 15,  0 >( proc.R[m] );
 
         int64_t product = int64_t( int32_t( proc.R[n] ) )
                         * int64_t( operand2 );
 
-        proc.R[d] = Bits64( product, 47, 16 );
+        proc.R[d] = Bits64< 47, 16 >( product );
         // Signed overflow cannot occur
     }
 }
@@ -6531,27 +6362,27 @@ void arm::SMUSD_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t M = Bits( instr,  5,  5 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t M = Bits<  5,  5 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
         
         bool m_swap = (M == 1);
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SMUSD_A1 );
 
         // Operation
         int32_t operand2 = ( m_swap ? ROR(proc.R[m],16) : uint32_t( proc.R[m] ) );
 
-        int32_t product1 = int32_t( int16_t( Bits( proc.R[n], 15, 0 ) ) )
-                         * int32_t( int16_t( Bits( operand2,  15, 0 ) ) );
+        int32_t product1 = int32_t( int16_t( Bits< 15, 0 >( proc.R[n] ) ) )
+                         * int32_t( int16_t( Bits<  15, 0 >( operand2 ) ) );
 
-        int32_t product2 = int32_t( int16_t( Bits( proc.R[n], 31, 16 ) ) )
-                         * int32_t( int16_t( Bits( operand2,  31, 16 ) ) );
+        int32_t product2 = int32_t( int16_t( Bits< 31, 16 >( proc.R[n] ) ) )
+                         * int32_t( int16_t( Bits<  31, 16 >( operand2 ) ) );
 
         int64_t result = int64_t( product1 ) - int64_t( product2 );
 
-        proc.R[d] = Bits( result, 31, 0 );
+        proc.R[d] = Bits< 31, 0 >( result );
         // Signed overflow cannot occur
 
     }
@@ -6564,11 +6395,11 @@ void arm::SSAT_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t sat_imm = Bits( instr, 20, 16 );
-        uint32_t d       = Bits( instr, 15, 12 );
-        uint32_t imm5    = Bits( instr, 11,  7 );
-        uint32_t sh      = Bits( instr,  6,  6 );
-        uint32_t n       = Bits( instr,  3,  0 );
+        uint32_t sat_imm = Bits< 20, 16 >( instr );
+        uint32_t d       = Bits< 15, 12 >( instr );
+        uint32_t imm5    = Bits< 11,  7 >( instr );
+        uint32_t sh      = Bits<  6,  6 >( instr );
+        uint32_t n       = Bits<  3,  0 >( instr );
         
         uint32_t saturate_to = UInt(sat_imm)+1;
 
@@ -6578,7 +6409,7 @@ void arm::SSAT_A1( proc_type& proc, uint32_t instr )
         SRType      shift_t = shift.shift_t;
         uint32_t    shift_n = shift.shift_n;
         
-        if( d == 15 || n == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 ) ARMV7_UNPREDICTABLE( SSAT_A1 );
 
         // Operation
         uint32_t operand = Shift( proc.R[n], shift_t, shift_n, proc.CPSR.C);
@@ -6602,23 +6433,23 @@ void arm::SSAT16_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t sat_imm = Bits( instr, 19, 16 );
-        uint32_t d       = Bits( instr, 15, 12 );
-        uint32_t n       = Bits( instr,  3,  0 );
+        uint32_t sat_imm = Bits< 19, 16 >( instr );
+        uint32_t d       = Bits< 15, 12 >( instr );
+        uint32_t n       = Bits<  3,  0 >( instr );
         
         uint32_t saturate_to = UInt(sat_imm)+1;
 
-        if( d == 15 || n == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 ) ARMV7_UNPREDICTABLE( SSAT16_A1 );
 
         // Operation
         ValueSat valueSat1 = 
-            SignedSatQ( int16_t( Bits( proc.R[n], 15, 0 ) ), saturate_to );
+            SignedSatQ( int16_t( Bits< 15, 0 >( proc.R[n] ) ), saturate_to );
 
         int64_t result1    = valueSat1.value;
         bool    sat1       = valueSat1.saturated;
 
         ValueSat valueSat2 = 
-            SignedSatQ( int16_t( Bits( proc.R[n], 31, 16 ) ), saturate_to );
+            SignedSatQ( int16_t( Bits< 31, 16 >( proc.R[n] ) ), saturate_to );
 
         int64_t result2    = valueSat2.value;
         bool    sat2       = valueSat2.saturated;
@@ -6639,25 +6470,19 @@ void arm::SSAX_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SSAX_A1 );
 
         // Operation
-        int16_t sum = int16_t( Bits( proc.R[n], 15,  0 ) ) 
-                    + int16_t( Bits( proc.R[m], 31, 16 ) );
-
-        int16_t diff = int16_t( Bits( proc.R[n], 31, 16 ) )
-                     - int16_t( Bits( proc.R[m], 15,  0 ) );
-
-        proc.R[d]  = 0x00000000;
-        proc.R[d] |= Bits( sum,  15, 0 );
-        proc.R[d] |= Bits( diff, 15, 0 ) << 16;
-
-        proc.CPSR.GE  = ( sum  >= 0 ? 3 : 0 ) 
-                    | ( ( diff >= 0 ? 3 : 0 ) << 2 );
+        const uint32_t x = ROR( proc.R[m], 16 );
+        proc.CPSR.GE = GEFromSigns< 16 >(
+            ~MergeHalfwords( ParallelSignedHalvingAdd< 16 >( proc.R[n], x ),
+                             ParallelSignedHalvingSub< 16 >( proc.R[n], x ) ) );
+        proc.R[d]    = MergeHalfwords( ParallelAdd< 16 >( proc.R[n], x ),
+                                       ParallelSub< 16 >( proc.R[n], x ) );
     }
 }
 
@@ -6668,25 +6493,16 @@ void arm::SSUB16_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SSUB16_A1 );
 
         // Operation
-        int16_t diff1 = int16_t( Bits( proc.R[n], 15,  0 ) )
-                      - int16_t( Bits( proc.R[m], 15,  0 ) );
-
-        int16_t diff2 = int16_t( Bits( proc.R[n], 31, 16 ) )
-                      - int16_t( Bits( proc.R[m], 31, 16 ) );
-
-        proc.R[d]  = 0x00000000;
-        proc.R[d] |= Bits( diff1, 15, 0 );
-        proc.R[d] |= Bits( diff2, 15, 0 ) << 16;
-
-        proc.CPSR.GE  = ( diff1 >= 0 ? 3 : 0 )
-                    | ( ( diff2 >= 0 ? 3 : 0 ) << 2 );
+        proc.CPSR.GE = GEFromSigns< 16 >(
+            ~ParallelSignedHalvingSub< 16 >( proc.R[n], proc.R[m] ) );
+        proc.R[d]    = ParallelSub< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -6697,35 +6513,16 @@ void arm::SSUB8_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
         
-        if( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SSUB8_A1 );
 
         // Operation
-        int8_t diff1 = int8_t( Bits( proc.R[n],  7,  0 ) ) 
-                     - int8_t( Bits( proc.R[m],  7,  0 ) );
-
-        int8_t diff2 = int8_t( Bits( proc.R[n], 15,  8 ) )
-                     - int8_t( Bits( proc.R[m], 15,  8 ) );
-
-        int8_t diff3 = int8_t( Bits( proc.R[n], 23, 16 ) ) 
-                     - int8_t( Bits( proc.R[m], 23, 16 ) );
-
-        int8_t diff4 = int8_t( Bits( proc.R[n], 31, 24 ) )
-                     - int8_t( Bits( proc.R[m], 31, 24 ) );
-
-        proc.R[d]  = 0x00000000;
-        proc.R[d] |= Bits( diff1, 7, 0 );
-        proc.R[d] |= Bits( diff2, 7, 0 ) << 8;
-        proc.R[d] |= Bits( diff3, 7, 0 ) << 16;
-        proc.R[d] |= Bits( diff4, 7, 0 ) << 24;
-
-        proc.CPSR.GE = ( diff1 >= 0 ? 1 : 0 )
-                     | (( diff2 >= 0 ? 1 : 0 ) << 1)
-                     | (( diff3 >= 0 ? 1 : 0 ) << 2)
-                     | (( diff4 >= 0 ? 1 : 0 ) << 3);
+        proc.CPSR.GE = GEFromSigns< 8 >(
+            ~ParallelSignedHalvingSub< 8 >( proc.R[n], proc.R[m] ) );
+        proc.R[d]    = ParallelSub< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -6736,36 +6533,24 @@ void arm::STM_STMIA_STMEA_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t W             = Bits( instr, 21, 21 );
-        uint32_t n             = Bits( instr, 19, 16 );
-        uint32_t register_list = Bits( instr, 15,  0 );
+        uint32_t W             = Bits< 21, 21 >( instr );
+        uint32_t n             = Bits< 19, 16 >( instr );
+        uint32_t register_list = Bits< 15,  0 >( instr );
 
         uint32_t registers = register_list;
         bool wback = ( W == 1 );
         
-        if( n == 15 || BitCount( registers ) < 1 ) UNPREDICTABLE;
+        if( n == 15 || BitCount( registers ) < 1 )
+            ARMV7_UNPREDICTABLE( STM_STMIA_STMEA_A1 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
 
         uint32_t address = proc.R[n];
 
-        for( int i = 0; i <= 14; ++i )
-        {
-            if( Bits( registers, i, i ) == 1 )
-            {
-                if( (uint32_t)i == n && wback && i != LowestSetBit( registers ) )
-                    // Only possible for encodings T1 and A1
-                    proc.dMem.write_word( address, 0x000000000 );// UNKNOWN;
-                else
-                    proc.dMem.write_word( address, proc.R[i] );
-
-                address = address + 4;
-            }
-        }
-
-        if( Bits( registers, 15, 15 ) == 1 ) // Only possible for encoding A1
-            proc.dMem.write_word( address, PCStoreValue( proc ) );
+        // The base register is UNKNOWN when written back and not the
+        // lowest register (only possible for encodings T1 and A1)
+        StoreMultiple( proc, address, registers, wback ? n : 16, 0 );
 
         if( wback )
             proc.R[n] = proc.R[n] + 4 * BitCount( registers );
@@ -6779,34 +6564,22 @@ void arm::STMDA_STMED_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t W             = Bits( instr, 21, 21 );
-        uint32_t n             = Bits( instr, 19, 16 );
-        uint32_t register_list = Bits( instr, 15,  0 );
+        uint32_t W             = Bits< 21, 21 >( instr );
+        uint32_t n             = Bits< 19, 16 >( instr );
+        uint32_t register_list = Bits< 15,  0 >( instr );
 
         uint32_t registers = register_list;
         bool wback = ( W == 1 );
         
-        if( n == 15 || BitCount( registers ) < 1 ) UNPREDICTABLE;
+        if( n == 15 || BitCount( registers ) < 1 )
+            ARMV7_UNPREDICTABLE( STMDA_STMED_A1 );
 
         // Operation
         uint32_t address = proc.R[n] - 4 * BitCount( registers ) + 4;
 
-        for( int i = 0; i <= 14; ++i )
-        {
-            if( Bits( registers, i, i ) == 1 )
-            {
-                if( (uint32_t)i == n && wback && i != LowestSetBit( registers ) )
-                    // Only possible for encodings T1 and A1
-                    proc.dMem.write_word( address, 0x000000000 );// UNKNOWN;
-                else
-                    proc.dMem.write_word( address, proc.R[i] );
-
-                address = address + 4;
-            }
-        }
-
-        if( Bits( registers, 15, 15 ) == 1 ) // Only possible for encoding A1
-            proc.dMem.write_word( address, PCStoreValue( proc ) );
+        // The base register is UNKNOWN when written back and not the
+        // lowest register (only possible for encodings T1 and A1)
+        StoreMultiple( proc, address, registers, wback ? n : 16, 0 );
 
         if( wback )
             proc.R[n] = proc.R[n] - 4 * BitCount( registers );     
@@ -6820,9 +6593,9 @@ void arm::STMDB_STMFD_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t W             = Bits( instr, 21, 21 );
-        uint32_t n             = Bits( instr, 19, 16 );
-        uint32_t register_list = Bits( instr, 15,  0 );
+        uint32_t W             = Bits< 21, 21 >( instr );
+        uint32_t n             = Bits< 19, 16 >( instr );
+        uint32_t register_list = Bits< 15,  0 >( instr );
 
         if( W == 1 && n == 13 && BitCount(register_list) >= 2 )
         {
@@ -6833,28 +6606,16 @@ void arm::STMDB_STMFD_A1( proc_type& proc, uint32_t instr )
         uint32_t registers = register_list;
         bool wback = ( W == 1 );
         
-        if( n == 15 || BitCount( registers ) < 1 ) UNPREDICTABLE;
+        if( n == 15 || BitCount( registers ) < 1 )
+            ARMV7_UNPREDICTABLE( STMDB_STMFD_A1 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
 
         uint32_t address = proc.R[n] - 4 * BitCount( registers );
-        for( int i = 0; i <= 14; ++i )
-        {
-            if( Bits( registers, i, i ) == 1 )
-            {
-                if( (uint32_t)i == n && wback && i != LowestSetBit( registers ) )
-                    // Only possible for encodings T1 and A1
-                    proc.dMem.write_word( address, 0x000000000 );// UNKNOWN;
-                else
-                    proc.dMem.write_word( address, proc.R[i] );
-
-                address = address + 4;
-            }
-        }
-
-        if( Bits( registers, 15, 15 ) == 1 ) // Only possible for encoding A1
-            proc.dMem.write_word( address, PCStoreValue( proc ) );
+        // The base register is UNKNOWN when written back and not the
+        // lowest register (only possible for encodings T1 and A1)
+        StoreMultiple( proc, address, registers, wback ? n : 16, 0 );
 
         if( wback )
             proc.R[n] = proc.R[n] - 4 * BitCount( registers );   
@@ -6868,34 +6629,22 @@ void arm::STMIB_STMFA_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t W             = Bits( instr, 21, 21 );
-        uint32_t n             = Bits( instr, 19, 16 );
-        uint32_t register_list = Bits( instr, 15,  0 );
+        uint32_t W             = Bits< 21, 21 >( instr );
+        uint32_t n             = Bits< 19, 16 >( instr );
+        uint32_t register_list = Bits< 15,  0 >( instr );
 
         uint32_t registers = register_list;
         bool wback = ( W == 1 );
         
-        if( n == 15 || BitCount( registers ) < 1 ) UNPREDICTABLE;
+        if( n == 15 || BitCount( registers ) < 1 )
+            ARMV7_UNPREDICTABLE( STMIB_STMFA_A1 );
 
         // Operation
         uint32_t address = proc.R[n] + 4;
 
-        for( int i = 0; i <= 14; ++i )
-        {
-            if( Bits( registers, i, i ) == 1 )
-            {
-                if( (uint32_t)i == n && wback && i != LowestSetBit( registers ) )
-                    // Only possible for encodings T1 and A1
-                    proc.dMem.write_word( address, 0x000000000 );// UNKNOWN;
-                else
-                    proc.dMem.write_word( address, proc.R[i] );
-
-                address = address + 4;
-            }
-        }
-
-        if( Bits( registers, 15, 15 ) == 1 ) // Only possible for encoding A1
-            proc.dMem.write_word( address, PCStoreValue( proc ) );
+        // The base register is UNKNOWN when written back and not the
+        // lowest register (only possible for encodings T1 and A1)
+        StoreMultiple( proc, address, registers, wback ? n : 16, 0 );
 
         if( wback )
             proc.R[n] = proc.R[n] + 4 * BitCount( registers );   
@@ -6909,12 +6658,12 @@ void arm::STR_imm_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t n     = Bits( instr, 19, 16 );
-        uint32_t t     = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t n     = Bits< 19, 16 >( instr );
+        uint32_t t     = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         uint32_t imm32 = ZeroExtend(imm12); 
         bool     index = (P == 1);
@@ -6933,7 +6682,7 @@ void arm::STR_imm_A1( proc_type& proc, uint32_t instr )
             return;
         }
         
-        if( wback && ( n == 15 || n == t ) ) UNPREDICTABLE;
+        if( wback && ( n == 15 || n == t ) ) ARMV7_UNPREDICTABLE( STR_imm_A1 );
 
         // Operation
         uint32_t offset_addr;
@@ -6956,7 +6705,7 @@ void arm::STR_imm_A1( proc_type& proc, uint32_t instr )
         else
             storeValue = proc.R[t];
 
-        proc.dMem.write_word( address, storeValue );
+        MemWriteWord( proc, address, storeValue );
 
         if( wback )
             proc.R[n] = offset_addr;
@@ -6970,14 +6719,14 @@ void arm::STR_reg_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t P    = Bits( instr, 24, 24 );
-        uint32_t U    = Bits( instr, 23, 23 );
-        uint32_t W    = Bits( instr, 21, 21 );
-        uint32_t n    = Bits( instr, 19, 16 );
-        uint32_t t    = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t m    = Bits( instr,  3,  0 );
+        uint32_t P    = Bits< 24, 24 >( instr );
+        uint32_t U    = Bits< 23, 23 >( instr );
+        uint32_t W    = Bits< 21, 21 >( instr );
+        uint32_t n    = Bits< 19, 16 >( instr );
+        uint32_t t    = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t m    = Bits<  3,  0 >( instr );
 
         bool     index = (P == 1);
         bool     add   = (U == 1);
@@ -6993,9 +6742,10 @@ void arm::STR_reg_A1( proc_type& proc, uint32_t instr )
         SRType      shift_t = shift.shift_t;
         uint32_t    shift_n = shift.shift_n;
 
-        if( m == 15 ) UNPREDICTABLE;
-        if( wback && (n == 15 || n == t) ) UNPREDICTABLE;
-        if( ArchVersion() < 6 && wback && m == n ) UNPREDICTABLE;
+        if( m == 15 ) ARMV7_UNPREDICTABLE( STR_reg_A1 );
+        if( wback && (n == 15 || n == t) ) ARMV7_UNPREDICTABLE( STR_reg_A1 );
+        if( ArchVersion( proc ) < 6 && wback && m == n )
+            ARMV7_UNPREDICTABLE( STR_reg_A1 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7023,11 +6773,11 @@ void arm::STR_reg_A1( proc_type& proc, uint32_t instr )
         else
             data = proc.R[t];
 
-        if( UnalignedSupport() || Bits( address, 1, 0 ) == 0 
+        if( UnalignedSupport( proc ) || Bits< 1, 0 >( address ) == 0 
             || CurrentInstrSet( proc ) == InstrSet_ARM )
-            proc.dMem.write_word( address, data );
+            MemWriteWord( proc, address, data );
         else // Can only occur before ARMv7
-            proc.dMem.write_word( address, 0x0 ); // UNKNOWN;
+            MemWriteWord( proc, address, 0x0 ); // UNKNOWN;
 
         if( wback )
             proc.R[n] = offset_addr;
@@ -7041,12 +6791,12 @@ void arm::STRB_imm_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t n     = Bits( instr, 19, 16 );
-        uint32_t t     = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t n     = Bits< 19, 16 >( instr );
+        uint32_t t     = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         uint32_t imm32 = ZeroExtend(imm12); 
         bool     index = (P == 1);
@@ -7059,8 +6809,8 @@ void arm::STRB_imm_A1( proc_type& proc, uint32_t instr )
             return;
         }
         
-        if( t == 15 ) UNPREDICTABLE;
-        if( wback && ( n == 15 || n == t ) ) UNPREDICTABLE;
+        if( t == 15 ) ARMV7_UNPREDICTABLE( STRB_imm_A1 );
+        if( wback && ( n == 15 || n == t ) ) ARMV7_UNPREDICTABLE( STRB_imm_A1 );
 
         // Operation
         uint32_t offset_addr;
@@ -7076,7 +6826,7 @@ void arm::STRB_imm_A1( proc_type& proc, uint32_t instr )
         else
             address = proc.R[n];
 
-        proc.dMem.write_byte( address, Bits( proc.R[t], 7, 0 ) );
+        proc.dMem.write_byte( address, Bits< 7, 0 >( proc.R[t] ) );
 
         if( wback )
             proc.R[n] = offset_addr;
@@ -7090,14 +6840,14 @@ void arm::STRB_reg_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t P    = Bits( instr, 24, 24 );
-        uint32_t U    = Bits( instr, 23, 23 );
-        uint32_t W    = Bits( instr, 21, 21 );
-        uint32_t n    = Bits( instr, 19, 16 );
-        uint32_t t    = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t m    = Bits( instr,  3,  0 );
+        uint32_t P    = Bits< 24, 24 >( instr );
+        uint32_t U    = Bits< 23, 23 >( instr );
+        uint32_t W    = Bits< 21, 21 >( instr );
+        uint32_t n    = Bits< 19, 16 >( instr );
+        uint32_t t    = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t m    = Bits<  3,  0 >( instr );
 
         bool     index = (P == 1);
         bool     add   = (U == 1);
@@ -7113,9 +6863,10 @@ void arm::STRB_reg_A1( proc_type& proc, uint32_t instr )
         SRType      shift_t = shift.shift_t;
         uint32_t    shift_n = shift.shift_n;
 
-        if( t == 15 || m == 15 ) UNPREDICTABLE;
-        if( wback && (n == 15 || n == t) ) UNPREDICTABLE;
-        if( ArchVersion() < 6 && wback && m == n ) UNPREDICTABLE;
+        if( t == 15 || m == 15 ) ARMV7_UNPREDICTABLE( STRB_reg_A1 );
+        if( wback && (n == 15 || n == t) ) ARMV7_UNPREDICTABLE( STRB_reg_A1 );
+        if( ArchVersion( proc ) < 6 && wback && m == n )
+            ARMV7_UNPREDICTABLE( STRB_reg_A1 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7136,7 +6887,7 @@ void arm::STRB_reg_A1( proc_type& proc, uint32_t instr )
         else
             address = proc.R[n];
 
-        proc.dMem.write_byte( address, Bits( proc.R[t], 7, 0 ) );
+        proc.dMem.write_byte( address, Bits< 7, 0 >( proc.R[t] ) );
 
         if( wback )
             proc.R[n] = offset_addr;
@@ -7150,10 +6901,10 @@ void arm::STRBT_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t n     = Bits( instr, 19, 16 );
-        uint32_t t     = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t n     = Bits< 19, 16 >( instr );
+        uint32_t t     = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         bool postindex     = true;
         bool add           = (U == 1);
@@ -7165,7 +6916,7 @@ void arm::STRBT_A1( proc_type& proc, uint32_t instr )
         uint32_t    shift_n = 0;
         uint32_t    m       = 0;
 
-        if( t == 15 || n == 15 || n == t) UNPREDICTABLE;
+        if( t == 15 || n == 15 || n == t) ARMV7_UNPREDICTABLE( STRBT_A1 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7189,7 +6940,7 @@ void arm::STRBT_A1( proc_type& proc, uint32_t instr )
         else
             address = offset_addr;
 
-        proc.dMem.write_byte( address, Bits( proc.R[t], 7, 0 ) );
+        proc.dMem.write_byte( address, Bits< 7, 0 >( proc.R[t] ) );
 
         if( postindex )
             proc.R[n] = offset_addr;
@@ -7203,12 +6954,12 @@ void arm::STRBT_A2( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t U    = Bits( instr, 23, 23 );
-        uint32_t n    = Bits( instr, 19, 16 );
-        uint32_t t    = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t m    = Bits( instr,  3,  0 );
+        uint32_t U    = Bits< 23, 23 >( instr );
+        uint32_t n    = Bits< 19, 16 >( instr );
+        uint32_t t    = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t m    = Bits<  3,  0 >( instr );
 
         bool postindex     = true;
         bool add           = (U == 1);
@@ -7220,8 +6971,11 @@ void arm::STRBT_A2( proc_type& proc, uint32_t instr )
         SRType      shift_t = shift.shift_t;
         uint32_t    shift_n = shift.shift_n;
 
-        if( t == 15 || n == 15 || n == t || m == 15 ) UNPREDICTABLE;
-        if( ArchVersion() < 6 && m == n ) UNPREDICTABLE;
+        if( t == 15 || n == 15 || n == t || m == 15 )
+        {
+            ARMV7_UNPREDICTABLE( STRBT_A2 );
+        }
+        if( ArchVersion( proc ) < 6 && m == n ) ARMV7_UNPREDICTABLE( STRBT_A2 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7245,7 +6999,7 @@ void arm::STRBT_A2( proc_type& proc, uint32_t instr )
         else
             address = offset_addr;
 
-        proc.dMem.write_byte( address, Bits( proc.R[t], 7, 0 ) );
+        proc.dMem.write_byte( address, Bits< 7, 0 >( proc.R[t] ) );
 
         if( postindex )
             proc.R[n] = offset_addr;
@@ -7259,15 +7013,15 @@ void arm::STRD_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t n     = Bits( instr, 19, 16 );
-        uint32_t t     = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t n     = Bits< 19, 16 >( instr );
+        uint32_t t     = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
 
-        if( Bits( t, 0, 0 ) == 1 ); // UNDEFINED;
+        if( Bits< 0, 0 >( t ) == 1 ); // UNDEFINED;
 
         uint32_t t2    = t + 1;
         uint32_t imm32 = ZeroExtend( imm4H << 4 | imm4L );
@@ -7276,9 +7030,10 @@ void arm::STRD_imm_A1( proc_type& proc, uint32_t instr )
         bool     add   = (U == 1);
         bool     wback = (P == 0) || (W == 1);
 
-        if( P == 0 && W == 1 ) UNPREDICTABLE;
-        if( wback && ( n == 15 || n == t || n == t2 ) ) UNPREDICTABLE;
-        if( t2 == 15 ) UNPREDICTABLE;
+        if( P == 0 && W == 1 ) ARMV7_UNPREDICTABLE( STRD_imm_A1 );
+        if( wback && ( n == 15 || n == t || n == t2 ) )
+            ARMV7_UNPREDICTABLE( STRD_imm_A1 );
+        if( t2 == 15 ) ARMV7_UNPREDICTABLE( STRD_imm_A1 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7296,8 +7051,8 @@ void arm::STRD_imm_A1( proc_type& proc, uint32_t instr )
         else
             address = proc.R[n];
 
-        proc.dMem.write_word( address,     proc.R[t]  );
-        proc.dMem.write_word( address + 4, proc.R[t2] );
+        uint32_t data[2] = { proc.R[t], proc.R[t2] };
+        MemWriteWords( proc, address, data, 2 );
 
         if( wback )
             proc.R[n] = offset_addr;
@@ -7311,14 +7066,14 @@ void arm::STRD_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P  = Bits( instr, 24, 24 );
-        uint32_t U  = Bits( instr, 23, 23 );
-        uint32_t W  = Bits( instr, 21, 21 );
-        uint32_t n  = Bits( instr, 19, 16 );
-        uint32_t t  = Bits( instr, 15, 12 );
-        uint32_t m  = Bits( instr,  3,  0 );
+        uint32_t P  = Bits< 24, 24 >( instr );
+        uint32_t U  = Bits< 23, 23 >( instr );
+        uint32_t W  = Bits< 21, 21 >( instr );
+        uint32_t n  = Bits< 19, 16 >( instr );
+        uint32_t t  = Bits< 15, 12 >( instr );
+        uint32_t m  = Bits<  3,  0 >( instr );
 
-        if( Bits( t, 0, 0 ) == 1 ); // UNDEFINED;
+        if( Bits< 0, 0 >( t ) == 1 ); // UNDEFINED;
 
         uint32_t t2    = t + 1;
 
@@ -7326,10 +7081,12 @@ void arm::STRD_reg_A1( proc_type& proc, uint32_t instr )
         bool     add   = (U == 1);
         bool     wback = (P == 0) || (W == 1);
 
-        if( P == 0 && W == 1 ) UNPREDICTABLE;
-        if( t2 == 15 || m == 15 ) UNPREDICTABLE;
-        if( wback && ( n == 15 || n == t || n == t2 ) ) UNPREDICTABLE;
-        if( ArchVersion() < 6 && wback && m == n ) UNPREDICTABLE;
+        if( P == 0 && W == 1 ) ARMV7_UNPREDICTABLE( STRD_reg_A1 );
+        if( t2 == 15 || m == 15 ) ARMV7_UNPREDICTABLE( STRD_reg_A1 );
+        if( wback && ( n == 15 || n == t || n == t2 ) )
+            ARMV7_UNPREDICTABLE( STRD_reg_A1 );
+        if( ArchVersion( proc ) < 6 && wback && m == n )
+            ARMV7_UNPREDICTABLE( STRD_reg_A1 );
 
         // Operation
         uint32_t offset_addr;
@@ -7345,8 +7102,8 @@ void arm::STRD_reg_A1( proc_type& proc, uint32_t instr )
         else
             address = proc.R[n];
 
-        proc.dMem.write_word( address,     proc.R[t]  );
-        proc.dMem.write_word( address + 4, proc.R[t2] );
+        uint32_t data[2] = { proc.R[t], proc.R[t2] };
+        MemWriteWords( proc, address, data, 2 );
 
         if( wback )
             proc.R[n] = offset_addr;
@@ -7354,19 +7111,138 @@ void arm::STRD_reg_A1( proc_type& proc, uint32_t instr )
 }
 
 
+template< typename proc_type >
+void arm::STREX_A1( proc_type& proc, uint32_t instr )
+{
+    // (A8.6.202, p.712)
+    // Operation
+    if ( ConditionPassed( proc, instr ) )
+    {
+        // Encoding-specific operations
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t t = Bits<  3,  0 >( instr );
+        uint32_t n = Bits< 19, 16 >( instr );
+
+        if( d == 15 || t == 15 || n == 15 ) ARMV7_UNPREDICTABLE( STREX_A1 );
+        if( d == n || d == t ) ARMV7_UNPREDICTABLE( STREX_A1 );
+
+        // Before the granule is claimed
+        uint32_t address = MemAAlignedAddress( proc, proc.R[n], 4 );
+        bool     passed  = ExclusiveMonitorsPass( proc, address, 4 );
+        if( passed )
+        {
+            // MemA
+            MemAWriteWord( proc, address, proc.R[t] );
+        }
+        ClearExclusiveLocal( proc );
+        proc.R[d] = passed ? 0 : 1;
+    }
+}
+
+
+template< typename proc_type >
+void arm::STREXB_A1( proc_type& proc, uint32_t instr )
+{
+    // (A8.6.203, p.714)
+    // Operation
+    if ( ConditionPassed( proc, instr ) )
+    {
+        // Encoding-specific operations
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t t = Bits<  3,  0 >( instr );
+        uint32_t n = Bits< 19, 16 >( instr );
+
+        if( d == 15 || t == 15 || n == 15 ) ARMV7_UNPREDICTABLE( STREXB_A1 );
+        if( d == n || d == t ) ARMV7_UNPREDICTABLE( STREXB_A1 );
+
+        uint32_t address = proc.R[n];
+        bool     passed  = ExclusiveMonitorsPass( proc, address, 1 );
+        if( passed )
+        {
+            // MemA
+            proc.dMem.write_byte( address, Bits< 7, 0 >( proc.R[t] ) );
+        }
+        ClearExclusiveLocal( proc );
+        proc.R[d] = passed ? 0 : 1;
+    }
+}
+
+
+template< typename proc_type >
+void arm::STREXD_A1( proc_type& proc, uint32_t instr )
+{
+    // (A8.6.204, p.716)
+    // Operation
+    if ( ConditionPassed( proc, instr ) )
+    {
+        // Encoding-specific operations
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t t = Bits<  3,  0 >( instr );
+        uint32_t n = Bits< 19, 16 >( instr );
+
+        uint32_t t2 = t + 1;
+
+        if( d == 15 || Bits< 0, 0 >( t ) == 1 || t == 14 || n == 15 )
+            ARMV7_UNPREDICTABLE( STREXD_A1 );
+        if( d == n || d == t || d == t2 ) ARMV7_UNPREDICTABLE( STREXD_A1 );
+
+        // Before the granule is claimed
+        uint32_t address = MemAAlignedAddress( proc, proc.R[n], 8 );
+        bool     passed  = ExclusiveMonitorsPass( proc, address, 8 );
+        if( passed )
+        {
+            // MemA[address,8]
+            uint32_t data[2] = { proc.R[t], proc.R[t2] };
+            MemWriteWords( proc, address, data, 2, 8 );
+        }
+        ClearExclusiveLocal( proc );
+        proc.R[d] = passed ? 0 : 1;
+    }
+}
+
+
+template< typename proc_type >
+void arm::STREXH_A1( proc_type& proc, uint32_t instr )
+{
+    // (A8.6.205, p.718)
+    // Operation
+    if ( ConditionPassed( proc, instr ) )
+    {
+        // Encoding-specific operations
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t t = Bits<  3,  0 >( instr );
+        uint32_t n = Bits< 19, 16 >( instr );
+
+        if( d == 15 || t == 15 || n == 15 ) ARMV7_UNPREDICTABLE( STREXH_A1 );
+        if( d == n || d == t ) ARMV7_UNPREDICTABLE( STREXH_A1 );
+
+        // Before the granule is claimed
+        uint32_t address = MemAAlignedAddress( proc, proc.R[n], 2 );
+        bool     passed  = ExclusiveMonitorsPass( proc, address, 2 );
+        if( passed )
+        {
+            // MemA
+            MemAWriteHalf( proc, address, Bits< 15, 0 >( proc.R[t] ) );
+        }
+        ClearExclusiveLocal( proc );
+        proc.R[d] = passed ? 0 : 1;
+    }
+}
+
+
 template< typename proc_type >
 void arm::STRH_imm_A1( proc_type& proc, uint32_t instr )
 {
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P     = Bits( instr, 24, 24 );
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t W     = Bits( instr, 21, 21 );
-        uint32_t n     = Bits( instr, 19, 16 );
-        uint32_t t     = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t P     = Bits< 24, 24 >( instr );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t W     = Bits< 21, 21 >( instr );
+        uint32_t n     = Bits< 19, 16 >( instr );
+        uint32_t t     = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
 
         if( P == 0 && W == 1 )
         {
@@ -7380,8 +7256,8 @@ void arm::STRH_imm_A1( proc_type& proc, uint32_t instr )
         bool     add   = (U == 1);
         bool     wback = (P == 0) || (W == 1);
 
-        if( t == 15 ) UNPREDICTABLE;
-        if( wback && ( n == 15 || n == t ) ) UNPREDICTABLE;
+        if( t == 15 ) ARMV7_UNPREDICTABLE( STRH_imm_A1 );
+        if( wback && ( n == 15 || n == t ) ) ARMV7_UNPREDICTABLE( STRH_imm_A1 );
 
         // Operation
         uint32_t offset_addr;
@@ -7397,10 +7273,10 @@ void arm::STRH_imm_A1( proc_type& proc, uint32_t instr )
         else
             address = proc.R[n];
 
-        if( UnalignedSupport() || Bits( address, 0, 0 ) == 0 )
-            proc.dMem.write_half( address, Bits( proc.R[t], 15, 0 ) );
+        if( UnalignedSupport( proc ) || Bits< 0, 0 >( address ) == 0 )
+            MemWriteHalf( proc, address, Bits< 15, 0 >( proc.R[t] ) );
         else // Can only occur before ARMv7
-            proc.dMem.write_half( address, 0x0000 ); //UNKNOWN;
+            MemWriteHalf( proc, address, 0x0000 ); //UNKNOWN;
 
         if( wback )
             proc.R[n] = offset_addr;
@@ -7414,12 +7290,12 @@ void arm::STRH_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t P  = Bits( instr, 24, 24 );
-        uint32_t U  = Bits( instr, 23, 23 );
-        uint32_t W  = Bits( instr, 21, 21 );
-        uint32_t n  = Bits( instr, 19, 16 );
-        uint32_t t  = Bits( instr, 15, 12 );
-        uint32_t m  = Bits( instr,  3,  0 );
+        uint32_t P  = Bits< 24, 24 >( instr );
+        uint32_t U  = Bits< 23, 23 >( instr );
+        uint32_t W  = Bits< 21, 21 >( instr );
+        uint32_t n  = Bits< 19, 16 >( instr );
+        uint32_t t  = Bits< 15, 12 >( instr );
+        uint32_t m  = Bits<  3,  0 >( instr );
 
         if( P == 0 && W == 1 )
         {
@@ -7434,9 +7310,10 @@ void arm::STRH_reg_A1( proc_type& proc, uint32_t instr )
         SRType      shift_t = SRType_LSL;
         uint32_t    shift_n = 0;
 
-        if( t == 15 || m == 15 ) UNPREDICTABLE;
-        if( wback && ( n == 15 || n == t ) ) UNPREDICTABLE;
-        if( ArchVersion() < 6 && wback && m == n ) UNPREDICTABLE;
+        if( t == 15 || m == 15 ) ARMV7_UNPREDICTABLE( STRH_reg_A1 );
+        if( wback && ( n == 15 || n == t ) ) ARMV7_UNPREDICTABLE( STRH_reg_A1 );
+        if( ArchVersion( proc ) < 6 && wback && m == n )
+            ARMV7_UNPREDICTABLE( STRH_reg_A1 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7457,10 +7334,10 @@ void arm::STRH_reg_A1( proc_type& proc, uint32_t instr )
         else
             address = proc.R[n];
 
-        if( UnalignedSupport() || Bits( address, 0, 0 ) == 0 )
-            proc.dMem.write_half( address, Bits( proc.R[t], 15, 0 ) );
+        if( UnalignedSupport( proc ) || Bits< 0, 0 >( address ) == 0 )
+            MemWriteHalf( proc, address, Bits< 15, 0 >( proc.R[t] ) );
         else // Can only occur before ARMv7
-            proc.dMem.write_half( address, 0x0000 ); //UNKNOWN;
+            MemWriteHalf( proc, address, 0x0000 ); //UNKNOWN;
 
         if( wback )
             proc.R[n] = offset_addr;
@@ -7474,11 +7351,11 @@ void arm::STRHT_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t n     = Bits( instr, 19, 16 );
-        uint32_t t     = Bits( instr, 15, 12 );
-        uint32_t imm4H = Bits( instr, 11,  8 );
-        uint32_t imm4L = Bits( instr,  3,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t n     = Bits< 19, 16 >( instr );
+        uint32_t t     = Bits< 15, 12 >( instr );
+        uint32_t imm4H = Bits< 11,  8 >( instr );
+        uint32_t imm4L = Bits<  3,  0 >( instr );
 
         bool postindex     = true;
         bool add           = (U == 1);
@@ -7487,7 +7364,7 @@ void arm::STRHT_A1( proc_type& proc, uint32_t instr )
         uint32_t imm32 = ZeroExtend( imm4H << 4 | imm4L );
         uint32_t m     = 0;
 
-        if( t == 15 || n == 15 || n == t) UNPREDICTABLE;
+        if( t == 15 || n == 15 || n == t) ARMV7_UNPREDICTABLE( STRHT_A1 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7511,10 +7388,10 @@ void arm::STRHT_A1( proc_type& proc, uint32_t instr )
         else
             address = offset_addr;
 
-        if( UnalignedSupport() || Bits( address, 0, 0 ) == 0 )
-            proc.dMem.write_half( address, Bits( proc.R[t], 15, 0 ) );
+        if( UnalignedSupport( proc ) || Bits< 0, 0 >( address ) == 0 )
+            MemWriteHalf( proc, address, Bits< 15, 0 >( proc.R[t] ) );
         else // Can only occur before ARMv7
-            proc.dMem.write_half( address, 0x0000 ); //UNKNOWN;
+            MemWriteHalf( proc, address, 0x0000 ); //UNKNOWN;
 
         if( postindex )
             proc.R[n] = offset_addr;
@@ -7528,10 +7405,10 @@ void arm::STRHT_A2( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t U    = Bits( instr, 23, 23 );
-        uint32_t n    = Bits( instr, 19, 16 );
-        uint32_t t    = Bits( instr, 15, 12 );
-        uint32_t m    = Bits( instr,  3,  0 );
+        uint32_t U    = Bits< 23, 23 >( instr );
+        uint32_t n    = Bits< 19, 16 >( instr );
+        uint32_t t    = Bits< 15, 12 >( instr );
+        uint32_t m    = Bits<  3,  0 >( instr );
 
         bool postindex     = true;
         bool add           = (U == 1);
@@ -7539,7 +7416,10 @@ void arm::STRHT_A2( proc_type& proc, uint32_t instr )
 
         uint32_t imm32 = 0;
 
-        if( t == 15 || n == 15 || n == t || m == 15 ) UNPREDICTABLE;
+        if( t == 15 || n == 15 || n == t || m == 15 )
+        {
+            ARMV7_UNPREDICTABLE( STRHT_A2 );
+        }
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7563,10 +7443,10 @@ void arm::STRHT_A2( proc_type& proc, uint32_t instr )
         else
             address = offset_addr;
 
-        if( UnalignedSupport() || Bits( address, 0, 0 ) == 0 )
-            proc.dMem.write_half( address, Bits( proc.R[t], 15, 0 ) );
+        if( UnalignedSupport( proc ) || Bits< 0, 0 >( address ) == 0 )
+            MemWriteHalf( proc, address, Bits< 15, 0 >( proc.R[t] ) );
         else // Can only occur before ARMv7
-            proc.dMem.write_half( address, 0x0000 ); //UNKNOWN;
+            MemWriteHalf( proc, address, 0x0000 ); //UNKNOWN;
 
         if( postindex )
             proc.R[n] = offset_addr;
@@ -7580,10 +7460,10 @@ void arm::STRT_A1( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t U     = Bits( instr, 23, 23 );
-        uint32_t n     = Bits( instr, 19, 16 );
-        uint32_t t     = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11,  0 );
+        uint32_t U     = Bits< 23, 23 >( instr );
+        uint32_t n     = Bits< 19, 16 >( instr );
+        uint32_t t     = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11,  0 >( instr );
 
         bool postindex     = true;
         bool add           = (U == 1);
@@ -7595,7 +7475,7 @@ void arm::STRT_A1( proc_type& proc, uint32_t instr )
         uint32_t    shift_n = 0;
         uint32_t    m       = 0;
 
-        if( n == 15 || n == t) UNPREDICTABLE;
+        if( n == 15 || n == t) ARMV7_UNPREDICTABLE( STRT_A1 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7625,11 +7505,11 @@ void arm::STRT_A1( proc_type& proc, uint32_t instr )
         else
             data = proc.R[t];
 
-        if( UnalignedSupport() || Bits( address, 0, 0 ) == 0 
+        if( UnalignedSupport( proc ) || Bits< 0, 0 >( address ) == 0 
             || CurrentInstrSet( proc ) == InstrSet_ARM )
-            proc.dMem.write_word( address, data );
+            MemWriteWord( proc, address, data );
         else // Can only occur before ARMv7
-            proc.dMem.write_word( address, 0x00000000 ); //UNKNOWN;
+            MemWriteWord( proc, address, 0x00000000 ); //UNKNOWN;
 
         if( postindex )
             proc.R[n] = offset_addr;
@@ -7643,12 +7523,12 @@ void arm::STRT_A2( proc_type& proc, uint32_t instr )
     if( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operation
-        uint32_t U    = Bits( instr, 23, 23 );
-        uint32_t n    = Bits( instr, 19, 16 );
-        uint32_t t    = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t m    = Bits( instr,  3,  0 );
+        uint32_t U    = Bits< 23, 23 >( instr );
+        uint32_t n    = Bits< 19, 16 >( instr );
+        uint32_t t    = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t m    = Bits<  3,  0 >( instr );
 
         bool postindex     = true;
         bool add           = (U == 1);
@@ -7660,8 +7540,8 @@ void arm::STRT_A2( proc_type& proc, uint32_t instr )
         SRType      shift_t = shift.shift_t;
         uint32_t    shift_n = shift.shift_n;
 
-        if( n == 15 || n == t || m == 15 ) UNPREDICTABLE;
-        if( ArchVersion() < 6 && m == n ) UNPREDICTABLE;
+        if( n == 15 || n == t || m == 15 ) ARMV7_UNPREDICTABLE( STRT_A2 );
+        if( ArchVersion( proc ) < 6 && m == n ) ARMV7_UNPREDICTABLE( STRT_A2 );
 
         // Operation
         if( !NullCheckIfThumbEE( proc, n ) ) return;
@@ -7691,11 +7571,11 @@ void arm::STRT_A2( proc_type& proc, uint32_t instr )
         else
             data = proc.R[t];
 
-        if( UnalignedSupport() || Bits( address, 0, 0 ) == 0 
+        if( UnalignedSupport( proc ) || Bits< 0, 0 >( address ) == 0 
             || CurrentInstrSet( proc ) == InstrSet_ARM )
-            proc.dMem.write_word( address, data );
+            MemWriteWord( proc, address, data );
         else // Can only occur before ARMv7
-            proc.dMem.write_word( address, 0x00000000 ); //UNKNOWN;
+            MemWriteWord( proc, address, 0x00000000 ); //UNKNOWN;
 
         if( postindex )
             proc.R[n] = offset_addr;
@@ -7709,10 +7589,10 @@ void arm::SUB_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S     = Bits( instr, 20, 20 );
-        uint32_t n     = Bits( instr, 19, 16 );
-        uint32_t d     = Bits( instr, 15, 12 );
-        uint32_t imm12 = Bits( instr, 11, 0 );
+        uint32_t S     = Bits< 20, 20 >( instr );
+        uint32_t n     = Bits< 19, 16 >( instr );
+        uint32_t d     = Bits< 15, 12 >( instr );
+        uint32_t imm12 = Bits< 11, 0 >( instr );
         
         if ( n == 0xF && S == 0x0 ) ; // SEE ADR
         if ( n == 0xD ) ;             // SEE SUB (SP minus immediate)
@@ -7724,8 +7604,10 @@ void arm::SUB_imm_A1( proc_type& proc, uint32_t instr )
 
         // Operation
         uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)( proc.R[n] ), ~imm32, (uint32_t)1,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)( proc.R[n] );
+        const uint32_t y        = ~imm32;
+        const uint32_t carry_in = 1;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
         if ( d == 15 )
         {
             ALUWritePC( proc, result ); // setflags is always FALSE here
@@ -7735,10 +7617,7 @@ void arm::SUB_imm_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if ( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                proc.CPSR.V = overflow;
+                SetAddFlags( proc.CPSR, x, y, carry_in );
             }
         }
     }
@@ -7751,12 +7630,12 @@ void arm::SUB_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) ) // FIXME
     {
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t n    = Bits( instr, 19, 16 );
-        uint32_t d    = Bits( instr, 15, 12 );
-        uint32_t imm5 = Bits( instr, 11,  7 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t m    = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t n    = Bits< 19, 16 >( instr );
+        uint32_t d    = Bits< 15, 12 >( instr );
+        uint32_t imm5 = Bits< 11,  7 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t m    = Bits<  3,  0 >( instr );
 
         bool        setflags = ( S == 1 );
         ShiftUValue shift    = DecodeImmShift( type, imm5 );
@@ -7768,8 +7647,10 @@ void arm::SUB_reg_A1( proc_type& proc, uint32_t instr )
         shifted = Shift( proc.R[m], shift_t, shift_n, proc.CPSR.C );
 
         uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], ~shifted, (uint32_t)1,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = ~shifted;
+        const uint32_t carry_in = 1;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
         if ( d == 15 )
         {
             ALUWritePC( proc, result ); // setflags is always FALSE here
@@ -7779,10 +7660,7 @@ void arm::SUB_reg_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = result;
             if ( setflags )
             {
-                proc.CPSR.N = Bits( result, 31, 31 );
-                proc.CPSR.Z = IsZeroBit( result );
-                proc.CPSR.C = carry;
-                proc.CPSR.V = overflow;
+                SetAddFlags( proc.CPSR, x, y, carry_in );
             }
         }
     }
@@ -7795,33 +7673,33 @@ void arm::SUB_sh_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S    = Bits( instr, 20, 20 );
-        uint32_t n    = Bits( instr, 19, 16 );
-        uint32_t d    = Bits( instr, 15, 12 );
-        uint32_t s    = Bits( instr, 11,  8 );
-        uint32_t type = Bits( instr,  6,  5 );
-        uint32_t m    = Bits( instr,  3,  0 );
+        uint32_t S    = Bits< 20, 20 >( instr );
+        uint32_t n    = Bits< 19, 16 >( instr );
+        uint32_t d    = Bits< 15, 12 >( instr );
+        uint32_t s    = Bits< 11,  8 >( instr );
+        uint32_t type = Bits<  6,  5 >( instr );
+        uint32_t m    = Bits<  3,  0 >( instr );
 
         bool   setflags = ( S == 1 );
         SRType shift_t  = DecodeRegShift( type );
 
-        if ( d == 15 || n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 || s == 15 )
+            ARMV7_UNPREDICTABLE( SUB_sh_reg_A1 );
 
         // Operation
-        uint32_t shift_n = UInt( Bits( proc.R[s], 7, 0 ) );
+        uint32_t shift_n = UInt( Bits< 7, 0 >( proc.R[s] ) );
         uint32_t shifted = Shift( proc.R[m], shift_t, shift_n, proc.CPSR.C );
 
         uint32_t result, carry, overflow;
-        result = AddWithCarry( (uint32_t)proc.R[n], ~shifted, (uint32_t)1,
-                               carry, overflow );
+        const uint32_t x        = (uint32_t)proc.R[n];
+        const uint32_t y        = ~shifted;
+        const uint32_t carry_in = 1;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
         
         proc.R[d] = result;
         if ( setflags )
         {
-            proc.CPSR.N = Bits( result, 31, 31 );
-            proc.CPSR.Z = IsZeroBit( result );
-            proc.CPSR.C = carry;
-            proc.CPSR.V = overflow;
+            SetAddFlags( proc.CPSR, x, y, carry_in );
         }
 
     }
@@ -7834,17 +7712,17 @@ void arm::SXTAB_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n        = Bits( instr, 19, 16 );
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t n        = Bits< 19, 16 >( instr );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
         if ( n == 0xF ) ;           // SEE SXTB
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SXTAB_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        proc.R[d] = proc.R[n] + SignExtend( Bits( rotated, 7, 0 ), 32, 8 );
+        proc.R[d] = proc.R[n] + SignExtend( Bits< 7, 0 >( rotated ), 32, 8 );
     }
 }
 
@@ -7855,21 +7733,21 @@ void arm::SXTAB16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t n        = Bits( instr, 19, 16 );
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t n        = Bits< 19, 16 >( instr );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
         if ( n == 0xF ) ;           // SEE SXTB16
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SXTAB16_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        uint32_t rn_h    = Bits( proc.R[n], 31, 16 );
-        uint32_t rn_l    = Bits( proc.R[n], 15,  0 );
+        uint32_t rn_h    = Bits< 31, 16 >( proc.R[n] );
+        uint32_t rn_l    = Bits< 15,  0 >( proc.R[n] );
 
-        uint32_t rd_l = rn_l + SignExtend( Bits( rotated,  7,  0 ), 16, 8 );
-        uint32_t rd_h = rn_h + SignExtend( Bits( rotated, 23, 16 ), 16, 8 );
+        uint32_t rd_l = rn_l + SignExtend( Bits<  7,  0 >( rotated ), 16, 8 );
+        uint32_t rd_h = rn_h + SignExtend( Bits< 23, 16 >( rotated ), 16, 8 );
         proc.R[d] = ( rd_h << 16 ) + rd_l;
     }    
 }
@@ -7881,18 +7759,18 @@ void arm::SXTAH_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t n        = Bits( instr, 19, 16 );
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t n        = Bits< 19, 16 >( instr );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
 
         if ( n == 0xF ) ;           // SEE SXTH
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SXTAH_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        proc.R[d] = proc.R[n] + SignExtend( Bits( rotated, 15, 0 ), 32, 16 );
+        proc.R[d] = proc.R[n] + SignExtend( Bits< 15, 0 >( rotated ), 32, 16 );
     }    
 }
 
@@ -7903,16 +7781,16 @@ void arm::SXTB_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
 
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SXTB_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        proc.R[d] = SignExtend( Bits( rotated, 7, 0 ), 32, 8 );
+        proc.R[d] = SignExtend( Bits< 7, 0 >( rotated ), 32, 8 );
     }    
 }
 
@@ -7923,17 +7801,17 @@ void arm::SXTB16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
 
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SXTB16_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        uint32_t rd_l = SignExtend( Bits( rotated,  7,  0 ), 16, 8 );
-        uint32_t rd_h = SignExtend( Bits( rotated, 23, 16 ), 16, 8 );
+        uint32_t rd_l = SignExtend( Bits<  7,  0 >( rotated ), 16, 8 );
+        uint32_t rd_h = SignExtend( Bits< 23, 16 >( rotated ), 16, 8 );
         proc.R[d] = ( rd_h << 16 ) + rd_l;
     }    
 }
@@ -7945,16 +7823,16 @@ void arm::SXTH_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
 
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( SXTH_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        proc.R[d] = SignExtend( Bits( rotated, 15, 0 ), 32, 16 );
+        proc.R[d] = SignExtend( Bits< 15, 0 >( rotated ), 32, 16 );
     }
 }
 
@@ -7965,18 +7843,15 @@ void arm::TEQ_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t    n     = Bits( instr, 19, 16 );
-        uint32_t    imm12 = Bits( instr, 11,  0 );
+        uint32_t    n     = Bits< 19, 16 >( instr );
+        uint32_t    imm12 = Bits< 11,  0 >( instr );
         UValueCarry value = ARMExpandImm_C( imm12, proc.CPSR.C );
         uint32_t    imm32 = value.value;
         uint32_t    carry = value.carry ? 1 : 0;
 
         // Operation
         uint32_t result = proc.R[n] ^ imm32;
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        // CPSR.V unchanged
+        SetLogicalFlags( proc.CPSR, result, carry );
     }
 }
 
@@ -7987,10 +7862,10 @@ void arm::TEQ_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t    n       = Bits( instr, 19, 16 );
-        uint32_t    imm5    = Bits( instr, 11,  7 );
-        uint32_t    type    = Bits( instr,  6,  5 );
-        uint32_t    m       = Bits( instr,  3,  0 );
+        uint32_t    n       = Bits< 19, 16 >( instr );
+        uint32_t    imm5    = Bits< 11,  7 >( instr );
+        uint32_t    type    = Bits<  6,  5 >( instr );
+        uint32_t    m       = Bits<  3,  0 >( instr );
         ShiftUValue shift   = DecodeImmShift( type, imm5 );
         SRType      shift_t = shift.shift_t;
         uint32_t    shift_n = shift.shift_n;
@@ -8002,10 +7877,7 @@ void arm::TEQ_reg_A1( proc_type& proc, uint32_t instr )
         uint32_t    carry   = value.carry ? 1 : 0;
 
         uint32_t result = proc.R[n] ^ shifted;
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        // CPSR.V unchanged
+        SetLogicalFlags( proc.CPSR, result, carry );
     }
 }
 
@@ -8016,26 +7888,29 @@ void arm::TEQ_sh_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t    n       = Bits( instr, 19, 16 );
-        uint32_t    s       = Bits( instr, 11,  8 );
-        uint32_t    type    = Bits( instr,  6,  5 );
-        uint32_t    m       = Bits( instr,  3,  0 );
+        uint32_t    n       = Bits< 19, 16 >( instr );
+        uint32_t    s       = Bits< 11,  8 >( instr );
+        uint32_t    type    = Bits<  6,  5 >( instr );
+        uint32_t    m       = Bits<  3,  0 >( instr );
         SRType      shift_t = DecodeRegShift( type );
 
-        if ( n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
+        if ( n == 15 || m == 15 || s == 15 )
+
+        {
+
+            ARMV7_UNPREDICTABLE( TEQ_sh_reg_A1 );
+
+        }
 
         // Operation
-        uint32_t    shift_n = Bits( proc.R[s], 7, 0 );
+        uint32_t    shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry value   = Shift_C( proc.R[m], shift_t, shift_n,
                                        proc.CPSR.C );
         uint32_t    shifted = value.value;
         uint32_t    carry   = value.carry ? 1 : 0;
 
         uint32_t result = proc.R[n] ^ shifted;
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        // CPSR.V unchanged        
+        SetLogicalFlags( proc.CPSR, result, carry );
     }    
 }
 
@@ -8046,18 +7921,15 @@ void arm::TST_imm_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t    n     = Bits( instr, 19, 16 );
-        uint32_t    imm12 = Bits( instr, 11,  0 );
+        uint32_t    n     = Bits< 19, 16 >( instr );
+        uint32_t    imm12 = Bits< 11,  0 >( instr );
         UValueCarry value = ARMExpandImm_C( imm12, proc.CPSR.C );
         uint32_t    imm32 = value.value;
         uint32_t    carry = value.carry ? 1 : 0;
 
         // Operation
         uint32_t result = proc.R[n] & imm32;
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        // CPSR.V unchanged        
+        SetLogicalFlags( proc.CPSR, result, carry );
     }    
 }
 
@@ -8068,10 +7940,10 @@ void arm::TST_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t    n       = Bits( instr, 19, 16 );
-        uint32_t    imm5    = Bits( instr, 11,  7 );
-        uint32_t    type    = Bits( instr,  6,  5 );
-        uint32_t    m       = Bits( instr,  3,  0 );
+        uint32_t    n       = Bits< 19, 16 >( instr );
+        uint32_t    imm5    = Bits< 11,  7 >( instr );
+        uint32_t    type    = Bits<  6,  5 >( instr );
+        uint32_t    m       = Bits<  3,  0 >( instr );
         ShiftUValue shift   = DecodeImmShift( type, imm5 );
         SRType      shift_t = shift.shift_t;
         uint32_t    shift_n = shift.shift_n;
@@ -8082,10 +7954,7 @@ void arm::TST_reg_A1( proc_type& proc, uint32_t instr )
         uint32_t    shifted = value.value;
         uint32_t    carry   = value.carry ? 1 : 0;
         uint32_t    result  = proc.R[n] & shifted;
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        // CPSR.V unchanged
+        SetLogicalFlags( proc.CPSR, result, carry );
     }    
 }
 
@@ -8096,25 +7965,28 @@ void arm::TST_sh_reg_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t    n       = Bits( instr, 19, 16 );
-        uint32_t    s       = Bits( instr, 11,  8 );
-        uint32_t    type    = Bits( instr,  6,  5 );
-        uint32_t    m       = Bits( instr,  3,  0 );
+        uint32_t    n       = Bits< 19, 16 >( instr );
+        uint32_t    s       = Bits< 11,  8 >( instr );
+        uint32_t    type    = Bits<  6,  5 >( instr );
+        uint32_t    m       = Bits<  3,  0 >( instr );
         SRType      shift_t = DecodeRegShift( type );
 
-        if ( n == 15 || m == 15 || s == 15 ) UNPREDICTABLE;
+        if ( n == 15 || m == 15 || s == 15 )
+
+        {
+
+            ARMV7_UNPREDICTABLE( TST_sh_reg_A1 );
+
+        }
 
         // Operation
-        uint32_t    shift_n = Bits( proc.R[s], 7, 0 );
+        uint32_t    shift_n = Bits< 7, 0 >( proc.R[s] );
         UValueCarry value   = Shift_C( proc.R[m], shift_t, shift_n,
                                        proc.CPSR.C );
         uint32_t    shifted = value.value;
         uint32_t    carry   = value.carry ? 1 : 0;
         uint32_t    result  = proc.R[n] & shifted;
-        proc.CPSR.N = Bits( result, 31, 31 );
-        proc.CPSR.Z = IsZeroBit( result );
-        proc.CPSR.C = carry;
-        // CPSR.V unchanged
+        SetLogicalFlags( proc.CPSR, result, carry );
     }    
 }
 
@@ -8125,19 +7997,16 @@ void arm::UADD16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UADD16_A1 );
 
         // Operation
-        uint32_t sum1 = Bits( proc.R[n], 15,  0 ) + Bits( proc.R[m], 15,  0 );
-        uint32_t sum2 = Bits( proc.R[n], 31, 16 ) + Bits( proc.R[m], 31, 16 );
-        proc.R[d] = Bits( sum1, 15, 0 ) + ( Bits( sum2, 15, 0 ) << 16 );
-        
-        proc.CPSR.GE = (sum1 >= 0x10000 ? 0x3 : 0x0) 
-                     | (sum2 >= 0x10000 ? 0xC : 0x0);
+        proc.CPSR.GE = GEFromSigns< 16 >(
+            ParallelHalvingAdd< 16 >( proc.R[n], proc.R[m] ) );
+        proc.R[d]    = ParallelAdd< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8148,28 +8017,16 @@ void arm::UADD8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UADD8_A1 );
 
         // Operation
-        uint32_t sum1 = Bits( proc.R[n],  7,  0  ) + Bits( proc.R[m],  7,  0  );
-        uint32_t sum2 = Bits( proc.R[n], 15,  8  ) + Bits( proc.R[m], 15,  8  );
-        uint32_t sum3 = Bits( proc.R[n], 23,  16 ) + Bits( proc.R[m], 23,  16 );
-        uint32_t sum4 = Bits( proc.R[n], 31,  24 ) + Bits( proc.R[m], 31,  24 );
-
-        proc.R[d]  = 0x00000000;
-        proc.R[d] += Bits( sum1, 7, 0 );
-        proc.R[d] += ( Bits( sum2, 7, 0 ) << 8 );
-        proc.R[d] += ( Bits( sum3, 7, 0 ) << 16 );
-        proc.R[d] += ( Bits( sum4, 7, 0 ) << 24 );
-
-        proc.CPSR.GE = (sum1 >= 0x100 ? 0x1 : 0x0)
-                     | (sum2 >= 0x100 ? 0x2 : 0x0)
-                     | (sum3 >= 0x100 ? 0x4 : 0x0)
-                     | (sum4 >= 0x100 ? 0x8 : 0x0);
+        proc.CPSR.GE = GEFromSigns< 8 >(
+            ParallelHalvingAdd< 8 >( proc.R[n], proc.R[m] ) );
+        proc.R[d]    = ParallelAdd< 8 >( proc.R[n], proc.R[m] );
     }    
 }
 
@@ -8180,19 +8037,19 @@ void arm::UASX_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UASX_A1 );
 
         // Operation
-        uint32_t diff = Bits( proc.R[n], 15,  0 ) - Bits( proc.R[m], 31, 16 );
-        uint32_t sum  = Bits( proc.R[n], 31, 16 ) + Bits( proc.R[m], 15,  0 );
-        proc.R[d] = Bits( diff, 15, 0 ) + ( Bits( sum, 15, 0 ) << 16 );
-        
-        proc.CPSR.GE = (SInt( (uint16_t)diff ) >= 0x0 ? 0x3 : 0x0)
-                     | (sum  >= 0x10000 ? 0xC : 0x0);
+        const uint32_t x = ROR( proc.R[m], 16 );
+        proc.CPSR.GE = GEFromSigns< 16 >(
+            MergeHalfwords( ~ParallelHalvingSub< 16 >( proc.R[n], x ),
+                            ParallelHalvingAdd< 16 >( proc.R[n], x ) ) );
+        proc.R[d]    = MergeHalfwords( ParallelSub< 16 >( proc.R[n], x ),
+                                       ParallelAdd< 16 >( proc.R[n], x ) );
     }
 }
 
@@ -8203,12 +8060,12 @@ void arm::UBFX_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t widthminus1 = Bits( instr, 20, 16 );
-        uint32_t d           = Bits( instr, 15, 12 );
-        uint32_t lsbit       = Bits( instr, 11,  7 );
-        uint32_t n           = Bits( instr,  3,  0 );
+        uint32_t widthminus1 = Bits< 20, 16 >( instr );
+        uint32_t d           = Bits< 15, 12 >( instr );
+        uint32_t lsbit       = Bits< 11,  7 >( instr );
+        uint32_t n           = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 ) ARMV7_UNPREDICTABLE( UBFX_A1 );
 
         // Operation
         uint32_t msbit = lsbit + widthminus1;
@@ -8217,7 +8074,7 @@ void arm::UBFX_A1( proc_type& proc, uint32_t instr )
             proc.R[d] = ZeroExtend( Bits( proc.R[n], msbit, lsbit ) );
         }
         else
-             UNPREDICTABLE;
+             ARMV7_UNPREDICTABLE( UBFX_A1 );
     }
 }
 
@@ -8228,20 +8085,14 @@ void arm::UHADD16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UHADD16_A1 );
 
         // Operation
-        uint32_t sum1 = Bits( proc.R[n], 15,  0 ) + Bits( proc.R[m], 15,  0 );
-        uint32_t sum2 = Bits( proc.R[n], 31, 16 ) + Bits( proc.R[m], 31, 16 );
-
-        sum1 = Bits( sum1, 16, 1 );
-        sum2 = Bits( sum2, 16, 1 );
-
-        proc.R[d] = sum1 + ( sum2 << 16 );
+        proc.R[d] = ParallelHalvingAdd< 16 >( proc.R[n], proc.R[m] );
     }    
 }
 
@@ -8253,24 +8104,14 @@ void arm::UHADD8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UHADD8_A1 );
 
         // Operation
-        uint32_t sum1 = Bits( proc.R[n],  7,  0 ) + Bits( proc.R[m],  7,  0 );
-        uint32_t sum2 = Bits( proc.R[n], 15,  8 ) + Bits( proc.R[m], 15,  8 );
-        uint32_t sum3 = Bits( proc.R[n], 23, 16 ) + Bits( proc.R[m], 23, 16 );
-        uint32_t sum4 = Bits( proc.R[n], 31, 24 ) + Bits( proc.R[m], 31, 24 );
-        
-        sum1 = Bits( sum1, 8, 1 );
-        sum2 = Bits( sum2, 8, 1 );
-        sum3 = Bits( sum3, 8, 1 );
-        sum4 = Bits( sum4, 8, 1 );
-
-        proc.R[d] = sum1 + ( sum2 << 8 ) + ( sum3 << 16 ) + ( sum4 << 24 );
+        proc.R[d] = ParallelHalvingAdd< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8281,20 +8122,16 @@ void arm::UHASX_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UHASX_A1 );
 
         // Operation
-        uint32_t diff = Bits( proc.R[n], 15,  0 ) - Bits( proc.R[m], 31, 16 );
-        uint32_t sum  = Bits( proc.R[n], 31, 16 ) + Bits( proc.R[m], 15,  0 );
-
-        diff = Bits( diff, 16, 1 );
-        sum  = Bits( sum , 16, 1 );
-
-        proc.R[d] = diff + ( sum << 16 );
+        const uint32_t x = ROR( proc.R[m], 16 );
+        proc.R[d] = MergeHalfwords( ParallelHalvingSub< 16 >( proc.R[n], x ),
+                                    ParallelHalvingAdd< 16 >( proc.R[n], x ) );
     }
 }
 
@@ -8305,20 +8142,16 @@ void arm::UHSAX_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UHSAX_A1 );
 
         // Operation
-        uint32_t sum  = Bits( proc.R[n], 15,  0 ) + Bits( proc.R[m], 31, 16 );
-        uint32_t diff = Bits( proc.R[n], 31, 16 ) - Bits( proc.R[m], 15,  0 );
-
-        diff = Bits( diff, 16, 1 );
-        sum  = Bits( sum , 16, 1 );
-
-        proc.R[d] = sum + ( diff << 16 );
+        const uint32_t x = ROR( proc.R[m], 16 );
+        proc.R[d] = MergeHalfwords( ParallelHalvingAdd< 16 >( proc.R[n], x ),
+                                    ParallelHalvingSub< 16 >( proc.R[n], x ) );
     }
 }
 
@@ -8329,20 +8162,14 @@ void arm::UHSUB16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UHSUB16_A1 );
 
         // Operation
-        uint32_t diff1 = Bits( proc.R[n], 15,  0 ) - Bits( proc.R[m], 15,  0 );
-        uint32_t diff2 = Bits( proc.R[n], 31, 16 ) - Bits( proc.R[m], 31, 16 );
-
-        diff1 = Bits( diff1, 16, 1 );
-        diff2 = Bits( diff2, 16, 1 );
-
-        proc.R[d] = diff1 + ( diff2 << 16 );
+        proc.R[d] = ParallelHalvingSub< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8353,24 +8180,14 @@ void arm::UHSUB8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UHSUB8_A1 );
 
         // Operation
-        uint32_t diff1 = Bits( proc.R[n],  7,  0 ) - Bits( proc.R[m],  7,  0 );
-        uint32_t diff2 = Bits( proc.R[n], 15,  8 ) - Bits( proc.R[m], 15,  8 );
-        uint32_t diff3 = Bits( proc.R[n], 23, 16 ) - Bits( proc.R[m], 23, 16 );
-        uint32_t diff4 = Bits( proc.R[n], 31, 24 ) - Bits( proc.R[m], 31, 24 );
-        
-        diff1 = Bits( diff1, 8, 1 );
-        diff2 = Bits( diff2, 8, 1 );
-        diff3 = Bits( diff3, 8, 1 );
-        diff4 = Bits( diff4, 8, 1 );
-
-        proc.R[d] = diff1 + ( diff2 << 8 ) + ( diff3 << 16 ) + ( diff4 << 24 );
+        proc.R[d] = ParallelHalvingSub< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8381,20 +8198,21 @@ void arm::UMAAL_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t dHi = Bits( instr, 19, 16 );
-        uint32_t dLo = Bits( instr, 15, 12 );
-        uint32_t m   = Bits( instr, 11,  8 );
-        uint32_t n   = Bits( instr,  3,  0 );
+        uint32_t dHi = Bits< 19, 16 >( instr );
+        uint32_t dLo = Bits< 15, 12 >( instr );
+        uint32_t m   = Bits< 11,  8 >( instr );
+        uint32_t n   = Bits<  3,  0 >( instr );
 
-        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
-        if ( dHi == dLo ) UNPREDICTABLE;
+        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 )
+            ARMV7_UNPREDICTABLE( UMAAL_A1 );
+        if ( dHi == dLo ) ARMV7_UNPREDICTABLE( UMAAL_A1 );
 
         // Operation
         uint64_t result
             = (uint64_t)UInt( proc.R[n] )   * (uint64_t)UInt( proc.R[m] )
             + (uint64_t)UInt( proc.R[dHi] ) + (uint64_t)UInt( proc.R[dLo] );
-        proc.R[dHi] = Bits64( result, 63, 32 );
-        proc.R[dLo] = Bits64( result, 31,  0 );
+        proc.R[dHi] = Bits64< 63, 32 >( result );
+        proc.R[dLo] = Bits64< 31,  0 >( result );
     }
 }
 
@@ -8405,15 +8223,17 @@ void arm::UMLAL_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S   = Bits( instr, 20, 20 );
-        uint32_t dHi = Bits( instr, 19, 16 );
-        uint32_t dLo = Bits( instr, 15, 12 );
-        uint32_t m   = Bits( instr, 11,  8 );
-        uint32_t n   = Bits( instr,  3,  0 );
+        uint32_t S   = Bits< 20, 20 >( instr );
+        uint32_t dHi = Bits< 19, 16 >( instr );
+        uint32_t dLo = Bits< 15, 12 >( instr );
+        uint32_t m   = Bits< 11,  8 >( instr );
+        uint32_t n   = Bits<  3,  0 >( instr );
 
-        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
-        if ( dHi == dLo ) UNPREDICTABLE;
-        if ( ArchVersion() < 6 && ( dHi == n || dLo == n ) ) UNPREDICTABLE;
+        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 )
+            ARMV7_UNPREDICTABLE( UMLAL_A1 );
+        if ( dHi == dLo ) ARMV7_UNPREDICTABLE( UMLAL_A1 );
+        if ( ArchVersion( proc ) < 6 && ( dHi == n || dLo == n ) )
+            ARMV7_UNPREDICTABLE( UMLAL_A1 );
 
         bool setflags = ( S == 0x1 );
 
@@ -8421,12 +8241,12 @@ void arm::UMLAL_A1( proc_type& proc, uint32_t instr )
         uint64_t result
             =   (uint64_t)( proc.R[n] )           * (uint64_t)( proc.R[m] )
             + ( (uint64_t)( proc.R[dHi] ) << 32 ) + (uint64_t)( proc.R[dLo] );
-        proc.R[dHi] = Bits64( result, 63, 32 );
-        proc.R[dLo] = Bits64( result, 31,  0 );
+        proc.R[dHi] = Bits64< 63, 32 >( result );
+        proc.R[dLo] = Bits64< 31,  0 >( result );
 
         if ( setflags )
         {
-            proc.CPSR.N = Bits64( result, 63, 63 );
+            proc.CPSR.N = Bits64< 63, 63 >( result );
             proc.CPSR.Z = IsZeroBit( result );
             // CPSR.C, CPSR.V unchanged
         }
@@ -8440,26 +8260,28 @@ void arm::UMULL_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t S   = Bits( instr, 20, 20 );
-        uint32_t dHi = Bits( instr, 19, 16 );
-        uint32_t dLo = Bits( instr, 15, 12 );
-        uint32_t m   = Bits( instr, 11,  8 );
-        uint32_t n   = Bits( instr,  3,  0 );
+        uint32_t S   = Bits< 20, 20 >( instr );
+        uint32_t dHi = Bits< 19, 16 >( instr );
+        uint32_t dLo = Bits< 15, 12 >( instr );
+        uint32_t m   = Bits< 11,  8 >( instr );
+        uint32_t n   = Bits<  3,  0 >( instr );
 
-        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
-        if ( dHi == dLo ) UNPREDICTABLE;
-        if ( ArchVersion() < 6 && ( dHi == n || dLo == n ) ) UNPREDICTABLE;
+        if ( dLo == 15 || dHi == 15 || n == 15 || m == 15 )
+            ARMV7_UNPREDICTABLE( UMULL_A1 );
+        if ( dHi == dLo ) ARMV7_UNPREDICTABLE( UMULL_A1 );
+        if ( ArchVersion( proc ) < 6 && ( dHi == n || dLo == n ) )
+            ARMV7_UNPREDICTABLE( UMULL_A1 );
 
         bool setflags = ( S == 0x1 );
 
         // Operation
         uint64_t result = (uint64_t)( proc.R[n] ) * (uint64_t)( proc.R[m] );
-        proc.R[dHi] = Bits64( result, 63, 32 );
-        proc.R[dLo] = Bits64( result, 31,  0 );
+        proc.R[dHi] = Bits64< 63, 32 >( result );
+        proc.R[dLo] = Bits64< 31,  0 >( result );
 
         if ( setflags )
         {
-            proc.CPSR.N = Bits64( result, 63, 63 );
+            proc.CPSR.N = Bits64< 63, 63 >( result );
             proc.CPSR.Z = IsZeroBit( result );
             // CPSR.C, CPSR.V unchanged
         }
@@ -8473,16 +8295,14 @@ void arm::UQADD16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UQADD16_A1 );
 
         // Operation
-        int64_t sum1 = Bits( proc.R[n], 15,  0 ) + Bits( proc.R[m], 15,  0 );
-        int64_t sum2 = Bits( proc.R[n], 31, 16 ) + Bits( proc.R[m], 31, 16 );
-        proc.R[d] = UnsignedSat( sum1, 16 ) + ( UnsignedSat( sum2, 16 ) << 16 );
+        proc.R[d] = ParallelUnsignedSatAdd< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8493,24 +8313,14 @@ void arm::UQADD8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UQADD8_A1 );
 
         // Operation
-        int64_t sum1 = Bits( proc.R[n],  7,   0 ) + Bits( proc.R[m],  7,  0 );
-        int64_t sum2 = Bits( proc.R[n], 15,   8 ) + Bits( proc.R[m], 15,  8 );
-        int64_t sum3 = Bits( proc.R[n], 23,  16 ) + Bits( proc.R[m], 23, 16 );
-        int64_t sum4 = Bits( proc.R[n], 31,  24 ) + Bits( proc.R[m], 31, 24 );
-
-        sum1 = UnsignedSat( sum1, 8 );
-        sum2 = UnsignedSat( sum2, 8 );
-        sum3 = UnsignedSat( sum3, 8 );
-        sum4 = UnsignedSat( sum4, 8 );
-
-        proc.R[d] = sum1 + ( sum2 << 8 ) + ( sum3 << 16 ) + ( sum4 << 24 );
+        proc.R[d] = ParallelUnsignedSatAdd< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8521,21 +8331,17 @@ void arm::UQASX_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UQASX_A1 );
 
         // Operation
-        int64_t diff
-            = (int64_t)Bits( proc.R[n], 15,  0 )
-            - (int64_t)Bits( proc.R[m], 31, 16 );
-        int64_t sum
-            = (int64_t)Bits( proc.R[n], 31, 16 )
-            + (int64_t)Bits( proc.R[m], 15,  0 );
-
-        proc.R[d] = UnsignedSat( diff, 16 ) + ( UnsignedSat( sum, 16 ) << 16 );
+        const uint32_t x = ROR( proc.R[m], 16 );
+        proc.R[d] =
+            MergeHalfwords( ParallelUnsignedSatSub< 16 >( proc.R[n], x ),
+                            ParallelUnsignedSatAdd< 16 >( proc.R[n], x ) );
     }
 }
 
@@ -8546,21 +8352,17 @@ void arm::UQSAX_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UQSAX_A1 );
 
         // Operation
-        int64_t sum
-            = (int64_t)Bits( proc.R[n], 15,  0 )
-            + (int64_t)Bits( proc.R[m], 31, 16 );
-        int64_t diff
-            = (int64_t)Bits( proc.R[n], 31, 16 )
-            - (int64_t)Bits( proc.R[m], 15,  0 );
-
-        proc.R[d] = UnsignedSat( sum, 16 ) + ( UnsignedSat( diff, 16 ) << 16 );
+        const uint32_t x = ROR( proc.R[m], 16 );
+        proc.R[d] =
+            MergeHalfwords( ParallelUnsignedSatAdd< 16 >( proc.R[n], x ),
+                            ParallelUnsignedSatSub< 16 >( proc.R[n], x ) );
     }
 }
 
@@ -8571,21 +8373,14 @@ void arm::UQSUB16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UQSUB16_A1 );
 
         // Operation
-        int64_t diff1
-            = (int64_t)Bits( proc.R[n], 15,  0 )
-            - (int64_t)Bits( proc.R[m], 15,  0 );
-        int64_t diff2
-            = (int64_t)Bits( proc.R[n], 31, 16 )
-            - (int64_t)Bits( proc.R[m], 31, 16 );
-        proc.R[d]
-            = UnsignedSat( diff1, 16 ) + ( UnsignedSat( diff2, 16 ) << 16 );
+        proc.R[d] = ParallelUnsignedSatSub< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8596,32 +8391,14 @@ void arm::UQSUB8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UQSUB8_A1 );
 
         // Operation
-        int64_t diff1
-            = (int64_t)Bits( proc.R[n],  7,  0 )
-            - (int64_t)Bits( proc.R[m],  7,  0 );
-        int64_t diff2
-            = (int64_t)Bits( proc.R[n], 15,  8 )
-            - (int64_t)Bits( proc.R[m], 15,  8 );
-        int64_t diff3
-            = (int64_t)Bits( proc.R[n], 23, 16 )
-            - (int64_t)Bits( proc.R[m], 23, 16 );
-        int64_t diff4
-            = (int64_t)Bits( proc.R[n], 31, 24 )
-            - (int64_t)Bits( proc.R[m], 31, 24 );
-
-        diff1 = UnsignedSat( diff1, 8 );
-        diff2 = UnsignedSat( diff2, 8 );
-        diff3 = UnsignedSat( diff3, 8 );
-        diff4 = UnsignedSat( diff4, 8 );
-
-        proc.R[d] = diff1 + ( diff2 << 8 ) + ( diff3 << 16 ) + ( diff4 << 24 );
+        proc.R[d] = ParallelUnsignedSatSub< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8632,33 +8409,14 @@ void arm::USAD8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( USAD8_A1 );
 
         // Operation
-        int16_t diff1
-            = (int16_t)Bits( proc.R[n],  7,  0 )
-            - (int16_t)Bits( proc.R[m],  7,  0 );
-        int16_t diff2
-            = (int16_t)Bits( proc.R[n], 15,  8 )
-            - (int16_t)Bits( proc.R[m], 15,  8 );
-        int16_t diff3
-            = (int16_t)Bits( proc.R[n], 23, 16 )
-            - (int16_t)Bits( proc.R[m], 23, 16 );
-        int16_t diff4
-            = (int16_t)Bits( proc.R[n], 31, 24 )
-            - (int16_t)Bits( proc.R[m], 31, 24 );
-
-        uint32_t absdiff1 = Abs( diff1 );
-        uint32_t absdiff2 = Abs( diff2 );
-        uint32_t absdiff3 = Abs( diff3 );
-        uint32_t absdiff4 = Abs( diff4 );
-
-        uint32_t result = absdiff1 + absdiff2 + absdiff3 + absdiff4;
-        proc.R[d] = result;
+        proc.R[d] = SumAbsDiff8( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8669,35 +8427,16 @@ void arm::USADA8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t d = Bits( instr, 19, 16 );
-        uint32_t a = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr, 11,  8 );
-        uint32_t n = Bits( instr,  3,  0 );
+        uint32_t d = Bits< 19, 16 >( instr );
+        uint32_t a = Bits< 15, 12 >( instr );
+        uint32_t m = Bits< 11,  8 >( instr );
+        uint32_t n = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 || a == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 || a == 15 )
+            ARMV7_UNPREDICTABLE( USADA8_A1 );
 
         // Operation
-        int16_t diff1
-            = (int16_t)Bits( proc.R[n],  7,  0 )
-            - (int16_t)Bits( proc.R[m],  7,  0 );
-        int16_t diff2
-            = (int16_t)Bits( proc.R[n], 15,  8 )
-            - (int16_t)Bits( proc.R[m], 15,  8 );
-        int16_t diff3
-            = (int16_t)Bits( proc.R[n], 23, 16 )
-            - (int16_t)Bits( proc.R[m], 23, 16 );
-        int16_t diff4
-            = (int16_t)Bits( proc.R[n], 31, 24 )
-            - (int16_t)Bits( proc.R[m], 31, 24 );
-
-        uint32_t absdiff1 = Abs( diff1 );
-        uint32_t absdiff2 = Abs( diff2 );
-        uint32_t absdiff3 = Abs( diff3 );
-        uint32_t absdiff4 = Abs( diff4 );
-
-        uint32_t result
-            = UInt( proc.R[a] ) + absdiff1 + absdiff2 + absdiff3 + absdiff4;
-        proc.R[d] = result;
+        proc.R[d] = proc.R[a] + SumAbsDiff8( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8708,17 +8447,17 @@ void arm::USAT_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t saturate_to = Bits( instr, 20, 16 );
-        uint32_t d           = Bits( instr, 15, 12 );
-        uint32_t imm5        = Bits( instr, 11,  7 );
-        uint32_t sh          = Bits( instr,  6,  6 );
-        uint32_t n           = Bits( instr,  3,  0 );
+        uint32_t saturate_to = Bits< 20, 16 >( instr );
+        uint32_t d           = Bits< 15, 12 >( instr );
+        uint32_t imm5        = Bits< 11,  7 >( instr );
+        uint32_t sh          = Bits<  6,  6 >( instr );
+        uint32_t n           = Bits<  3,  0 >( instr );
 
         ShiftUValue shift    = DecodeImmShift( sh << 1, imm5 );
         SRType      shift_t  = shift.shift_t;
         uint32_t    shift_n  = shift.shift_n;
 
-        if ( d == 15 || n == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 ) ARMV7_UNPREDICTABLE( USAT_A1 );
 
         // Operation
         int64_t operand
@@ -8742,15 +8481,15 @@ void arm::USAT16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t saturate_to = Bits( instr, 19, 16 );
-        uint32_t d           = Bits( instr, 15, 12 );
-        uint32_t n           = Bits( instr,  3,  0 );
+        uint32_t saturate_to = Bits< 19, 16 >( instr );
+        uint32_t d           = Bits< 15, 12 >( instr );
+        uint32_t n           = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 ) ARMV7_UNPREDICTABLE( USAT16_A1 );
 
         // Operation
-        uint16_t operand1 = Bits( proc.R[n], 15,  0 );
-        uint16_t operand2 = Bits( proc.R[n], 31, 16 );
+        uint16_t operand1 = Bits< 15,  0 >( proc.R[n] );
+        uint16_t operand2 = Bits< 31, 16 >( proc.R[n] );
 
         UValueSat v1 = UnsignedSatQ( SInt( operand1 ), saturate_to );
         uint64_t  result1 = v1.value;
@@ -8776,20 +8515,19 @@ void arm::USAX_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( USAX_A1 );
 
         // Operation
-        int32_t sum  = Bits( proc.R[n], 15,  0 ) + Bits( proc.R[m], 31, 16 );
-        int32_t diff = Bits( proc.R[n], 31, 16 ) - Bits( proc.R[m], 15,  0 );
-
-        proc.R[d] = Bits( sum, 15, 0 ) + ( Bits( diff, 15, 0 ) << 16 );
-
-        proc.CPSR.GE = (sum  >= 0x10000 ? 0x3 : 0x0)
-                     | (diff >= 0x0     ? 0xC : 0x0);
+        const uint32_t x = ROR( proc.R[m], 16 );
+        proc.CPSR.GE = GEFromSigns< 16 >(
+            MergeHalfwords( ParallelHalvingAdd< 16 >( proc.R[n], x ),
+                            ~ParallelHalvingSub< 16 >( proc.R[n], x ) ) );
+        proc.R[d]    = MergeHalfwords( ParallelAdd< 16 >( proc.R[n], x ),
+                                       ParallelSub< 16 >( proc.R[n], x ) );
     }
 }
 
@@ -8800,19 +8538,16 @@ void arm::USUB16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( USUB16_A1 );
 
         // Operation
-        int32_t diff1 = Bits( proc.R[n], 15,  0 ) - Bits( proc.R[m], 15,  0 );
-        int32_t diff2 = Bits( proc.R[n], 31, 16 ) - Bits( proc.R[m], 31, 16 );
-        proc.R[d] = Bits( diff1, 15, 0 ) + ( Bits( diff2, 15, 0 ) << 16 );
-
-        proc.CPSR.GE = (diff1 >= 0x0 ? 0x3 : 0x0)
-                     | (diff2 >= 0x0 ? 0xC : 0x0);
+        proc.CPSR.GE = GEFromSigns< 16 >(
+            ~ParallelHalvingSub< 16 >( proc.R[n], proc.R[m] ) );
+        proc.R[d]    = ParallelSub< 16 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8823,28 +8558,16 @@ void arm::USUB8_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n = Bits( instr, 19, 16 );
-        uint32_t d = Bits( instr, 15, 12 );
-        uint32_t m = Bits( instr,  3,  0 );
+        uint32_t n = Bits< 19, 16 >( instr );
+        uint32_t d = Bits< 15, 12 >( instr );
+        uint32_t m = Bits<  3,  0 >( instr );
 
-        if ( d == 15 || n == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || n == 15 || m == 15 ) ARMV7_UNPREDICTABLE( USUB8_A1 );
 
         // Operation
-        int32_t diff1 = Bits( proc.R[n],  7,  0 ) - Bits( proc.R[m],  7,  0 );
-        int32_t diff2 = Bits( proc.R[n], 15,  8 ) - Bits( proc.R[m], 15,  8 );
-        int32_t diff3 = Bits( proc.R[n], 23, 16 ) - Bits( proc.R[m], 23, 16 );
-        int32_t diff4 = Bits( proc.R[n], 31, 24 ) - Bits( proc.R[m], 31, 24 );
-
-        proc.R[d]
-            = Bits( diff1, 7, 0 )
-            + ( Bits( diff2, 7, 0 ) << 8 )
-            + ( Bits( diff3, 7, 0 ) << 16 )
-            + ( Bits( diff4, 7, 0 ) << 24 );
-
-        proc.CPSR.GE = (diff1 >= 0x0 ? 0x1 : 0x0)
-                     | (diff2 >= 0x0 ? 0x2 : 0x0)
-                     | (diff3 >= 0x0 ? 0x4 : 0x0)
-                     | (diff4 >= 0x0 ? 0x8 : 0x0);
+        proc.CPSR.GE = GEFromSigns< 8 >(
+            ~ParallelHalvingSub< 8 >( proc.R[n], proc.R[m] ) );
+        proc.R[d]    = ParallelSub< 8 >( proc.R[n], proc.R[m] );
     }
 }
 
@@ -8855,17 +8578,17 @@ void arm::UXTAB_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {
         // Encoding-specific operations
-        uint32_t n        = Bits( instr, 19, 16 );
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t n        = Bits< 19, 16 >( instr );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
         if ( n == 0xF ) ;           // SEE UXTB
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UXTAB_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        proc.R[d] = proc.R[n] + ZeroExtend( Bits( rotated, 7, 0 ) );
+        proc.R[d] = proc.R[n] + ZeroExtend( Bits< 7, 0 >( rotated ) );
     }
 }
 
@@ -8876,22 +8599,22 @@ void arm::UXTAB16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t n        = Bits( instr, 19, 16 );
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t n        = Bits< 19, 16 >( instr );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
         if ( n == 0xF ) ;           // SEE UXTB16
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UXTAB16_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        uint32_t rn_h    = Bits( proc.R[n], 31, 16 );
-        uint32_t rn_l    = Bits( proc.R[n], 15,  0 );
+        uint32_t rn_h    = Bits< 31, 16 >( proc.R[n] );
+        uint32_t rn_l    = Bits< 15,  0 >( proc.R[n] );
 
-        uint32_t rd_l = rn_l + ZeroExtend( Bits( rotated, 7, 0 ) );
-        uint32_t rd_h = rn_h + ZeroExtend( Bits( rotated, 23, 16 ) );
-        proc.R[d] = ( Bits( rd_h, 15, 0 ) << 16 ) + Bits( rd_l, 15, 0 );
+        uint32_t rd_l = rn_l + ZeroExtend( Bits< 7, 0 >( rotated ) );
+        uint32_t rd_h = rn_h + ZeroExtend( Bits< 23, 16 >( rotated ) );
+        proc.R[d] = ( Bits< 15, 0 >( rd_h ) << 16 ) + Bits< 15, 0 >( rd_l );
     }
 }
 
@@ -8902,18 +8625,18 @@ void arm::UXTAH_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t n        = Bits( instr, 19, 16 );
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t n        = Bits< 19, 16 >( instr );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
 
         if ( n == 0xF ) ;           // SEE UXTH
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UXTAH_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        proc.R[d] = proc.R[n] + ZeroExtend( Bits( rotated, 15, 0 ) );
+        proc.R[d] = proc.R[n] + ZeroExtend( Bits< 15, 0 >( rotated ) );
     }
 }
 
@@ -8924,16 +8647,16 @@ void arm::UXTB_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
 
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UXTB_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        proc.R[d] = ZeroExtend( Bits( rotated, 7, 0 ) );
+        proc.R[d] = ZeroExtend( Bits< 7, 0 >( rotated ) );
     }
 }
 
@@ -8944,18 +8667,18 @@ void arm::UXTB16_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
 
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UXTB16_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        uint32_t rd_l = ZeroExtend( Bits( rotated, 7, 0 ) );
-        uint32_t rd_h = ZeroExtend( Bits( rotated, 23, 16 ) );
-        proc.R[d] = ( Bits( rd_h, 15, 0 ) << 16 ) + Bits( rd_l, 15, 0 );
+        uint32_t rd_l = ZeroExtend( Bits< 7, 0 >( rotated ) );
+        uint32_t rd_h = ZeroExtend( Bits< 23, 16 >( rotated ) );
+        proc.R[d] = ( Bits< 15, 0 >( rd_h ) << 16 ) + Bits< 15, 0 >( rd_l );
     }
 }
 
@@ -8966,16 +8689,16 @@ void arm::UXTH_A1( proc_type& proc, uint32_t instr )
     if ( ConditionPassed( proc, instr ) )
     {    
         // Encoding-specific operations
-        uint32_t d        = Bits( instr, 15, 12 );
-        uint32_t rotate   = Bits( instr, 11, 10 );
-        uint32_t m        = Bits( instr,  3,  0 );
+        uint32_t d        = Bits< 15, 12 >( instr );
+        uint32_t rotate   = Bits< 11, 10 >( instr );
+        uint32_t m        = Bits<  3,  0 >( instr );
         uint32_t rotation = UInt( rotate << 3 );
 
-        if ( d == 15 || m == 15 ) UNPREDICTABLE;
+        if ( d == 15 || m == 15 ) ARMV7_UNPREDICTABLE( UXTH_A1 );
 
         // Operation
         uint32_t rotated = ROR( proc.R[m], rotation );
-        proc.R[d] = ZeroExtend( Bits( rotated, 15, 0 ) );
+        proc.R[d] = ZeroExtend( Bits< 15, 0 >( rotated ) );
     }
 }
 
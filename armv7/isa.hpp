@@ -23,10 +23,43 @@
 #ifndef __ARMV7_ISA_HPP__
 #define __ARMV7_ISA_HPP__
 
+#include "batch.hpp"
+#include "batch_impl.hpp"
+#include "block.hpp"
+#include "block_impl.hpp"
+#include "decoder.hpp"
+#include "decoder_impl.hpp"
+#include "elf.hpp"
+#include "elf_impl.hpp"
+#include "endian.hpp"
+#include "endian_impl.hpp"
+#include "exclusive.hpp"
+#include "exclusive_impl.hpp"
 #include "function.hpp"
 #include "function_impl.hpp"
 #include "instruction.hpp"
 #include "instruction_impl.hpp"
+#include "jit.hpp"
+#include "jit_impl.hpp"
+#include "memory.hpp"
+#include "memory_impl.hpp"
+#include "mmio.hpp"
+#include "mmio_impl.hpp"
+#include "parallel.hpp"
+#include "parallel_impl.hpp"
+#include "predecode.hpp"
+#include "predecode_impl.hpp"
 #include "processor.hpp"
+#include "profile.hpp"
+#include "run.hpp"
+#include "run_impl.hpp"
+#include "smc.hpp"
+#include "smc_impl.hpp"
+#include "smp.hpp"
+#include "smp_impl.hpp"
+#include "unpredictable.hpp"
+#include "unpredictable_impl.hpp"
+#include "vmsa.hpp"
+#include "vmsa_impl.hpp"
 
 #endif // __ARMV7_ISA_HPP__
@@ -0,0 +1,309 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "jit.hpp"
+
+#include <boost/cstdint.hpp>
+#include <cassert>
+#include <stdexcept>
+
+#ifdef ARMV7_JIT
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+namespace {
+
+    // Register numbers used in ModRM bytes
+    const uint8_t eax = 0;
+    const uint8_t ecx = 1;
+
+    // Operand of [R13 + disp32]: mod = 10, rm = 101
+    uint8_t ModRMR13( uint8_t reg )
+    {
+        return 0x80 | ( reg << 3 ) | 0x05;
+    }
+
+} // namespace
+
+
+bool arm::JitAvailable()
+{
+#ifdef ARMV7_JIT
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+arm::code_buffer::code_buffer( size_t size ) : base( 0 ), next( 0 ),
+                                               size( size )
+{
+#ifdef ARMV7_JIT
+    void* p = mmap( 0, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if( p == MAP_FAILED )
+    {
+        throw std::runtime_error( "code_buffer: cannot map the buffer" );
+    }
+    base = static_cast< uint8_t* >( p );
+    next = base;
+
+    // Hosts refusing executable memory are told apart right away
+    try
+    {
+        protect( PROT_READ | PROT_EXEC );
+    }
+    catch( ... )
+    {
+        munmap( base, size );
+        throw;
+    }
+#else
+    this->size = 0;
+#endif
+}
+
+
+arm::code_buffer::~code_buffer()
+{
+#ifdef ARMV7_JIT
+    if( base != 0 )
+    {
+        munmap( base, size );
+    }
+#endif
+}
+
+
+uint8_t* arm::code_buffer::begin() const
+{
+    return next;
+}
+
+
+uint8_t* arm::code_buffer::end() const
+{
+    return base + size;
+}
+
+
+void arm::code_buffer::open()
+{
+#ifdef ARMV7_JIT
+    protect( PROT_READ | PROT_WRITE );
+#endif
+}
+
+
+void arm::code_buffer::commit( uint8_t* next )
+{
+    assert( next >= this->next && next <= end() && "Invalid code end" );
+
+#ifdef ARMV7_JIT
+    protect( PROT_READ | PROT_EXEC );
+#endif
+    this->next = next;
+}
+
+
+void arm::code_buffer::protect( int prot )
+{
+#ifdef ARMV7_JIT
+    // The page holding "next" may also hold committed code
+    const uintptr_t page  = sysconf( _SC_PAGESIZE );
+    const uintptr_t first = reinterpret_cast< uintptr_t >( next ) &
+                            ~( page - 1 );
+    const uintptr_t last  = reinterpret_cast< uintptr_t >( end() );
+
+    if( first < last &&
+        mprotect( reinterpret_cast< void* >( first ), last - first,
+                  prot ) != 0 )
+    {
+        throw std::runtime_error( "code_buffer: cannot change the "
+                                  "protection of the buffer" );
+    }
+#else
+    (void)prot;
+#endif
+}
+
+
+void arm::code_buffer::reset()
+{
+    next = base;
+}
+
+
+arm::x86_64_emitter::x86_64_emitter( uint8_t* begin, uint8_t* end ) :
+    next( begin ), last( end ), full( false )
+{
+}
+
+
+void arm::x86_64_emitter::prologue( int32_t bank_offset )
+{
+    byte( 0x53 );                                   // push rbx
+    byte( 0x41 ); byte( 0x54 );                     // push r12
+    byte( 0x41 ); byte( 0x55 );                     // push r13
+    byte( 0x48 ); byte( 0x89 ); byte( 0xFB );       // mov  rbx, rdi
+    byte( 0x49 ); byte( 0x89 ); byte( 0xF4 );       // mov  r12, rsi
+    byte( 0x4C ); byte( 0x8B ); byte( 0xAB );       // mov  r13, [rbx+disp32]
+    dword( bank_offset );
+}
+
+
+void arm::x86_64_emitter::epilogue()
+{
+    byte( 0x41 ); byte( 0x5D );                     // pop  r13
+    byte( 0x41 ); byte( 0x5C );                     // pop  r12
+    byte( 0x5B );                                   // pop  rbx
+    byte( 0xC3 );                                   // ret
+}
+
+
+void arm::x86_64_emitter::load_eax( uint32_t r )
+{
+    byte( 0x41 ); byte( 0x8B ); byte( ModRMR13( eax ) ); // mov eax, [r13+d]
+    dword( 4 * r );
+}
+
+
+void arm::x86_64_emitter::load_ecx( uint32_t r )
+{
+    byte( 0x41 ); byte( 0x8B ); byte( ModRMR13( ecx ) ); // mov ecx, [r13+d]
+    dword( 4 * r );
+}
+
+
+void arm::x86_64_emitter::store_eax( uint32_t r )
+{
+    byte( 0x41 ); byte( 0x89 ); byte( ModRMR13( eax ) ); // mov [r13+d], eax
+    dword( 4 * r );
+}
+
+
+void arm::x86_64_emitter::store_imm( uint32_t r, uint32_t imm )
+{
+    byte( 0x41 ); byte( 0xC7 ); byte( ModRMR13( 0 ) );   // mov [r13+d], imm
+    dword( 4 * r );
+    dword( imm );
+}
+
+
+void arm::x86_64_emitter::alu_eax_imm( alu_op op, uint32_t imm )
+{
+    switch( op )
+    {
+    case alu_add: byte( 0x05 ); dword(  imm ); break;    // add eax, imm
+    case alu_sub: byte( 0x2D ); dword(  imm ); break;    // sub eax, imm
+    case alu_and: byte( 0x25 ); dword(  imm ); break;    // and eax, imm
+    case alu_or:  byte( 0x0D ); dword(  imm ); break;    // or  eax, imm
+    case alu_xor: byte( 0x35 ); dword(  imm ); break;    // xor eax, imm
+    case alu_bic: byte( 0x25 ); dword( ~imm ); break;    // and eax, ~imm
+    }
+}
+
+
+void arm::x86_64_emitter::alu_eax_ecx( alu_op op )
+{
+    switch( op )
+    {
+    case alu_add: byte( 0x01 ); break;              // add eax, ecx
+    case alu_sub: byte( 0x29 ); break;              // sub eax, ecx
+    case alu_and: byte( 0x21 ); break;              // and eax, ecx
+    case alu_or:  byte( 0x09 ); break;              // or  eax, ecx
+    case alu_xor: byte( 0x31 ); break;              // xor eax, ecx
+    case alu_bic:
+        byte( 0xF7 ); byte( 0xD1 );                 // not ecx
+        byte( 0x21 );                               // and eax, ecx
+        break;
+    }
+
+    byte( 0xC8 );   // mod = 11, reg = ecx, rm = eax
+}
+
+
+void arm::x86_64_emitter::shift_ecx( SRType type, uint32_t amount )
+{
+    assert( amount >= 1 && amount <= 31 && "Invalid shift amount" );
+
+    byte( 0xC1 );
+    switch( type )
+    {
+    case SRType_LSL: byte( 0xE1 ); break;           // shl ecx, imm8
+    case SRType_LSR: byte( 0xE9 ); break;           // shr ecx, imm8
+    case SRType_ASR: byte( 0xF9 ); break;           // sar ecx, imm8
+    case SRType_ROR: byte( 0xC9 ); break;           // ror ecx, imm8
+    default:
+        assert( false && "Invalid shift type" );
+    }
+    byte( amount );
+}
+
+
+void arm::x86_64_emitter::call( const void* function, int32_t instr_offset )
+{
+    byte( 0x48 ); byte( 0x89 ); byte( 0xDF );       // mov  rdi, rbx
+    byte( 0x49 ); byte( 0x8D ); byte( 0xB4 );       // lea  rsi, [r12+disp32]
+    byte( 0x24 ); dword( instr_offset );
+    byte( 0x48 ); byte( 0xB8 );                     // mov  rax, imm64
+    qword( reinterpret_cast< uint64_t >( function ) );
+    byte( 0xFF ); byte( 0xD0 );                     // call rax
+}
+
+
+uint8_t* arm::x86_64_emitter::current() const
+{
+    return next;
+}
+
+
+bool arm::x86_64_emitter::overflow() const
+{
+    return full;
+}
+
+
+void arm::x86_64_emitter::byte( uint8_t b )
+{
+    if( next < last )
+    {
+        *next++ = b;
+    }
+    else
+    {
+        full = true;
+    }
+}
+
+
+void arm::x86_64_emitter::dword( uint32_t d )
+{
+    for( int i = 0; i < 4; ++i )
+    {
+        byte( d >> ( 8 * i ) );
+    }
+}
+
+
+void arm::x86_64_emitter::qword( uint64_t q )
+{
+    dword( q );
+    dword( q >> 32 );
+}
@@ -0,0 +1,205 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file defines a translator from hot basic blocks to native
+ * x86-64 code, used by block_cache. Simple data-processing
+ * instructions are translated to native instructions working on the
+ * register bank; all others are translated to a call to their
+ * behavior function. On other hosts, no block is ever translated.
+ */
+
+#ifndef __ARMV7_JIT_HPP__
+#define __ARMV7_JIT_HPP__
+
+#include "block.hpp"
+#include "types.hpp"
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <cstddef>
+
+#if defined( __x86_64__ ) && defined( __linux__ )
+#define ARMV7_JIT 1
+#endif
+
+namespace arm {
+
+
+    /**
+     * Returns true if native code can be generated and executed on the
+     * host.
+     */
+    bool JitAvailable();
+
+
+    /**
+     * Executable memory holding generated code. Code is appended until
+     * the buffer is full and released all at once by reset().
+     *
+     * The memory is never writable and executable at once, so that
+     * hosts enforcing W^X accept it: the free space is made writable
+     * by open() and executable again by commit(), and no code of the
+     * buffer may run in between. The constructor, open() and commit()
+     * throw std::runtime_error if the host refuses the mapping or the
+     * protection change.
+     */
+    class code_buffer : boost::noncopyable
+    {
+    public:
+        explicit code_buffer( size_t size );
+        ~code_buffer();
+
+        uint8_t* begin() const;  /// Start of the free space
+        uint8_t* end()   const;  /// End of the buffer
+
+        /**
+         * Makes the free space writable.
+         */
+        void open();
+
+        /**
+         * Marks the space up to "next" as used and makes the buffer
+         * executable again.
+         */
+        void commit( uint8_t* next );
+
+        /**
+         * Releases all generated code.
+         */
+        void reset();
+
+    private:
+        // Changes the protection of the free space
+        void protect( int prot );
+
+        uint8_t* base;
+        uint8_t* next;
+        size_t   size;
+    };
+
+
+    /**
+     * Emits x86-64 instructions for the System V calling convention.
+     * Generated functions take the processor in RDI and the array of
+     * predecoded instructions in RSI. RBX holds the processor, R12 the
+     * instructions and R13 the register bank.
+     */
+    class x86_64_emitter
+    {
+    public:
+        enum alu_op { alu_add, alu_sub, alu_and, alu_or, alu_xor, alu_bic };
+
+        x86_64_emitter( uint8_t* begin, uint8_t* end );
+
+        /**
+         * Saves callee-saved registers and loads the register bank
+         * pointer found at "bank_offset" in the processor.
+         */
+        void prologue( int32_t bank_offset );
+
+        /**
+         * Restores callee-saved registers and returns.
+         */
+        void epilogue();
+
+        void load_eax( uint32_t r );               /// EAX <- R[r]
+        void load_ecx( uint32_t r );               /// ECX <- R[r]
+        void store_eax( uint32_t r );              /// R[r] <- EAX
+        void store_imm( uint32_t r, uint32_t imm );   /// R[r] <- imm
+        void alu_eax_imm( alu_op op, uint32_t imm );  /// EAX <- EAX op imm
+        void alu_eax_ecx( alu_op op );                /// EAX <- EAX op ECX
+
+        /**
+         * Shifts ECX by an immediate amount between 1 and 31.
+         */
+        void shift_ecx( SRType type, uint32_t amount );
+
+        /**
+         * Calls "function" with the processor and the predecoded
+         * instruction found at "instr_offset" in the array.
+         */
+        void call( const void* function, int32_t instr_offset );
+
+        uint8_t* current() const;   /// Next byte to be written
+        bool     overflow() const;  /// True if the buffer is too small
+
+    private:
+        void byte( uint8_t b );
+        void dword( uint32_t d );
+        void qword( uint64_t q );
+
+        uint8_t* next;
+        uint8_t* last;
+        bool     full;
+    };
+
+
+    /**
+     * Translates basic blocks executed at least "threshold" times to
+     * native code. Throws std::runtime_error when the host refuses
+     * executable memory (see code_buffer).
+     */
+    template< typename proc_type >
+    class jit_compiler : boost::noncopyable
+    {
+    public:
+        explicit jit_compiler( size_t buffer_size = 1 << 20,
+                               uint32_t threshold = 16 );
+
+        /**
+         * Translates all instructions of a block but a final branch,
+         * which block_cache executes itself. Sets block.native and
+         * returns true on success. Fails when the host is not
+         * supported, when the code buffer is full, or when the
+         * unpredictable policy stops and an instruction needs its
+         * behavior function, which could raise.
+         */
+        bool compile( proc_type& proc, basic_block< proc_type >& block );
+
+        /**
+         * Returns true if the last compile() failed because the code
+         * buffer was full. block_cache then releases all generated
+         * code with reset() and tries again.
+         */
+        bool full() const;
+
+        /**
+         * Releases all generated code. Blocks pointing to it must be
+         * dropped first.
+         */
+        void reset();
+
+        const uint32_t threshold;   /// Executions before translation
+
+    private:
+        code_buffer buffer;
+        bool        overflow;   /// Last compile() ran out of space
+    };
+
+
+    /**
+     * Executes a predecoded instruction from generated code if its
+     * condition passes, setting the PC as behavior functions expect.
+     */
+    template< typename proc_type >
+    void ExecuteFromNative( proc_type& proc,
+                            const predecoded_instr< proc_type >& p );
+
+
+} // namespace arm
+
+#endif // __ARMV7_JIT_HPP__
@@ -0,0 +1,224 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_JIT_IMPL_HPP__
+#define __ARMV7_JIT_IMPL_HPP__
+
+#include "jit.hpp"
+#include "block.hpp"
+#include "function.hpp"
+#include "unpredictable.hpp"
+#include <boost/cstdint.hpp>
+
+
+namespace arm {
+
+    // Register banks that generated code can access directly
+    template< typename bank_type >
+    struct native_bank
+    {
+        enum { value = false };
+    };
+
+    template<>
+    struct native_bank< uint32_t* >
+    {
+        enum { value = true };
+    };
+
+    template< typename bank_type >
+    bool IsNativeBank( const bank_type& )
+    {
+        return native_bank< bank_type >::value;
+    }
+
+    // Emits native code for a predecoded instruction. Returns false if
+    // it has to be executed by its behavior function.
+    inline bool EmitNative( x86_64_emitter& e, const Predecoded& p )
+    {
+        // Only unconditional instructions without flags, not reading
+        // the PC.
+        if( !p.simple || p.setflags || p.cond != 0xE ||
+            p.n == 15 || p.m == 15 )
+        {
+            return false;
+        }
+
+        x86_64_emitter::alu_op op;
+
+        switch( p.encoding )
+        {
+        case Encoding_MOV_imm_A1:
+            e.store_imm( p.d, p.imm32 );
+            return true;
+
+        case Encoding_MVN_imm_A1:
+            e.store_imm( p.d, ~p.imm32 );
+            return true;
+
+        case Encoding_MOV_reg_A1:
+            e.load_eax( p.m );
+            e.store_eax( p.d );
+            return true;
+
+        case Encoding_ADD_imm_A1: op = x86_64_emitter::alu_add; break;
+        case Encoding_SUB_imm_A1: op = x86_64_emitter::alu_sub; break;
+        case Encoding_AND_imm_A1: op = x86_64_emitter::alu_and; break;
+        case Encoding_ORR_imm_A1: op = x86_64_emitter::alu_or;  break;
+        case Encoding_EOR_imm_A1: op = x86_64_emitter::alu_xor; break;
+        case Encoding_BIC_imm_A1: op = x86_64_emitter::alu_bic; break;
+
+        case Encoding_ADD_reg_A1: op = x86_64_emitter::alu_add; break;
+        case Encoding_SUB_reg_A1: op = x86_64_emitter::alu_sub; break;
+        case Encoding_AND_reg_A1: op = x86_64_emitter::alu_and; break;
+        case Encoding_ORR_reg_A1: op = x86_64_emitter::alu_or;  break;
+        case Encoding_EOR_reg_A1: op = x86_64_emitter::alu_xor; break;
+        case Encoding_BIC_reg_A1: op = x86_64_emitter::alu_bic; break;
+
+        default:
+            return false;
+        }
+
+        switch( p.encoding )
+        {
+        case Encoding_ADD_imm_A1:
+        case Encoding_SUB_imm_A1:
+        case Encoding_AND_imm_A1:
+        case Encoding_ORR_imm_A1:
+        case Encoding_EOR_imm_A1:
+        case Encoding_BIC_imm_A1:
+            e.load_eax( p.n );
+            e.alu_eax_imm( op, p.imm32 );
+            e.store_eax( p.d );
+            return true;
+
+        default:
+            // RRX and shifts by 32 have no x86 counterpart
+            if( p.shift_t == SRType_RRX || p.shift_n > 31 )
+            {
+                return false;
+            }
+
+            e.load_eax( p.n );
+            e.load_ecx( p.m );
+            if( p.shift_n != 0 )
+            {
+                e.shift_ecx( p.shift_t, p.shift_n );
+            }
+            e.alu_eax_ecx( op );
+            e.store_eax( p.d );
+            return true;
+        }
+    }
+
+} // namespace arm
+
+
+template< typename proc_type >
+arm::jit_compiler< proc_type >::jit_compiler( size_t buffer_size,
+                                              uint32_t threshold ) :
+    threshold( threshold ), buffer( buffer_size ), overflow( false )
+{
+}
+
+
+template< typename proc_type >
+bool arm::jit_compiler< proc_type >::compile( proc_type& proc,
+                                              basic_block< proc_type >& block )
+{
+    const size_t count = block.instrs.size() - ( block.branch ? 1 : 0 );
+
+    overflow = false;
+    if( !JitAvailable() || count == 0 )
+    {
+        return false;
+    }
+
+    const bool native = IsNativeBank( proc.R );
+    const int32_t bank_offset = reinterpret_cast< char* >( &proc.R ) -
+                                reinterpret_cast< char* >( &proc );
+
+    typedef typename unpredictable_policy_of< proc_type >::type policy;
+
+    x86_64_emitter e( buffer.begin(), buffer.end() );
+    bool translated = true;
+
+    buffer.open();
+    e.prologue( bank_offset );
+
+    for( size_t i = 0; i < count; ++i )
+    {
+        if( !native || !EmitNative( e, block.instrs[i] ) )
+        {
+            // Generated code cannot stop after a behavior function
+            // that raised, so such blocks stay with block_cache
+            if( policy::stops )
+            {
+                translated = false;
+                break;
+            }
+
+            e.call( reinterpret_cast< const void* >(
+                        &arm::ExecuteFromNative< proc_type > ),
+                    i * sizeof( predecoded_instr< proc_type > ) );
+        }
+    }
+
+    e.epilogue();
+
+    if( !translated || e.overflow() )
+    {
+        overflow = translated;
+        buffer.commit( buffer.begin() );
+        return false;
+    }
+
+    block.native = reinterpret_cast< typename basic_block< proc_type >::
+                                     native_type >( buffer.begin() );
+    buffer.commit( e.current() );
+    return true;
+}
+
+
+template< typename proc_type >
+bool arm::jit_compiler< proc_type >::full() const
+{
+    return overflow;
+}
+
+
+template< typename proc_type >
+void arm::jit_compiler< proc_type >::reset()
+{
+    buffer.reset();
+}
+
+
+template< typename proc_type >
+void arm::ExecuteFromNative( proc_type& proc,
+                             const predecoded_instr< proc_type >& p )
+{
+    proc.PC    = p.address + 8;
+    proc.R[15] = p.address + 8;
+
+    // Blocks store conditional instructions with the AL condition
+    if( p.cond == 0xE || ConditionHolds( p.cond, ConditionFlags( proc.CPSR ) ) )
+    {
+        p.exec( proc, p );
+    }
+}
+
+#endif // __ARMV7_JIT_IMPL_HPP__
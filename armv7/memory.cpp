@@ -0,0 +1,391 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "memory.hpp"
+#include "memory_impl.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#ifdef ARMV7_RESERVED_MEM
+#include <boost/atomic.hpp>
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+namespace {
+
+    // Read in place of the pages that were never written. It is never
+    // written itself, and never cached.
+    uint8_t zero_page[ arm::paged_mem::PageSize ];
+
+}
+
+
+arm::paged_mem::page_caches::page_caches()
+{
+    reset();
+}
+
+
+void arm::paged_mem::page_caches::reset()
+{
+    for( int i = 0; i < Count; ++i )
+    {
+        read [i].tag  = 0;
+        read [i].page = 0;
+        write[i].tag  = 0;
+        write[i].page = 0;
+    }
+}
+
+
+arm::paged_mem::paged_mem()
+    : page_count( 0 )
+{
+    for( size_t t = 0; t < TableSize; ++t )
+    {
+        tables[t].store( 0, boost::memory_order_relaxed );
+    }
+}
+
+
+arm::paged_mem::~paged_mem()
+{
+    clear();
+}
+
+
+void arm::paged_mem::write( uint32_t addr, const void* data, size_t size )
+{
+    write_bytes( addr, data, size, caches.write[ page_caches::Byte ] );
+}
+
+
+void arm::paged_mem::read( uint32_t addr, void* data, size_t size ) const
+{
+    read_bytes( addr, data, size, caches.read[ page_caches::Byte ] );
+}
+
+
+void arm::paged_mem::write_bytes( uint32_t addr, const void* data,
+                                  size_t size, page_cache& cache )
+{
+    const uint8_t* bytes = static_cast< const uint8_t* >( data );
+
+    while( size > 0 )
+    {
+        const size_t offset = addr & PageMask;
+        const size_t n      = std::min( size, PageSize - offset );
+
+        memcpy( write_page( addr, cache ) + offset, bytes, n );
+
+        addr  += n;
+        bytes += n;
+        size  -= n;
+    }
+}
+
+
+void arm::paged_mem::read_bytes( uint32_t addr, void* data, size_t size,
+                                 page_cache& cache ) const
+{
+    uint8_t* bytes = static_cast< uint8_t* >( data );
+
+    while( size > 0 )
+    {
+        const size_t offset = addr & PageMask;
+        const size_t n      = std::min( size, PageSize - offset );
+
+        memcpy( bytes, read_page( addr, cache ) + offset, n );
+
+        addr  += n;
+        bytes += n;
+        size  -= n;
+    }
+}
+
+
+void arm::paged_mem::clear()
+{
+    for( size_t t = 0; t < TableSize; ++t )
+    {
+        page_entry* table = tables[t].exchange( 0,
+                                                boost::memory_order_acquire );
+        if( table )
+        {
+            for( size_t p = 0; p < TableSize; ++p )
+            {
+                delete[] table[p].load( boost::memory_order_relaxed );
+            }
+            delete[] table;
+        }
+    }
+
+    page_count.store( 0, boost::memory_order_relaxed );
+    caches.reset();
+}
+
+
+const uint8_t* arm::paged_mem::find_page( uint32_t addr,
+                                          page_cache& cache ) const
+{
+    const uint32_t number = addr >> PageBits;
+    page_entry* table = tables[ number >> TableBits ].load(
+        boost::memory_order_acquire );
+    uint8_t* page = table ?
+        table[ number & ( TableSize - 1 ) ].load(
+            boost::memory_order_acquire ) : 0;
+
+    // The zero page is not cached, since another thread may allocate
+    // the page at any time
+    if( !page )
+    {
+        return zero_page;
+    }
+
+    cache.tag  = number + 1;
+    cache.page = page;
+    return page;
+}
+
+
+uint8_t* arm::paged_mem::make_page( uint32_t addr, page_cache& cache )
+{
+    const uint32_t number = addr >> PageBits;
+
+    // A thread losing the race to allocate a table or a page frees its
+    // own and takes the other one
+    boost::atomic< page_entry* >& slot = tables[ number >> TableBits ];
+    page_entry* table = slot.load( boost::memory_order_acquire );
+    if( !table )
+    {
+        page_entry* made = new page_entry[ TableSize ];
+        for( size_t p = 0; p < TableSize; ++p )
+        {
+            made[p].store( 0, boost::memory_order_relaxed );
+        }
+
+        if( slot.compare_exchange_strong( table, made,
+                                          boost::memory_order_acq_rel ) )
+        {
+            table = made;
+        }
+        else
+        {
+            delete[] made;
+        }
+    }
+
+    page_entry& entry = table[ number & ( TableSize - 1 ) ];
+    uint8_t* page = entry.load( boost::memory_order_acquire );
+    if( !page )
+    {
+        uint8_t* made = new uint8_t[ PageSize ]();
+        if( entry.compare_exchange_strong( page, made,
+                                           boost::memory_order_acq_rel ) )
+        {
+            page = made;
+            page_count.fetch_add( 1, boost::memory_order_relaxed );
+        }
+        else
+        {
+            delete[] made;
+        }
+    }
+
+    cache.tag  = number + 1;
+    cache.page = page;
+    return page;
+}
+
+
+#ifdef ARMV7_RESERVED_MEM
+namespace {
+
+    // The 4 GB of guest memory, followed by a guard page for accesses
+    // crossing its end
+    const size_t reserved_size = ( size_t( 1 ) << 32 ) + 0x10000;
+
+    // Reservations the SIGSEGV handler commits pages in. A slot is
+    // taken with a compare-and-swap, so that the handler never waits
+    // for a lock.
+    const int slot_count = 16;
+    boost::atomic< uint8_t* > slots[ slot_count ];
+
+    struct sigaction previous_action;
+    size_t           host_page_size;
+
+    void ReservedMemHandler( int sig, siginfo_t* info, void* context )
+    {
+        uint8_t* addr = static_cast< uint8_t* >( info->si_addr );
+
+        for( int i = 0; i < slot_count; ++i )
+        {
+            uint8_t* base = slots[i].load( boost::memory_order_acquire );
+            if( base && addr >= base && addr < base + reserved_size )
+            {
+                const size_t offset =
+                    ( addr - base ) & ~( host_page_size - 1 );
+                if( mprotect( base + offset, host_page_size,
+                              PROT_READ | PROT_WRITE ) == 0 )
+                {
+                    return;
+                }
+            }
+        }
+
+        // Not a guest access: let the previous handler deal with it, or
+        // restart the access with the default action, which terminates
+        // the program
+        if( previous_action.sa_flags & SA_SIGINFO )
+        {
+            previous_action.sa_sigaction( sig, info, context );
+        }
+        else if( previous_action.sa_handler != SIG_DFL &&
+                 previous_action.sa_handler != SIG_IGN )
+        {
+            previous_action.sa_handler( sig );
+        }
+        else
+        {
+            signal( sig, SIG_DFL );
+        }
+    }
+
+    // Installs the handler, unless it is installed already. Test
+    // frameworks may have replaced it since the last call.
+    void InstallReservedMemHandler()
+    {
+        struct sigaction current;
+        sigaction( SIGSEGV, 0, &current );
+
+        if( ( current.sa_flags & SA_SIGINFO ) &&
+            current.sa_sigaction == ReservedMemHandler )
+        {
+            return;
+        }
+
+        host_page_size = sysconf( _SC_PAGESIZE );
+
+        struct sigaction action;
+        memset( &action, 0, sizeof( action ) );
+        action.sa_sigaction = ReservedMemHandler;
+        action.sa_flags     = SA_SIGINFO | SA_ONSTACK | SA_NODEFER;
+        sigemptyset( &action.sa_mask );
+        sigaction( SIGSEGV, &action, &previous_action );
+    }
+
+}
+#endif
+
+
+bool arm::ReservedMemAvailable()
+{
+#ifdef ARMV7_RESERVED_MEM
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+arm::reserved_mem::reserved_mem() : base( 0 ), slot( -1 )
+{
+#ifdef ARMV7_RESERVED_MEM
+    void* p = mmap( 0, reserved_size, PROT_NONE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+    if( p == MAP_FAILED )
+    {
+        throw std::bad_alloc();
+    }
+    base = static_cast< uint8_t* >( p );
+
+    InstallReservedMemHandler();
+
+    for( int i = 0; i < slot_count && slot < 0; ++i )
+    {
+        uint8_t* empty = 0;
+        if( slots[i].compare_exchange_strong( empty, base ) )
+        {
+            slot = i;
+        }
+    }
+    if( slot < 0 )
+    {
+        munmap( base, reserved_size );
+        throw std::bad_alloc();
+    }
+#else
+    throw std::bad_alloc();
+#endif
+}
+
+
+arm::reserved_mem::~reserved_mem()
+{
+#ifdef ARMV7_RESERVED_MEM
+    slots[ slot ].store( 0, boost::memory_order_release );
+    munmap( base, reserved_size );
+#endif
+}
+
+
+void arm::reserved_mem::write( uint32_t addr, const void* data,
+                               size_t size )
+{
+    const uint8_t* bytes = static_cast< const uint8_t* >( data );
+
+    // Wrap around the end of the address space
+    while( size > 0 )
+    {
+        const size_t n = std::min( size, size_t( 0xFFFFFFFF - addr ) + 1 );
+        memcpy( base + addr, bytes, n );
+
+        addr  += n;
+        bytes += n;
+        size  -= n;
+    }
+}
+
+
+void arm::reserved_mem::read( uint32_t addr, void* data, size_t size ) const
+{
+    uint8_t* bytes = static_cast< uint8_t* >( data );
+
+    while( size > 0 )
+    {
+        const size_t n = std::min( size, size_t( 0xFFFFFFFF - addr ) + 1 );
+        memcpy( bytes, base + addr, n );
+
+        addr  += n;
+        bytes += n;
+        size  -= n;
+    }
+}
+
+
+void arm::reserved_mem::clear()
+{
+#ifdef ARMV7_RESERVED_MEM
+    // Replacing the mapping releases the committed pages
+    mmap( base, reserved_size, PROT_NONE,
+          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0 );
+#endif
+}
@@ -0,0 +1,324 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file declares memory types covering the whole 32-bit address
+ * space. They provide the read_ and write_ functions expected from
+ * the iMem and dMem members of armv7_core.
+ */
+
+#ifndef __ARMV7_MEMORY_HPP__
+#define __ARMV7_MEMORY_HPP__
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <cstddef>
+
+#if defined( __linux__ ) && \
+    ( defined( __x86_64__ ) || defined( __aarch64__ ) )
+#define ARMV7_RESERVED_MEM 1
+#endif
+
+namespace arm {
+
+
+    /**
+     * Sparse memory of 4 GB made of 4 KB pages, allocated the first
+     * time they are written. Reading a page that was never written
+     * returns zeros without allocating it.
+     *
+     * Pages are found through a two-level table: the upper 10 bits of
+     * an address select a table of 1024 pages, allocated along with
+     * its first page. Tables and pages are allocated with a
+     * compare-and-swap, so that several threads can find and allocate
+     * pages at the same time without a lock.
+     *
+     * Each access width remembers the last page it read and the last
+     * page it wrote in a page_caches, so that consecutive accesses to
+     * the same page skip the table. The read_ and write_ functions
+     * without a page_caches argument use the one of the paged_mem,
+     * and may only be called by one thread at a time. Threads sharing
+     * a paged_mem each pass their own, as shared_mem does for each
+     * core.
+     *
+     * Accesses may be unaligned, and may cross a page boundary. Data
+     * is stored in the byte order of the host. As with host memory,
+     * threads must not write the same bytes at the same time.
+     */
+    class paged_mem : boost::noncopyable
+    {
+    public:
+        enum
+        {
+            PageBits  = 12,
+            PageSize  = 1 << PageBits,
+            PageMask  = PageSize - 1,
+            TableBits = 10,
+            TableSize = 1 << TableBits
+        };
+
+        /**
+         * Last pages accessed by one thread. Pages that were never
+         * written are not remembered, so that a page allocated by
+         * another thread is seen at once. A page_caches filled with
+         * zeros is empty.
+         */
+        class page_caches
+        {
+        public:
+            page_caches();
+
+            /**
+             * Forgets all pages, which is needed after the paged_mem
+             * is cleared.
+             */
+            void reset();
+
+        private:
+            friend class paged_mem;
+
+            struct page_cache
+            {
+                uint32_t tag;   /// Page number plus 1, or 0 if empty
+                uint8_t* page;
+            };
+
+            enum { Dword, Word, Half, Byte, Count };
+
+            page_cache read [ Count ];
+            page_cache write[ Count ];
+        };
+
+        paged_mem();
+        ~paged_mem();
+
+        uint64_t read_dword( uint32_t addr ) const;
+        uint32_t read_word ( uint32_t addr ) const;
+        uint16_t read_half ( uint32_t addr ) const;
+        uint8_t  read_byte ( uint32_t addr ) const;
+
+        void write_dword( uint32_t addr, uint64_t data );
+        void write_word ( uint32_t addr, uint32_t data );
+        void write_half ( uint32_t addr, uint16_t data );
+        void write_byte ( uint32_t addr,  uint8_t data );
+
+        /// Bulk word accesses (see ReadWords())
+        void read_words ( uint32_t addr, uint32_t* data, unsigned int n ) const;
+        void write_words( uint32_t addr, const uint32_t* data, unsigned int n );
+
+        /// The same accesses through the page caches of the caller
+        uint64_t read_dword( uint32_t addr, page_caches& caches ) const;
+        uint32_t read_word ( uint32_t addr, page_caches& caches ) const;
+        uint16_t read_half ( uint32_t addr, page_caches& caches ) const;
+        uint8_t  read_byte ( uint32_t addr, page_caches& caches ) const;
+
+        void write_dword( uint32_t addr, uint64_t data,
+                          page_caches& caches );
+        void write_word ( uint32_t addr, uint32_t data,
+                          page_caches& caches );
+        void write_half ( uint32_t addr, uint16_t data,
+                          page_caches& caches );
+        void write_byte ( uint32_t addr,  uint8_t data,
+                          page_caches& caches );
+
+        void read_words ( uint32_t addr, uint32_t* data, unsigned int n,
+                          page_caches& caches ) const;
+        void write_words( uint32_t addr, const uint32_t* data,
+                          unsigned int n, page_caches& caches );
+
+        /**
+         * Copies "size" bytes from "data" to the memory at "addr",
+         * e.g. to load a program.
+         */
+        void write( uint32_t addr, const void* data, size_t size );
+
+        /**
+         * Copies "size" bytes from the memory at "addr" to "data".
+         */
+        void read( uint32_t addr, void* data, size_t size ) const;
+
+        /**
+         * Frees all pages. The memory then reads as zeros. No other
+         * thread may access the memory meanwhile, and the page caches
+         * of the other threads must then be reset.
+         */
+        void clear();
+
+        /**
+         * Returns the number of pages allocated.
+         */
+        size_t pages() const;
+
+        /**
+         * Returns the host address of the page of "addr", allocating
+         * it if needed. It remains valid until clear() is called.
+         */
+        uint8_t* host_page( uint32_t addr );
+
+    private:
+        typedef page_caches::page_cache page_cache;
+        typedef boost::atomic< uint8_t* > page_entry;
+
+        /**
+         * Returns the page of "addr" for reading, which is the shared
+         * zero page if it was never written.
+         */
+        const uint8_t* read_page( uint32_t addr, page_cache& cache ) const;
+
+        /**
+         * Returns the page of "addr" for writing.
+         */
+        uint8_t* write_page( uint32_t addr, page_cache& cache );
+
+        /// Accesses that may cross a page boundary
+        template< typename data_type >
+        data_type load( uint32_t addr, page_cache& cache ) const;
+
+        template< typename data_type >
+        void store( uint32_t addr, data_type data, page_cache& cache );
+
+        /// read() and write() through "cache"
+        void read_bytes ( uint32_t addr, void* data, size_t size,
+                          page_cache& cache ) const;
+        void write_bytes( uint32_t addr, const void* data, size_t size,
+                          page_cache& cache );
+
+        /// Slow paths of read_page() and write_page()
+        const uint8_t* find_page( uint32_t addr, page_cache& cache ) const;
+        uint8_t*       make_page( uint32_t addr, page_cache& cache );
+
+        boost::atomic< page_entry* > tables[ TableSize ];
+        boost::atomic< size_t >      page_count;
+        mutable page_caches          caches;  /// Of the functions above
+    };
+
+
+    /**
+     * Returns true if reserved_mem can be used on the host, which
+     * needs a 64-bit address space.
+     */
+    bool ReservedMemAvailable();
+
+
+    /**
+     * Memory of 4 GB mapped in one piece in the address space of the
+     * host, so that an access is a single host access at the same
+     * offset, without any table or bounds check.
+     *
+     * The whole range is reserved without access rights. The first
+     * access to a host page, read or write, raises a SIGSEGV which a
+     * handler installed by the constructor catches to commit the page,
+     * filled with zeros, before the access is restarted. Other
+     * segmentation faults are passed to the handler installed before,
+     * so a program that installs its own SIGSEGV handler must chain to
+     * it, or install it before creating a reserved_mem.
+     *
+     * Accesses may be unaligned. An access crossing the end of the
+     * address space reaches a guard page instead of wrapping around.
+     * Data is stored in the byte order of the host. As with host
+     * memory, several threads can access a reserved_mem as long as
+     * they do not write the same bytes at the same time.
+     */
+    class reserved_mem : boost::noncopyable
+    {
+    public:
+        /**
+         * Reserves the memory. Throws std::bad_alloc if the host cannot
+         * reserve it, or if too many reserved_mem exist already.
+         */
+        reserved_mem();
+        ~reserved_mem();
+
+        uint64_t read_dword( uint32_t addr ) const;
+        uint32_t read_word ( uint32_t addr ) const;
+        uint16_t read_half ( uint32_t addr ) const;
+        uint8_t  read_byte ( uint32_t addr ) const;
+
+        void write_dword( uint32_t addr, uint64_t data );
+        void write_word ( uint32_t addr, uint32_t data );
+        void write_half ( uint32_t addr, uint16_t data );
+        void write_byte ( uint32_t addr,  uint8_t data );
+
+        /// Bulk word accesses (see ReadWords())
+        void read_words ( uint32_t addr, uint32_t* data, unsigned int n ) const;
+        void write_words( uint32_t addr, const uint32_t* data, unsigned int n );
+
+        /**
+         * Copies "size" bytes from "data" to the memory at "addr",
+         * e.g. to load a program.
+         */
+        void write( uint32_t addr, const void* data, size_t size );
+
+        /**
+         * Copies "size" bytes from the memory at "addr" to "data".
+         */
+        void read( uint32_t addr, void* data, size_t size ) const;
+
+        /**
+         * Releases all committed pages. The memory then reads as
+         * zeros.
+         */
+        void clear();
+
+        /**
+         * Returns the host address of the 4 KB page of "addr".
+         */
+        uint8_t* host_page( uint32_t addr );
+
+    private:
+        uint8_t* base;  /// Host address of guest address 0
+        int      slot;  /// Index of the reservation for the handler
+    };
+
+
+    /**
+     * Returns the host address of the 4 KB page of "addr" in "mem",
+     * through which it can be read and written directly, or 0 if the
+     * memory type does not have one. Memory types with such pages can
+     * provide their own overload.
+     */
+    template< typename mem_type >
+    uint8_t* HostPage( mem_type& mem, uint32_t addr );
+
+    uint8_t* HostPage( paged_mem& mem, uint32_t addr );
+    uint8_t* HostPage( reserved_mem& mem, uint32_t addr );
+
+
+    /**
+     * Reads "n" consecutive words at "addr" into "data", in order of
+     * increasing addresses, as LDM and LDRD do. Memory types may
+     * provide a read_words() member with the same arguments, which
+     * is then used instead of calling read_word() for each word; it
+     * is detected at compile time.
+     */
+    template< typename mem_type >
+    void ReadWords( mem_type& mem, uint32_t addr, uint32_t* data,
+                    unsigned int n );
+
+    /**
+     * Writes "n" consecutive words from "data" at "addr", through the
+     * write_words() member of the memory type if it has one.
+     */
+    template< typename mem_type >
+    void WriteWords( mem_type& mem, uint32_t addr, const uint32_t* data,
+                     unsigned int n );
+
+
+} // namespace arm
+
+#endif // __ARMV7_MEMORY_HPP__
@@ -0,0 +1,418 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_MEMORY_IMPL_HPP__
+#define __ARMV7_MEMORY_IMPL_HPP__
+
+#include "memory.hpp"
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+inline const uint8_t* arm::paged_mem::read_page( uint32_t addr,
+                                                 page_cache& cache ) const
+{
+    if( cache.tag == ( addr >> PageBits ) + 1 )
+    {
+        return cache.page;
+    }
+    return find_page( addr, cache );
+}
+
+
+inline uint8_t* arm::paged_mem::write_page( uint32_t addr,
+                                            page_cache& cache )
+{
+    if( cache.tag == ( addr >> PageBits ) + 1 )
+    {
+        return cache.page;
+    }
+    return make_page( addr, cache );
+}
+
+
+template< typename data_type >
+inline data_type arm::paged_mem::load( uint32_t addr,
+                                       page_cache& cache ) const
+{
+    data_type data;
+    if( ( addr & PageMask ) <= PageSize - sizeof( data_type ) )
+    {
+        memcpy( &data, read_page( addr, cache ) + ( addr & PageMask ),
+                sizeof( data_type ) );
+    }
+    else
+    {
+        read_bytes( addr, &data, sizeof( data_type ), cache );
+    }
+    return data;
+}
+
+
+template< typename data_type >
+inline void arm::paged_mem::store( uint32_t addr, data_type data,
+                                   page_cache& cache )
+{
+    if( ( addr & PageMask ) <= PageSize - sizeof( data_type ) )
+    {
+        memcpy( write_page( addr, cache ) + ( addr & PageMask ), &data,
+                sizeof( data_type ) );
+    }
+    else
+    {
+        write_bytes( addr, &data, sizeof( data_type ), cache );
+    }
+}
+
+
+inline uint64_t arm::paged_mem::read_dword( uint32_t addr,
+                                            page_caches& caches ) const
+{
+    return load< uint64_t >( addr, caches.read[ page_caches::Dword ] );
+}
+
+
+inline uint32_t arm::paged_mem::read_word( uint32_t addr,
+                                           page_caches& caches ) const
+{
+    return load< uint32_t >( addr, caches.read[ page_caches::Word ] );
+}
+
+
+inline uint16_t arm::paged_mem::read_half( uint32_t addr,
+                                           page_caches& caches ) const
+{
+    return load< uint16_t >( addr, caches.read[ page_caches::Half ] );
+}
+
+
+inline uint8_t arm::paged_mem::read_byte( uint32_t addr,
+                                          page_caches& caches ) const
+{
+    return read_page( addr, caches.read[ page_caches::Byte ] )
+        [ addr & PageMask ];
+}
+
+
+inline void arm::paged_mem::write_dword( uint32_t addr, uint64_t data,
+                                         page_caches& caches )
+{
+    store< uint64_t >( addr, data, caches.write[ page_caches::Dword ] );
+}
+
+
+inline void arm::paged_mem::write_word( uint32_t addr, uint32_t data,
+                                        page_caches& caches )
+{
+    store< uint32_t >( addr, data, caches.write[ page_caches::Word ] );
+}
+
+
+inline void arm::paged_mem::write_half( uint32_t addr, uint16_t data,
+                                        page_caches& caches )
+{
+    store< uint16_t >( addr, data, caches.write[ page_caches::Half ] );
+}
+
+
+inline void arm::paged_mem::write_byte( uint32_t addr, uint8_t data,
+                                        page_caches& caches )
+{
+    write_page( addr, caches.write[ page_caches::Byte ] )
+        [ addr & PageMask ] = data;
+}
+
+
+inline void arm::paged_mem::read_words( uint32_t addr, uint32_t* data,
+                                        unsigned int n,
+                                        page_caches& caches ) const
+{
+    // In 64 bits, since "n" is not bounded
+    if( ( addr & PageMask ) + 4 * uint64_t( n ) <= PageSize )
+    {
+        memcpy( data, read_page( addr, caches.read[ page_caches::Word ] ) +
+                ( addr & PageMask ), 4 * n );
+    }
+    else
+    {
+        read_bytes( addr, data, 4 * size_t( n ),
+                    caches.read[ page_caches::Word ] );
+    }
+}
+
+
+inline void arm::paged_mem::write_words( uint32_t addr,
+                                         const uint32_t* data,
+                                         unsigned int n,
+                                         page_caches& caches )
+{
+    if( ( addr & PageMask ) + 4 * uint64_t( n ) <= PageSize )
+    {
+        memcpy( write_page( addr, caches.write[ page_caches::Word ] ) +
+                ( addr & PageMask ), data, 4 * n );
+    }
+    else
+    {
+        write_bytes( addr, data, 4 * size_t( n ),
+                     caches.write[ page_caches::Word ] );
+    }
+}
+
+
+inline uint64_t arm::paged_mem::read_dword( uint32_t addr ) const
+{
+    return read_dword( addr, caches );
+}
+
+
+inline uint32_t arm::paged_mem::read_word( uint32_t addr ) const
+{
+    return read_word( addr, caches );
+}
+
+
+inline uint16_t arm::paged_mem::read_half( uint32_t addr ) const
+{
+    return read_half( addr, caches );
+}
+
+
+inline uint8_t arm::paged_mem::read_byte( uint32_t addr ) const
+{
+    return read_byte( addr, caches );
+}
+
+
+inline void arm::paged_mem::write_dword( uint32_t addr, uint64_t data )
+{
+    write_dword( addr, data, caches );
+}
+
+
+inline void arm::paged_mem::write_word( uint32_t addr, uint32_t data )
+{
+    write_word( addr, data, caches );
+}
+
+
+inline void arm::paged_mem::write_half( uint32_t addr, uint16_t data )
+{
+    write_half( addr, data, caches );
+}
+
+
+inline void arm::paged_mem::write_byte( uint32_t addr, uint8_t data )
+{
+    write_byte( addr, data, caches );
+}
+
+
+inline void arm::paged_mem::read_words( uint32_t addr, uint32_t* data,
+                                        unsigned int n ) const
+{
+    read_words( addr, data, n, caches );
+}
+
+
+inline void arm::paged_mem::write_words( uint32_t addr,
+                                         const uint32_t* data,
+                                         unsigned int n )
+{
+    write_words( addr, data, n, caches );
+}
+
+
+inline size_t arm::paged_mem::pages() const
+{
+    return page_count.load( boost::memory_order_relaxed );
+}
+
+
+inline uint8_t* arm::paged_mem::host_page( uint32_t addr )
+{
+    return write_page( addr, caches.write[ page_caches::Byte ] );
+}
+
+
+inline uint64_t arm::reserved_mem::read_dword( uint32_t addr ) const
+{
+    uint64_t data;
+    memcpy( &data, base + addr, sizeof( data ) );
+    return data;
+}
+
+
+inline uint32_t arm::reserved_mem::read_word( uint32_t addr ) const
+{
+    uint32_t data;
+    memcpy( &data, base + addr, sizeof( data ) );
+    return data;
+}
+
+
+inline uint16_t arm::reserved_mem::read_half( uint32_t addr ) const
+{
+    uint16_t data;
+    memcpy( &data, base + addr, sizeof( data ) );
+    return data;
+}
+
+
+inline uint8_t arm::reserved_mem::read_byte( uint32_t addr ) const
+{
+    return base[ addr ];
+}
+
+
+inline void arm::reserved_mem::write_dword( uint32_t addr, uint64_t data )
+{
+    memcpy( base + addr, &data, sizeof( data ) );
+}
+
+
+inline void arm::reserved_mem::write_word( uint32_t addr, uint32_t data )
+{
+    memcpy( base + addr, &data, sizeof( data ) );
+}
+
+
+inline void arm::reserved_mem::write_half( uint32_t addr, uint16_t data )
+{
+    memcpy( base + addr, &data, sizeof( data ) );
+}
+
+
+inline void arm::reserved_mem::write_byte( uint32_t addr, uint8_t data )
+{
+    base[ addr ] = data;
+}
+
+
+inline void arm::reserved_mem::read_words( uint32_t addr, uint32_t* data,
+                                           unsigned int n ) const
+{
+    // The copy wraps around the end of the address space
+    if( addr + 4 * uint64_t( n ) <= uint64_t( 1 ) << 32 )
+    {
+        memcpy( data, base + addr, 4 * size_t( n ) );
+    }
+    else
+    {
+        read( addr, data, 4 * size_t( n ) );
+    }
+}
+
+
+inline void arm::reserved_mem::write_words( uint32_t addr,
+                                            const uint32_t* data,
+                                            unsigned int n )
+{
+    if( addr + 4 * uint64_t( n ) <= uint64_t( 1 ) << 32 )
+    {
+        memcpy( base + addr, data, 4 * size_t( n ) );
+    }
+    else
+    {
+        write( addr, data, 4 * size_t( n ) );
+    }
+}
+
+
+inline uint8_t* arm::reserved_mem::host_page( uint32_t addr )
+{
+    return base + ( addr & ~uint32_t( 0xFFF ) );
+}
+
+
+template< typename mem_type >
+inline uint8_t* arm::HostPage( mem_type&, uint32_t )
+{
+    return 0;
+}
+
+
+inline uint8_t* arm::HostPage( paged_mem& mem, uint32_t addr )
+{
+    return mem.host_page( addr );
+}
+
+
+inline uint8_t* arm::HostPage( reserved_mem& mem, uint32_t addr )
+{
+    return mem.host_page( addr );
+}
+
+
+namespace arm {
+    namespace detail {
+
+        // The int argument prefers these overloads, which only exist when
+        // the memory type has bulk accesses, to those taking a long
+        template< typename mem_type >
+        inline auto ReadWords( mem_type& mem, uint32_t addr, uint32_t* data,
+                               unsigned int n, int )
+            -> decltype( mem.read_words( addr, data, n ) )
+        {
+            return mem.read_words( addr, data, n );
+        }
+
+        template< typename mem_type >
+        inline void ReadWords( mem_type& mem, uint32_t addr, uint32_t* data,
+                               unsigned int n, long )
+        {
+            for( unsigned int i = 0; i < n; ++i )
+            {
+                data[i] = mem.read_word( addr + 4 * i );
+            }
+        }
+
+        template< typename mem_type >
+        inline auto WriteWords( mem_type& mem, uint32_t addr,
+                                const uint32_t* data, unsigned int n, int )
+            -> decltype( mem.write_words( addr, data, n ) )
+        {
+            return mem.write_words( addr, data, n );
+        }
+
+        template< typename mem_type >
+        inline void WriteWords( mem_type& mem, uint32_t addr,
+                                const uint32_t* data, unsigned int n, long )
+        {
+            for( unsigned int i = 0; i < n; ++i )
+            {
+                mem.write_word( addr + 4 * i, data[i] );
+            }
+        }
+    }
+}
+
+
+template< typename mem_type >
+inline void arm::ReadWords( mem_type& mem, uint32_t addr, uint32_t* data,
+                            unsigned int n )
+{
+    detail::ReadWords( mem, addr, data, n, 0 );
+}
+
+
+template< typename mem_type >
+inline void arm::WriteWords( mem_type& mem, uint32_t addr,
+                             const uint32_t* data, unsigned int n )
+{
+    detail::WriteWords( mem, addr, data, n, 0 );
+}
+
+#endif // __ARMV7_MEMORY_IMPL_HPP__
@@ -0,0 +1,198 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "mmio.hpp"
+#include "mmio_impl.hpp"
+
+#include <stdexcept>
+
+
+namespace {
+
+    // The device of the unmapped pages
+    uint32_t UnmappedRead( void*, uint32_t, unsigned int )
+    {
+        return 0;
+    }
+
+    void UnmappedWrite( void*, uint32_t, uint32_t, unsigned int )
+    {
+    }
+
+}
+
+
+arm::mmio_bus::page_entry arm::mmio_bus::empty_table[ TableSize ];
+
+
+arm::mmio_bus::mmio_bus()
+{
+    for( size_t t = 0; t < TableSize; ++t )
+    {
+        tables[t] = empty_table;
+    }
+
+    device_entry unmapped;
+    unmapped.device = 0;
+    unmapped.read   = UnmappedRead;
+    unmapped.write  = UnmappedWrite;
+    unmapped.addr   = 0;
+    devices.push_back( unmapped );
+}
+
+
+arm::mmio_bus::~mmio_bus()
+{
+    for( size_t t = 0; t < TableSize; ++t )
+    {
+        if( tables[t] != empty_table )
+        {
+            delete[] tables[t];
+        }
+    }
+}
+
+
+void arm::mmio_bus::map_ram( uint32_t addr, uint32_t size, void* host )
+{
+    check( addr, size );
+
+    uint8_t* data = static_cast< uint8_t* >( host );
+    for( uint64_t offset = 0; offset < size; offset += PageSize )
+    {
+        make( addr + offset ).host = data + offset;
+    }
+}
+
+
+void arm::mmio_bus::map_device( uint32_t addr, uint32_t size, void* device,
+                                read_type read, write_type write )
+{
+    check( addr, size );
+
+    device_entry entry;
+    entry.device = device;
+    entry.read   = read;
+    entry.write  = write;
+    entry.addr   = addr;
+    devices.push_back( entry );
+
+    for( uint64_t offset = 0; offset < size; offset += PageSize )
+    {
+        make( addr + offset ).device = devices.size() - 1;
+    }
+}
+
+
+void arm::mmio_bus::unmap( uint32_t addr, uint32_t size )
+{
+    if( ( addr | size ) & PageMask )
+    {
+        throw std::invalid_argument( "mmio_bus: unaligned range" );
+    }
+
+    // The entries of the devices are kept, as few devices are unmapped
+    for( uint64_t offset = 0; offset < size; offset += PageSize )
+    {
+        const uint32_t page = addr + offset;
+        if( tables[ page >> ( PageBits + TableBits ) ] != empty_table )
+        {
+            page_entry& entry = make( page );
+            entry.host   = 0;
+            entry.device = 0;
+        }
+    }
+}
+
+
+arm::mmio_bus::page_entry& arm::mmio_bus::make( uint32_t addr )
+{
+    page_entry*& table = tables[ addr >> ( PageBits + TableBits ) ];
+    if( table == empty_table )
+    {
+        table = new page_entry[ TableSize ]();
+    }
+    return table[ ( addr >> PageBits ) & ( TableSize - 1 ) ];
+}
+
+
+void arm::mmio_bus::check( uint32_t addr, uint32_t size )
+{
+    if( ( ( addr | size ) & PageMask ) || size == 0 ||
+        uint64_t( addr ) + size > uint64_t( 1 ) << 32 )
+    {
+        throw std::invalid_argument( "mmio_bus: invalid range" );
+    }
+
+    for( uint64_t offset = 0; offset < size; offset += PageSize )
+    {
+        const page_entry& entry = find( addr + offset );
+        if( entry.host || entry.device )
+        {
+            throw std::invalid_argument( "mmio_bus: range mapped already" );
+        }
+    }
+}
+
+
+uint32_t arm::mmio_bus::read_slow( uint32_t addr, unsigned int size ) const
+{
+    uint32_t data = 0;
+
+    if( ( addr & PageMask ) > PageSize - size )
+    {
+        for( unsigned int i = 0; i < size; ++i )
+        {
+            data |= uint32_t( read_byte( addr + i ) ) << ( 8 * i );
+        }
+        return data;
+    }
+
+    const page_entry& page = find( addr );
+    if( page.host )
+    {
+        // Half of a doubleword
+        memcpy( &data, page.host + ( addr & PageMask ), size );
+        return data;
+    }
+
+    const device_entry& device = devices[ page.device ];
+    return device.read( device.device, addr - device.addr, size );
+}
+
+
+void arm::mmio_bus::write_slow( uint32_t addr, uint32_t data,
+                                unsigned int size )
+{
+    if( ( addr & PageMask ) > PageSize - size )
+    {
+        for( unsigned int i = 0; i < size; ++i )
+        {
+            write_byte( addr + i, uint8_t( data >> ( 8 * i ) ) );
+        }
+        return;
+    }
+
+    const page_entry& page = find( addr );
+    if( page.host )
+    {
+        memcpy( page.host + ( addr & PageMask ), &data, size );
+        return;
+    }
+
+    const device_entry& device = devices[ page.device ];
+    device.write( device.device, addr - device.addr, data, size );
+}
@@ -0,0 +1,168 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file declares a memory type dispatching accesses to RAM and to
+ * memory-mapped devices, as the bus of a system on chip does.
+ */
+
+#ifndef __ARMV7_MMIO_HPP__
+#define __ARMV7_MMIO_HPP__
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <vector>
+
+namespace arm {
+
+
+    /**
+     * Memory of 4 GB made of 4 KB pages, each of which is RAM held in
+     * host memory, a range of a device, or unmapped.
+     *
+     * The page of an address is found through a two-level table
+     * indexed by its upper 20 bits, whatever the number of devices: a
+     * RAM page holds the host address of its data, which is accessed
+     * directly, and a device page holds the device called for the
+     * access. Unmapped pages read as zeros and ignore writes.
+     *
+     * Devices are called with the offset of the access from the start
+     * of their range, and its size in bytes: 1, 2 or 4. A doubleword
+     * access is made of two word accesses, the lower address first,
+     * and an access crossing a page boundary is made of byte accesses.
+     *
+     * Ranges are mapped and unmapped between runs, not during
+     * accesses. RAM pages can be accessed by several threads as host
+     * memory is; devices are called on the thread of the access.
+     */
+    class mmio_bus : boost::noncopyable
+    {
+    public:
+        enum
+        {
+            PageBits  = 12,
+            PageSize  = 1 << PageBits,
+            PageMask  = PageSize - 1,
+            TableBits = 10,
+            TableSize = 1 << TableBits
+        };
+
+        /// Reads "size" bytes of "device" at "offset"
+        typedef uint32_t ( *read_type )( void* device, uint32_t offset,
+                                         unsigned int size );
+
+        /// Writes the "size" lower bytes of "data" to "device"
+        typedef void ( *write_type )( void* device, uint32_t offset,
+                                      uint32_t data, unsigned int size );
+
+        mmio_bus();
+        ~mmio_bus();
+
+        /**
+         * Maps the "size" bytes at "host" as RAM at "addr". The host
+         * memory is not copied, and must outlive the mapping.
+         *
+         * This and map_device() throw std::invalid_argument if "addr"
+         * or "size" is not a multiple of PageSize, if the range is
+         * empty or wraps around, or if a page of it is mapped already.
+         */
+        void map_ram( uint32_t addr, uint32_t size, void* host );
+
+        /**
+         * Maps "device" at "addr", accessed through "read" and "write".
+         */
+        void map_device( uint32_t addr, uint32_t size, void* device,
+                         read_type read, write_type write );
+
+        /**
+         * Unmaps the pages of [addr, addr + size), which must be
+         * multiples of PageSize.
+         */
+        void unmap( uint32_t addr, uint32_t size );
+
+        uint64_t read_dword( uint32_t addr ) const;
+        uint32_t read_word ( uint32_t addr ) const;
+        uint16_t read_half ( uint32_t addr ) const;
+        uint8_t  read_byte ( uint32_t addr ) const;
+
+        void write_dword( uint32_t addr, uint64_t data );
+        void write_word ( uint32_t addr, uint32_t data );
+        void write_half ( uint32_t addr, uint16_t data );
+        void write_byte ( uint32_t addr,  uint8_t data );
+
+        /// Bulk word accesses (see ReadWords())
+        void read_words ( uint32_t addr, uint32_t* data, unsigned int n ) const;
+        void write_words( uint32_t addr, const uint32_t* data, unsigned int n );
+
+        /**
+         * Returns the host address of the RAM page of "addr", or 0 if
+         * it is not RAM.
+         */
+        uint8_t* host_page( uint32_t addr ) const;
+
+    private:
+        struct page_entry
+        {
+            uint8_t*     host;    /// Data of a RAM page, or 0
+            unsigned int device;  /// Index in "devices" otherwise
+        };
+
+        struct device_entry
+        {
+            void*      device;
+            read_type  read;
+            write_type write;
+            uint32_t   addr;      /// Start of its range
+        };
+
+        const page_entry& find( uint32_t addr ) const;
+
+        /// Makes the table of "addr" writable, and returns its entry
+        page_entry& make( uint32_t addr );
+
+        /// Checks a range to map, see map_ram()
+        void check( uint32_t addr, uint32_t size );
+
+        /// RAM accesses within a page
+        template< typename data_type >
+        bool load( uint32_t addr, data_type& data ) const;
+
+        template< typename data_type >
+        bool store( uint32_t addr, data_type data );
+
+        /// Device, unmapped and page-crossing accesses
+        uint32_t read_slow ( uint32_t addr, unsigned int size ) const;
+        void     write_slow( uint32_t addr, uint32_t data,
+                             unsigned int size );
+
+        /// Tables without any mapped page are the shared empty table
+        static page_entry empty_table[ TableSize ];
+
+        page_entry*                 tables[ TableSize ];
+        std::vector< device_entry > devices;  /// The first is unmapped
+    };
+
+
+    /**
+     * Returns the RAM page of "addr", or 0 for devices (see memory.hpp).
+     */
+    uint8_t* HostPage( mmio_bus& mem, uint32_t addr );
+
+
+} // namespace arm
+
+#endif // __ARMV7_MMIO_HPP__
@@ -0,0 +1,179 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_MMIO_IMPL_HPP__
+#define __ARMV7_MMIO_IMPL_HPP__
+
+#include "mmio.hpp"
+#include "types.hpp"
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+inline const arm::mmio_bus::page_entry&
+arm::mmio_bus::find( uint32_t addr ) const
+{
+    return tables[ addr >> ( PageBits + TableBits ) ]
+                 [ ( addr >> PageBits ) & ( TableSize - 1 ) ];
+}
+
+
+template< typename data_type >
+inline bool arm::mmio_bus::load( uint32_t addr, data_type& data ) const
+{
+    const page_entry& page = find( addr );
+    if( ARMV7_LIKELY( page.host != 0 ) &&
+        ( addr & PageMask ) <= PageSize - sizeof( data_type ) )
+    {
+        memcpy( &data, page.host + ( addr & PageMask ), sizeof( data ) );
+        return true;
+    }
+    return false;
+}
+
+
+template< typename data_type >
+inline bool arm::mmio_bus::store( uint32_t addr, data_type data )
+{
+    const page_entry& page = find( addr );
+    if( ARMV7_LIKELY( page.host != 0 ) &&
+        ( addr & PageMask ) <= PageSize - sizeof( data_type ) )
+    {
+        memcpy( page.host + ( addr & PageMask ), &data, sizeof( data ) );
+        return true;
+    }
+    return false;
+}
+
+
+inline uint64_t arm::mmio_bus::read_dword( uint32_t addr ) const
+{
+    uint64_t data;
+    if( load( addr, data ) )
+    {
+        return data;
+    }
+    return read_slow( addr, 4 ) |
+           uint64_t( read_slow( addr + 4, 4 ) ) << 32;
+}
+
+
+inline uint32_t arm::mmio_bus::read_word( uint32_t addr ) const
+{
+    uint32_t data;
+    return load( addr, data ) ? data : read_slow( addr, 4 );
+}
+
+
+inline uint16_t arm::mmio_bus::read_half( uint32_t addr ) const
+{
+    uint16_t data;
+    return load( addr, data ) ? data : read_slow( addr, 2 );
+}
+
+
+inline uint8_t arm::mmio_bus::read_byte( uint32_t addr ) const
+{
+    uint8_t data;
+    return load( addr, data ) ? data : read_slow( addr, 1 );
+}
+
+
+inline void arm::mmio_bus::write_dword( uint32_t addr, uint64_t data )
+{
+    if( !store( addr, data ) )
+    {
+        write_slow( addr,     uint32_t( data ),       4 );
+        write_slow( addr + 4, uint32_t( data >> 32 ), 4 );
+    }
+}
+
+
+inline void arm::mmio_bus::write_word( uint32_t addr, uint32_t data )
+{
+    if( !store( addr, data ) )
+    {
+        write_slow( addr, data, 4 );
+    }
+}
+
+
+inline void arm::mmio_bus::write_half( uint32_t addr, uint16_t data )
+{
+    if( !store( addr, data ) )
+    {
+        write_slow( addr, data, 2 );
+    }
+}
+
+
+inline void arm::mmio_bus::write_byte( uint32_t addr, uint8_t data )
+{
+    if( !store( addr, data ) )
+    {
+        write_slow( addr, data, 1 );
+    }
+}
+
+
+inline void arm::mmio_bus::read_words( uint32_t addr, uint32_t* data,
+                                       unsigned int n ) const
+{
+    const page_entry& page = find( addr );
+    if( page.host && ( addr & PageMask ) + 4 * uint64_t( n ) <= PageSize )
+    {
+        memcpy( data, page.host + ( addr & PageMask ), 4 * n );
+    }
+    else
+    {
+        for( unsigned int i = 0; i < n; ++i )
+        {
+            data[i] = read_word( addr + 4 * i );
+        }
+    }
+}
+
+
+inline void arm::mmio_bus::write_words( uint32_t addr, const uint32_t* data,
+                                        unsigned int n )
+{
+    const page_entry& page = find( addr );
+    if( page.host && ( addr & PageMask ) + 4 * uint64_t( n ) <= PageSize )
+    {
+        memcpy( page.host + ( addr & PageMask ), data, 4 * n );
+    }
+    else
+    {
+        for( unsigned int i = 0; i < n; ++i )
+        {
+            write_word( addr + 4 * i, data[i] );
+        }
+    }
+}
+
+
+inline uint8_t* arm::mmio_bus::host_page( uint32_t addr ) const
+{
+    return find( addr ).host;
+}
+
+
+inline uint8_t* arm::HostPage( mmio_bus& mem, uint32_t addr )
+{
+    return mem.host_page( addr );
+}
+
+#endif // __ARMV7_MMIO_IMPL_HPP__
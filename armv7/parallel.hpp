@@ -0,0 +1,136 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file declares the lane operations of the parallel addition
+ * and subtraction instructions (A4.4.3, p.160), SEL and USAD8. They
+ * work on all the 8-bit or 16-bit lanes of a word at once, with a few
+ * 32-bit operations that do not let carries cross lanes. "width" is
+ * the lane width, 8 or 16.
+ */
+
+#ifndef __ARMV7_PARALLEL_HPP__
+#define __ARMV7_PARALLEL_HPP__
+
+#include <boost/cstdint.hpp>
+
+namespace arm {
+
+
+    /**
+     * Returns the top bit of each lane.
+     */
+    template< int width >
+    constexpr uint32_t LaneSigns();
+
+
+    /**
+     * Sets all the bits of the lanes whose top bit is set in "signs".
+     */
+    template< int width >
+    constexpr uint32_t LaneMask( uint32_t signs );
+
+
+    /**
+     * Lane-wise a + b and a - b, modulo 2^width.
+     */
+    template< int width >
+    constexpr uint32_t ParallelAdd( uint32_t a, uint32_t b );
+
+    template< int width >
+    constexpr uint32_t ParallelSub( uint32_t a, uint32_t b );
+
+
+    /**
+     * Lane-wise ( a + b ) / 2 and ( a - b ) / 2, rounded down, of
+     * unsigned lanes (UHADD, UHSUB). The top bit of each lane of the
+     * halved sum is the carry of a + b, and that of the halved
+     * difference is set if a < b.
+     */
+    template< int width >
+    constexpr uint32_t ParallelHalvingAdd( uint32_t a, uint32_t b );
+
+    template< int width >
+    constexpr uint32_t ParallelHalvingSub( uint32_t a, uint32_t b );
+
+
+    /**
+     * Lane-wise ( a + b ) / 2 and ( a - b ) / 2, rounded down, of
+     * signed lanes (SHADD, SHSUB). The top bit of each lane is the
+     * sign of the unhalved result.
+     */
+    template< int width >
+    constexpr uint32_t ParallelSignedHalvingAdd( uint32_t a, uint32_t b );
+
+    template< int width >
+    constexpr uint32_t ParallelSignedHalvingSub( uint32_t a, uint32_t b );
+
+
+    /**
+     * Lane-wise a + b and a - b, saturated to signed lanes (QADD,
+     * QSUB).
+     */
+    template< int width >
+    constexpr uint32_t ParallelSatAdd( uint32_t a, uint32_t b );
+
+    template< int width >
+    constexpr uint32_t ParallelSatSub( uint32_t a, uint32_t b );
+
+
+    /**
+     * Lane-wise a + b and a - b, saturated to unsigned lanes (UQADD,
+     * UQSUB).
+     */
+    template< int width >
+    constexpr uint32_t ParallelUnsignedSatAdd( uint32_t a, uint32_t b );
+
+    template< int width >
+    constexpr uint32_t ParallelUnsignedSatSub( uint32_t a, uint32_t b );
+
+
+    /**
+     * Returns the APSR.GE bits of the lanes whose top bit is set in
+     * "signs": one bit per 8-bit lane, two per 16-bit lane.
+     */
+    template< int width >
+    constexpr uint32_t GEFromSigns( uint32_t signs );
+
+
+    /**
+     * Returns the low halfword of "low" and the high halfword of
+     * "high", for the ASX and SAX forms.
+     */
+    constexpr uint32_t MergeHalfwords( uint32_t low, uint32_t high );
+
+
+    /**
+     * Returns a mask of the bytes selected by the APSR.GE bits, as
+     * SEL uses them.
+     */
+    constexpr uint32_t GEByteMask( uint32_t ge );
+
+
+    /**
+     * Returns the sum of the absolute differences of the unsigned
+     * bytes of a and b (USAD8).
+     */
+    constexpr uint32_t SumAbsDiff8( uint32_t a, uint32_t b );
+
+
+} // namespace arm
+
+#endif // __ARMV7_PARALLEL_HPP__
@@ -0,0 +1,174 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_PARALLEL_IMPL_HPP__
+#define __ARMV7_PARALLEL_IMPL_HPP__
+
+#include "parallel.hpp"
+#include <boost/static_assert.hpp>
+
+
+template< int width >
+constexpr uint32_t arm::LaneSigns()
+{
+    BOOST_STATIC_ASSERT( width == 8 || width == 16 );
+    return width == 8 ? 0x80808080 : 0x80008000;
+}
+
+
+template< int width >
+constexpr uint32_t arm::LaneMask( uint32_t signs )
+{
+    return ( ( signs & LaneSigns< width >() ) >> ( width - 1 ) ) *
+           ( ( 1u << width ) - 1 );
+}
+
+
+// The top bits are left out of the sum so that no carry leaves a
+// lane, then set from the operands and the carry into them.
+template< int width >
+constexpr uint32_t arm::ParallelAdd( uint32_t a, uint32_t b )
+{
+    const uint32_t h = LaneSigns< width >();
+    return ( ( a & ~h ) + ( b & ~h ) ) ^ ( ( a ^ b ) & h );
+}
+
+
+// Likewise, setting the top bits of a so that no borrow leaves a lane
+template< int width >
+constexpr uint32_t arm::ParallelSub( uint32_t a, uint32_t b )
+{
+    const uint32_t h = LaneSigns< width >();
+    return ( ( a | h ) - ( b & ~h ) ) ^ ( ( a ^ ~b ) & h );
+}
+
+
+// a + b == 2 * ( a & b ) + ( a ^ b ), and the halved sum fits its lane
+template< int width >
+constexpr uint32_t arm::ParallelHalvingAdd( uint32_t a, uint32_t b )
+{
+    return ( a & b ) + ( ( ( a ^ b ) >> 1 ) & ~LaneSigns< width >() );
+}
+
+
+// a - b == ( a ^ b ) - 2 * ( ~a & b )
+template< int width >
+constexpr uint32_t arm::ParallelHalvingSub( uint32_t a, uint32_t b )
+{
+    return ParallelSub< width >( ( ( a ^ b ) >> 1 ) & ~LaneSigns< width >(),
+                                 ~a & b );
+}
+
+
+// Reading a lane as signed subtracts 2^width from it if its top bit is
+// set, which changes the halved result by 2^(width-1) if exactly one
+// of the top bits is set.
+template< int width >
+constexpr uint32_t arm::ParallelSignedHalvingAdd( uint32_t a, uint32_t b )
+{
+    return ParallelHalvingAdd< width >( a, b ) ^
+           ( ( a ^ b ) & LaneSigns< width >() );
+}
+
+
+template< int width >
+constexpr uint32_t arm::ParallelSignedHalvingSub( uint32_t a, uint32_t b )
+{
+    return ParallelHalvingSub< width >( a, b ) ^
+           ( ( a ^ b ) & LaneSigns< width >() );
+}
+
+
+// A lane overflows if the sign of its result is not the sign of the
+// exact one. It is then set to the largest positive value plus 1 if
+// the exact result is negative.
+template< int width >
+constexpr uint32_t arm::ParallelSatAdd( uint32_t a, uint32_t b )
+{
+    const uint32_t h     = LaneSigns< width >();
+    const uint32_t sum   = ParallelAdd< width >( a, b );
+    const uint32_t sign  = ParallelSignedHalvingAdd< width >( a, b ) & h;
+    const uint32_t mask  = LaneMask< width >( sum ^ sign );
+    const uint32_t limit = ~h + ( sign >> ( width - 1 ) );
+    return ( sum & ~mask ) | ( limit & mask );
+}
+
+
+template< int width >
+constexpr uint32_t arm::ParallelSatSub( uint32_t a, uint32_t b )
+{
+    const uint32_t h     = LaneSigns< width >();
+    const uint32_t diff  = ParallelSub< width >( a, b );
+    const uint32_t sign  = ParallelSignedHalvingSub< width >( a, b ) & h;
+    const uint32_t mask  = LaneMask< width >( diff ^ sign );
+    const uint32_t limit = ~h + ( sign >> ( width - 1 ) );
+    return ( diff & ~mask ) | ( limit & mask );
+}
+
+
+template< int width >
+constexpr uint32_t arm::ParallelUnsignedSatAdd( uint32_t a, uint32_t b )
+{
+    return ParallelAdd< width >( a, b ) |
+           LaneMask< width >( ParallelHalvingAdd< width >( a, b ) );
+}
+
+
+template< int width >
+constexpr uint32_t arm::ParallelUnsignedSatSub( uint32_t a, uint32_t b )
+{
+    return ParallelSub< width >( a, b ) &
+           ~LaneMask< width >( ParallelHalvingSub< width >( a, b ) );
+}
+
+
+// The multiplication gathers bits 0, 8, 16 and 24 into bits 21 to 24
+// without carries.
+template< int width >
+constexpr uint32_t arm::GEFromSigns( uint32_t signs )
+{
+    return ( ( ( ( LaneMask< width >( signs ) & 0x80808080 ) >> 7 ) *
+               0x00204081 ) >> 21 ) & 0xF;
+}
+
+
+constexpr uint32_t arm::MergeHalfwords( uint32_t low, uint32_t high )
+{
+    return ( low & 0x0000FFFF ) | ( high & 0xFFFF0000 );
+}
+
+
+// The inverse of GEFromSigns(): bits 0 to 3 are spread to bits 0, 8,
+// 16 and 24.
+constexpr uint32_t arm::GEByteMask( uint32_t ge )
+{
+    return ( ( ( ge & 0xF ) * 0x00204081 ) & 0x01010101 ) * 0xFF;
+}
+
+
+// The differences of the lanes where a < b are negated, then the
+// bytes are summed in pairs.
+constexpr uint32_t arm::SumAbsDiff8( uint32_t a, uint32_t b )
+{
+    const uint32_t less  = LaneMask< 8 >( ParallelHalvingSub< 8 >( a, b ) );
+    const uint32_t diff  = ParallelSub< 8 >( ParallelSub< 8 >( a, b ) ^ less,
+                                             less );
+    const uint32_t pairs = ( diff & 0x00FF00FF ) +
+                           ( ( diff >> 8 ) & 0x00FF00FF );
+    return ( pairs + ( pairs >> 16 ) ) & 0xFFFF;
+}
+
+#endif // __ARMV7_PARALLEL_IMPL_HPP__
@@ -0,0 +1,154 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "predecode.hpp"
+#include "function.hpp"
+#include "function_impl.hpp"
+
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    // Data-processing (immediate): cond 001 opcode S Rn Rd imm12
+    void PredecodeDataImm( arm::Predecoded& p )
+    {
+        const uint32_t imm12 = arm::Bits< 11, 0 >( p.instr );
+
+        p.setflags     = arm::Bits< 20, 20 >( p.instr ) == 1;
+        p.n            = arm::Bits< 19, 16 >( p.instr );
+        p.d            = arm::Bits< 15, 12 >( p.instr );
+        p.imm32        = arm::ARMExpandImm_C( imm12, false ).value;
+        p.imm_carry[0] = arm::ARMExpandImm_C( imm12, false ).carry;
+        p.imm_carry[1] = arm::ARMExpandImm_C( imm12, true  ).carry;
+        p.simple       = p.d != 15;
+    }
+
+    // Data-processing (register): cond 000 opcode S Rn Rd imm5 type 0 Rm
+    void PredecodeDataReg( arm::Predecoded& p )
+    {
+        const arm::ShiftUValue s_ =
+            arm::DecodeImmShift( arm::Bits< 6, 5 >( p.instr ),
+                                 arm::Bits< 11, 7 >( p.instr ) );
+
+        p.setflags = arm::Bits< 20, 20 >( p.instr ) == 1;
+        p.n        = arm::Bits< 19, 16 >( p.instr );
+        p.d        = arm::Bits< 15, 12 >( p.instr );
+        p.m        = arm::Bits<  3,  0 >( p.instr );
+        p.shift_t  = s_.shift_t;
+        p.shift_n  = s_.shift_n;
+        p.simple   = p.d != 15;
+    }
+
+    // Load/store (immediate): cond 010 P U 0 W L Rn Rt imm12
+    void PredecodeLoadStoreImm( arm::Predecoded& p, bool store )
+    {
+        const uint32_t P = arm::Bits< 24, 24 >( p.instr );
+        const uint32_t W = arm::Bits< 21, 21 >( p.instr );
+
+        p.n     = arm::Bits< 19, 16 >( p.instr );
+        p.d     = arm::Bits< 15, 12 >( p.instr );
+        p.imm32 = arm::Bits< 11,  0 >( p.instr );
+        p.index = P == 1;
+        p.add   = arm::Bits< 23, 23 >( p.instr ) == 1;
+        p.wback = P == 0 || W == 1;
+
+        // Unprivileged forms, literal forms, PC destinations and
+        // UNPREDICTABLE writebacks are left to the full behavior
+        // function.
+        p.simple = !( P == 0 && W == 1 ) && p.d != 15 && p.n != 15 &&
+                   !( p.wback && p.n == p.d ) &&
+                   !( store && p.n == 13 && P == 1 && W == 1 &&
+                      !p.add && p.imm32 == 4 ) &&
+                   !( !store && p.n == 13 && P == 0 && W == 0 &&
+                      p.add && p.imm32 == 4 );
+    }
+
+    // Branch: cond 101 L imm24
+    void PredecodeBranch( arm::Predecoded& p )
+    {
+        const uint32_t imm24 = arm::Bits< 23, 0 >( p.instr );
+
+        p.imm32  = (uint32_t)arm::SignExtend( (imm24 << 2), 32, 26 );
+        p.simple = true;
+    }
+
+} // namespace
+
+
+arm::Predecoded arm::Predecode( uint32_t instr )
+{
+    Predecoded p;
+    memset( &p, 0, sizeof( p ) );
+
+    p.instr    = instr;
+    p.encoding = DecodeEncoding( instr );
+    p.cond     = CurrentCond( instr );
+    p.shift_t  = SRType_LSL;
+
+    switch( p.encoding )
+    {
+    case Encoding_ADD_imm_A1:
+    case Encoding_SUB_imm_A1:
+    case Encoding_AND_imm_A1:
+    case Encoding_ORR_imm_A1:
+    case Encoding_EOR_imm_A1:
+    case Encoding_BIC_imm_A1:
+    case Encoding_MOV_imm_A1:
+    case Encoding_MVN_imm_A1:
+    case Encoding_CMP_imm_A1:
+    case Encoding_CMN_imm_A1:
+    case Encoding_TST_imm_A1:
+    case Encoding_TEQ_imm_A1:
+        PredecodeDataImm( p );
+        break;
+
+    case Encoding_ADD_reg_A1:
+    case Encoding_SUB_reg_A1:
+    case Encoding_AND_reg_A1:
+    case Encoding_ORR_reg_A1:
+    case Encoding_EOR_reg_A1:
+    case Encoding_BIC_reg_A1:
+    case Encoding_MOV_reg_A1:
+    case Encoding_CMP_reg_A1:
+    case Encoding_CMN_reg_A1:
+    case Encoding_TST_reg_A1:
+    case Encoding_TEQ_reg_A1:
+        PredecodeDataReg( p );
+        break;
+
+    case Encoding_LDR_imm_A1:
+    case Encoding_LDRB_imm_A1:
+        PredecodeLoadStoreImm( p, false );
+        break;
+
+    case Encoding_STR_imm_A1:
+    case Encoding_STRB_imm_A1:
+        PredecodeLoadStoreImm( p, true );
+        break;
+
+    case Encoding_B_A1:
+    case Encoding_BL_A1:
+        PredecodeBranch( p );
+        break;
+
+    default:
+        break;
+    }
+
+    return p;
+}
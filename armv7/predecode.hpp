@@ -0,0 +1,257 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file defines a predecoded form of ARM instructions. Operand
+ * fields are extracted once per static instruction and cached by
+ * address, so that executing the same instruction again does not
+ * extract them from the instruction word again.
+ */
+
+#ifndef __ARMV7_PREDECODE_HPP__
+#define __ARMV7_PREDECODE_HPP__
+
+#include "decoder.hpp"
+#include "types.hpp"
+#include <boost/cstdint.hpp>
+
+/*
+ * Encodings that have a behavior function working on predecoded
+ * fields. All other encodings are executed from the instruction word.
+ */
+
+#define ARMV7_PREDECODED_ENCODINGS( X )                                 \
+    X( ADD_imm_A1 ) X( ADD_reg_A1 )                                     \
+    X( SUB_imm_A1 ) X( SUB_reg_A1 )                                     \
+    X( AND_imm_A1 ) X( AND_reg_A1 )                                     \
+    X( ORR_imm_A1 ) X( ORR_reg_A1 )                                     \
+    X( EOR_imm_A1 ) X( EOR_reg_A1 )                                     \
+    X( BIC_imm_A1 ) X( BIC_reg_A1 )                                     \
+    X( MOV_imm_A1 ) X( MOV_reg_A1 )                                     \
+    X( MVN_imm_A1 )                                                     \
+    X( CMP_imm_A1 ) X( CMP_reg_A1 )                                     \
+    X( CMN_imm_A1 ) X( CMN_reg_A1 )                                     \
+    X( TST_imm_A1 ) X( TST_reg_A1 )                                     \
+    X( TEQ_imm_A1 ) X( TEQ_reg_A1 )                                     \
+    X( LDR_imm_A1 ) X( LDRB_imm_A1 )                                    \
+    X( STR_imm_A1 ) X( STRB_imm_A1 )                                    \
+    X( B_A1 )       X( BL_A1 )
+
+namespace arm {
+
+
+    /**
+     * Operand fields of an instruction, extracted by Predecode().
+     * Fields that do not apply to the encoding are zero.
+     */
+    struct Predecoded
+    {
+        uint32_t instr;        /// Instruction word
+        Encoding encoding;     /// Encoding identifier
+        uint8_t  cond;         /// Condition, bits [31:28]
+
+        /// True if the encoding is in ARMV7_PREDECODED_ENCODINGS and
+        /// none of its special cases (PC destination, UNPREDICTABLE
+        /// operands) apply, so that the predecoded behavior function
+        /// can be used.
+        bool     simple;
+
+        uint8_t  n;            /// Rn
+        uint8_t  d;            /// Rd, or Rt for loads and stores
+        uint8_t  m;            /// Rm
+        bool     setflags;     /// S bit
+
+        /// Expanded immediate (ARMExpandImm(), ZeroExtend() of imm12 or
+        /// sign-extended branch offset)
+        uint32_t imm32;
+
+        /// Carry out of ARMExpandImm_C() for a carry in of 0 and 1
+        bool     imm_carry[2];
+
+        SRType   shift_t;      /// Decoded immediate shift type
+        uint32_t shift_n;      /// Decoded immediate shift amount
+
+        bool     index;        /// P bit of loads and stores
+        bool     add;          /// U bit of loads and stores
+        bool     wback;        /// Base register writeback
+    };
+
+
+    /**
+     * Extracts the operand fields of an ARM instruction.
+     */
+    Predecoded Predecode( uint32_t instr );
+
+
+    /**
+     * Predecoded instruction along with the behavior function that
+     * executes it.
+     */
+    template< typename proc_type >
+    struct predecoded_instr : Predecoded
+    {
+        typedef void ( *exec_type )( proc_type&, const Predecoded& );
+
+        exec_type exec;        /// Behavior function
+        uint32_t  address;     /// Address of the instruction
+    };
+
+
+    /**
+     * Predecodes an instruction and selects the behavior function
+     * that executes it.
+     */
+    template< typename proc_type >
+    predecoded_instr< proc_type > PredecodeInstr( uint32_t instr );
+
+
+    /**
+     * Executes a predecoded instruction through the behavior function
+     * taking the instruction word. Used for encodings that have no
+     * predecoded behavior function.
+     */
+    template< typename proc_type >
+    void ExecuteInstrWord( proc_type& proc, const Predecoded& p );
+
+
+    /**
+     * Direct-mapped cache of predecoded instructions, indexed by
+     * address. Instructions are fetched from proc.iMem on a miss.
+     * Entries must be invalidated by the client when the instruction
+     * memory is modified.
+     */
+    template< typename proc_type, unsigned int size_log2 = 12 >
+    struct predecode_cache
+    {
+        predecode_cache();
+
+        /**
+         * Returns the predecoded instruction at address "pc".
+         */
+        const predecoded_instr< proc_type >& lookup( proc_type& proc,
+                                                     uint32_t pc );
+
+        /**
+         * Drops the entry for address "pc", if any.
+         */
+        void invalidate( uint32_t pc );
+
+        /**
+         * Drops all entries.
+         */
+        void flush();
+
+        predecoded_instr< proc_type > entries[ 1 << size_log2 ];
+    };
+
+
+    /*
+     * Behavior functions working on predecoded fields. They must only
+     * be called when Predecoded::simple is true.
+     */
+
+    template< typename proc_type >
+    void ADD_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void ADD_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void SUB_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void SUB_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void AND_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void AND_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void ORR_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void ORR_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void EOR_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void EOR_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void BIC_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void BIC_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void MOV_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void MOV_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void MVN_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void CMP_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void CMP_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void CMN_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void CMN_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void TST_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void TST_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void TEQ_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void TEQ_reg_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void LDR_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void LDRB_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void STR_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void STRB_imm_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void B_A1( proc_type& proc, const Predecoded& p );
+
+    template< typename proc_type >
+    void BL_A1( proc_type& proc, const Predecoded& p );
+
+
+} // namespace arm
+
+#endif // __ARMV7_PREDECODE_HPP__
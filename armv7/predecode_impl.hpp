@@ -0,0 +1,656 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_PREDECODE_IMPL_HPP__
+#define __ARMV7_PREDECODE_IMPL_HPP__
+
+#include "predecode.hpp"
+#include "decoder_impl.hpp"
+#include "endian_impl.hpp"
+#include "function.hpp"
+#include "instruction.hpp"
+#include <boost/cstdint.hpp>
+
+
+template< typename proc_type >
+arm::predecoded_instr< proc_type > arm::PredecodeInstr( uint32_t instr )
+{
+    predecoded_instr< proc_type > result;
+    static_cast< Predecoded& >( result ) = Predecode( instr );
+    result.exec    = &arm::ExecuteInstrWord< proc_type >;
+    result.address = 0;
+
+    if( result.simple )
+    {
+        switch( result.encoding )
+        {
+#define ARMV7_PREDECODED_CASE( name )                                   \
+        case Encoding_##name:                                           \
+            result.exec = &arm::name< proc_type >;                      \
+            break;
+        ARMV7_PREDECODED_ENCODINGS( ARMV7_PREDECODED_CASE )
+#undef ARMV7_PREDECODED_CASE
+
+        default:
+            break;
+        }
+    }
+
+    return result;
+}
+
+
+template< typename proc_type >
+void arm::ExecuteInstrWord( proc_type& proc, const Predecoded& p )
+{
+    typename DecodeResult< proc_type >::handler_type handler =
+        EncodingHandlers< proc_type >()[ p.encoding ];
+
+    if( handler )
+    {
+        handler( proc, p.instr );
+    }
+}
+
+
+template< typename proc_type, unsigned int size_log2 >
+arm::predecode_cache< proc_type, size_log2 >::predecode_cache()
+{
+    flush();
+}
+
+
+template< typename proc_type, unsigned int size_log2 >
+const arm::predecoded_instr< proc_type >&
+arm::predecode_cache< proc_type, size_log2 >::lookup( proc_type& proc,
+                                                      uint32_t pc )
+{
+    predecoded_instr< proc_type >& entry =
+        entries[ ( pc >> 2 ) & ( ( 1 << size_log2 ) - 1 ) ];
+
+    if( entry.address != pc )
+    {
+        entry = PredecodeInstr< proc_type >( proc.iMem.read_word( pc ) );
+        entry.address = pc;
+    }
+
+    return entry;
+}
+
+
+template< typename proc_type, unsigned int size_log2 >
+void arm::predecode_cache< proc_type, size_log2 >::invalidate( uint32_t pc )
+{
+    predecoded_instr< proc_type >& entry =
+        entries[ ( pc >> 2 ) & ( ( 1 << size_log2 ) - 1 ) ];
+
+    if( entry.address == pc )
+    {
+        // Instructions are word-aligned, so this address never matches
+        entry.address = 0xFFFFFFFF;
+    }
+}
+
+
+template< typename proc_type, unsigned int size_log2 >
+void arm::predecode_cache< proc_type, size_log2 >::flush()
+{
+    for( uint32_t i = 0; i < ( 1u << size_log2 ); ++i )
+    {
+        entries[i].address = 0xFFFFFFFF;
+    }
+}
+
+
+template< typename proc_type >
+void arm::ADD_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.5, p.334)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result, carry, overflow;
+        const uint32_t x        = (uint32_t)proc.R[p.n];
+        const uint32_t y        = p.imm32;
+        const uint32_t carry_in = 0;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetAddFlags( proc.CPSR, x, y, carry_in );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::ADD_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.6, p.336)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t shifted =
+            Shift_C( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C ).value;
+
+        uint32_t result, carry, overflow;
+        const uint32_t x        = (uint32_t)proc.R[p.n];
+        const uint32_t y        = shifted;
+        const uint32_t carry_in = 0;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetAddFlags( proc.CPSR, x, y, carry_in );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::SUB_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.212, p.732)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result, carry, overflow;
+        const uint32_t x        = (uint32_t)proc.R[p.n];
+        const uint32_t y        = ~p.imm32;
+        const uint32_t carry_in = 1;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetAddFlags( proc.CPSR, x, y, carry_in );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::SUB_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.213, p.734)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t shifted =
+            Shift( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C );
+
+        uint32_t result, carry, overflow;
+        const uint32_t x        = (uint32_t)proc.R[p.n];
+        const uint32_t y        = ~shifted;
+        const uint32_t carry_in = 1;
+        result = AddWithCarry( x, y, carry_in, carry, overflow );
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetAddFlags( proc.CPSR, x, y, carry_in );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::AND_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.11, p.346)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result = proc.R[p.n] & p.imm32;
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result,
+                             p.imm_carry[ proc.CPSR.C ? 1 : 0 ] );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::AND_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.12, p.348)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        UValueCarry c_ =
+            Shift_C( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C );
+        uint32_t result = proc.R[p.n] & c_.value;
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result, c_.carry );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::ORR_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.113, p.540)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result = proc.R[p.n] | p.imm32;
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result,
+                             p.imm_carry[ proc.CPSR.C ? 1 : 0 ] );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::ORR_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.114, p.542)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        UValueCarry c_ =
+            Shift_C( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C );
+        uint32_t result = proc.R[p.n] | c_.value;
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result, c_.carry );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::EOR_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.44, p.406)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result = proc.R[p.n] ^ p.imm32;
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result,
+                             p.imm_carry[ proc.CPSR.C ? 1 : 0 ] );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::EOR_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.45, p.408)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        UValueCarry c_ =
+            Shift_C( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C );
+        uint32_t result = proc.R[p.n] ^ c_.value;
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result, c_.carry );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::BIC_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.19, p.362)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result = proc.R[p.n] & NOT( p.imm32 );
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result,
+                             p.imm_carry[ proc.CPSR.C ? 1 : 0 ] );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::BIC_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.20, p.364)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        UValueCarry c_ =
+            Shift_C( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C );
+        uint32_t result = proc.R[p.n] & NOT( c_.value );
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result, c_.carry );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::MOV_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.96, p.506)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result = p.imm32;
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result,
+                             p.imm_carry[ proc.CPSR.C ? 1 : 0 ] );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::MOV_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.97, p.508)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result = proc.R[p.m];
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            proc.CPSR.N = Bits< 31, 31 >( result );
+            proc.CPSR.Z = IsZeroBit( result );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::MVN_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.106, p.526)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result = NOT( p.imm32 );
+
+        proc.R[p.d] = result;
+        if( p.setflags )
+        {
+            SetLogicalFlags( proc.CPSR, result,
+                             p.imm_carry[ proc.CPSR.C ? 1 : 0 ] );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::CMP_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.35, p.392)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        const uint32_t x        = (uint32_t)proc.R[p.n];
+        const uint32_t y        = NOT( p.imm32 );
+        const uint32_t carry_in = 1;
+
+        SetAddFlags( proc.CPSR, x, y, carry_in );
+    }
+}
+
+
+template< typename proc_type >
+void arm::CMP_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.36, p.394)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t shifted =
+            Shift_C( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C ).value;
+
+        const uint32_t x        = (uint32_t)proc.R[p.n];
+        const uint32_t y        = NOT( shifted );
+        const uint32_t carry_in = 1;
+
+        SetAddFlags( proc.CPSR, x, y, carry_in );
+    }
+}
+
+
+template< typename proc_type >
+void arm::CMN_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.32, p.386)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        const uint32_t x        = (uint32_t)proc.R[p.n];
+        const uint32_t y        = p.imm32;
+        const uint32_t carry_in = 0;
+
+        SetAddFlags( proc.CPSR, x, y, carry_in );
+    }
+}
+
+
+template< typename proc_type >
+void arm::CMN_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.33, p.388)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t shifted =
+            Shift_C( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C ).value;
+
+        const uint32_t x        = (uint32_t)proc.R[p.n];
+        const uint32_t y        = shifted;
+        const uint32_t carry_in = 0;
+
+        SetAddFlags( proc.CPSR, x, y, carry_in );
+    }
+}
+
+
+template< typename proc_type >
+void arm::TST_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.230, p.766)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result = proc.R[p.n] & p.imm32;
+
+        SetLogicalFlags( proc.CPSR, result,
+                         p.imm_carry[ proc.CPSR.C ? 1 : 0 ] );
+    }
+}
+
+
+template< typename proc_type >
+void arm::TST_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.231, p.768)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        UValueCarry c_ =
+            Shift_C( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C );
+        uint32_t result = proc.R[p.n] & c_.value;
+
+        SetLogicalFlags( proc.CPSR, result, c_.carry );
+    }
+}
+
+
+template< typename proc_type >
+void arm::TEQ_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.227, p.760)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t result = proc.R[p.n] ^ p.imm32;
+
+        SetLogicalFlags( proc.CPSR, result,
+                         p.imm_carry[ proc.CPSR.C ? 1 : 0 ] );
+    }
+}
+
+
+template< typename proc_type >
+void arm::TEQ_reg_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.228, p.762)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        UValueCarry c_ =
+            Shift_C( proc.R[p.m], p.shift_t, p.shift_n, proc.CPSR.C );
+        uint32_t result = proc.R[p.n] ^ c_.value;
+
+        SetLogicalFlags( proc.CPSR, result, c_.carry );
+    }
+}
+
+
+template< typename proc_type >
+void arm::LDR_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.58, p.432)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t offset_addr = p.add ? proc.R[p.n] + p.imm32
+                                     : proc.R[p.n] - p.imm32;
+        uint32_t address     = p.index ? offset_addr : proc.R[p.n];
+
+        // MemU
+        uint32_t data = MemReadWord( proc, address );
+        if( p.wback )
+        {
+            proc.R[p.n] = offset_addr;
+        }
+
+        if( UnalignedSupport( proc ) || (Bits< 1, 0 >( address ) == 0) )
+        {
+            proc.R[p.d] = data;
+        }
+        else
+        {
+            proc.R[p.d] = ROR( data, 8*Bits< 1, 0 >( address ) );
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::LDRB_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.62, p.440)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t offset_addr = p.add ? proc.R[p.n] + p.imm32
+                                     : proc.R[p.n] - p.imm32;
+        uint32_t address     = p.index ? offset_addr : proc.R[p.n];
+
+        // MemU
+        proc.R[p.d] = ZeroExtend( proc.dMem.read_byte( address ) );
+        if( p.wback )
+        {
+            proc.R[p.n] = offset_addr;
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::STR_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.194, p.696)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t offset_addr = p.add ? proc.R[p.n] + p.imm32
+                                     : proc.R[p.n] - p.imm32;
+        uint32_t address     = p.index ? offset_addr : proc.R[p.n];
+
+        MemWriteWord( proc, address, proc.R[p.d] );
+
+        if( p.wback )
+        {
+            proc.R[p.n] = offset_addr;
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::STRB_imm_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.197, p.702)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        uint32_t offset_addr = p.add ? proc.R[p.n] + p.imm32
+                                     : proc.R[p.n] - p.imm32;
+        uint32_t address     = p.index ? offset_addr : proc.R[p.n];
+
+        proc.dMem.write_byte( address, Bits< 7, 0 >( proc.R[p.d] ) );
+
+        if( p.wback )
+        {
+            proc.R[p.n] = offset_addr;
+        }
+    }
+}
+
+
+template< typename proc_type >
+void arm::B_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.16, p.356)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        BranchWritePC( proc, proc.PC + p.imm32 );
+    }
+}
+
+
+template< typename proc_type >
+void arm::BL_A1( proc_type& proc, const Predecoded& p )
+{
+    // (A8.6.23, p.370)
+    if( ConditionPassed( proc, p.instr ) )
+    {
+        if( CurrentInstrSet( proc ) == arm::InstrSet_ARM )
+        {
+            // FIXME: LR register is not always register 14!
+            proc.R[14] = proc.PC - 4;
+        }
+        else
+        {
+            // FIXME: LR register is not always register 14!
+            proc.R[14] = SET_BIT( proc.PC, 0 );
+        }
+
+        SelectInstrSet( proc, arm::InstrSet_ARM );
+        BranchWritePC( proc, Align( proc.PC, 4 ) + p.imm32 );
+    }
+}
+
+#endif // __ARMV7_PREDECODE_IMPL_HPP__
@@ -24,7 +24,10 @@
 #ifndef __ARMV7_PROCESSOR_HPP__
 #define __ARMV7_PROCESSOR_HPP__
 
+#include "profile.hpp"
+#include "unpredictable.hpp"
 #include <boost/cstdint.hpp>
+#include <cstddef>
 
 namespace arm {
 
@@ -53,16 +56,317 @@ namespace arm {
         field_type M;    /// bits [4:0] Mode field
     };
 
+    /**
+     * Field of a packed_cpsr: "width" bits starting at bit "lsb" of
+     * the status register word.
+     */
+    template< int lsb, int width >
+    struct cpsr_bits
+    {
+        static const uint32_t mask = ( ( 1ull << width ) - 1 ) << lsb;
+
+        uint32_t word; /// Whole status register
+
+        operator uint32_t() const
+        {
+            return ( word & mask ) >> lsb;
+        }
+
+        cpsr_bits& operator=( uint32_t value )
+        {
+            word = ( word & ~mask ) | ( ( value << lsb ) & mask );
+            return *this;
+        }
+
+        cpsr_bits& operator=( const cpsr_bits& field )
+        {
+            return *this = (uint32_t)field;
+        }
+
+        cpsr_bits& operator|=( uint32_t value )
+        {
+            word |= ( value << lsb ) & mask;
+            return *this;
+        }
+
+        cpsr_bits& operator&=( uint32_t value )
+        {
+            word &= ( value << lsb ) | ~mask;
+            return *this;
+        }
+    };
+
+    /**
+     * Current program status register stored as the 32-bit word
+     * defined by the architecture. Its fields are the same as in
+     * cpsr_adaptor, but each of them reads or writes its bits of the
+     * word. The word itself can be read and written with the integer
+     * operators used by CPSRWriteByInstr().
+     * (B1.3.3, p.1166)
+     */
+    struct packed_cpsr
+    {
+        union
+        {
+            uint32_t           word;
+            cpsr_bits< 31, 1 > N;        /// bit [31] Negative flag
+            cpsr_bits< 30, 1 > Z;        /// bit [30] Zero flag
+            cpsr_bits< 29, 1 > C;        /// bit [29] Carry flag
+            cpsr_bits< 28, 1 > V;        /// bit [28] Overflow flag
+            cpsr_bits< 27, 1 > Q;        /// bit [27] Saturation flag
+            cpsr_bits< 25, 2 > IT_L;     /// bits [26:25] If-Then bits
+            cpsr_bits< 24, 1 > J;        /// bit [24] Jazelle bit
+            cpsr_bits< 20, 4 > reserved; /// bits [23:20]
+            cpsr_bits< 16, 4 > GE;       /// bits [19:16] SIMD GE flags
+            cpsr_bits< 10, 6 > IT_H;     /// bits [15:10] If-Then bits
+            cpsr_bits<  9, 1 > E;        /// bit [9] Endianness bit
+            cpsr_bits<  8, 1 > A;        /// bit [8] Async abort disable
+            cpsr_bits<  7, 1 > I;        /// bit [7] Interrupt disable
+            cpsr_bits<  6, 1 > F;        /// bit [6] Fast interrupt disable
+            cpsr_bits<  5, 1 > T;        /// bit [5] Thumb bit
+            cpsr_bits<  0, 5 > M;        /// bits [4:0] Mode field
+        };
+
+        operator uint32_t() const
+        {
+            return word;
+        }
+
+        packed_cpsr& operator=( const packed_cpsr& cpsr )
+        {
+            word = cpsr.word;
+            return *this;
+        }
+
+        packed_cpsr& operator=( uint32_t value )
+        {
+            word = value;
+            return *this;
+        }
+
+        packed_cpsr& operator&=( uint32_t value )
+        {
+            word &= value;
+            return *this;
+        }
+
+        packed_cpsr& operator|=( uint32_t value )
+        {
+            word |= value;
+            return *this;
+        }
+    };
+
+    /**
+     * Last operation that set the condition flags of a
+     * lazy_cpsr_adaptor.
+     */
+    enum FlagsOp {
+        FlagsOp_None,    /// Flags are stored
+        FlagsOp_Add,     /// NZCV from x + y + c
+        FlagsOp_Logical  /// NZ from x, C from c, V is stored
+    };
+
+    /**
+     * Current program status register whose N, Z, C and V flags are
+     * only computed when read. Flag-setting instructions record their
+     * operation and operands with SetAddFlags() and SetLogicalFlags()
+     * instead of computing the four flags. Reading a flag, as
+     * ConditionPassed() and MRS do, computes it from that record;
+     * writing one first stores all four. All other fields are the
+     * same as in cpsr_adaptor.
+     */
+    template< typename field_type >
+    struct lazy_cpsr_adaptor
+    {
+        /**
+         * Condition flag, converted to and from field_type.
+         */
+        template< int bit >
+        struct flag
+        {
+            field_type value; /// Flag value when op is FlagsOp_None
+
+            operator field_type() const;
+            flag& operator=( field_type f );
+            flag& operator=( const flag& f );
+
+            lazy_cpsr_adaptor&       cpsr();
+            const lazy_cpsr_adaptor& cpsr() const;
+        };
+
+        // The record comes first so that copying the whole structure
+        // copies it before the flags.
+        uint32_t op;     /// FlagsOp of the last flag-setting operation
+        uint32_t x;      /// First operand, or result of a logical one
+        uint32_t y;      /// Second operand
+        uint32_t c;      /// Carry in, or carry out of a logical one
+
+        flag< 31 > N;    /// bit [31] Negative condition code flag
+        flag< 30 > Z;    /// bit [30] Zero condition code flag
+        flag< 29 > C;    /// bit [29] Carry condition code flag
+        flag< 28 > V;    /// bit [28] Overflow condition code flag.
+        field_type Q;    /// bit [27] Cumulative saturation flag
+        field_type IT_L; /// bits [26:25] Thumb if-Then execution state bits
+        field_type J;    /// bit [24] Jazelle bit
+        field_type reserved;
+        field_type GE;   /// bits [19:16] SIMD greater than or Equal flags
+        field_type IT_H; /// bits [15:10] Thumb if-Then execution state bits
+        field_type E;    /// bit [9] Endianness execution state bit
+        field_type A;    /// bit [8] Asynchronous abort disable bit
+        field_type I;    /// bit [7] Interrupt disable bit
+        field_type F;    /// bit [6] Fast interrupt disable bit
+        field_type T;    /// bit [5] Thumb execution state bit
+        field_type M;    /// bits [4:0] Mode field
+
+        /**
+         * Records an addition of x, y and carry_in.
+         */
+        void record_add( uint32_t x, uint32_t y, uint32_t carry_in )
+        {
+            op = FlagsOp_Add;
+            this->x = x;
+            this->y = y;
+            c = carry_in;
+        }
+
+        /**
+         * Records a logical operation. V keeps its current value.
+         */
+        void record_logical( uint32_t result, uint32_t carry )
+        {
+            if( op == FlagsOp_Add )
+            {
+                V.value = compute( 28 );
+            }
+            op = FlagsOp_Logical;
+            x = result;
+            c = carry;
+        }
+
+        /**
+         * Computes the flag at "bit" from the record.
+         */
+        field_type compute( int bit ) const
+        {
+            uint32_t result = x;
+            uint32_t carry  = c;
+
+            if( op == FlagsOp_Add )
+            {
+                const uint64_t sum = (uint64_t)x + y + c;
+                result = (uint32_t)sum;
+                carry  = (uint32_t)( sum >> 32 );
+            }
+
+            switch( bit )
+            {
+            case 31: return result >> 31;
+            case 30: return result == 0;
+            case 29: return carry;
+            default:
+                if( op == FlagsOp_Add )
+                {
+                    return ( ~( x ^ y ) & ( x ^ result ) ) >> 31;
+                }
+                return V.value;
+            }
+        }
+
+        /**
+         * Returns the N, Z, C and V flags as bits [3:0], computing
+         * them from the record at once.
+         */
+        uint32_t flags() const
+        {
+            if( op == FlagsOp_None )
+            {
+                return ( ( N.value & 1 ) << 3 ) | ( ( Z.value & 1 ) << 2 ) |
+                       ( ( C.value & 1 ) << 1 ) |   ( V.value & 1 );
+            }
+
+            uint32_t result = x;
+            uint32_t carry  = c;
+            uint32_t v      = V.value & 1;
+
+            if( op == FlagsOp_Add )
+            {
+                const uint64_t sum = (uint64_t)x + y + c;
+                result = (uint32_t)sum;
+                carry  = (uint32_t)( sum >> 32 );
+                v      = ( ~( x ^ y ) & ( x ^ result ) ) >> 31;
+            }
+
+            return ( ( result >> 31 ) << 3 ) | ( ( result == 0 ) << 2 ) |
+                   ( ( carry & 1 ) << 1 ) | v;
+        }
+
+        /**
+         * Stores the four flags and clears the record.
+         */
+        void materialize()
+        {
+            if( op != FlagsOp_None )
+            {
+                const field_type n = compute( 31 );
+                const field_type z = compute( 30 );
+                const field_type c = compute( 29 );
+                const field_type v = compute( 28 );
+                N.value = n;
+                Z.value = z;
+                C.value = c;
+                V.value = v;
+                op = FlagsOp_None;
+            }
+        }
+    };
+
+    /**
+     * State of a local exclusive monitor (A3.4.1, p.114).
+     */
+    enum ExclusiveState {
+        ExclusiveState_Open,       /// Open Access
+        ExclusiveState_Exclusive,  /// Exclusive Access
+        ExclusiveState_Storing     /// Passed by a store, not yet cleared
+    };
+
+    /**
+     * Local exclusive monitor of a core: the reservation granule
+     * marked by the last load exclusive, along with the tag the global
+     * monitor had for it (see exclusive.hpp). A zeroed monitor is in
+     * the Open Access state.
+     */
+    struct exclusive_monitor
+    {
+        uint32_t address; /// Address of the marked granule
+        uint32_t tag;     /// Tag of the granule when it was marked
+        uint32_t state;   /// ExclusiveState
+    };
+
     /**
      * Virtual core structure that contains the registers manipulated
-     * by the ARMv7 instruction set.
+     * by the ARMv7 instruction set. The profile type selects the
+     * implemented features (see isa_profile) and the unpredictable
+     * type what UNPREDICTABLE instructions do (see unpredictable.hpp).
+     *
+     * The memory type provides read_dword(), read_word(), read_half()
+     * and read_byte(), and the matching write functions, which access
+     * little-endian data at any address, aligned or not. The behavior
+     * functions check the alignment before calling them (see
+     * endian.hpp). Memory types may also provide bulk word accesses
+     * (see ReadWords()).
      */
     template< typename cpsr_type,
               typename reg_type,
               typename bank_type,
-              typename mem_type >
+              typename mem_type,
+              typename profile_type = armv7a_profile,
+              typename unpredictable_type = unpredictable_warn >
     struct armv7_core
     {
+        typedef profile_type       profile;
+        typedef unpredictable_type unpredictable;
+
         // In ARMv7-A and ARMv7-R, the APSR is the same register
         // as the CPSR, but the APSR must be used only to access
         // the N, Z, C, V, Q, and GE[3:0] bits.
@@ -72,8 +376,66 @@ namespace arm {
         bank_type R;    /// Register bank
         mem_type  iMem; /// Instruction memory
         mem_type  dMem; /// Data memory
+
+        exclusive_monitor Monitor; /// Local exclusive monitor
+
+        /// State of the unpredictable policy
+        typename unpredictable_type::state UnpredictableState;
     };
 
 } // namespace arm
 
+
+template< typename field_type >
+template< int bit >
+arm::lazy_cpsr_adaptor< field_type >::flag< bit >::operator field_type() const
+{
+    const lazy_cpsr_adaptor& p = cpsr();
+    return p.op == FlagsOp_None ? value : p.compute( bit );
+}
+
+
+template< typename field_type >
+template< int bit >
+typename arm::lazy_cpsr_adaptor< field_type >::template flag< bit >&
+arm::lazy_cpsr_adaptor< field_type >::flag< bit >::operator=( field_type f )
+{
+    cpsr().materialize();
+    value = f;
+    return *this;
+}
+
+
+template< typename field_type >
+template< int bit >
+typename arm::lazy_cpsr_adaptor< field_type >::template flag< bit >&
+arm::lazy_cpsr_adaptor< field_type >::flag< bit >::operator=( const flag& f )
+{
+    return *this = (field_type)f;
+}
+
+
+template< typename field_type >
+template< int bit >
+arm::lazy_cpsr_adaptor< field_type >&
+arm::lazy_cpsr_adaptor< field_type >::flag< bit >::cpsr()
+{
+    const size_t offset = offsetof( lazy_cpsr_adaptor, N ) +
+                          ( 31 - bit ) * sizeof( flag );
+    return *reinterpret_cast< lazy_cpsr_adaptor* >(
+        reinterpret_cast< char* >( this ) - offset );
+}
+
+
+template< typename field_type >
+template< int bit >
+const arm::lazy_cpsr_adaptor< field_type >&
+arm::lazy_cpsr_adaptor< field_type >::flag< bit >::cpsr() const
+{
+    const size_t offset = offsetof( lazy_cpsr_adaptor, N ) +
+                          ( 31 - bit ) * sizeof( flag );
+    return *reinterpret_cast< const lazy_cpsr_adaptor* >(
+        reinterpret_cast< const char* >( this ) - offset );
+}
+
 #endif // __ARMV7_PROCESSOR_HPP__
@@ -0,0 +1,96 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file defines the implementation-defined features of the
+ * simulated processor (architecture version, extensions, memory
+ * system). They are constants known at compile time, so that the
+ * behavior functions only contain the code for the configured
+ * profile.
+ */
+
+#ifndef __ARMV7_PROFILE_HPP__
+#define __ARMV7_PROFILE_HPP__
+
+#include "types.hpp"
+#include <boost/mpl/has_xxx.hpp>
+
+namespace arm {
+
+
+    /**
+     * ARMv7-A profile without the Security and Multiprocessing
+     * extensions. Other profiles can derive from it and hide the
+     * constants that differ.
+     */
+    struct armv7a_profile
+    {
+        /// Major version number of the architecture (ArchVersion())
+        static const int     arch_version      = 7;
+
+        /// Security Extensions implemented (HaveSecurityExt())
+        static const bool    security_ext      = false;
+
+        /// Multiprocessing Extensions implemented (HaveMPExt())
+        static const bool    mp_ext            = false;
+
+        /// Unaligned memory accesses supported (UnalignedSupport())
+        static const bool    unaligned_support = true;
+
+        /// All unaligned data accesses fault (SCTLR.A, see endian.hpp)
+        static const bool    alignment_check   = false;
+
+        /// Memory system architecture (MemorySystemArchitecture())
+        static const MemArch memory_arch       = MemArch_VMSA;
+
+        /// Endianness of the data accesses (BigEndian())
+        static const Endianness data_endianness = Endianness_Selectable;
+    };
+
+
+    namespace detail {
+        BOOST_MPL_HAS_XXX_TRAIT_DEF( profile )
+
+        template< typename proc_type, bool has_profile >
+        struct profile_of
+        {
+            typedef typename proc_type::profile type;
+        };
+
+        template< typename proc_type >
+        struct profile_of< proc_type, false >
+        {
+            typedef armv7a_profile type;
+        };
+    }
+
+
+    /**
+     * Profile of the processor type: its nested "profile" type if it
+     * has one, armv7a_profile otherwise. Can also be specialized for
+     * processor types that cannot be modified.
+     */
+    template< typename proc_type >
+    struct isa_profile :
+        detail::profile_of< proc_type, detail::has_profile< proc_type >::value >
+    {
+    };
+
+
+} // namespace arm
+
+#endif // __ARMV7_PROFILE_HPP__
@@ -0,0 +1,60 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file defines a ready-made interpreter loop for ARM code. Each
+ * instruction is fetched, decoded and dispatched to its behavior
+ * function.
+ *
+ * With GCC-compatible compilers, dispatch is direct-threaded: every
+ * behavior function is followed by its own copy of the fetch, decode
+ * and indirect jump, which gives the host branch predictor one jump
+ * per encoding to learn instead of a single shared one. Defining
+ * ARMV7_NO_COMPUTED_GOTO selects a portable switch-based loop.
+ */
+
+#ifndef __ARMV7_RUN_HPP__
+#define __ARMV7_RUN_HPP__
+
+#include <boost/cstdint.hpp>
+
+#if defined( __GNUC__ ) && !defined( ARMV7_NO_COMPUTED_GOTO )
+#define ARMV7_COMPUTED_GOTO 1
+#endif
+
+namespace arm {
+
+
+    /**
+     * Executes at most max_instrs ARM instructions fetched with
+     * proc.iMem.read_word(), starting at proc.PC. Returns the number
+     * of instructions executed.
+     *
+     * Between instructions, proc.PC holds the address of the next
+     * instruction. While an instruction executes, proc.PC and
+     * proc.R[15] hold its address plus 8. The loop stops early before
+     * an instruction without a behavior function (e.g. SVC), leaving
+     * proc.PC at its address, or when the processor leaves the ARM
+     * instruction set.
+     */
+    template< typename proc_type >
+    uint64_t run( proc_type& proc, uint64_t max_instrs );
+
+
+} // namespace arm
+
+#endif // __ARMV7_RUN_HPP__
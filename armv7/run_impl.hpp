@@ -0,0 +1,148 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_RUN_IMPL_HPP__
+#define __ARMV7_RUN_IMPL_HPP__
+
+#include "run.hpp"
+#include "decoder.hpp"
+#include "function.hpp"
+#include "instruction.hpp"
+#include <boost/cstdint.hpp>
+
+
+/*
+ * Executes the instruction at "pc" with behavior function "name" and
+ * computes the address of the next one. Instructions whose condition
+ * fails are skipped; the others reach their behavior function with
+ * the condition rewritten to AL, as in block_cache, so that it is not
+ * checked twice. An instruction writing the PC moves proc.PC away from
+ * pc + 8, except when branching to pc + 8 itself, which is told apart
+ * by the condition checked before executing it (it cannot have changed
+ * the flags). Returns if the unpredictable policy stops.
+ */
+#define ARMV7_RUN_EXECUTE( name )                                       \
+    proc.PC    = pc + 8;                                                \
+    proc.R[15] = pc + 8;                                                \
+    passed     = ConditionPassed( proc, instr );                        \
+    if( passed )                                                        \
+    {                                                                   \
+        arm::name< proc_type >( proc, ( instr >> 28 ) < 0xE ?           \
+                                ( instr & 0x0FFFFFFF ) | 0xE0000000 :   \
+                                instr );                                \
+    }                                                                   \
+    if( proc.PC == pc + 8 &&                                            \
+        !( passed && may_write_pc[ Encoding_##name ] &&                 \
+           WritesPC( Encoding_##name, instr ) ) )                       \
+    {                                                                   \
+        proc.PC = pc + 4;                                               \
+    }                                                                   \
+    ++count;                                                            \
+    if( UnpredictableRaised( proc ) )                                   \
+    {                                                                   \
+        return count;                                                   \
+    }
+
+
+/*
+ * Fetches and decodes the next instruction, or leaves the loop.
+ */
+#define ARMV7_RUN_FETCH()                                               \
+    if( count == max_instrs || CurrentInstrSet( proc ) != InstrSet_ARM ) \
+    {                                                                   \
+        return count;                                                   \
+    }                                                                   \
+    pc       = proc.PC;                                                 \
+    instr    = proc.iMem.read_word( pc );                               \
+    encoding = DecodeEncoding( instr );
+
+
+template< typename proc_type >
+uint64_t arm::run( proc_type& proc, uint64_t max_instrs )
+{
+    struct pc_writers
+    {
+        bool encodings[ Encoding_Count ];
+
+        pc_writers()
+        {
+            for( int e = 0; e < Encoding_Count; ++e )
+            {
+                encodings[e] = MayWritePC( static_cast< Encoding >( e ) );
+            }
+        }
+    };
+
+    static const pc_writers writers;
+    const bool* may_write_pc = writers.encodings;
+
+    uint64_t count = 0;
+    uint32_t pc, instr;
+    Encoding encoding;
+    bool     passed;
+
+#ifdef ARMV7_COMPUTED_GOTO
+
+    static void* const labels[ Encoding_Count ] =
+    {
+        &&label_Unknown,
+#define ARMV7_RUN_LABEL( name, mask, value ) &&label_##name,
+        ARMV7_A1_ENCODINGS( ARMV7_RUN_LABEL )
+#undef ARMV7_RUN_LABEL
+    };
+
+    ARMV7_RUN_FETCH();
+    goto *labels[ encoding ];
+
+#define ARMV7_RUN_LABEL( name, mask, value )                            \
+label_##name:                                                           \
+    ARMV7_RUN_EXECUTE( name );                                          \
+    ARMV7_RUN_FETCH();                                                  \
+    goto *labels[ encoding ];
+
+    ARMV7_A1_ENCODINGS( ARMV7_RUN_LABEL )
+#undef ARMV7_RUN_LABEL
+
+label_Unknown:
+    return count;
+
+#else
+
+    for( ;; )
+    {
+        ARMV7_RUN_FETCH();
+
+        switch( encoding )
+        {
+#define ARMV7_RUN_CASE( name, mask, value )                             \
+        case Encoding_##name:                                           \
+            ARMV7_RUN_EXECUTE( name );                                  \
+            break;
+        ARMV7_A1_ENCODINGS( ARMV7_RUN_CASE )
+#undef ARMV7_RUN_CASE
+
+        default:
+            return count;
+        }
+    }
+
+#endif
+}
+
+#undef ARMV7_RUN_EXECUTE
+#undef ARMV7_RUN_FETCH
+
+#endif // __ARMV7_RUN_IMPL_HPP__
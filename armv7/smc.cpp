@@ -0,0 +1,78 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "smc.hpp"
+#include "smc_impl.hpp"
+
+#include <cstring>
+
+
+arm::code_map::code_map()
+{
+    clear();
+}
+
+
+void arm::code_map::attach( void* cache, invalidate_type invalidate )
+{
+    cache_entry entry;
+    entry.cache      = cache;
+    entry.invalidate = invalidate;
+    caches.push_back( entry );
+}
+
+
+void arm::code_map::detach( void* cache )
+{
+    for( size_t i = 0; i < caches.size(); ++i )
+    {
+        if( caches[i].cache == cache )
+        {
+            caches.erase( caches.begin() + i );
+            return;
+        }
+    }
+}
+
+
+void arm::code_map::mark( uint32_t addr )
+{
+    const uint32_t page = addr >> PageBits;
+    bits[ page / 64 ] |= uint64_t( 1 ) << ( page % 64 );
+}
+
+
+void arm::code_map::notify( uint32_t addr, uint32_t size )
+{
+    // The caches mark the pages again if they still hold code there
+    const uint32_t pages[2] = { addr >> PageBits,
+                                ( addr + size - 1 ) >> PageBits };
+    for( size_t i = 0; i < 2; ++i )
+    {
+        bits[ pages[i] / 64 ] &= ~( uint64_t( 1 ) << ( pages[i] % 64 ) );
+    }
+
+    for( size_t i = 0; i < caches.size(); ++i )
+    {
+        caches[i].invalidate( caches[i].cache, addr, size );
+    }
+}
+
+
+void arm::code_map::clear()
+{
+    memset( bits, 0, sizeof( bits ) );
+}
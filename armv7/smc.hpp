@@ -0,0 +1,140 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file declares the detection of self-modifying code: the guest
+ * pages holding cached instructions are flagged, and stores to these
+ * pages through a unified memory invalidate the cached instructions
+ * they overwrite.
+ */
+
+#ifndef __ARMV7_SMC_HPP__
+#define __ARMV7_SMC_HPP__
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <vector>
+
+namespace arm {
+
+
+    /**
+     * Bitmap of the 4 KB guest pages holding code cached by decode or
+     * translation caches, along with the caches to notify when such a
+     * page is written.
+     *
+     * A cache attaches itself with a function invalidating the
+     * instructions it holds in a range of addresses, and marks the
+     * pages of the instructions it caches. When a marked page is
+     * written, its bit is cleared and all caches are notified; the
+     * caches mark it again if they still hold code in it.
+     *
+     * The map is not thread-safe: the cores and caches using it must
+     * run on the same host thread.
+     */
+    class code_map : boost::noncopyable
+    {
+    public:
+        enum
+        {
+            PageBits = 12
+        };
+
+        /// Drops the instructions of "cache" in [addr, addr + size)
+        typedef void ( *invalidate_type )( void* cache, uint32_t addr,
+                                           uint32_t size );
+
+        code_map();
+
+        /**
+         * Notifies "cache" through "invalidate" of the writes to the
+         * marked pages, until it is detached.
+         */
+        void attach( void* cache, invalidate_type invalidate );
+        void detach( void* cache );
+
+        /**
+         * Marks the page of "addr" as holding code.
+         */
+        void mark( uint32_t addr );
+
+        /**
+         * Returns true if the page of "addr" holds code.
+         */
+        bool marked( uint32_t addr ) const;
+
+        /**
+         * Invalidates the code in [addr, addr + size), if any of the
+         * pages of this range are marked. Called after each write to
+         * a unified memory; the range spans at most two pages.
+         */
+        void written( uint32_t addr, uint32_t size );
+
+        /**
+         * Unmarks all pages, without notifying the caches.
+         */
+        void clear();
+
+    private:
+        struct cache_entry
+        {
+            void*           cache;
+            invalidate_type invalidate;
+        };
+
+        void notify( uint32_t addr, uint32_t size );
+
+        uint64_t                   bits[ ( 1 << ( 32 - PageBits ) ) / 64 ];
+        std::vector< cache_entry > caches;
+    };
+
+
+    /**
+     * Memory used both as the instruction and data memory of a core.
+     * All accesses are forwarded to "mem", and each write is reported
+     * to "code", so that stores overwriting cached instructions
+     * invalidate them. "mem" and "code" must be set before the core
+     * runs.
+     *
+     * A unified memory has no host pages (see HostPage()): a VMSA
+     * with direct host access would write pages without telling the
+     * code map.
+     */
+    template< typename mem_type >
+    struct unified_mem
+    {
+        mem_type* mem;  /// Memory holding instructions and data
+        code_map* code; /// Pages of the cached instructions
+
+        uint64_t read_dword( uint32_t addr ) const;
+        uint32_t read_word ( uint32_t addr ) const;
+        uint16_t read_half ( uint32_t addr ) const;
+        uint8_t  read_byte ( uint32_t addr ) const;
+
+        void write_dword( uint32_t addr, uint64_t data );
+        void write_word ( uint32_t addr, uint32_t data );
+        void write_half ( uint32_t addr, uint16_t data );
+        void write_byte ( uint32_t addr,  uint8_t data );
+
+        void read_words ( uint32_t addr, uint32_t* data, unsigned int n ) const;
+        void write_words( uint32_t addr, const uint32_t* data, unsigned int n );
+    };
+
+
+} // namespace arm
+
+#endif // __ARMV7_SMC_HPP__
@@ -0,0 +1,126 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_SMC_IMPL_HPP__
+#define __ARMV7_SMC_IMPL_HPP__
+
+#include "memory_impl.hpp"
+#include "smc.hpp"
+#include <boost/cstdint.hpp>
+#include <algorithm>
+
+
+inline bool arm::code_map::marked( uint32_t addr ) const
+{
+    const uint32_t page = addr >> PageBits;
+    return ( bits[ page / 64 ] >> ( page % 64 ) ) & 1;
+}
+
+
+inline void arm::code_map::written( uint32_t addr, uint32_t size )
+{
+    // A write spans at most two pages
+    if( marked( addr ) || marked( addr + size - 1 ) )
+    {
+        notify( addr, size );
+    }
+}
+
+
+template< typename mem_type >
+uint64_t arm::unified_mem< mem_type >::read_dword( uint32_t addr ) const
+{
+    return mem->read_dword( addr );
+}
+
+
+template< typename mem_type >
+uint32_t arm::unified_mem< mem_type >::read_word( uint32_t addr ) const
+{
+    return mem->read_word( addr );
+}
+
+
+template< typename mem_type >
+uint16_t arm::unified_mem< mem_type >::read_half( uint32_t addr ) const
+{
+    return mem->read_half( addr );
+}
+
+
+template< typename mem_type >
+uint8_t arm::unified_mem< mem_type >::read_byte( uint32_t addr ) const
+{
+    return mem->read_byte( addr );
+}
+
+
+template< typename mem_type >
+void arm::unified_mem< mem_type >::write_dword( uint32_t addr, uint64_t data )
+{
+    mem->write_dword( addr, data );
+    code->written( addr, 8 );
+}
+
+
+template< typename mem_type >
+void arm::unified_mem< mem_type >::write_word( uint32_t addr, uint32_t data )
+{
+    mem->write_word( addr, data );
+    code->written( addr, 4 );
+}
+
+
+template< typename mem_type >
+void arm::unified_mem< mem_type >::write_half( uint32_t addr, uint16_t data )
+{
+    mem->write_half( addr, data );
+    code->written( addr, 2 );
+}
+
+
+template< typename mem_type >
+void arm::unified_mem< mem_type >::write_byte( uint32_t addr, uint8_t data )
+{
+    mem->write_byte( addr, data );
+    code->written( addr, 1 );
+}
+
+
+
+template< typename mem_type >
+void arm::unified_mem< mem_type >::read_words( uint32_t addr, uint32_t* data,
+                                              unsigned int n ) const
+{
+    ReadWords( *mem, addr, data, n );
+}
+
+
+template< typename mem_type >
+void arm::unified_mem< mem_type >::write_words( uint32_t addr,
+                                               const uint32_t* data,
+                                               unsigned int n )
+{
+    WriteWords( *mem, addr, data, n );
+
+    // code_map::written() takes at most two pages at a time
+    for( unsigned int i = 0; i < n; i += 1024 )
+    {
+        code->written( addr + 4 * i, 4 * std::min( n - i, 1024u ) );
+    }
+}
+
+#endif // __ARMV7_SMC_IMPL_HPP__
@@ -0,0 +1,55 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "smp.hpp"
+
+
+arm::smp_barrier::smp_barrier( unsigned int threads )
+    : threads( threads ),
+      waiting( 0 ),
+      generation( 0 ),
+      all_done( true ),
+      result( false )
+{
+}
+
+
+bool arm::smp_barrier::wait( bool done )
+{
+    std::unique_lock< std::mutex > lock( mutex );
+
+    const uint64_t current = generation;
+    all_done = all_done && done;
+
+    if( ++waiting == threads )
+    {
+        // The last thread releases the others
+        result   = all_done;
+        all_done = true;
+        waiting  = 0;
+        ++generation;
+        released.notify_all();
+        return result;
+    }
+
+    while( generation == current )
+    {
+        released.wait( lock );
+    }
+
+    // The next generation cannot end before this thread reaches it
+    return result;
+}
@@ -0,0 +1,202 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file defines a multi-core system: several cores sharing their
+ * memory, each run by its own host thread. The cores run a quantum of
+ * instructions each, then wait for each other, so that none of them
+ * gets more than a quantum ahead of the others.
+ */
+
+#ifndef __ARMV7_SMP_HPP__
+#define __ARMV7_SMP_HPP__
+
+#include "memory.hpp"
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+
+namespace arm {
+
+
+    /**
+     * Memory of a core forwarding all accesses to a memory shared
+     * with other cores. "mem" must be set before the core runs.
+     * Writes hold the granules they touch in the global monitor, as
+     * store exclusives do, so that a store from one core makes the
+     * pending store exclusive of another fail and is never overwritten
+     * by it (A3.4, p.114).
+     *
+     * A shared memory has no host pages (see HostPage()): a VMSA with
+     * direct host access would write pages without clearing the
+     * global monitor.
+     */
+    template< typename mem_type >
+    struct shared_mem
+    {
+        mem_type* mem; /// Shared memory
+
+        uint64_t read_dword( uint32_t addr ) const;
+        uint32_t read_word ( uint32_t addr ) const;
+        uint16_t read_half ( uint32_t addr ) const;
+        uint8_t  read_byte ( uint32_t addr ) const;
+
+        void write_dword( uint32_t addr, uint64_t data );
+        void write_word ( uint32_t addr, uint32_t data );
+        void write_half ( uint32_t addr, uint16_t data );
+        void write_byte ( uint32_t addr,  uint8_t data );
+
+        void read_words ( uint32_t addr, uint32_t* data, unsigned int n ) const;
+        void write_words( uint32_t addr, const uint32_t* data, unsigned int n );
+    };
+
+
+    /**
+     * Shared paged_mem. Each core keeps the last pages it accessed in
+     * its own page caches, since those of the paged_mem itself are not
+     * thread-safe. A core filled with zeros has empty caches; they must
+     * be reset if the paged_mem is cleared.
+     */
+    template<>
+    struct shared_mem< paged_mem >
+    {
+        paged_mem*                     mem;    /// Shared memory
+        mutable paged_mem::page_caches caches; /// Of this core
+
+        uint64_t read_dword( uint32_t addr ) const;
+        uint32_t read_word ( uint32_t addr ) const;
+        uint16_t read_half ( uint32_t addr ) const;
+        uint8_t  read_byte ( uint32_t addr ) const;
+
+        void write_dword( uint32_t addr, uint64_t data );
+        void write_word ( uint32_t addr, uint32_t data );
+        void write_half ( uint32_t addr, uint16_t data );
+        void write_byte ( uint32_t addr,  uint8_t data );
+
+        void read_words ( uint32_t addr, uint32_t* data, unsigned int n ) const;
+        void write_words( uint32_t addr, const uint32_t* data, unsigned int n );
+    };
+
+
+    /**
+     * Barrier for a fixed number of threads, which also tells each of
+     * them whether all threads were done.
+     */
+    class smp_barrier : boost::noncopyable
+    {
+    public:
+        explicit smp_barrier( unsigned int threads );
+
+        /**
+         * Waits until all threads have called wait(). Returns true if
+         * "done" was true for all of them.
+         */
+        bool wait( bool done );
+
+    private:
+        std::mutex              mutex;
+        std::condition_variable released;
+        unsigned int            threads;
+        unsigned int            waiting;
+        uint64_t                generation;
+        bool                    all_done;  /// Of the current generation
+        bool                    result;    /// Of the last generation
+    };
+
+
+    /**
+     * Set of cores run together. Each core should access the shared
+     * memory through a shared_mem, or any other memory type whose
+     * copies access the same storage.
+     *
+     * In each round, every core executes at most "quantum"
+     * instructions with arm::run(). By default each core is run by its
+     * own host thread, and the threads wait for each other at the end
+     * of each round; the order in which the cores access memory within
+     * a round is then up to the host. In deterministic mode, the cores
+     * are run one after the other by the calling thread, in order, for
+     * a quantum each, which always gives the same interleaving.
+     */
+    template< typename proc_type >
+    class smp_system : boost::noncopyable
+    {
+    public:
+        /**
+         * Runs the "count" cores of array "cores", which must outlive
+         * the system.
+         */
+        smp_system( proc_type* cores, unsigned int count,
+                    uint64_t quantum, bool deterministic = false );
+
+        /**
+         * Executes at most max_instrs instructions in each core,
+         * starting at its PC. A core stops early before an instruction
+         * without a behavior function, when it leaves the ARM
+         * instruction set or when the unpredictable policy stops it;
+         * the others go on. Returns the number of instructions
+         * executed by all cores.
+         *
+         * In deterministic mode, run() returns as soon as the
+         * unpredictable policy stops a core, so that the calling
+         * thread can tell why (see UnpredictableRaised()).
+         */
+        uint64_t run( uint64_t max_instrs );
+
+        /**
+         * Returns the number of instructions executed by core "i"
+         * during the last call to run().
+         */
+        uint64_t executed( unsigned int i ) const;
+
+        /**
+         * Returns true if core "i" stopped early during the last call
+         * to run().
+         */
+        bool stopped( unsigned int i ) const;
+
+        /**
+         * Returns the number of rounds of the last call to run().
+         */
+        uint64_t rounds() const;
+
+    private:
+        // Returns the number of instructions executed by all cores
+        uint64_t executed() const;
+
+        // Runs a quantum of core "i". Returns true if it is done.
+        bool step( unsigned int i, uint64_t max_instrs );
+
+        void run_thread( unsigned int i, uint64_t max_instrs,
+                         smp_barrier* barrier );
+
+        proc_type*   cores;
+        unsigned int count;
+        uint64_t     quantum;
+        bool         deterministic;
+
+        std::vector< uint64_t > counts;
+        std::vector< uint8_t >  stops;
+        uint64_t                round_count;
+    };
+
+
+} // namespace arm
+
+#endif // __ARMV7_SMP_HPP__
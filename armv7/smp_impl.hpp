@@ -0,0 +1,333 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_SMP_IMPL_HPP__
+#define __ARMV7_SMP_IMPL_HPP__
+
+#include "smp.hpp"
+#include "exclusive.hpp"
+#include "function.hpp"
+#include "memory_impl.hpp"
+#include "run_impl.hpp"
+#include "unpredictable_impl.hpp"
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <thread>
+
+
+template< typename mem_type >
+uint64_t arm::shared_mem< mem_type >::read_dword( uint32_t addr ) const
+{
+    return mem->read_dword( addr );
+}
+
+
+template< typename mem_type >
+uint32_t arm::shared_mem< mem_type >::read_word( uint32_t addr ) const
+{
+    return mem->read_word( addr );
+}
+
+
+template< typename mem_type >
+uint16_t arm::shared_mem< mem_type >::read_half( uint32_t addr ) const
+{
+    return mem->read_half( addr );
+}
+
+
+template< typename mem_type >
+uint8_t arm::shared_mem< mem_type >::read_byte( uint32_t addr ) const
+{
+    return mem->read_byte( addr );
+}
+
+
+template< typename mem_type >
+void arm::shared_mem< mem_type >::write_dword( uint32_t addr, uint64_t data )
+{
+    ExclusiveHoldByAddress( addr, 8 );
+    mem->write_dword( addr, data );
+    ExclusiveReleaseByAddress( addr, 8 );
+}
+
+
+template< typename mem_type >
+void arm::shared_mem< mem_type >::write_word( uint32_t addr, uint32_t data )
+{
+    ExclusiveHoldByAddress( addr, 4 );
+    mem->write_word( addr, data );
+    ExclusiveReleaseByAddress( addr, 4 );
+}
+
+
+template< typename mem_type >
+void arm::shared_mem< mem_type >::write_half( uint32_t addr, uint16_t data )
+{
+    ExclusiveHoldByAddress( addr, 2 );
+    mem->write_half( addr, data );
+    ExclusiveReleaseByAddress( addr, 2 );
+}
+
+
+template< typename mem_type >
+void arm::shared_mem< mem_type >::write_byte( uint32_t addr, uint8_t data )
+{
+    ExclusiveHoldByAddress( addr, 1 );
+    mem->write_byte( addr, data );
+    ExclusiveReleaseByAddress( addr, 1 );
+}
+
+
+template< typename mem_type >
+void arm::shared_mem< mem_type >::read_words( uint32_t addr, uint32_t* data,
+                                             unsigned int n ) const
+{
+    ReadWords( *mem, addr, data, n );
+}
+
+
+template< typename mem_type >
+void arm::shared_mem< mem_type >::write_words( uint32_t addr,
+                                              const uint32_t* data,
+                                              unsigned int n )
+{
+    ExclusiveHoldByAddress( addr, 4 * n );
+    WriteWords( *mem, addr, data, n );
+    ExclusiveReleaseByAddress( addr, 4 * n );
+}
+
+
+inline uint64_t arm::shared_mem< arm::paged_mem >::read_dword(
+    uint32_t addr ) const
+{
+    return mem->read_dword( addr, caches );
+}
+
+
+inline uint32_t arm::shared_mem< arm::paged_mem >::read_word(
+    uint32_t addr ) const
+{
+    return mem->read_word( addr, caches );
+}
+
+
+inline uint16_t arm::shared_mem< arm::paged_mem >::read_half(
+    uint32_t addr ) const
+{
+    return mem->read_half( addr, caches );
+}
+
+
+inline uint8_t arm::shared_mem< arm::paged_mem >::read_byte(
+    uint32_t addr ) const
+{
+    return mem->read_byte( addr, caches );
+}
+
+
+inline void arm::shared_mem< arm::paged_mem >::write_dword( uint32_t addr,
+                                                            uint64_t data )
+{
+    ExclusiveHoldByAddress( addr, 8 );
+    mem->write_dword( addr, data, caches );
+    ExclusiveReleaseByAddress( addr, 8 );
+}
+
+
+inline void arm::shared_mem< arm::paged_mem >::write_word( uint32_t addr,
+                                                           uint32_t data )
+{
+    ExclusiveHoldByAddress( addr, 4 );
+    mem->write_word( addr, data, caches );
+    ExclusiveReleaseByAddress( addr, 4 );
+}
+
+
+inline void arm::shared_mem< arm::paged_mem >::write_half( uint32_t addr,
+                                                           uint16_t data )
+{
+    ExclusiveHoldByAddress( addr, 2 );
+    mem->write_half( addr, data, caches );
+    ExclusiveReleaseByAddress( addr, 2 );
+}
+
+
+inline void arm::shared_mem< arm::paged_mem >::write_byte( uint32_t addr,
+                                                           uint8_t data )
+{
+    ExclusiveHoldByAddress( addr, 1 );
+    mem->write_byte( addr, data, caches );
+    ExclusiveReleaseByAddress( addr, 1 );
+}
+
+
+inline void arm::shared_mem< arm::paged_mem >::read_words(
+    uint32_t addr, uint32_t* data, unsigned int n ) const
+{
+    mem->read_words( addr, data, n, caches );
+}
+
+
+inline void arm::shared_mem< arm::paged_mem >::write_words(
+    uint32_t addr, const uint32_t* data, unsigned int n )
+{
+    ExclusiveHoldByAddress( addr, 4 * n );
+    mem->write_words( addr, data, n, caches );
+    ExclusiveReleaseByAddress( addr, 4 * n );
+}
+
+
+template< typename proc_type >
+arm::smp_system< proc_type >::smp_system( proc_type* cores,
+                                          unsigned int count,
+                                          uint64_t quantum,
+                                          bool deterministic )
+    : cores( cores ),
+      count( count ),
+      quantum( quantum ),
+      deterministic( deterministic ),
+      counts( count, 0 ),
+      stops( count, 0 ),
+      round_count( 0 )
+{
+}
+
+
+template< typename proc_type >
+uint64_t arm::smp_system< proc_type >::run( uint64_t max_instrs )
+{
+    std::fill( counts.begin(), counts.end(), 0 );
+    std::fill( stops.begin(), stops.end(), 0 );
+    round_count = 0;
+
+    if( deterministic )
+    {
+        bool done = false;
+        while( !done )
+        {
+            done = true;
+            for( unsigned int i = 0; i < count; ++i )
+            {
+                done = step( i, max_instrs ) && done;
+
+                if( UnpredictableRaised( cores[i] ) )
+                {
+                    ++round_count;
+                    return executed();
+                }
+            }
+            ++round_count;
+        }
+    }
+    else
+    {
+        smp_barrier barrier( count );
+        std::vector< std::thread > threads;
+
+        for( unsigned int i = 1; i < count; ++i )
+        {
+            threads.push_back( std::thread( &smp_system::run_thread, this,
+                                            i, max_instrs, &barrier ) );
+        }
+        run_thread( 0, max_instrs, &barrier );
+
+        for( size_t t = 0; t < threads.size(); ++t )
+        {
+            threads[t].join();
+        }
+    }
+
+    return executed();
+}
+
+
+template< typename proc_type >
+uint64_t arm::smp_system< proc_type >::executed() const
+{
+    uint64_t total = 0;
+    for( unsigned int i = 0; i < count; ++i )
+    {
+        total += counts[i];
+    }
+    return total;
+}
+
+
+template< typename proc_type >
+uint64_t arm::smp_system< proc_type >::executed( unsigned int i ) const
+{
+    return counts[i];
+}
+
+
+template< typename proc_type >
+bool arm::smp_system< proc_type >::stopped( unsigned int i ) const
+{
+    return stops[i] != 0;
+}
+
+
+template< typename proc_type >
+uint64_t arm::smp_system< proc_type >::rounds() const
+{
+    return round_count;
+}
+
+
+template< typename proc_type >
+bool arm::smp_system< proc_type >::step( unsigned int i,
+                                         uint64_t max_instrs )
+{
+    if( !stops[i] && counts[i] < max_instrs )
+    {
+        const uint64_t n = std::min( quantum, max_instrs - counts[i] );
+        const uint64_t done = arm::run( cores[i], n );
+
+        counts[i] += done;
+        if( done < n || UnpredictableRaised( cores[i] ) )
+        {
+            stops[i] = 1;
+        }
+    }
+
+    return stops[i] || counts[i] == max_instrs;
+}
+
+
+template< typename proc_type >
+void arm::smp_system< proc_type >::run_thread( unsigned int i,
+                                               uint64_t max_instrs,
+                                               smp_barrier* barrier )
+{
+    for( ;; )
+    {
+        const bool done = step( i, max_instrs );
+
+        // Only the first thread counts the rounds
+        if( i == 0 )
+        {
+            ++round_count;
+        }
+
+        if( barrier->wait( done ) )
+        {
+            return;
+        }
+    }
+}
+
+#endif // __ARMV7_SMP_IMPL_HPP__
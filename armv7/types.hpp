@@ -26,6 +26,21 @@
 
 #include <boost/cstdint.hpp>
 
+/*
+ * Branch hints and attributes of GCC and compatible compilers. Other
+ * compilers do without them.
+ */
+
+#ifdef __GNUC__
+#define ARMV7_LIKELY( x )   __builtin_expect( !!( x ), 1 )
+#define ARMV7_UNLIKELY( x ) __builtin_expect( !!( x ), 0 )
+#define ARMV7_COLD          __attribute__(( noinline, cold ))
+#else
+#define ARMV7_LIKELY( x )   ( x )
+#define ARMV7_UNLIKELY( x ) ( x )
+#define ARMV7_COLD
+#endif
+
 namespace arm {
 
 
@@ -65,6 +80,17 @@ namespace arm {
     };
 
 
+    /**
+     * Endianness of the data accesses: fixed, or selected by CPSR.E
+     * (A3.3.1, p.109)
+     */
+    enum Endianness {
+        Endianness_Little,
+        Endianness_Big,
+        Endianness_Selectable
+    };
+
+
     /**
      * Types of memory
      * (B2.4.1, p.1263)
@@ -119,7 +145,8 @@ namespace arm {
      */
     struct UValueCarry
     {
-        UValueCarry() : value( 0 ), carry( false ) {}
+        constexpr UValueCarry() : value( 0 ), carry( false ) {}
+        constexpr UValueCarry( uint32_t v, bool c ) : value( v ), carry( c ) {}
         uint32_t value;
         bool     carry;
     };
@@ -130,7 +157,8 @@ namespace arm {
      */
     struct ValueSat
     {
-        ValueSat() : value( 0 ), saturated( false ) {}
+        constexpr ValueSat() : value( 0 ), saturated( false ) {}
+        constexpr ValueSat( int64_t v, bool s ) : value( v ), saturated( s ) {}
         int64_t value;
         bool    saturated;
     };
@@ -141,7 +169,9 @@ namespace arm {
      */
     struct UValueSat
     {
-        UValueSat() : value( 0 ), saturated( false ) {}
+        constexpr UValueSat() : value( 0 ), saturated( false ) {}
+        constexpr UValueSat( uint64_t v, bool s )
+            : value( v ), saturated( s ) {}
         uint64_t value;
         bool     saturated;
     };
@@ -0,0 +1,94 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "unpredictable.hpp"
+#include "decoder.hpp"
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+
+
+namespace {
+
+    boost::atomic< uint64_t > counters[ arm::Encoding_Count ];
+
+    // Events are packed as encoding << 32 | pc so that each slot is
+    // written atomically
+    boost::atomic< uint64_t > ring[ arm::unpredictable_record::size ];
+    boost::atomic< uint64_t > ring_next( 0 );
+
+}
+
+
+void arm::unpredictable_count::add( Encoding encoding )
+{
+    counters[ encoding ].fetch_add( 1, boost::memory_order_relaxed );
+}
+
+
+uint64_t arm::unpredictable_count::count( Encoding encoding )
+{
+    return counters[ encoding ].load( boost::memory_order_relaxed );
+}
+
+
+void arm::unpredictable_count::reset()
+{
+    for( int e = 0; e < Encoding_Count; ++e )
+    {
+        counters[e].store( 0, boost::memory_order_relaxed );
+    }
+}
+
+
+void arm::unpredictable_record::add( Encoding encoding, uint32_t pc )
+{
+    const uint64_t i = ring_next.fetch_add( 1, boost::memory_order_relaxed );
+    ring[ i % size ].store( ( (uint64_t)encoding << 32 ) | pc,
+                            boost::memory_order_release );
+}
+
+
+size_t arm::unpredictable_record::events( unpredictable_event* events,
+                                          size_t max )
+{
+    const uint64_t next  = ring_next.load( boost::memory_order_acquire );
+    const uint64_t count = std::min< uint64_t >( std::min< uint64_t >(
+                                                     next, size ), max );
+
+    for( uint64_t i = 0; i < count; ++i )
+    {
+        const uint64_t e = ring[ ( next - count + i ) % size ].load(
+            boost::memory_order_acquire );
+        events[i].encoding = static_cast< Encoding >( e >> 32 );
+        events[i].pc       = (uint32_t)e;
+    }
+
+    return count;
+}
+
+
+uint64_t arm::unpredictable_record::total()
+{
+    return ring_next.load( boost::memory_order_relaxed );
+}
+
+
+void arm::unpredictable_record::reset()
+{
+    ring_next.store( 0, boost::memory_order_relaxed );
+}
@@ -0,0 +1,221 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file defines what behavior functions do when an instruction is
+ * UNPREDICTABLE. The processor type selects one of the policies below
+ * with a nested "unpredictable" type; the default one prints a
+ * warning. Policies only differ in their static report() function and
+ * in the per-core state they keep, so that the cheapest ones cost
+ * nothing.
+ */
+
+#ifndef __ARMV7_UNPREDICTABLE_HPP__
+#define __ARMV7_UNPREDICTABLE_HPP__
+
+#include "decoder.hpp"
+#include <boost/cstdint.hpp>
+#include <boost/mpl/has_xxx.hpp>
+#include <cstddef>
+
+namespace arm {
+
+
+    /**
+     * Members common to all policies. Engines stop after an
+     * instruction when "stops" is true and raised() returns true.
+     * armv7_core holds a "state" for its policy, which a zeroed core
+     * initializes.
+     */
+    struct unpredictable_policy
+    {
+        static const bool stops = false;
+
+        struct state
+        {
+        };
+
+        template< typename proc_type >
+        static bool raised( const proc_type& )
+        {
+            return false;
+        }
+    };
+
+
+    /**
+     * Prints a warning on std::cerr (default).
+     */
+    struct unpredictable_warn : unpredictable_policy
+    {
+        template< typename proc_type >
+        static void report( proc_type& proc, Encoding encoding,
+                            const char* function );
+    };
+
+
+    /**
+     * Does nothing.
+     */
+    struct unpredictable_ignore : unpredictable_policy
+    {
+        template< typename proc_type >
+        static void report( proc_type&, Encoding, const char* )
+        {
+        }
+    };
+
+
+    /**
+     * Counts UNPREDICTABLE instructions per encoding, in counters
+     * shared by all threads.
+     */
+    struct unpredictable_count : unpredictable_policy
+    {
+        template< typename proc_type >
+        static void report( proc_type& proc, Encoding encoding,
+                            const char* function );
+
+        static void     add( Encoding encoding );
+        static uint64_t count( Encoding encoding );
+        static void     reset();
+    };
+
+
+    /**
+     * Entry of the unpredictable_record ring buffer.
+     */
+    struct unpredictable_event
+    {
+        Encoding encoding;  /// Encoding of the behavior function
+        uint32_t pc;        /// Value of proc.PC, the address plus 8
+    };
+
+
+    /**
+     * Records UNPREDICTABLE instructions in a ring buffer shared by all
+     * threads, without locks. The oldest events are overwritten.
+     */
+    struct unpredictable_record : unpredictable_policy
+    {
+        enum { size = 256 };    /// Number of events kept
+
+        template< typename proc_type >
+        static void report( proc_type& proc, Encoding encoding,
+                            const char* function );
+
+        static void add( Encoding encoding, uint32_t pc );
+
+        /**
+         * Copies the last events (at most "max" of them, oldest first)
+         * to "events" and returns their number.
+         */
+        static size_t events( unpredictable_event* events, size_t max );
+
+        /**
+         * Returns the number of events recorded since the last reset,
+         * including overwritten ones.
+         */
+        static uint64_t total();
+
+        static void reset();
+    };
+
+
+    /**
+     * Stops the engines (arm::run(), block_cache::run()) after an
+     * UNPREDICTABLE instruction. The status is kept in the core until
+     * taken, so that cores run by the same thread do not see each
+     * other's.
+     */
+    struct unpredictable_status : unpredictable_policy
+    {
+        static const bool stops = true;
+
+        struct state
+        {
+            uint32_t raised;    /// Non-zero once raised
+            uint32_t encoding;  /// Encoding of the instruction
+        };
+
+        template< typename proc_type >
+        static void report( proc_type& proc, Encoding encoding,
+                            const char* function );
+
+        template< typename proc_type >
+        static bool raised( const proc_type& proc );
+
+        /**
+         * Returns the encoding of the last UNPREDICTABLE instruction
+         * executed by the core and clears it, or Encoding_Unknown.
+         */
+        template< typename proc_type >
+        static Encoding take( proc_type& proc );
+    };
+
+
+    namespace detail {
+        BOOST_MPL_HAS_XXX_TRAIT_DEF( unpredictable )
+
+        template< typename proc_type, bool has_policy >
+        struct unpredictable_of
+        {
+            typedef typename proc_type::unpredictable type;
+        };
+
+        template< typename proc_type >
+        struct unpredictable_of< proc_type, false >
+        {
+            typedef unpredictable_warn type;
+        };
+    }
+
+
+    /**
+     * Policy of the processor type: its nested "unpredictable" type if
+     * it has one, unpredictable_warn otherwise.
+     */
+    template< typename proc_type >
+    struct unpredictable_policy_of :
+        detail::unpredictable_of<
+            proc_type, detail::has_unpredictable< proc_type >::value >
+    {
+    };
+
+
+    /**
+     * Reports an UNPREDICTABLE instruction to the processor's policy.
+     * Called by the ARMV7_UNPREDICTABLE macro of the behavior
+     * functions.
+     */
+    template< typename proc_type >
+    void Unpredictable( proc_type& proc, Encoding encoding,
+                        const char* function );
+
+
+    /**
+     * Returns true if an engine must stop after the current
+     * instruction. Always false, at compile time, unless the policy
+     * stops.
+     */
+    template< typename proc_type >
+    bool UnpredictableRaised( proc_type& proc );
+
+
+} // namespace arm
+
+#endif // __ARMV7_UNPREDICTABLE_HPP__
@@ -0,0 +1,94 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_UNPREDICTABLE_IMPL_HPP__
+#define __ARMV7_UNPREDICTABLE_IMPL_HPP__
+
+#include "unpredictable.hpp"
+#include <iostream>
+
+
+template< typename proc_type >
+void arm::unpredictable_warn::report( proc_type&, Encoding,
+                                      const char* function )
+{
+    std::cerr << "Warning: arm::" << function
+              << "(): entering unpredictable state." << std::endl;
+}
+
+
+template< typename proc_type >
+void arm::unpredictable_count::report( proc_type&, Encoding encoding,
+                                       const char* )
+{
+    add( encoding );
+}
+
+
+template< typename proc_type >
+void arm::unpredictable_record::report( proc_type& proc,
+                                        Encoding encoding, const char* )
+{
+    add( encoding, proc.PC );
+}
+
+
+template< typename proc_type >
+void arm::unpredictable_status::report( proc_type& proc, Encoding encoding,
+                                        const char* )
+{
+    proc.UnpredictableState.raised   = 1;
+    proc.UnpredictableState.encoding = encoding;
+}
+
+
+template< typename proc_type >
+bool arm::unpredictable_status::raised( const proc_type& proc )
+{
+    return proc.UnpredictableState.raised != 0;
+}
+
+
+template< typename proc_type >
+arm::Encoding arm::unpredictable_status::take( proc_type& proc )
+{
+    if( !raised( proc ) )
+    {
+        return Encoding_Unknown;
+    }
+
+    proc.UnpredictableState.raised = 0;
+    return static_cast< Encoding >( proc.UnpredictableState.encoding );
+}
+
+
+template< typename proc_type >
+void arm::Unpredictable( proc_type& proc, Encoding encoding,
+                         const char* function )
+{
+    unpredictable_policy_of< proc_type >::type::report( proc, encoding,
+                                                         function );
+}
+
+
+template< typename proc_type >
+bool arm::UnpredictableRaised( proc_type& proc )
+{
+    typedef typename unpredictable_policy_of< proc_type >::type policy;
+    return policy::stops && policy::raised( proc );
+}
+
+#endif // __ARMV7_UNPREDICTABLE_IMPL_HPP__
@@ -0,0 +1,249 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * This file declares the virtual memory system architecture (VMSA):
+ * translation of the virtual addresses of a core through the
+ * short-descriptor translation tables (B3.5, p.1324), cached by a
+ * software TLB.
+ */
+
+#ifndef __ARMV7_VMSA_HPP__
+#define __ARMV7_VMSA_HPP__
+
+#include "memory.hpp"
+#include "types.hpp"
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace arm {
+
+
+    /**
+     * System control registers used by the translation.
+     * (B4.1, p.1518)
+     */
+    struct vmsa_registers
+    {
+        uint32_t SCTLR;      /// System Control Register, bit [0] is M
+        uint32_t TTBR0;      /// Translation Table Base Register 0
+        uint32_t TTBR1;      /// Translation Table Base Register 1
+        uint32_t TTBCR;      /// Translation Table Base Control Register
+        uint32_t DACR;       /// Domain Access Control Register
+        uint32_t CONTEXTIDR; /// Context ID Register, bits [7:0] are ASID
+    };
+
+
+    /**
+     * Kind of memory access, used for the permission checks.
+     */
+    enum VMSAAccess {
+        VMSAAccess_Read  = 1,
+        VMSAAccess_Write = 2,
+        VMSAAccess_Fetch = 4
+    };
+
+
+    /**
+     * Last translation fault. Data and prefetch abort exceptions are
+     * not implemented: a faulting read returns zero, a faulting fetch
+     * returns VMSAFetchFault, a faulting write is ignored, and the
+     * fault is recorded here, as the DFSR or IFSR and the DFAR or IFAR
+     * would hold it.
+     */
+    struct vmsa_fault
+    {
+        bool     faulted; /// A fault occurred since the last clear
+        DAbort   type;    /// Translation, Domain or Permission
+        uint32_t address; /// Faulting virtual address
+        uint32_t access;  /// VMSAAccess of the faulting access
+        int      domain;  /// Domain of the descriptor, if any
+        int      level;   /// Level of the translation table, 1 or 2
+    };
+
+
+    /**
+     * Instruction returned by a faulting fetch: a permanently
+     * undefined instruction (UDF), whose low halfword is the Thumb
+     * UDF too, so that the engines stop before it instead of running
+     * zeros (ANDEQ r0, r0, r0) through an unmapped or execute-never
+     * page.
+     */
+    const uint32_t VMSAFetchFault = 0xE7F0DEF0;
+
+
+    /**
+     * Memory management unit translating virtual addresses to the
+     * physical addresses of "mem_type". Translations are looked up in
+     * a direct-mapped TLB of "tlb_size" entries of 4 KB each, and the
+     * translation tables are only walked on a miss. When the physical
+     * memory has host pages (see HostPage()), the TLB entries keep
+     * the host address of their page, so that a hit accesses the host
+     * memory directly.
+     *
+     * As in hardware, the TLB is not kept consistent with the
+     * translation tables: after changing a descriptor or TTBR0, TTBR1
+     * or TTBCR, the TLB must be maintained with TLBIALL(), TLBIMVA(),
+     * TLBIASID() or TLBIMVAA(). The core does not implement the CP15
+     * operations, so the host calls these functions. Changing SCTLR or
+     * DACR with write_registers() flushes the whole TLB. Host pages of
+     * the physical memory must not change while the TLB holds them.
+     *
+     * The Security, Large Physical Address and Multiprocessing
+     * Extensions, the access flag and TEX remap are not implemented.
+     * Supersections translate to the low 32 bits of their address.
+     */
+    template< typename mem_type, unsigned int tlb_size = 256 >
+    class vmsa_mmu : boost::noncopyable
+    {
+    public:
+        /**
+         * Translates addresses to "memory", which must outlive the
+         * unit. The MMU is disabled and the core privileged.
+         */
+        explicit vmsa_mmu( mem_type& memory );
+
+        const vmsa_registers& registers() const;
+        void write_registers( const vmsa_registers& registers );
+
+        /**
+         * Sets whether accesses are privileged or user ones, as they
+         * would be from the current mode of the core.
+         */
+        void set_privileged( bool privileged );
+
+        /**
+         * TLB maintenance operations.
+         * (B4.2.2, p.1746)
+         */
+        void TLBIALL();                  /// Whole TLB
+        void TLBIMVA( uint32_t mva );    /// Entry of mva and ASID [7:0]
+        void TLBIASID( uint32_t asid );  /// Non-global entries of asid
+        void TLBIMVAA( uint32_t mva );   /// Entry of mva, for all ASIDs
+
+        /**
+         * Returns the TLB entry of "mva" if it is in the TLB.
+         */
+        CheckTLBRecord CheckTLB( uint32_t mva ) const;
+
+        /**
+         * Walks the translation tables for "mva", without using or
+         * filling the TLB. Returns false and records a translation
+         * fault for an access of kind "access" if there is no valid
+         * descriptor.
+         * (B3.13.3, p.1417)
+         */
+        bool TranslationTableWalk( uint32_t mva, uint32_t access,
+                                   TLBRecord& record );
+
+        /**
+         * Translates "va" for an access of kind "access", filling the
+         * TLB if needed. Returns false and records a fault if the
+         * access is not allowed.
+         * (B3.13.1, p.1414)
+         */
+        bool TranslateAddress( uint32_t va, uint32_t access,
+                               AddressDescriptor& desc );
+
+        const vmsa_fault& fault() const;
+        void clear_fault();
+
+        /**
+         * Accesses at virtual address "va" for an access of kind
+         * "access". Reading returns 0, or VMSAFetchFault for a fetch,
+         * and writing does nothing when the translation faults.
+         */
+        template< typename data_type >
+        data_type read( uint32_t va, uint32_t access );
+
+        template< typename data_type >
+        void write( uint32_t va, data_type data );
+
+    private:
+        /// Hot part of a TLB entry
+        struct tlb_entry
+        {
+            uint32_t page;    /// Virtual page number, or an invalid one
+            uint32_t frame;   /// Physical address of the page
+            uint8_t* host;    /// Host address of the page, or 0
+            uint32_t allowed; /// VMSAAccess bits allowed, privileged
+                              /// ones in [2:0] and user ones in [6:4]
+        };
+
+        /// Returns the host address of "va" if the TLB holds it with a
+        /// host page and allows "access", 0 otherwise
+        uint8_t* host_address( uint32_t va, uint32_t access ) const;
+
+        /// Slow paths of read() and write(), which may cross pages
+        uint64_t read_slow( uint32_t va, uint32_t access,
+                            unsigned int size );
+        void write_slow( uint32_t va, uint64_t data, unsigned int size );
+
+        /// Accesses physical memory through the mem_type functions
+        uint64_t read_physical( uint32_t pa, unsigned int size );
+        void write_physical( uint32_t pa, uint64_t data,
+                             unsigned int size );
+
+        /// Fills the TLB entry of "va", returns false on a fault
+        bool fill( uint32_t va, uint32_t access );
+
+        /// VMSAAccess allowed by a record, for privileged and user
+        /// accesses
+        uint32_t allowed( const TLBRecord& record ) const;
+
+        void record_fault( DAbort type, uint32_t va, uint32_t access,
+                           int domain, int level );
+
+        /// Whether the entry matches the current ASID
+        bool matches( unsigned int i ) const;
+
+        mem_type*      memory;
+        vmsa_registers regs;
+        uint32_t       shift;      /// 0 when privileged, 4 in user mode
+        vmsa_fault     last_fault;
+        tlb_entry      entries[ tlb_size ];
+        TLBRecord      records[ tlb_size ];  /// Cold part of the entries
+        uint8_t        asids  [ tlb_size ];  /// ASID of nG entries
+    };
+
+
+    /**
+     * Memory of a core accessing a vmsa_mmu. The iMem of the core
+     * should set "fetch", so that its reads check execute permissions.
+     * "mmu" must be set before the core runs.
+     */
+    template< typename mmu_type >
+    struct vmsa_mem
+    {
+        mmu_type* mmu;   /// Translating unit, shared by iMem and dMem
+        bool      fetch; /// Reads are instruction fetches
+
+        uint64_t read_dword( uint32_t addr ) const;
+        uint32_t read_word ( uint32_t addr ) const;
+        uint16_t read_half ( uint32_t addr ) const;
+        uint8_t  read_byte ( uint32_t addr ) const;
+
+        void write_dword( uint32_t addr, uint64_t data );
+        void write_word ( uint32_t addr, uint32_t data );
+        void write_half ( uint32_t addr, uint16_t data );
+        void write_byte ( uint32_t addr,  uint8_t data );
+    };
+
+
+} // namespace arm
+
+#endif // __ARMV7_VMSA_HPP__
@@ -0,0 +1,638 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARMV7_VMSA_IMPL_HPP__
+#define __ARMV7_VMSA_IMPL_HPP__
+
+#include "vmsa.hpp"
+#include "function.hpp"
+#include "memory_impl.hpp"
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace arm {
+    namespace detail {
+
+        const uint32_t VMSAInvalidPage = 0xFFFFFFFF;
+
+        /**
+         * Memory attributes of the TEX, C and B bits of a descriptor,
+         * with TEX remap disabled.
+         * (B3.8.2, p.1367)
+         */
+        inline MemoryAttributes VMSAMemoryAttributes( uint32_t tex,
+                                                      uint32_t c,
+                                                      uint32_t b,
+                                                      uint32_t s )
+        {
+            MemoryAttributes attrs;
+            memset( &attrs, 0, sizeof( attrs ) );
+
+            if( tex & 4 )
+            {
+                // Cacheable memory, outer policy in TEX[1:0]
+                attrs.type          = MemType_Normal;
+                attrs.innerattrs[0] = b;
+                attrs.innerattrs[1] = c;
+                attrs.outerattrs[0] = tex & 1;
+                attrs.outerattrs[1] = ( tex >> 1 ) & 1;
+                attrs.shareable     = s;
+            }
+            else if( tex == 0 && c == 0 )
+            {
+                attrs.type      = b ? MemType_Device : MemType_StronglyOrdered;
+                attrs.shareable = true;
+            }
+            else if( tex == 2 && c == 0 && b == 0 )
+            {
+                attrs.type = MemType_Device;
+            }
+            else
+            {
+                // Write-through or write-back, or non-cacheable with
+                // TEX = 001
+                attrs.type          = MemType_Normal;
+                attrs.innerattrs[0] = tex == 0 ? !b : b;
+                attrs.innerattrs[1] = c;
+                attrs.outerattrs[0] = attrs.innerattrs[0];
+                attrs.outerattrs[1] = attrs.innerattrs[1];
+                attrs.shareable     = s;
+            }
+
+            attrs.outershareable = attrs.shareable;
+            return attrs;
+        }
+
+        /**
+         * VMSAAccess allowed by the AP[2:0] bits of a descriptor, for
+         * privileged accesses in bits [2:0] and user ones in [6:4].
+         * (B3.7.1, p.1357)
+         */
+        inline uint32_t VMSAAccessAllowed( uint32_t ap, bool xn )
+        {
+            const uint32_t r  = VMSAAccess_Read | VMSAAccess_Fetch;
+            const uint32_t rw = r | VMSAAccess_Write;
+
+            static const uint32_t allowed[8] =
+            {
+                0,                  // 000: no access
+                rw,                 // 001: privileged only
+                rw | ( r << 4 ),    // 010: user read-only
+                rw | ( rw << 4 ),   // 011: full access
+                0,                  // 100: reserved
+                r,                  // 101: privileged read-only
+                r | ( r << 4 ),     // 110: read-only
+                r | ( r << 4 )      // 111: read-only
+            };
+
+            const uint32_t fetch = VMSAAccess_Fetch * 0x11;
+            return xn ? allowed[ ap ] & ~fetch : allowed[ ap ];
+        }
+
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+arm::vmsa_mmu< mem_type, tlb_size >::vmsa_mmu( mem_type& memory )
+    : memory( &memory ),
+      shift( 0 )
+{
+    memset( &regs, 0, sizeof( regs ) );
+    memset( &last_fault, 0, sizeof( last_fault ) );
+    memset( records, 0, sizeof( records ) );
+    memset( asids, 0, sizeof( asids ) );
+    TLBIALL();
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+const arm::vmsa_registers&
+arm::vmsa_mmu< mem_type, tlb_size >::registers() const
+{
+    return regs;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::write_registers(
+    const vmsa_registers& registers )
+{
+    // The TLB entries hold the permissions of their domain, and are
+    // identity mappings when the MMU is disabled
+    const bool flush = registers.SCTLR != regs.SCTLR ||
+                       registers.DACR  != regs.DACR;
+    regs = registers;
+
+    if( flush )
+    {
+        TLBIALL();
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::set_privileged( bool privileged )
+{
+    shift = privileged ? 0 : 4;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::TLBIALL()
+{
+    for( unsigned int i = 0; i < tlb_size; ++i )
+    {
+        entries[i].page    = detail::VMSAInvalidPage;
+        entries[i].frame   = 0;
+        entries[i].host    = 0;
+        entries[i].allowed = 0;
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::TLBIMVA( uint32_t mva )
+{
+    // The ASID is the one of the operand, not the current one
+    const unsigned int i = ( mva >> 12 ) % tlb_size;
+    if( entries[i].page == mva >> 12 &&
+        ( !records[i].nG || asids[i] == ( mva & 0xFF ) ) )
+    {
+        entries[i].page = detail::VMSAInvalidPage;
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::TLBIASID( uint32_t asid )
+{
+    for( unsigned int i = 0; i < tlb_size; ++i )
+    {
+        if( records[i].nG && asids[i] == ( asid & 0xFF ) )
+        {
+            entries[i].page = detail::VMSAInvalidPage;
+        }
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::TLBIMVAA( uint32_t mva )
+{
+    const unsigned int i = ( mva >> 12 ) % tlb_size;
+    if( entries[i].page == mva >> 12 )
+    {
+        entries[i].page = detail::VMSAInvalidPage;
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+arm::CheckTLBRecord
+arm::vmsa_mmu< mem_type, tlb_size >::CheckTLB( uint32_t mva ) const
+{
+    const unsigned int i = ( mva >> 12 ) % tlb_size;
+
+    CheckTLBRecord result;
+    result.tlbhit = entries[i].page == mva >> 12 && matches( i );
+    if( result.tlbhit )
+    {
+        result.tlbrecord = records[i];
+    }
+    return result;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+bool arm::vmsa_mmu< mem_type, tlb_size >::TranslationTableWalk(
+    uint32_t mva, uint32_t access, TLBRecord& record )
+{
+    memset( &record, 0, sizeof( record ) );
+
+    // TTBR0 translates the addresses whose top TTBCR.N bits are zero
+    // (B3.5.4, p.1330)
+    const uint32_t n = Bits< 2, 0 >( regs.TTBCR );
+    uint32_t l1_addr;
+    bool     disabled;
+    if( n == 0 || ( mva >> ( 32 - n ) ) == 0 )
+    {
+        l1_addr  = ( regs.TTBR0 & ( 0xFFFFFFFF << ( 14 - n ) ) ) |
+                   ( ( ( mva >> 20 ) & ( 0xFFF >> n ) ) << 2 );
+        disabled = Bits< 4, 4 >( regs.TTBCR );  // PD0
+    }
+    else
+    {
+        l1_addr  = ( regs.TTBR1 & 0xFFFFC000 ) | ( ( mva >> 20 ) << 2 );
+        disabled = Bits< 5, 5 >( regs.TTBCR );  // PD1
+    }
+
+    const uint32_t l1 = disabled ? 0 : memory->read_word( l1_addr );
+    uint32_t pa, ap, xn, tex, s, ng;
+
+    switch( Bits< 1, 0 >( l1 ) )
+    {
+    case 1:
+    {
+        // Page table (B3.5.1, p.1326)
+        record.domain = Bits< 8, 5 >( l1 );
+
+        const uint32_t l2 = memory->read_word(
+            ( l1 & 0xFFFFFC00 ) | ( Bits< 19, 12 >( mva ) << 2 ) );
+
+        if( Bits< 1, 0 >( l2 ) == 0 )
+        {
+            record_fault( DAbort_Translation, mva, access,
+                          record.domain, 2 );
+            return false;
+        }
+        else if( Bits< 1, 0 >( l2 ) == 1 )
+        {
+            record.type = TLBRecType_LargePage;
+            pa  = ( l2 & 0xFFFF0000 ) | ( mva & 0x0000F000 );
+            xn  = Bits< 15, 15 >( l2 );
+            tex = Bits< 14, 12 >( l2 );
+        }
+        else
+        {
+            record.type = TLBRecType_SmallPage;
+            pa  = l2 & 0xFFFFF000;
+            xn  = Bits< 0, 0 >( l2 );
+            tex = Bits< 8, 6 >( l2 );
+        }
+
+        ap = ( Bits< 9, 9 >( l2 ) << 2 ) | Bits< 5, 4 >( l2 );
+        s  = Bits< 10, 10 >( l2 );
+        ng = Bits< 11, 11 >( l2 );
+        record.addrdesc.memattrs = detail::VMSAMemoryAttributes(
+            tex, Bits< 3, 3 >( l2 ), Bits< 2, 2 >( l2 ), s );
+        break;
+    }
+
+    case 2:
+        // Section or supersection (B3.5.1, p.1326)
+        if( Bits< 18, 18 >( l1 ) )
+        {
+            record.type = TLBRecType_Supersection;
+            pa = ( l1 & 0xFF000000 ) | ( mva & 0x00FFF000 );
+        }
+        else
+        {
+            record.type   = TLBRecType_Section;
+            record.domain = Bits< 8, 5 >( l1 );
+            pa = ( l1 & 0xFFF00000 ) | ( mva & 0x000FF000 );
+        }
+
+        record.sectionnotpage = true;
+        ap  = ( Bits< 15, 15 >( l1 ) << 2 ) | Bits< 11, 10 >( l1 );
+        xn  = Bits< 4, 4 >( l1 );
+        tex = Bits< 14, 12 >( l1 );
+        s   = Bits< 16, 16 >( l1 );
+        ng  = Bits< 17, 17 >( l1 );
+        record.addrdesc.memattrs = detail::VMSAMemoryAttributes(
+            tex, Bits< 3, 3 >( l1 ), Bits< 2, 2 >( l1 ), s );
+        break;
+
+    default:
+        record_fault( DAbort_Translation, mva, access, 0, 1 );
+        return false;
+    }
+
+    record.perms.ap = ap;
+    record.perms.xn = xn;
+    record.nG       = ng;
+    record.addrdesc.paddress.physicaladdress = pa;
+    record.addrdesc.paddress.NS = true;
+    return true;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+bool arm::vmsa_mmu< mem_type, tlb_size >::TranslateAddress(
+    uint32_t va, uint32_t access, AddressDescriptor& desc )
+{
+    const unsigned int i = ( va >> 12 ) % tlb_size;
+
+    if( !( entries[i].page == va >> 12 && matches( i ) ) &&
+        !fill( va, access ) )
+    {
+        return false;
+    }
+
+    if( !( ( entries[i].allowed >> shift ) & access ) )
+    {
+        // Domain fault if the domain has no access (B3.12.3, p.1403)
+        const uint32_t domain = Bits< 1, 0 >(
+            regs.DACR >> ( 2 * records[i].domain ) );
+        record_fault( domain == 1 ? DAbort_Permission : DAbort_Domain,
+                      va, access, records[i].domain,
+                      records[i].sectionnotpage ? 1 : 2 );
+        return false;
+    }
+
+    desc = records[i].addrdesc;
+    desc.paddress.physicaladdress = entries[i].frame | ( va & 0xFFF );
+    return true;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+const arm::vmsa_fault& arm::vmsa_mmu< mem_type, tlb_size >::fault() const
+{
+    return last_fault;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::clear_fault()
+{
+    last_fault.faulted = false;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+template< typename data_type >
+inline data_type arm::vmsa_mmu< mem_type, tlb_size >::read( uint32_t va,
+                                                             uint32_t access )
+{
+    if( ( va & 0xFFF ) <= 0x1000 - sizeof( data_type ) )
+    {
+        const uint8_t* host = host_address( va, access );
+        if( host )
+        {
+            data_type data;
+            memcpy( &data, host, sizeof( data_type ) );
+            return data;
+        }
+    }
+    return data_type( read_slow( va, access, sizeof( data_type ) ) );
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+template< typename data_type >
+inline void arm::vmsa_mmu< mem_type, tlb_size >::write( uint32_t va,
+                                                        data_type data )
+{
+    if( ( va & 0xFFF ) <= 0x1000 - sizeof( data_type ) )
+    {
+        uint8_t* host = host_address( va, VMSAAccess_Write );
+        if( host )
+        {
+            memcpy( host, &data, sizeof( data_type ) );
+            return;
+        }
+    }
+    write_slow( va, data, sizeof( data_type ) );
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+inline uint8_t* arm::vmsa_mmu< mem_type, tlb_size >::host_address(
+    uint32_t va, uint32_t access ) const
+{
+    const unsigned int i = ( va >> 12 ) % tlb_size;
+    const tlb_entry&   e = entries[i];
+
+    if( e.page == va >> 12 && e.host && ( ( e.allowed >> shift ) & access ) &&
+        matches( i ) )
+    {
+        return e.host + ( va & 0xFFF );
+    }
+    return 0;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+uint64_t arm::vmsa_mmu< mem_type, tlb_size >::read_slow( uint32_t va,
+                                                         uint32_t access,
+                                                         unsigned int size )
+{
+    AddressDescriptor first, last;
+    if( !TranslateAddress( va, access, first ) ||
+        !TranslateAddress( va + size - 1, access, last ) )
+    {
+        return access == VMSAAccess_Fetch ? VMSAFetchFault : 0;
+    }
+
+    if( ( va & 0xFFF ) <= 0x1000 - size )
+    {
+        return read_physical( first.paddress.physicaladdress, size );
+    }
+
+    // Across two pages, in little-endian order
+    uint64_t data = 0;
+    for( unsigned int b = 0; b < size; ++b )
+    {
+        AddressDescriptor desc;
+        TranslateAddress( va + b, access, desc );
+        data |= read_physical( desc.paddress.physicaladdress, 1 ) << ( 8 * b );
+    }
+    return data;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::write_slow( uint32_t va,
+                                                      uint64_t data,
+                                                      unsigned int size )
+{
+    // Both pages are checked first, so that a faulting write does not
+    // write anything
+    AddressDescriptor first, last;
+    if( !TranslateAddress( va, VMSAAccess_Write, first ) ||
+        !TranslateAddress( va + size - 1, VMSAAccess_Write, last ) )
+    {
+        return;
+    }
+
+    if( ( va & 0xFFF ) <= 0x1000 - size )
+    {
+        write_physical( first.paddress.physicaladdress, data, size );
+        return;
+    }
+
+    for( unsigned int b = 0; b < size; ++b )
+    {
+        AddressDescriptor desc;
+        TranslateAddress( va + b, VMSAAccess_Write, desc );
+        write_physical( desc.paddress.physicaladdress, data >> ( 8 * b ), 1 );
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+uint64_t arm::vmsa_mmu< mem_type, tlb_size >::read_physical(
+    uint32_t pa, unsigned int size )
+{
+    switch( size )
+    {
+    case 8:  return memory->read_dword( pa );
+    case 4:  return memory->read_word ( pa );
+    case 2:  return memory->read_half ( pa );
+    default: return memory->read_byte ( pa );
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::write_physical(
+    uint32_t pa, uint64_t data, unsigned int size )
+{
+    switch( size )
+    {
+    case 8:  memory->write_dword( pa, data );           break;
+    case 4:  memory->write_word ( pa, uint32_t( data ) ); break;
+    case 2:  memory->write_half ( pa, uint16_t( data ) ); break;
+    default: memory->write_byte ( pa,  uint8_t( data ) ); break;
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+bool arm::vmsa_mmu< mem_type, tlb_size >::fill( uint32_t va,
+                                                uint32_t access )
+{
+    const unsigned int i = ( va >> 12 ) % tlb_size;
+    TLBRecord record;
+
+    if( Bits< 0, 0 >( regs.SCTLR ) == 0 )
+    {
+        // Flat mapping (B3.2.1, p.1306)
+        memset( &record, 0, sizeof( record ) );
+        record.type = TLBRecType_MMUDisabled;
+        record.addrdesc.memattrs.type = MemType_StronglyOrdered;
+        record.addrdesc.paddress.physicaladdress = va & 0xFFFFF000;
+        record.addrdesc.paddress.NS = true;
+        entries[i].allowed = 0x77;
+    }
+    else if( TranslationTableWalk( va, access, record ) )
+    {
+        entries[i].allowed = allowed( record );
+    }
+    else
+    {
+        return false;
+    }
+
+    const uint32_t frame = record.addrdesc.paddress.physicaladdress;
+    entries[i].page  = va >> 12;
+    entries[i].frame = frame;
+    entries[i].host  = HostPage( *memory, frame );
+    records[i]       = record;
+    asids[i]         = Bits< 7, 0 >( regs.CONTEXTIDR );
+    return true;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+uint32_t arm::vmsa_mmu< mem_type, tlb_size >::allowed(
+    const TLBRecord& record ) const
+{
+    // Domain access control (B3.12.3, p.1403)
+    switch( Bits< 1, 0 >( regs.DACR >> ( 2 * record.domain ) ) )
+    {
+    case 1:  return detail::VMSAAccessAllowed( record.perms.ap,
+                                               record.perms.xn );
+    case 3:  return 0x77;  // Manager: no checks
+    default: return 0;     // No access, or reserved
+    }
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+void arm::vmsa_mmu< mem_type, tlb_size >::record_fault( DAbort type,
+                                                        uint32_t va,
+                                                        uint32_t access,
+                                                        int domain,
+                                                        int level )
+{
+    last_fault.faulted = true;
+    last_fault.type    = type;
+    last_fault.address = va;
+    last_fault.access  = access;
+    last_fault.domain  = domain;
+    last_fault.level   = level;
+}
+
+
+template< typename mem_type, unsigned int tlb_size >
+inline bool arm::vmsa_mmu< mem_type, tlb_size >::matches(
+    unsigned int i ) const
+{
+    return !records[i].nG || asids[i] == Bits< 7, 0 >( regs.CONTEXTIDR );
+}
+
+
+template< typename mmu_type >
+uint64_t arm::vmsa_mem< mmu_type >::read_dword( uint32_t addr ) const
+{
+    return mmu->template read< uint64_t >( addr, VMSAAccess_Read );
+}
+
+
+template< typename mmu_type >
+uint32_t arm::vmsa_mem< mmu_type >::read_word( uint32_t addr ) const
+{
+    return mmu->template read< uint32_t >(
+        addr, fetch ? VMSAAccess_Fetch : VMSAAccess_Read );
+}
+
+
+template< typename mmu_type >
+uint16_t arm::vmsa_mem< mmu_type >::read_half( uint32_t addr ) const
+{
+    return mmu->template read< uint16_t >(
+        addr, fetch ? VMSAAccess_Fetch : VMSAAccess_Read );
+}
+
+
+template< typename mmu_type >
+uint8_t arm::vmsa_mem< mmu_type >::read_byte( uint32_t addr ) const
+{
+    return mmu->template read< uint8_t >( addr, VMSAAccess_Read );
+}
+
+
+template< typename mmu_type >
+void arm::vmsa_mem< mmu_type >::write_dword( uint32_t addr, uint64_t data )
+{
+    mmu->write( addr, data );
+}
+
+
+template< typename mmu_type >
+void arm::vmsa_mem< mmu_type >::write_word( uint32_t addr, uint32_t data )
+{
+    mmu->write( addr, data );
+}
+
+
+template< typename mmu_type >
+void arm::vmsa_mem< mmu_type >::write_half( uint32_t addr, uint16_t data )
+{
+    mmu->write( addr, data );
+}
+
+
+template< typename mmu_type >
+void arm::vmsa_mem< mmu_type >::write_byte( uint32_t addr, uint8_t data )
+{
+    mmu->write( addr, data );
+}
+
+#endif // __ARMV7_VMSA_IMPL_HPP__
@@ -0,0 +1,228 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the lockstep batch engine.
+ */
+
+#ifndef __ARMV7_BATCH_TEST_HPP__
+#define __ARMV7_BATCH_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    typedef arm::batch_core< test_mem<1024> > test_batch;
+
+    typedef arm::armv7_core< arm::packed_cpsr, test_reg,
+                             test_bank, test_mem<1024> > batch_test_proc;
+
+    // Each lane adds r0 or 3 to r1 for each of the 10 low bits of r0,
+    // then calls a function if the sum is above 20
+    const uint32_t batch_test_program[] =
+    {
+        0xE3A01000,     // 0x00: mov   r1, #0
+        0xE3A0200A,     // 0x04: mov   r2, #10
+        0xE3100001,     // 0x08: tst   r0, #1
+        0x10811000,     // 0x0C: addne r1, r1, r0
+        0x02811003,     // 0x10: addeq r1, r1, #3
+        0xE1A000A0,     // 0x14: lsr   r0, r0, #1
+        0xE2522001,     // 0x18: subs  r2, r2, #1
+        0x1AFFFFF9,     // 0x1C: bne   0x08
+        0xE3510014,     // 0x20: cmp   r1, #20
+        0xCB000001,     // 0x24: blgt  0x30
+        0xE5831000,     // 0x28: str   r1, [r3]
+        0xEF000000,     // 0x2C: svc   #0
+        0xE0214100,     // 0x30: eor   r4, r1, r0, lsl #2
+        0xE12FFF1E      // 0x34: bx    lr
+    };
+
+    uint32_t NextBatchTestValue( uint32_t& seed )
+    {
+        seed = seed * 1103515245 + 12345;
+        return seed;
+    }
+
+    // Checks that lane "l" is in the same state as "proc"
+    void CheckBatchLane( test_batch& batch, unsigned int l,
+                         batch_test_proc& proc )
+    {
+        for( int i = 0; i < 15; ++i )
+        {
+            BOOST_CHECK_EQUAL( batch.R[i][l], proc.R[i] );
+        }
+        BOOST_CHECK_EQUAL( batch.lane[l].CPSR.word, proc.CPSR.word );
+        BOOST_CHECK_EQUAL( batch.lane[l].PC, proc.PC );
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE( batch_core_test )
+{
+    test_batch batch;
+
+    // Each lane works on its own column
+    batch.lane[2].R[5] = 7;
+    BOOST_CHECK_EQUAL( batch.R[5][2], 7u );
+    BOOST_CHECK_EQUAL( batch.R[5][3], 0u );
+
+    batch.R[15][7] = 9;
+    BOOST_CHECK_EQUAL( batch.lane[7].R[15], 9u );
+    BOOST_CHECK_EQUAL( (unsigned int)test_batch::size, 8u );
+}
+
+BOOST_AUTO_TEST_CASE( batch_cache_run_test )
+{
+    test_batch batch;
+    arm::batch_cache< test_batch > cache;
+
+    batch_test_proc procs[ test_batch::size ];
+    uint32_t        R[ test_batch::size ][16];
+
+    uint32_t seed = 23;
+    for( unsigned int l = 0; l < test_batch::size; ++l )
+    {
+        LoadTestProgram( procs[l], R[l], batch_test_program );
+        memcpy( batch.lane[l].iMem.words, batch_test_program,
+                sizeof( batch_test_program ) );
+
+        // Inputs with few and many bits set
+        const uint32_t input = l < 4 ? l : NextBatchTestValue( seed );
+        batch.lane[l].R[0] = procs[l].R[0] = input;
+        batch.lane[l].R[3] = procs[l].R[3] = 0x100;
+    }
+
+    uint64_t total = 0;
+    for( unsigned int l = 0; l < test_batch::size; ++l )
+    {
+        total += arm::run( procs[l], 1000 );
+    }
+
+    BOOST_CHECK_EQUAL( cache.run( batch, 1000 ), total );
+    for( unsigned int l = 0; l < test_batch::size; ++l )
+    {
+        CheckBatchLane( batch, l, procs[l] );
+        BOOST_CHECK_EQUAL( batch.lane[l].dMem.read_word( 0x100 ),
+                           procs[l].dMem.read_word( 0x100 ) );
+        BOOST_CHECK_EQUAL( batch.lane[l].PC, 0x2Cu );
+    }
+
+    // Lane 0 adds 3 ten times, lane 1 adds 1 once and 3 nine times
+    BOOST_CHECK_EQUAL( batch.R[1][0], 30u );
+    BOOST_CHECK_EQUAL( batch.R[4][0], 30u );
+    BOOST_CHECK_EQUAL( batch.R[1][1], 28u );
+
+    // Stopped lanes do not move
+    BOOST_CHECK_EQUAL( cache.run( batch, 1000 ), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( batch_cache_max_instrs_test )
+{
+    test_batch batch;
+    arm::batch_cache< test_batch > cache;
+
+    for( unsigned int l = 0; l < test_batch::size; ++l )
+    {
+        memcpy( batch.lane[l].iMem.words, batch_test_program,
+                sizeof( batch_test_program ) );
+        batch.lane[l].R[0] = l;
+    }
+
+    BOOST_CHECK_EQUAL( cache.run( batch, 3 ), 3u * test_batch::size );
+    for( unsigned int l = 0; l < test_batch::size; ++l )
+    {
+        BOOST_CHECK_EQUAL( batch.lane[l].PC, 0x0Cu );
+        BOOST_CHECK_EQUAL( batch.R[2][l], 10u );
+        BOOST_CHECK_EQUAL( (uint32_t)batch.lane[l].CPSR.Z, l & 1 ? 0u : 1u );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( batch_cache_lanes_test )
+{
+    // Random data-processing instructions, executed by all lanes at
+    // once, against each lane executing them on its own
+    const uint32_t opcodes[] = { 0x0, 0x1, 0x2, 0x4, 0x8, 0x9, 0xA, 0xB,
+                                 0xC, 0xD, 0xE, 0xF };
+
+    test_batch batch;
+    arm::batch_cache< test_batch > cache;
+
+    batch_test_proc procs[ test_batch::size ];
+    uint32_t        R[ test_batch::size ][16];
+
+    uint32_t seed = 29;
+    for( int n = 0; n < 2000; ++n )
+    {
+        const uint32_t r      = NextBatchTestValue( seed );
+        const uint32_t opcode = opcodes[ ( r >> 8 ) % 12 ];
+        const bool     test   = opcode >= 0x8 && opcode <= 0xB;
+        const uint32_t s      = test ? 1 : ( r >> 12 ) & 1;
+        const uint32_t rn     = opcode == 0xD || opcode == 0xF ? 0 :
+                                ( r >> 16 ) % 13;
+        const uint32_t rd     = test ? 0 : ( r >> 20 ) % 13;
+        const uint32_t cond   = ( r >> 24 ) % 15;
+        const uint32_t low    = NextBatchTestValue( seed );
+
+        uint32_t instr = cond << 28 | opcode << 21 | s << 20 | rn << 16 |
+                         rd << 12;
+        if( r & 1 )
+        {
+            instr |= 1 << 25 | ( low & 0xFFF );            // imm12
+        }
+        else
+        {
+            instr |= ( low & 0xFE0 ) | ( ( low >> 16 ) % 15 ); // shift Rm
+        }
+
+        cache.flush();
+        for( unsigned int l = 0; l < test_batch::size; ++l )
+        {
+            memset( static_cast< void* >( &procs[l] ), 0,
+                    sizeof( procs[l] ) );
+            procs[l].R = R[l];
+            procs[l].iMem.words[0] = instr;
+            batch.lane[l].iMem.words[0] = instr;
+            batch.lane[l].PC = 0;
+
+            const uint32_t cpsr = NextBatchTestValue( seed ) & 0xF0000000;
+            procs[l].CPSR.word = batch.lane[l].CPSR.word = cpsr;
+            for( int i = 0; i < 15; ++i )
+            {
+                R[l][i] = batch.R[i][l] = NextBatchTestValue( seed ) >>
+                                          ( l & 3 ) * 8;
+            }
+            R[l][15] = batch.R[15][l] = 0;
+
+            arm::run( procs[l], 1 );
+        }
+
+        BOOST_CHECK_EQUAL( cache.run( batch, 1 ), (uint64_t)test_batch::size );
+        for( unsigned int l = 0; l < test_batch::size; ++l )
+        {
+            CheckBatchLane( batch, l, procs[l] );
+        }
+    }
+}
+
+#endif // __ARMV7_BATCH_TEST_HPP__
@@ -0,0 +1,210 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the ARMv7 basic block cache.
+ */
+
+#ifndef __ARMV7_BLOCK_TEST_HPP__
+#define __ARMV7_BLOCK_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    // Sums 10..1 in a loop, then calls a function
+    const uint32_t block_test_program[] =
+    {
+        0xE3A00000,     // 0x00: mov  r0, #0
+        0xE3A0100A,     // 0x04: mov  r1, #10
+        0xE0800001,     // 0x08: add  r0, r0, r1
+        0xE2511001,     // 0x0C: subs r1, r1, #1
+        0x1AFFFFFC,     // 0x10: bne  0x08
+        0xEB000001,     // 0x14: bl   0x20
+        0xE7F000F0,     // 0x18: udf
+        0xE7F000F0,     // 0x1C: udf
+        0xE3A02001,     // 0x20: mov  r2, #1
+        0xE12FFF1E      // 0x24: bx   lr
+    };
+
+    // Counts down with predicated instructions
+    const uint32_t block_cond_test_program[] =
+    {
+        0xE3A00005,     // 0x00: mov   r0, #5
+        0xE3500003,     // 0x04: cmp   r0, #3
+        0x03A01001,     // 0x08: moveq r1, #1
+        0x02811002,     // 0x0C: addeq r1, r1, #2
+        0x12822001,     // 0x10: addne r2, r2, #1
+        0x02933000,     // 0x14: addseq r3, r3, #0
+        0x02844001,     // 0x18: addeq r4, r4, #1
+        0xE2500001,     // 0x1C: subs  r0, r0, #1
+        0x1AFFFFF7,     // 0x20: bne   0x04
+        0xEF000000      // 0x24: svc   #0
+    };
+
+}
+
+
+BOOST_AUTO_TEST_CASE( block_cache_run_test )
+{
+    test_proc proc;
+    uint32_t  R[16];
+    LoadTestProgram( proc, R, block_test_program );
+
+    arm::block_cache< test_proc > cache;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 35u );
+    BOOST_CHECK_EQUAL( R[0], 55u );
+    BOOST_CHECK_EQUAL( R[1], 0u );
+    BOOST_CHECK_EQUAL( R[2], 1u );
+    BOOST_CHECK_EQUAL( R[14], 0x18u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x18u );
+
+    // 0x00, 0x08, 0x14, 0x20 and the empty block at 0x18
+    BOOST_CHECK_EQUAL( cache.size(), 5u );
+
+    const arm::basic_block< test_proc >* block = cache.lookup( proc, 0 );
+    BOOST_CHECK_EQUAL( block->instrs.size(), 5u );
+    BOOST_CHECK( block->branch );
+    BOOST_CHECK( block->next[1] == cache.lookup( proc, 0x08 ) );
+    BOOST_CHECK( block->next[0] == 0 );
+
+    // Running again starts over from the udf and does nothing
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 0u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x18u );
+}
+
+
+BOOST_AUTO_TEST_CASE( block_cache_max_instrs_test )
+{
+    test_proc proc;
+    uint32_t  R[16];
+    LoadTestProgram( proc, R, block_test_program );
+
+    arm::block_cache< test_proc > cache;
+    BOOST_CHECK_EQUAL( cache.run( proc, 7 ), 7u );
+    BOOST_CHECK_EQUAL( R[0], 19u );
+    BOOST_CHECK_EQUAL( R[1], 8u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x10u );
+
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 28u );
+    BOOST_CHECK_EQUAL( R[0], 55u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x18u );
+}
+
+
+BOOST_AUTO_TEST_CASE( block_cache_invalidate_test )
+{
+    test_proc proc;
+    uint32_t  R[16];
+    LoadTestProgram( proc, R, block_test_program );
+
+    // A branch to the instruction following the next one
+    proc.iMem.words[0] = 0xEA000000;    // 0x00: b    0x08
+    proc.iMem.words[1] = 0xE3A00007;    // 0x04: mov  r0, #7
+    proc.iMem.words[2] = 0xE7F000F0;    // 0x08: udf
+
+    arm::block_cache< test_proc > cache;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 1u );
+    BOOST_CHECK_EQUAL( R[0], 0u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x08u );
+
+    proc.iMem.words[0] = 0xE320F000;    // 0x00: nop
+    cache.invalidate( 0x00 );
+    BOOST_CHECK_EQUAL( cache.size(), 1u );
+
+    proc.PC = 0;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 2u );
+    BOOST_CHECK_EQUAL( R[0], 7u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x08u );
+
+    cache.flush();
+    BOOST_CHECK_EQUAL( cache.size(), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( block_cache_invalidate_links_test )
+{
+    test_proc proc;
+    uint32_t  R[16];
+    LoadTestProgram( proc, R, block_test_program );
+
+    arm::block_cache< test_proc > cache;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 35u );
+    BOOST_CHECK_EQUAL( cache.size(), 5u );
+
+    // Writes next to the blocks drop nothing
+    cache.invalidate( 0x200, 4 );
+    BOOST_CHECK_EQUAL( cache.size(), 5u );
+
+    // Only the links to the dropped block are cleared
+    typedef arm::basic_block< test_proc > block_type;
+    block_type* loop = cache.lookup( proc, 0x08 );
+    block_type* call = cache.lookup( proc, 0x14 );
+    BOOST_CHECK( loop->next[1] == loop );
+    BOOST_CHECK( call->next[1] != 0 );
+
+    cache.invalidate( 0x20 );
+    BOOST_CHECK_EQUAL( cache.size(), 4u );
+    BOOST_CHECK( cache.lookup( proc, 0 )->next[1] == loop );
+    BOOST_CHECK( loop->next[1] == loop );
+    BOOST_CHECK( call->next[1] == 0 );
+
+    // The dropped block is translated again when reached
+    proc.PC = 0;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 35u );
+    BOOST_CHECK_EQUAL( cache.size(), 5u );
+    BOOST_CHECK( call->next[1] == cache.lookup( proc, 0x20 ) );
+}
+
+BOOST_AUTO_TEST_CASE( block_cache_cond_test )
+{
+    test_proc expected, actual;
+    uint32_t  expected_R[16], actual_R[16];
+    LoadTestProgram( expected, expected_R, block_cond_test_program );
+    LoadTestProgram(   actual,   actual_R, block_cond_test_program );
+
+    arm::block_cache< test_proc > cache;
+    BOOST_CHECK_EQUAL( arm::run( expected, 1000 ),
+                       cache.run( actual, 1000 ) );
+    BOOST_CHECK_EQUAL( expected.PC, actual.PC );
+    BOOST_CHECK( memcmp( expected_R, actual_R, sizeof( expected_R ) ) == 0 );
+    BOOST_CHECK_EQUAL( actual_R[1], 3u );
+    BOOST_CHECK_EQUAL( actual_R[2], 4u );
+    BOOST_CHECK_EQUAL( actual_R[4], 1u );
+
+    // Predicated instructions are stored as AL, the flags are checked
+    // once per run
+    typedef arm::basic_block< test_proc > block_type;
+    const block_type* block = cache.lookup( actual, 0x04 );
+    BOOST_REQUIRE_EQUAL( block->instrs.size(), 8u );
+    BOOST_CHECK_EQUAL( block->instrs[1].instr, 0xE3A01001u );
+    BOOST_CHECK_EQUAL( block->instrs[1].cond, 0x0 );
+    BOOST_CHECK_EQUAL( block->checks[0], block_type::check_none );
+    BOOST_CHECK_EQUAL( block->checks[1], block_type::check_flags );
+    BOOST_CHECK_EQUAL( block->checks[2], block_type::check_previous );
+    BOOST_CHECK_EQUAL( block->checks[3], block_type::check_flags );
+    BOOST_CHECK_EQUAL( block->checks[4], block_type::check_flags );
+    BOOST_CHECK_EQUAL( block->checks[5], block_type::check_flags );
+    BOOST_CHECK_EQUAL( block->checks[7], block_type::check_flags );
+}
+
+#endif // __ARMV7_BLOCK_TEST_HPP__
@@ -0,0 +1,201 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the ARMv7 instruction decoder.
+ */
+
+#ifndef __ARMV7_DECODER_TEST_HPP__
+#define __ARMV7_DECODER_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <armv7/decoder.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+#define CHECK_DECODE( instr, expected )                                 \
+    BOOST_CHECK_EQUAL( arm::EncodingName( arm::DecodeEncoding( instr ) ), \
+                       arm::EncodingName( arm::Encoding_##expected ) )
+
+
+BOOST_AUTO_TEST_CASE( DecodeEncoding_test )
+{
+    // Words produced by an ARM assembler
+    CHECK_DECODE( 0xE0812003, ADD_reg_A1 );          // add   r2, r1, r3
+    CHECK_DECODE( 0xE28DD008, ADD_SP_imm_A1 );       // add   sp, sp, #8
+    CHECK_DECODE( 0xE28F0008, ADR_A1 );              // adr   r0, .+16
+    CHECK_DECODE( 0xE24F0008, ADR_A2 );              // adr   r0, .-0
+    CHECK_DECODE( 0xE29F0008, ADD_imm_A1 );          // adds  r0, pc, #8
+    CHECK_DECODE( 0xE25F0008, SUB_imm_A1 );          // subs  r0, pc, #8
+    CHECK_DECODE( 0xE2411001, SUB_imm_A1 );          // sub   r1, r1, #1
+    CHECK_DECODE( 0xE2511001, SUB_imm_A1 );          // subs  r1, r1, #1
+    CHECK_DECODE( 0xE3A00001, MOV_imm_A1 );          // mov   r0, #1
+    CHECK_DECODE( 0xE3010234, MOV_imm_A2 );          // movw  r0, #0x1234
+    CHECK_DECODE( 0xE3410234, MOVT_A1 );             // movt  r0, #0x1234
+    CHECK_DECODE( 0xE1A00000, MOV_reg_A1 );          // mov   r0, r0
+    CHECK_DECODE( 0xE1A00101, LSL_imm_A1 );          // lsl   r0, r1, #2
+    CHECK_DECODE( 0xE1A00061, RRX_A1 );              // rrx   r0, r1
+    CHECK_DECODE( 0xE1A00161, ROR_IMM_A1 );          // ror   r0, r1, #2
+    CHECK_DECODE( 0xE1A00211, LSL_reg_A1 );          // lsl   r0, r1, r2
+    CHECK_DECODE( 0xE1500001, CMP_reg_A1 );          // cmp   r0, r1
+    CHECK_DECODE( 0xE1500211, CMP_rsr_A1 );          // cmp   r0, r1, lsl r2
+    CHECK_DECODE( 0xE320F000, NOP_A1 );              // nop
+    CHECK_DECODE( 0xE328F00F, MSR_imm_A1 );          // msr   APSR_nzcvq, #15
+    CHECK_DECODE( 0xE10F0000, MRS_A1 );              // mrs   r0, APSR
+    CHECK_DECODE( 0xE12FF001, MSR_reg_A1 );          // msr   CPSR_fsxc, r1
+    CHECK_DECODE( 0xE0000291, MUL_A1 );              // mul   r0, r1, r2
+    CHECK_DECODE( 0xE0832291, UMULL_A1 );            // umull r2, r3, r1, r2
+    CHECK_DECODE( 0xE16F0F11, CLZ_A1 );              // clz   r0, r1
+    CHECK_DECODE( 0xE12FFF1E, BX_A1 );               // bx    lr
+    CHECK_DECODE( 0xE12FFF33, BLX_reg_A1 );          // blx   r3
+    CHECK_DECODE( 0xE1010081, SMLAxy_A1 );           // smlabb r1, r1, r0, r0
+    CHECK_DECODE( 0xE59F0004, LDR_lit_A1 );          // ldr   r0, [pc, #4]
+    CHECK_DECODE( 0xE5910004, LDR_imm_A1 );          // ldr   r0, [r1, #4]
+    CHECK_DECODE( 0xE7910002, LDR_reg_A1 );          // ldr   r0, [r1, r2]
+    CHECK_DECODE( 0xE4B10004, LDRT_A1 );             // ldrt  r0, [r1], #4
+    CHECK_DECODE( 0xE5C10000, STRB_imm_A1 );         // strb  r0, [r1]
+    CHECK_DECODE( 0xE1C020D0, LDRD_imm_A1 );         // ldrd  r2, r3, [r0]
+    CHECK_DECODE( 0xE1C020F0, STRD_imm_A1 );         // strd  r2, r3, [r0]
+    CHECK_DECODE( 0xE1D000B0, LDRH_imm_A1 );         // ldrh  r0, [r0]
+    CHECK_DECODE( 0xE1D000F0, LDRSH_imm_A1 );        // ldrsh r0, [r0]
+    CHECK_DECODE( 0xE0F000F2, LDRSHT_A1 );           // ldrsht r0, [r0], #2
+    CHECK_DECODE( 0xE1912F9F, LDREX_A1 );            // ldrex r2, [r1]
+    CHECK_DECODE( 0xE1814F92, STREX_A1 );            // strex r4, r2, [r1]
+    CHECK_DECODE( 0xE1B12F9F, LDREXD_A1 );           // ldrexd r2, r3, [r1]
+    CHECK_DECODE( 0xE1E14F92, STREXH_A1 );           // strexh r4, r2, [r1]
+    CHECK_DECODE( 0xE92D4010, PUSH_A1 );             // push  {r4, lr}
+    CHECK_DECODE( 0xE8BD8010, POP_A1 );              // pop   {r4, pc}
+    CHECK_DECODE( 0xE52DE004, PUSH_A2 );             // push  {lr}
+    CHECK_DECODE( 0xE49DF004, POP_A2 );              // pop   {pc}
+    CHECK_DECODE( 0xE8900006, LDM_A1 );              // ldm   r0, {r1, r2}
+    CHECK_DECODE( 0xE9800006, STMIB_STMFA_A1 );      // stmib r0, {r1, r2}
+    CHECK_DECODE( 0xEAFFFFFE, B_A1 );                // b     .
+    CHECK_DECODE( 0x1AFFFFFD, B_A1 );                // bne   .-4
+    CHECK_DECODE( 0xEBFFFFFE, BL_A1 );               // bl    .
+    CHECK_DECODE( 0xE6110F12, SADD16_A1 );           // sadd16 r0, r1, r2
+    CHECK_DECODE( 0xE6610FF2, UQSUB8_A1 );           // uqsub8 r0, r1, r2
+    CHECK_DECODE( 0xE6810FB2, SEL_A1 );              // sel   r0, r1, r2
+    CHECK_DECODE( 0xE6810012, PKH_A1 );              // pkhbt r0, r1, r2
+    CHECK_DECODE( 0xE6AF0071, SXTB_A1 );             // sxtb  r0, r1
+    CHECK_DECODE( 0xE6A10072, SXTAB_A1 );            // sxtab r0, r1, r2
+    CHECK_DECODE( 0xE6A70011, SSAT_A1 );             // ssat  r0, #8, r1
+    CHECK_DECODE( 0xE6BF0F31, REV_A1 );              // rev   r0, r1
+    CHECK_DECODE( 0xE6FF0F31, RBIT_A1 );             // rbit  r0, r1
+    CHECK_DECODE( 0xE6FF0071, UXTH_A1 );             // uxth  r0, r1
+    CHECK_DECODE( 0xE700F211, SMUAD_A1 );            // smuad r0, r1, r2
+    CHECK_DECODE( 0xE7003211, SMLAD_A1 );            // smlad r0, r1, r2, r3
+    CHECK_DECODE( 0xE750F211, SMMUL_A1 );            // smmul r0, r1, r2
+    CHECK_DECODE( 0xE780F211, USAD8_A1 );            // usad8 r0, r1, r2
+    CHECK_DECODE( 0xE7C7001F, BFC_A1 );              // bfc   r0, #0, #8
+    CHECK_DECODE( 0xE7C70011, BFI_A1 );              // bfi   r0, r1, #0, #8
+    CHECK_DECODE( 0xE7E70051, UBFX_A1 );             // ubfx  r0, r1, #0, #8
+    CHECK_DECODE( 0xFA000000, BLX_imm_A1 );          // blx   .+8
+    CHECK_DECODE( 0xF5D0F000, PLD_imm_A1 );          // pld   [r0]
+    CHECK_DECODE( 0xF1010200, SETEND_A1 );           // setend be
+    CHECK_DECODE( 0xF57FF01F, CLREX_A1 );            // clrex
+
+    // Encodings without a behavior function
+    CHECK_DECODE( 0xE320F003, Unknown );             // wfi
+    CHECK_DECODE( 0xEE070F15, Unknown );             // mcr
+    CHECK_DECODE( 0xEF000000, Unknown );             // svc   #0
+    CHECK_DECODE( 0xE7F000F0, Unknown );             // udf
+    CHECK_DECODE( 0xF57FF04F, Unknown );             // dsb
+    CHECK_DECODE( 0xF8900A00, Unknown );             // rfeia r0
+}
+
+
+BOOST_AUTO_TEST_CASE( DecodeEncoding_patterns_test )
+{
+    // The value of every pattern must decode to that pattern, unless
+    // a more specific one also covers it (e.g. MOV_reg_A1 and
+    // LSL_imm_A1 with a zero shift).
+    for( int e = 1; e < arm::Encoding_Count; ++e )
+    {
+        const arm::Encoding encoding = static_cast< arm::Encoding >( e );
+        const arm::EncodingPattern& p = arm::GetEncodingPattern( encoding );
+        const uint32_t instr = p.value | ( ~p.mask & 0xE0000000 );
+        const arm::Encoding decoded = arm::DecodeEncoding( instr );
+
+        BOOST_CHECK_MESSAGE( decoded != arm::Encoding_Unknown,
+                             arm::EncodingName( encoding ) );
+
+        if( decoded != encoding && decoded != arm::Encoding_Unknown )
+        {
+            const arm::EncodingPattern& q = arm::GetEncodingPattern( decoded );
+            BOOST_CHECK_MESSAGE( arm::BitCount( q.mask ) >
+                                 arm::BitCount( p.mask ),
+                                 arm::EncodingName( encoding ) );
+        }
+    }
+}
+
+
+#define CHECK_WRITES_PC( instr, expected )                              \
+    BOOST_CHECK_EQUAL( arm::WritesPC( arm::DecodeEncoding( instr ), instr ), \
+                       expected )
+
+
+BOOST_AUTO_TEST_CASE( WritesPC_test )
+{
+    CHECK_WRITES_PC( 0xEAFFFFFE, true  );           // b     .
+    CHECK_WRITES_PC( 0x1AFFFFFD, true  );           // bne   .-4
+    CHECK_WRITES_PC( 0xEBFFFFFE, true  );           // bl    .
+    CHECK_WRITES_PC( 0xE12FFF1E, true  );           // bx    lr
+    CHECK_WRITES_PC( 0xE12FFF33, true  );           // blx   r3
+    CHECK_WRITES_PC( 0xE1A0F00E, true  );           // mov   pc, lr
+    CHECK_WRITES_PC( 0xE08FF101, true  );           // add   pc, pc, r1, lsl #2
+    CHECK_WRITES_PC( 0xE59FF004, true  );           // ldr   pc, [pc, #4]
+    CHECK_WRITES_PC( 0xE49DF004, true  );           // pop   {pc}
+    CHECK_WRITES_PC( 0xE8BD8010, true  );           // pop   {r4, pc}
+    CHECK_WRITES_PC( 0xE8908006, true  );           // ldm   r0, {r1, r2, pc}
+    CHECK_WRITES_PC( 0xE1B0F00E, false );           // movs  pc, lr
+    CHECK_WRITES_PC( 0xE1A0000E, false );           // mov   r0, lr
+    CHECK_WRITES_PC( 0xE8BD0010, false );           // pop   {r4}
+    CHECK_WRITES_PC( 0xE5910004, false );           // ldr   r0, [r1, #4]
+    CHECK_WRITES_PC( 0xE0000291, false );           // mul   r0, r1, r2
+}
+
+
+BOOST_AUTO_TEST_CASE( decode_test )
+{
+    test_cpsr CPSR;
+    uint32_t  R[16];
+    memset( &CPSR, 0, sizeof( CPSR ) );
+    memset(     R, 0, sizeof( uint32_t ) * 16 );
+    test_proc proc = { CPSR, 0, R, {}, {} };
+
+    arm::DecodeResult< test_proc > d = arm::decode< test_proc >( 0xE0812003 );
+    BOOST_CHECK_EQUAL( d.encoding, arm::Encoding_ADD_reg_A1 );
+    arm::DecodeResult< test_proc >::handler_type handler =
+        &arm::ADD_reg_A1< test_proc >;
+    BOOST_CHECK( d.handler == handler );
+
+    // add r2, r1, r3
+    R[1] = 40; R[3] = 2;
+    d.handler( proc, 0xE0812003 );
+    BOOST_CHECK_EQUAL( R[2], 42u );
+
+    d = arm::decode< test_proc >( 0xEE070F15 );
+    BOOST_CHECK_EQUAL( d.encoding, arm::Encoding_Unknown );
+    BOOST_CHECK( d.handler == 0 );
+}
+
+#endif // __ARMV7_DECODER_TEST_HPP__
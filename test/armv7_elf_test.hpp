@@ -0,0 +1,240 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the ELF loader.
+ */
+
+#ifndef __ARMV7_ELF_TEST_HPP__
+#define __ARMV7_ELF_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <elf.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+
+namespace {
+
+    // Adds the words at 0x10100 and 0x10104, stores the sum at 0x10108
+    const uint32_t elf_test_program[] =
+    {
+        0xE59F100C,     // 0x8000: ldr   r1, [pc, #12]
+        0xE8910003,     // 0x8004: ldm   r1, {r0, r1}
+        0xE0800001,     // 0x8008: add   r0, r0, r1
+        0xE59F1000,     // 0x800C: ldr   r1, [pc, #0]
+        0xE5810008,     // 0x8010: str   r0, [r1, #8]
+        0x00010100      // 0x8014: .word 0x10100
+    };
+
+    /**
+     * ARM executable written to a temporary file, with a page-aligned
+     * text segment at 0x8000 and an unaligned data segment at 0x10100
+     * holding two words followed by 24 bytes of zeros. Its symbol
+     * table defines "main" and "data".
+     */
+    struct elf_test_file
+    {
+        std::string path;
+
+        elf_test_file( uint16_t machine = EM_ARM )
+        {
+            std::vector< uint8_t > file( 0x1400, 0 );
+
+            Elf32_Ehdr eh;
+            memset( &eh, 0, sizeof( eh ) );
+            memcpy( eh.e_ident, ELFMAG, SELFMAG );
+            eh.e_ident[ EI_CLASS ]   = ELFCLASS32;
+            eh.e_ident[ EI_DATA ]    = ELFDATA2LSB;
+            eh.e_ident[ EI_VERSION ] = EV_CURRENT;
+            eh.e_type      = ET_EXEC;
+            eh.e_machine   = machine;
+            eh.e_version   = EV_CURRENT;
+            eh.e_entry     = 0x8000;
+            eh.e_phoff     = sizeof( Elf32_Ehdr );
+            eh.e_shoff     = 0x1300;
+            eh.e_ehsize    = sizeof( Elf32_Ehdr );
+            eh.e_phentsize = sizeof( Elf32_Phdr );
+            eh.e_phnum     = 2;
+            eh.e_shentsize = sizeof( Elf32_Shdr );
+            eh.e_shnum     = 3;
+            memcpy( &file[0], &eh, sizeof( eh ) );
+
+            Elf32_Phdr ph[2];
+            memset( ph, 0, sizeof( ph ) );
+            ph[0].p_type   = PT_LOAD;
+            ph[0].p_offset = 0x1000;
+            ph[0].p_vaddr  = 0x8000;
+            ph[0].p_filesz = sizeof( elf_test_program );
+            ph[0].p_memsz  = sizeof( elf_test_program );
+            ph[0].p_flags  = PF_R | PF_X;
+            ph[1].p_type   = PT_LOAD;
+            ph[1].p_offset = 0x1100;
+            ph[1].p_vaddr  = 0x10100;
+            ph[1].p_filesz = 8;
+            ph[1].p_memsz  = 32;
+            ph[1].p_flags  = PF_R | PF_W;
+            memcpy( &file[ eh.e_phoff ], ph, sizeof( ph ) );
+
+            memcpy( &file[ 0x1000 ], elf_test_program,
+                    sizeof( elf_test_program ) );
+            const uint32_t data[] = { 40, 2 };
+            memcpy( &file[ 0x1100 ], data, sizeof( data ) );
+
+            // Data that must not be loaded after the data segment
+            memset( &file[ 0x1108 ], 0xFF, 0x18 );
+
+            Elf32_Sym sym[3];
+            memset( sym, 0, sizeof( sym ) );
+            sym[1].st_name  = 1;
+            sym[1].st_value = 0x8000;
+            sym[1].st_shndx = 1;
+            sym[2].st_name  = 6;
+            sym[2].st_value = 0x10100;
+            sym[2].st_shndx = 1;
+            memcpy( &file[ 0x1200 ], sym, sizeof( sym ) );
+            memcpy( &file[ 0x1240 ], "\0main\0data", 11 );
+
+            Elf32_Shdr sh[3];
+            memset( sh, 0, sizeof( sh ) );
+            sh[1].sh_type   = SHT_SYMTAB;
+            sh[1].sh_offset = 0x1200;
+            sh[1].sh_size   = sizeof( sym );
+            sh[1].sh_link   = 2;
+            sh[2].sh_type   = SHT_STRTAB;
+            sh[2].sh_offset = 0x1240;
+            sh[2].sh_size   = 11;
+            memcpy( &file[ eh.e_shoff ], sh, sizeof( sh ) );
+
+            char name[] = "/tmp/armv7_elf_testXXXXXX";
+            const int fd = mkstemp( name );
+            BOOST_REQUIRE( fd >= 0 );
+            BOOST_REQUIRE( write( fd, &file[0], file.size() ) ==
+                           ssize_t( file.size() ) );
+            close( fd );
+            path = name;
+        }
+
+        ~elf_test_file()
+        {
+            unlink( path.c_str() );
+        }
+    };
+
+    template< typename mem_type >
+    void CheckElfTestImage( const arm::elf_image& image, mem_type& mem )
+    {
+        BOOST_CHECK_EQUAL( image.entry, 0x8000u );
+        BOOST_CHECK_EQUAL( image.symbols.size(), 2u );
+        BOOST_CHECK_EQUAL( image.symbols.find( "main" )->second, 0x8000u );
+        BOOST_CHECK_EQUAL( image.symbols.find( "data" )->second, 0x10100u );
+
+        for( size_t i = 0; i < 6; ++i )
+        {
+            BOOST_CHECK_EQUAL( mem.read_word( 0x8000 + 4 * i ),
+                               elf_test_program[i] );
+        }
+        BOOST_CHECK_EQUAL( mem.read_word( 0x10100 ), 40u );
+        BOOST_CHECK_EQUAL( mem.read_word( 0x10104 ), 2u );
+        for( uint32_t addr = 0x10108; addr < 0x10120; addr += 4 )
+        {
+            BOOST_CHECK_EQUAL( mem.read_word( addr ), 0u );
+        }
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE( load_elf_paged_test )
+{
+    elf_test_file  file;
+    arm::paged_mem mem;
+    mem.write_word( 0x1010C, 0xFFFFFFFF );
+
+    const arm::elf_image image = arm::load_elf( file.path, mem );
+    CheckElfTestImage( image, mem );
+}
+
+BOOST_AUTO_TEST_CASE( load_elf_reserved_test )
+{
+    if( !arm::ReservedMemAvailable() )
+    {
+        return;
+    }
+
+    elf_test_file     file;
+    arm::reserved_mem mem;
+    const arm::elf_image image = arm::load_elf( file.path, mem );
+    CheckElfTestImage( image, mem );
+
+    // The mapped segment is a private copy of the file
+    mem.write_word( 0x8014, 0x10200 );
+    const arm::elf_file elf( file.path );
+    BOOST_CHECK_EQUAL( elf.segments()[0].data[ 0x14 ], 0x00 );
+    BOOST_CHECK_EQUAL( elf.segments()[0].data[ 0x15 ], 0x01 );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x8014 ), 0x10200u );
+}
+
+BOOST_AUTO_TEST_CASE( load_elf_generic_test )
+{
+    // Any memory type, one byte at a time
+    static test_mem< 0x20000 > mem;
+    memset( &mem, 0, sizeof( mem ) );
+
+    elf_test_file file;
+    const arm::elf_image image = arm::load_elf( file.path, mem );
+    CheckElfTestImage( image, mem );
+
+    // Run the loaded program
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             arm::shared_mem< test_mem< 0x20000 > > >
+        proc_type;
+
+    proc_type proc;
+    uint32_t  R[16];
+    memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+    memset( R, 0, sizeof( R ) );
+    proc.R = R;
+    proc.iMem.mem = &mem;
+    proc.dMem.mem = &mem;
+    proc.PC = image.entry;
+
+    arm::run( proc, 5 );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x10108 ), 42u );
+}
+
+BOOST_AUTO_TEST_CASE( load_elf_error_test )
+{
+    arm::paged_mem mem;
+    BOOST_CHECK_THROW( arm::load_elf( "/nonexistent/file", mem ),
+                       std::runtime_error );
+
+    elf_test_file file( EM_386 );
+    BOOST_CHECK_THROW( arm::load_elf( file.path, mem ), std::runtime_error );
+    BOOST_CHECK_EQUAL( mem.pages(), 0u );
+}
+
+#endif // __ARMV7_ELF_TEST_HPP__
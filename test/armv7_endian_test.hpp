@@ -0,0 +1,267 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the big-endian and unaligned data accesses.
+ */
+
+#ifndef __ARMV7_ENDIAN_TEST_HPP__
+#define __ARMV7_ENDIAN_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    struct little_endian_test_profile : arm::armv7a_profile
+    {
+        static const arm::Endianness data_endianness =
+            arm::Endianness_Little;
+    };
+
+    struct big_endian_test_profile : arm::armv7a_profile
+    {
+        static const arm::Endianness data_endianness = arm::Endianness_Big;
+    };
+
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             test_mem<1024>,
+                             little_endian_test_profile > little_test_proc;
+
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             test_mem<1024>,
+                             big_endian_test_profile > big_test_proc;
+
+    // Faults on all unaligned data accesses, as with SCTLR.A set
+    struct strict_test_profile : arm::armv7a_profile
+    {
+        static const bool alignment_check = true;
+    };
+
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             test_mem<1024>,
+                             strict_test_profile > strict_test_proc;
+
+    // Stops on alignment faults by throwing
+    struct throwing_test_profile : arm::armv7a_profile
+    {
+    };
+
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             test_mem<1024>,
+                             throwing_test_profile > throwing_test_proc;
+
+    unsigned int alignment_faults = 0;
+
+    // Loads and stores the same data in both endiannesses
+    const uint32_t endian_test_program[] =
+    {
+        0xF1010200,     // 0x00: setend be
+        0xE5901000,     // 0x04: ldr    r1, [r0]
+        0xE1D020B0,     // 0x08: ldrh   r2, [r0]
+        0xE5801004,     // 0x0C: str    r1, [r0, #4]
+        0xE8900018,     // 0x10: ldm    r0, {r3, r4}
+        0xF1010000,     // 0x14: setend le
+        0xE5905000,     // 0x18: ldr    r5, [r0]
+        0xEF000000      // 0x1C: svc    #0
+    };
+
+}
+
+
+namespace arm {
+
+    // Counts the faults of the test processors
+    void AlignmentFault( test_proc&, uint32_t )
+    {
+        ++alignment_faults;
+    }
+
+    void AlignmentFault( strict_test_proc&, uint32_t )
+    {
+        ++alignment_faults;
+    }
+
+    void AlignmentFault( throwing_test_proc&, uint32_t address )
+    {
+        throw address;
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE( BigEndianReverse_test )
+{
+    BOOST_CHECK_EQUAL( arm::BigEndianReverse( uint16_t( 0x1122 ) ),
+                       0x2211u );
+    BOOST_CHECK_EQUAL( arm::BigEndianReverse( uint32_t( 0x11223344 ) ),
+                       0x44332211u );
+}
+
+BOOST_AUTO_TEST_CASE( BigEndian_profile_test )
+{
+    uint32_t R[16];
+    memset( R, 0, sizeof( R ) );
+
+    test_proc        proc;
+    little_test_proc little;
+    big_test_proc    big;
+    memset( static_cast< void* >( &proc ),   0, sizeof( proc ) );
+    memset( static_cast< void* >( &little ), 0, sizeof( little ) );
+    memset( static_cast< void* >( &big ),    0, sizeof( big ) );
+    proc.R = little.R = big.R = R;
+
+    // Only the default profile follows CPSR.E
+    BOOST_CHECK( !arm::BigEndian( proc ) );
+    BOOST_CHECK( !arm::BigEndian( little ) );
+    BOOST_CHECK(  arm::BigEndian( big ) );
+
+    proc.CPSR.E = little.CPSR.E = 1;
+    BOOST_CHECK(  arm::BigEndian( proc ) );
+    BOOST_CHECK( !arm::BigEndian( little ) );
+
+    little.dMem.words[0] = 0x11223344;
+    big.dMem.words[0]    = 0x11223344;
+    BOOST_CHECK_EQUAL( arm::MemReadWord( little, 0 ), 0x11223344u );
+    BOOST_CHECK_EQUAL( arm::MemReadWord( big, 0 ),    0x44332211u );
+    BOOST_CHECK_EQUAL( arm::MemReadHalf( big, 0 ),    0x4433u );
+
+    arm::MemWriteHalf( big, 4, 0x5566 );
+    BOOST_CHECK_EQUAL( big.dMem.read_half( 4 ), 0x6655u );
+}
+
+BOOST_AUTO_TEST_CASE( SETEND_run_test )
+{
+    test_proc proc;
+    uint32_t  R[16];
+    LoadTestProgram( proc, R, endian_test_program );
+    proc.dMem.write_word( 0x100, 0x11223344 );
+    R[0] = 0x100;
+
+    BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 7u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x1Cu );
+    BOOST_CHECK_EQUAL( R[1], 0x44332211u );
+    BOOST_CHECK_EQUAL( R[2], 0x4433u );
+    BOOST_CHECK_EQUAL( R[3], 0x44332211u );
+    BOOST_CHECK_EQUAL( R[4], 0x44332211u );
+    BOOST_CHECK_EQUAL( R[5], 0x11223344u );
+    BOOST_CHECK_EQUAL( proc.CPSR.E, 0u );
+
+    // Stored in big-endian order
+    BOOST_CHECK_EQUAL( proc.dMem.read_word( 0x104 ), 0x11223344u );
+    BOOST_CHECK_EQUAL( proc.dMem.read_byte( 0x104 ), 0x44u );
+}
+
+BOOST_AUTO_TEST_CASE( AlignmentFault_test )
+{
+    uint32_t R[16];
+    memset( R, 0, sizeof( R ) );
+
+    test_proc        proc;
+    strict_test_proc strict;
+    memset( static_cast< void* >( &proc ),   0, sizeof( proc ) );
+    memset( static_cast< void* >( &strict ), 0, sizeof( strict ) );
+    proc.R = strict.R = R;
+    proc.dMem.words[4]   = strict.dMem.words[4]   = 0x11223344;
+    proc.dMem.words[5]   = strict.dMem.words[5]   = 0x55667788;
+    alignment_faults = 0;
+
+    // Unaligned MemU[] accesses go to memory as they are
+    BOOST_CHECK_EQUAL( arm::MemReadWord( proc, 0x12 ), 0x77881122u );
+    BOOST_CHECK_EQUAL( arm::MemReadHalf( proc, 0x13 ), 0x8811u );
+    arm::MemWriteWord( proc, 0x21, 0xAABBCCDD );
+    BOOST_CHECK_EQUAL( proc.dMem.read_word( 0x20 ), 0xBBCCDD00u );
+    BOOST_CHECK_EQUAL( alignment_faults, 0u );
+
+    // MemA[] accesses fault, and are made at the aligned address
+    BOOST_CHECK_EQUAL( arm::MemAReadWord( proc, 0x12 ), 0x11223344u );
+    BOOST_CHECK_EQUAL( arm::MemAReadHalf( proc, 0x13 ), 0x1122u );
+    uint32_t data[2];
+    arm::MemReadWords( proc, 0x16, data, 2 );
+    BOOST_CHECK_EQUAL( data[0], 0x55667788u );
+    BOOST_CHECK_EQUAL( alignment_faults, 3u );
+
+    arm::MemAReadWord( proc, 0x14 );
+    arm::MemAReadHalf( proc, 0x16 );
+    BOOST_CHECK_EQUAL( alignment_faults, 3u );
+
+    // With alignment checks, MemU[] accesses fault as well
+    BOOST_CHECK_EQUAL( arm::MemReadWord( strict, 0x12 ), 0x11223344u );
+    arm::MemWriteHalf( strict, 0x15, 0xAABB );
+    BOOST_CHECK_EQUAL( strict.dMem.read_word( 0x14 ), 0x5566AABBu );
+    BOOST_CHECK_EQUAL( alignment_faults, 5u );
+
+    arm::MemReadWord( strict, 0x10 );
+    BOOST_CHECK_EQUAL( alignment_faults, 5u );
+
+    // LDREXD and STREXD need doubleword alignment
+    R[1] = 0x14;
+    arm::LDREXD_A1( proc, 0xE1B12F9F );      // ldrexd r2, r3, [r1]
+    BOOST_CHECK_EQUAL( R[2], 0x11223344u );
+    BOOST_CHECK_EQUAL( R[3], 0x55667788u );
+    arm::STREXD_A1( proc, 0xE1A14F92 );      // strexd r4, r2, r3, [r1]
+    BOOST_CHECK_EQUAL( alignment_faults, 7u );
+
+    R[1] = 0x10;
+    arm::LDREXD_A1( proc, 0xE1B12F9F );      // ldrexd r2, r3, [r1]
+    BOOST_CHECK_EQUAL( alignment_faults, 7u );
+}
+
+BOOST_AUTO_TEST_CASE( AlignmentFault_STREX_test )
+{
+    uint32_t R[16];
+    memset( R, 0, sizeof( R ) );
+
+    throwing_test_proc proc;
+    memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+    proc.R = R;
+
+    // A store exclusive that faults leaves its granule unclaimed
+    void ( * const strex[] )( throwing_test_proc&, uint32_t ) =
+    {
+        arm::STREXD_A1< throwing_test_proc >,
+        arm::STREX_A1< throwing_test_proc >,
+        arm::STREXH_A1< throwing_test_proc >
+    };
+    const uint32_t instrs[] =
+    {
+        0xE1A14F92,     // strexd r4, r2, r3, [r1]
+        0xE1814F92,     // strex  r4, r2, [r1]
+        0xE1E14F92      // strexh r4, r2, [r1]
+    };
+    for( int i = 0; i < 3; ++i )
+    {
+        R[1] = 0x20;
+        arm::LDREX_A1( proc, 0xE1912F9F );   // ldrex  r2, [r1]
+        R[1] = 0x25;
+        BOOST_CHECK_THROW( strex[i]( proc, instrs[i] ), uint32_t );
+        BOOST_CHECK_EQUAL( proc.Monitor.state,
+                           arm::ExclusiveState_Exclusive );
+
+        R[1] = 0x20;
+        R[4] = 2;
+        arm::STREX_A1( proc, 0xE1814F92 );   // strex  r4, r2, [r1]
+        BOOST_CHECK_EQUAL( R[4], 0u );
+    }
+}
+
+#endif // __ARMV7_ENDIAN_TEST_HPP__
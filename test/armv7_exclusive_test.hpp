@@ -0,0 +1,249 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the exclusive monitors and the synchronization
+ * primitives.
+ */
+
+#ifndef __ARMV7_EXCLUSIVE_TEST_HPP__
+#define __ARMV7_EXCLUSIVE_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    typedef arm::shared_mem< test_mem<1024> > exclusive_test_mem;
+    typedef arm::armv7_core< test_cpsr, test_reg,
+                             test_bank, exclusive_test_mem >
+        exclusive_test_proc;
+
+    // Each core adds 1 to the word at r1, r3 times, with a load and
+    // store exclusive loop
+    const uint32_t exclusive_test_program[] =
+    {
+        0xE1912F9F,     // 0x00: ldrex r2, [r1]
+        0xE2822001,     // 0x04: add   r2, r2, #1
+        0xE1814F92,     // 0x08: strex r4, r2, [r1]
+        0xE3540000,     // 0x0C: cmp   r4, #0
+        0x1AFFFFFA,     // 0x10: bne   0x00
+        0xE2533001,     // 0x14: subs  r3, r3, #1
+        0x1AFFFFF8,     // 0x18: bne   0x00
+        0xEF000000      // 0x1C: svc   #0
+    };
+
+    struct exclusive_test_system
+    {
+        test_mem<1024>      memory;
+        exclusive_test_proc cores[4];
+        uint32_t            R[4][16];
+
+        exclusive_test_system()
+        {
+            memset( &memory, 0, sizeof( memory ) );
+            memcpy( memory.words, exclusive_test_program,
+                    sizeof( exclusive_test_program ) );
+
+            for( int i = 0; i < 4; ++i )
+            {
+                memset( static_cast< void* >( &cores[i] ), 0,
+                        sizeof( cores[i] ) );
+                memset( R[i], 0, sizeof( R[i] ) );
+                cores[i].R = R[i];
+                cores[i].iMem.mem = &memory;
+                cores[i].dMem.mem = &memory;
+                R[i][1] = 0x200;
+            }
+        }
+    };
+
+}
+
+
+BOOST_AUTO_TEST_CASE( LDREX_STREX_test )
+{
+    exclusive_test_system s;
+    exclusive_test_proc& proc = s.cores[0];
+    s.R[0][2] = 0x12345678;
+    s.memory.write_word( 0x200, 0xCAFE );
+
+    // No load exclusive
+    arm::STREX_A1( proc, 0xE1814F92 );       // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 1u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 0xCAFEu );
+
+    arm::LDREX_A1( proc, 0xE1912F9F );       // ldrex r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][2], 0xCAFEu );
+    s.R[0][2] = 0x12345678;
+    arm::STREX_A1( proc, 0xE1814F92 );       // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 0u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 0x12345678u );
+
+    // The store exclusive cleared the local monitor
+    s.R[0][2] = 0;
+    arm::STREX_A1( proc, 0xE1814F92 );       // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 1u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 0x12345678u );
+}
+
+BOOST_AUTO_TEST_CASE( CLREX_test )
+{
+    exclusive_test_system s;
+    exclusive_test_proc& proc = s.cores[0];
+
+    arm::LDREX_A1( proc, 0xE1912F9F );       // ldrex r2, [r1]
+    arm::CLREX_A1( proc, 0xF57FF01F );       // clrex
+    s.R[0][2] = 7;
+    arm::STREX_A1( proc, 0xE1814F92 );       // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 1u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( ExclusiveMonitorsPass_test )
+{
+    exclusive_test_system s;
+    exclusive_test_proc& a = s.cores[0];
+    exclusive_test_proc& b = s.cores[1];
+
+    // Another address
+    arm::LDREX_A1( a, 0xE1912F9F );          // ldrex r2, [r1]
+    s.R[0][1] = 0x300;
+    arm::STREX_A1( a, 0xE1814F92 );          // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 1u );
+    s.R[0][1] = 0x200;
+
+    // Same granule
+    arm::LDREX_A1( a, 0xE1912F9F );          // ldrex r2, [r1]
+    s.R[0][1] = 0x204;
+    arm::STREX_A1( a, 0xE1814F92 );          // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 0u );
+    s.R[0][1] = 0x200;
+
+    // A store to the granule
+    arm::LDREX_A1( a, 0xE1912F9F );          // ldrex r2, [r1]
+    arm::ClearExclusiveByAddress( 0x206, 2 );
+    arm::STREX_A1( a, 0xE1814F92 );          // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 1u );
+
+    // A store to a neighbouring granule
+    arm::LDREX_A1( a, 0xE1912F9F );          // ldrex r2, [r1]
+    arm::ClearExclusiveByAddress( 0x208, 4 );
+    arm::STREX_A1( a, 0xE1814F92 );          // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 0u );
+
+    // Both cores mark the granule, only the first store passes
+    arm::LDREX_A1( a, 0xE1912F9F );          // ldrex r2, [r1]
+    arm::LDREX_A1( b, 0xE1912F9F );          // ldrex r2, [r1]
+    s.R[1][2] = 1;
+    arm::STREX_A1( b, 0xE1814F92 );          // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[1][4], 0u );
+    s.R[0][2] = 2;
+    arm::STREX_A1( a, 0xE1814F92 );          // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 1u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 1u );
+}
+
+BOOST_AUTO_TEST_CASE( ExclusiveHoldByAddress_test )
+{
+    // A store wrapping around the address space clears both ends
+    uint32_t last  = arm::ExclusiveTagMark( 0xFFFFFFF8 );
+    uint32_t first = arm::ExclusiveTagMark( 0x00000000 );
+    arm::ClearExclusiveByAddress( 0xFFFFFFFC, 8 );
+    BOOST_CHECK( !arm::ExclusiveTagClaim( 0xFFFFFFF8, last ) );
+    BOOST_CHECK( !arm::ExclusiveTagClaim( 0x00000000, first ) );
+
+    // A held store makes the store exclusive fail once released
+    last  = arm::ExclusiveTagMark( 0xFFFFFFF8 );
+    first = arm::ExclusiveTagMark( 0x00000000 );
+    arm::ExclusiveHoldByAddress( 0xFFFFFFFC, 8 );
+    BOOST_CHECK( !arm::ExclusiveTagClaim( 0xFFFFFFF8, last ) );
+    arm::ExclusiveReleaseByAddress( 0xFFFFFFFC, 8 );
+    BOOST_CHECK( !arm::ExclusiveTagClaim( 0x00000000, first ) );
+    BOOST_CHECK_EQUAL( arm::ExclusiveTagMark( 0x00000000 ), first + 2 );
+
+    // A store larger than the table holds every tag once
+    first = arm::ExclusiveTagMark( 0x00000000 );
+    arm::ExclusiveHoldByAddress( 0x00000004, 0x10000 );
+    arm::ExclusiveReleaseByAddress( 0x00000004, 0x10000 );
+    BOOST_CHECK_EQUAL( arm::ExclusiveTagMark( 0x00000000 ), first + 2 );
+}
+
+BOOST_AUTO_TEST_CASE( LDREX_STREX_sizes_test )
+{
+    exclusive_test_system s;
+    exclusive_test_proc& proc = s.cores[0];
+    s.memory.write_word( 0x200, 0x44332211 );
+    s.memory.write_word( 0x204, 0x88776655 );
+
+    arm::LDREXB_A1( proc, 0xE1D12F9F );      // ldrexb r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][2], 0x11u );
+    s.R[0][2] = 0xFFFFFFAA;
+    arm::STREXB_A1( proc, 0xE1C14F92 );      // strexb r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 0u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 0x443322AAu );
+
+    arm::LDREXH_A1( proc, 0xE1F12F9F );      // ldrexh r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][2], 0x22AAu );
+    s.R[0][2] = 0xFFFFBBCC;
+    arm::STREXH_A1( proc, 0xE1E14F92 );      // strexh r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 0u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 0x4433BBCCu );
+
+    arm::LDREXD_A1( proc, 0xE1B12F9F );      // ldrexd r2, r3, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][2], 0x4433BBCCu );
+    BOOST_CHECK_EQUAL( s.R[0][3], 0x88776655u );
+    s.R[0][2] = 1;
+    s.R[0][3] = 2;
+    arm::STREXD_A1( proc, 0xE1A14F92 );      // strexd r4, r2, r3, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 0u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 1u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x204 ), 2u );
+}
+
+BOOST_AUTO_TEST_CASE( exclusive_smp_test )
+{
+    for( int deterministic = 0; deterministic < 2; ++deterministic )
+    {
+        exclusive_test_system s;
+        for( int i = 0; i < 4; ++i )
+        {
+            s.R[i][3] = 1000;
+        }
+
+        // Short quanta interrupt some loops between the load and the
+        // store exclusive
+        arm::smp_system< exclusive_test_proc > smp( s.cores, 4, 5,
+                                                    deterministic );
+        smp.run( 1000000 );
+
+        // No increment is lost
+        BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 4000u );
+        for( int i = 0; i < 4; ++i )
+        {
+            BOOST_CHECK( smp.stopped( i ) );
+            BOOST_CHECK_EQUAL( s.cores[i].PC, 0x1Cu );
+        }
+    }
+}
+
+#endif // __ARMV7_EXCLUSIVE_TEST_HPP__
@@ -27,6 +27,7 @@
 #include <armv7/isa.hpp>
 #include <armv7/types.hpp>
 #include <boost/test/unit_test.hpp>
+#include <cmath>
 #include <cstring>
 
 
@@ -54,6 +55,36 @@ BOOST_AUTO_TEST_CASE( Bits_test )
     const uint32_t s = 0x42C0FFEE;
     BOOST_CHECK_EQUAL( arm::Bits( s, 31, 24 ), 0x00000042 );
     BOOST_CHECK_EQUAL( arm::Bits( s, 23, 0  ), 0x00C0FFEE );
+    BOOST_CHECK_EQUAL( arm::Bits( s, 31, 0  ), 0x42C0FFEE );
+
+    // Template forms
+    BOOST_CHECK_EQUAL( ( arm::Bits< 31, 24 >( s ) ), 0x00000042u );
+    BOOST_CHECK_EQUAL( ( arm::Bits< 23,  0 >( s ) ), 0x00C0FFEEu );
+    BOOST_CHECK_EQUAL( ( arm::Bits< 31,  0 >( s ) ), 0x42C0FFEEu );
+    BOOST_CHECK_EQUAL( ( arm::Bits<  4,  4 >( s ) ), 0u );
+    BOOST_CHECK_EQUAL( ( arm::Bits<  5,  5 >( s ) ), 1u );
+
+    const uint64_t d = 0x8123456742C0FFEEULL;
+    BOOST_CHECK_EQUAL( arm::Bits64( d, 63, 32 ), 0x81234567u );
+    BOOST_CHECK_EQUAL( ( arm::Bits64< 63, 32 >( d ) ), 0x81234567u );
+    BOOST_CHECK_EQUAL( ( arm::Bits64< 63,  0 >( d ) ), d );
+    BOOST_CHECK_EQUAL( ( arm::Bits64< 35, 28 >( d ) ), 0x74u );
+
+    // Evaluated at compile time
+    BOOST_STATIC_ASSERT( arm::Bits( 0x42C0FFEE, 15, 8 ) == 0xFF );
+    BOOST_STATIC_ASSERT( ( arm::Bits< 15, 8 >( 0x42C0FFEE ) == 0xFF ) );
+
+    // Random ranges agree with the runtime form
+    uint32_t seed = 11;
+    for( int n = 0; n < 1000; ++n )
+    {
+        seed = seed * 1103515245 + 12345;
+        BOOST_CHECK_EQUAL( ( arm::Bits< 19, 16 >( seed ) ),
+                           arm::Bits( seed, 19, 16 ) );
+        BOOST_CHECK_EQUAL( ( arm::Bits< 11,  0 >( seed ) ),
+                           arm::Bits( seed, 11, 0 ) );
+        BOOST_CHECK_EQUAL( ( arm::Bits< 31, 31 >( seed ) ), seed >> 31 );
+    }
 }
 
 BOOST_AUTO_TEST_CASE( ARMExpandImm_C_test )
@@ -226,6 +257,67 @@ BOOST_AUTO_TEST_CASE( ArchVersion_test )
     BOOST_CHECK_EQUAL( arm::ArchVersion(), 7 );
 }
 
+namespace {
+
+    struct armv6_test_profile : arm::armv7a_profile
+    {
+        static const int  arch_version      = 6;
+        static const bool unaligned_support = false;
+    };
+
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             test_mem<1024>,
+                             armv6_test_profile > armv6_test_proc;
+
+}
+
+BOOST_AUTO_TEST_CASE( isa_profile_test )
+{
+    test_cpsr CPSR;
+    uint32_t  R7[16], R6[16];
+    memset( &CPSR, 0, sizeof( CPSR ) );
+    memset( R7, 0, sizeof( R7 ) );
+    memset( R6, 0, sizeof( R6 ) );
+    test_proc       proc7 = { CPSR, 0, R7, {}, {} };
+    armv6_test_proc proc6 = { CPSR, 0, R6, {}, {} };
+
+    BOOST_CHECK_EQUAL( arm::ArchVersion( proc7 ), 7 );
+    BOOST_CHECK_EQUAL( arm::ArchVersion( proc6 ), 6 );
+    BOOST_CHECK( arm::UnalignedSupport( proc7 ) );
+    BOOST_CHECK( !arm::UnalignedSupport( proc6 ) );
+    BOOST_CHECK( !arm::HaveSecurityExt( proc6 ) );
+    BOOST_CHECK( !arm::HaveMPExt( proc6 ) );
+    BOOST_CHECK( arm::MemorySystemArchitecture( proc6 ) == arm::MemArch_VMSA );
+
+    // mov pc, r0 interworks from ARMv7 only
+    R7[0] = R6[0] = 0x101;
+    arm::MOV_reg_A1( proc7, 0xE1A0F000 );
+    arm::MOV_reg_A1( proc6, 0xE1A0F000 );
+    BOOST_CHECK_EQUAL( proc7.CPSR.T, 1u );
+    BOOST_CHECK_EQUAL( proc7.PC, 0x100u );
+    BOOST_CHECK_EQUAL( proc6.CPSR.T, 0u );
+    BOOST_CHECK_EQUAL( proc6.PC, 0x100u );
+
+    // ldr r1, [r2] rotates unaligned words without unaligned support,
+    // and reads the unaligned word with it
+    proc7.dMem.write_word( 0x10, 0x11223344 );
+    proc6.dMem.write_word( 0x10, 0x11223344 );
+    R7[2] = R6[2] = 0x11;
+    arm::LDR_imm_A1( proc7, 0xE5921000 );
+    arm::LDR_imm_A1( proc6, 0xE5921000 );
+    BOOST_CHECK_EQUAL( R7[1], 0x00112233u );
+    BOOST_CHECK_EQUAL( R6[1], 0x44112233u );
+
+    // The block cache runs the predecoded twin and must rotate the same
+    proc6.iMem.write_word( 0x0, 0xE5921000 );   // ldr r1, [r2]
+    proc6.iMem.write_word( 0x4, 0xE7F000F0 );   // udf
+    proc6.PC = 0;
+    R6[1]    = 0;
+    arm::block_cache< armv6_test_proc > cache;
+    cache.run( proc6, 1 );
+    BOOST_CHECK_EQUAL( R6[1], 0x44112233u );
+}
+
 BOOST_AUTO_TEST_CASE( IsZero_test )
 {
     BOOST_CHECK( !arm::IsZero( 0x24 ) );
@@ -334,6 +426,223 @@ BOOST_AUTO_TEST_CASE( Shift_RRX )
     BOOST_CHECK_EQUAL( arm::RRX( RRX_original, RRX_amount ), RRX_shifted );
 }
 
+namespace {
+
+    // Loop and floating-point versions the inline ones replaced,
+    // valid for shift amounts of 1 to 32
+    arm::UValueCarry ReferenceASR_C( uint32_t value, int amount )
+    {
+        const bool sign = ( value >> 31 ) == 1;
+        uint32_t mask = 0;
+        for( int i = 0; i < amount; ++i )
+        {
+            mask |= ( 0x80000000 >> i );
+        }
+
+        arm::UValueCarry result;
+        result.value = value >> ( amount - 1 );
+        result.carry = ( result.value & 1 ) == 1;
+        result.value = result.value >> 1;
+        if( sign )
+        {
+            result.value |= mask;
+        }
+        return result;
+    }
+
+    arm::UValueCarry ReferenceLSL_C( uint32_t value, int amount )
+    {
+        arm::UValueCarry result;
+        result.value = value << ( amount - 1 );
+        result.carry = ( result.value & 0x80000000 ) != 0;
+        result.value = result.value << 1;
+        return result;
+    }
+
+    arm::UValueCarry ReferenceLSR_C( uint32_t value, int amount )
+    {
+        arm::UValueCarry result;
+        result.value = value >> ( amount - 1 );
+        result.carry = ( result.value & 1 ) != 0;
+        result.value = result.value >> 1;
+        return result;
+    }
+
+    arm::UValueCarry ReferenceROR_C( uint32_t value, int amount )
+    {
+        arm::UValueCarry result;
+        result.value = value;
+        for( int i = 0; i < amount; ++i )
+        {
+            result.value = ( result.value >> 1 ) | ( result.value << 31 );
+        }
+        result.carry = ( result.value >> 31 ) == 1;
+        return result;
+    }
+
+    arm::ValueSat ReferenceSignedSatQ( int64_t i, unsigned int N )
+    {
+        const int64_t max = pow( 2, N - 1 );
+        arm::ValueSat result;
+        result.value = i;
+        if( i > max - 1 )
+        {
+            result.value = max - 1;
+            result.saturated = true;
+        }
+        else if( i < -max )
+        {
+            result.value = -max;
+            result.saturated = true;
+        }
+        return result;
+    }
+
+    arm::UValueSat ReferenceUnsignedSatQ( int64_t i, unsigned int N )
+    {
+        const int64_t max = pow( 2, N ) - 1;
+        arm::UValueSat result;
+        result.value = (uint64_t)i;
+        if( i > max )
+        {
+            result.value = (uint64_t)max;
+            result.saturated = true;
+        }
+        else if( i < 0 )
+        {
+            result.value = 0;
+            result.saturated = true;
+        }
+        return result;
+    }
+
+    int ReferenceLowestSetBit( uint32_t x )
+    {
+        for( int i = 0; i < 32; ++i )
+        {
+            if( ( x >> i ) & 1 )
+            {
+                return i;
+            }
+        }
+        return 32;
+    }
+
+    // Random values, biased toward few bits set, sign bits and
+    // saturation bounds
+    uint32_t NextShiftTestValue( uint32_t& seed )
+    {
+        seed = seed * 1103515245 + 12345;
+        const uint32_t a = seed;
+        seed = seed * 1103515245 + 12345;
+        switch( seed >> 30 )
+        {
+        case 0:  return a;
+        case 1:  return a & ( seed >> 8 );
+        case 2:  return 1u << ( ( seed >> 16 ) % 32 );
+        default: return ~0u << ( ( seed >> 16 ) % 32 );
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( Shift_reference_test )
+{
+    uint32_t seed = 3;
+    for( int n = 0; n < 20000; ++n )
+    {
+        const uint32_t value  = NextShiftTestValue( seed );
+        const int      amount = 1 + ( seed >> 20 ) % 32;
+        const bool     carry  = ( seed >> 8 ) & 1;
+
+        arm::UValueCarry a, b;
+        a = arm::LSL_C( value, amount );
+        b = ReferenceLSL_C( value, amount );
+        BOOST_CHECK_EQUAL( a.value, b.value );
+        BOOST_CHECK_EQUAL( a.carry, b.carry );
+
+        a = arm::LSR_C( value, amount );
+        b = ReferenceLSR_C( value, amount );
+        BOOST_CHECK_EQUAL( a.value, b.value );
+        BOOST_CHECK_EQUAL( a.carry, b.carry );
+
+        a = arm::ASR_C( value, amount );
+        b = ReferenceASR_C( value, amount );
+        BOOST_CHECK_EQUAL( a.value, b.value );
+        BOOST_CHECK_EQUAL( a.carry, b.carry );
+
+        a = arm::ROR_C( value, amount );
+        b = ReferenceROR_C( value, amount );
+        BOOST_CHECK_EQUAL( a.value, b.value );
+        BOOST_CHECK_EQUAL( a.carry, b.carry );
+
+        const arm::SRType type = static_cast< arm::SRType >( seed % 4 );
+        a = arm::Shift_C( value, type, amount, carry );
+        b = type == arm::SRType_LSL ? ReferenceLSL_C( value, amount ) :
+            type == arm::SRType_LSR ? ReferenceLSR_C( value, amount ) :
+            type == arm::SRType_ASR ? ReferenceASR_C( value, amount ) :
+                                      ReferenceROR_C( value, amount );
+        BOOST_CHECK_EQUAL( a.value, b.value );
+        BOOST_CHECK_EQUAL( a.carry, b.carry );
+
+        a = arm::Shift_C( value, type, 0, carry );
+        BOOST_CHECK_EQUAL( a.value, value );
+        BOOST_CHECK_EQUAL( a.carry, carry );
+
+        BOOST_CHECK_EQUAL( arm::LowestSetBit( value ),
+                           ReferenceLowestSetBit( value ) );
+        BOOST_CHECK_EQUAL( arm::Align( value, 1u << ( seed >> 27 ) ),
+                           value / ( 1u << ( seed >> 27 ) ) *
+                           ( 1u << ( seed >> 27 ) ) );
+
+        // Register-controlled amounts shift all the bits out
+        const int big = 33 + ( seed >> 24 );
+        BOOST_CHECK_EQUAL( arm::LSL_C( value, big ).value, 0u );
+        BOOST_CHECK( !arm::LSL_C( value, big ).carry );
+        BOOST_CHECK_EQUAL( arm::LSR_C( value, big ).value, 0u );
+        BOOST_CHECK( !arm::LSR_C( value, big ).carry );
+        BOOST_CHECK_EQUAL( arm::ASR_C( value, big ).value,
+                           ( value >> 31 ) ? 0xFFFFFFFFu : 0u );
+        BOOST_CHECK_EQUAL( arm::ASR_C( value, big ).carry,
+                           ( value >> 31 ) == 1 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( SatQ_reference_test )
+{
+    uint32_t seed = 5;
+    for( int n = 0; n < 20000; ++n )
+    {
+        const uint64_t hi = NextShiftTestValue( seed );
+        const uint64_t lo = NextShiftTestValue( seed );
+        const int64_t  i  = (int64_t)( ( hi << 32 ) | lo ) >> ( seed % 40 );
+        // pow() is only exact up to 2^53 - 1
+        const unsigned int N = 1 + ( seed >> 16 ) % 53;
+
+        const arm::ValueSat  a = arm::SignedSatQ( i, N );
+        const arm::ValueSat  b = ReferenceSignedSatQ( i, N );
+        BOOST_CHECK_EQUAL( a.value, b.value );
+        BOOST_CHECK_EQUAL( a.saturated, b.saturated );
+
+        const arm::UValueSat c = arm::UnsignedSatQ( i, N );
+        const arm::UValueSat d = ReferenceUnsignedSatQ( i, N );
+        BOOST_CHECK_EQUAL( c.value, d.value );
+        BOOST_CHECK_EQUAL( c.saturated, d.saturated );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( constexpr_shift_test )
+{
+    // Evaluated at compile time
+    BOOST_STATIC_ASSERT( arm::ROR( 0x000000AC, 8 ) == 0xAC000000 );
+    BOOST_STATIC_ASSERT( arm::ASR( 0x80000000, 4 ) == 0xF8000000 );
+    BOOST_STATIC_ASSERT( arm::Shift_C( 1, arm::SRType_LSR, 1, false ).carry );
+    BOOST_STATIC_ASSERT( arm::SignedSat( 200, 8 ) == 127 );
+    BOOST_STATIC_ASSERT( arm::UnsignedSat( -3, 8 ) == 0 );
+    BOOST_STATIC_ASSERT( arm::LowestSetBit( 0x100420 ) == 5 );
+    BOOST_STATIC_ASSERT( arm::Align( 0x1237, 4 ) == 0x1234 );
+}
+
 BOOST_AUTO_TEST_CASE( CountLeadingZeroBits_test )
 {
     // 42 == 0x0000002A, 26 zeros.
@@ -567,6 +876,40 @@ BOOST_AUTO_TEST_CASE( ConditionPassed_test )
 
 }
 
+
+BOOST_AUTO_TEST_CASE( ConditionHolds_test )
+{
+    for( uint32_t cond = 0; cond < 16; ++cond )
+    {
+        for( uint32_t flags = 0; flags < 16; ++flags )
+        {
+            const bool N = ( flags >> 3 ) & 1;
+            const bool Z = ( flags >> 2 ) & 1;
+            const bool C = ( flags >> 1 ) & 1;
+            const bool V = flags & 1;
+            bool expected = true;
+
+            switch( cond >> 1 )
+            {
+            case 0: expected = Z;                 break;
+            case 1: expected = C;                 break;
+            case 2: expected = N;                 break;
+            case 3: expected = V;                 break;
+            case 4: expected = C && !Z;           break;
+            case 5: expected = N == V;            break;
+            case 6: expected = N == V && !Z;      break;
+            }
+
+            if( ( cond & 1 ) && cond != 0xF )
+            {
+                expected = !expected;
+            }
+
+            BOOST_CHECK_EQUAL( arm::ConditionHolds( cond, flags ), expected );
+        }
+    }
+}
+
 #define ADD_WITH_CARRY_TEST( value_type )                               \
 {                                                                       \
     uint64_t   max64 = 0xFFFFFFFFFFFFFFFFLL;                            \
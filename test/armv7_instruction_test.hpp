@@ -2498,6 +2498,16 @@ BOOST_AUTO_TEST_CASE( POP_A1_test )
     BOOST_CHECK_EQUAL( 0xA407BABE, R[2] );
     BOOST_CHECK_EQUAL( 0x800081E5, R[4] );
     BOOST_CHECK_EQUAL( 0x1337C0DE, R[5] );
+    BOOST_CHECK_EQUAL( 16u, R[13] );
+
+    // Pop {1, PC}: the PC is loaded from memory
+    proc.dMem.write_word( 16, 0x11111111 ); // Reg 1
+    proc.dMem.write_word( 20, 0x00002000 ); // PC
+
+    func( proc, 0xF8BD8002 );
+    BOOST_CHECK_EQUAL( 0x11111111, R[1] );
+    BOOST_CHECK_EQUAL( 0x00002000, proc.PC );
+    BOOST_CHECK_EQUAL( 24u, R[13] );
 }
 
 BOOST_AUTO_TEST_CASE( POP_A2_test )
@@ -2795,7 +2805,7 @@ BOOST_AUTO_TEST_CASE( SEL_A1_test )
     BehaviorFunc func = arm::SEL_A1;
     R[m] = 0xAABBCCDD; R[n] = 0xEEFF8899;
     proc.CPSR.GE = 0xD;
-    CHECK_RD( 0xAABBCC99 );        
+    CHECK_RD( 0xEEFFCC99 );        
 }
 
 BOOST_AUTO_TEST_CASE( SHADD16_A1_test )
@@ -3551,7 +3561,7 @@ BOOST_AUTO_TEST_CASE( STM_STMIA_STMEA_A1_test )
     uint8_t  W;
     uint16_t register_list;
     uint32_t instr;
-    uint32_t address = 0x00000021;
+    uint32_t address = 0x00000020;
 
     R[0] = 0x12345678;
     R[2] = 0x00000028;
@@ -3590,7 +3600,7 @@ BOOST_AUTO_TEST_CASE( STMDA_STMED_A1_test )
     uint8_t  W;
     uint16_t register_list;
     uint32_t instr;
-    uint32_t address = 0x00000021;
+    uint32_t address = 0x00000020;
 
     R[0] = 0x12345678;
     R[2] = 0x00000028;
@@ -3629,7 +3639,7 @@ BOOST_AUTO_TEST_CASE( STMDB_STMFD_A1_test )
     uint8_t  W;
     uint16_t register_list;
     uint32_t instr;
-    uint32_t address = 0x00000021;
+    uint32_t address = 0x00000020;
 
     R[0] = 0x12345678;
     R[2] = 0x00000028;
@@ -3646,7 +3656,7 @@ BOOST_AUTO_TEST_CASE( STMDB_STMFD_A1_test )
     BOOST_CHECK_EQUAL( proc.dMem.read_word( address - 12 ), R[4] );
     BOOST_CHECK_EQUAL( proc.dMem.read_word( address - 8 ), R[8] );
     BOOST_CHECK_EQUAL( proc.dMem.read_word( address - 4 ), proc.PC );
-    BOOST_CHECK_EQUAL( R[n], 0x00000021 );
+    BOOST_CHECK_EQUAL( R[n], 0x00000020 );
     
     W = 1; instr = op | W << 21 | register_list; R[n] = address;
 
@@ -3671,7 +3681,7 @@ BOOST_AUTO_TEST_CASE( STMIB_STMFA_A1_test )
     uint8_t  W;
     uint16_t register_list;
     uint32_t instr;
-    uint32_t address = 0x00000021;
+    uint32_t address = 0x00000020;
 
     R[0] = 0x12345678;
     R[2] = 0x00000028;
@@ -3956,9 +3966,9 @@ BOOST_AUTO_TEST_CASE( STRD_imm_A1_test )
     uint8_t  U;
     uint8_t  W;
     uint8_t imm4H = 0x2;
-    uint8_t imm4L = 0x1;
+    uint8_t imm4L = 0x0;
     uint32_t instr;
-    uint32_t address = 0x00000533;
+    uint32_t address = 0x00000530;
 
     R[t] = 0x12345678; R[t+1] = 0x9ABCDEF0; 
 
@@ -3967,21 +3977,21 @@ BOOST_AUTO_TEST_CASE( STRD_imm_A1_test )
     func( proc, instr );
     BOOST_CHECK_EQUAL( proc.dMem.read_word( address ), R[t] );
     BOOST_CHECK_EQUAL( proc.dMem.read_word( address + 4 ), R[t+1] );
-    BOOST_CHECK_EQUAL( R[n], address - 0x21 );
+    BOOST_CHECK_EQUAL( R[n], address - 0x20 );
 
     P = 1; U = 1; W = 0; R[n] = address;
     instr = op | P << 24 | U << 23 | W << 21 | imm4H << 8 | imm4L;
     func( proc, instr );
-    BOOST_CHECK_EQUAL( proc.dMem.read_word( address + 0x21 ), R[t] );
-    BOOST_CHECK_EQUAL( proc.dMem.read_word( address + 0x21 + 4 ), R[t+1] );
+    BOOST_CHECK_EQUAL( proc.dMem.read_word( address + 0x20 ), R[t] );
+    BOOST_CHECK_EQUAL( proc.dMem.read_word( address + 0x20 + 4 ), R[t+1] );
     BOOST_CHECK_EQUAL( R[n], address );
 
     P = 1; U = 1; W = 1; R[n] = address;
     instr = op | P << 24 | U << 23 | W << 21 | imm4H << 8 | imm4L;
     func( proc, instr );
-    BOOST_CHECK_EQUAL( proc.dMem.read_word( address + 0x21 ), R[t] );
-    BOOST_CHECK_EQUAL( proc.dMem.read_word( address + 0x21 + 4 ), R[t+1] );
-    BOOST_CHECK_EQUAL( R[n], address + 0x21 );
+    BOOST_CHECK_EQUAL( proc.dMem.read_word( address + 0x20 ), R[t] );
+    BOOST_CHECK_EQUAL( proc.dMem.read_word( address + 0x20 + 4 ), R[t+1] );
+    BOOST_CHECK_EQUAL( R[n], address + 0x20 );
 }
 
 BOOST_AUTO_TEST_CASE( STRD_reg_A1_test )
@@ -3994,9 +4004,9 @@ BOOST_AUTO_TEST_CASE( STRD_reg_A1_test )
     uint8_t  U;
     uint8_t  W;
     uint32_t instr;
-    uint32_t address = 0x00000533;
+    uint32_t address = 0x00000530;
 
-    R[m] = 15; R[t] = 0x12345678; R[t+1] = 0x9ABCDEF0; 
+    R[m] = 16; R[t] = 0x12345678; R[t+1] = 0x9ABCDEF0; 
 
     P = 0; U = 0; W = 0; R[n] = address;
     instr = op | P << 24 | U << 23 | W << 21 ;
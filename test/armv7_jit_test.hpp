@@ -0,0 +1,208 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the ARMv7 native code translator.
+ */
+
+#ifndef __ARMV7_JIT_TEST_HPP__
+#define __ARMV7_JIT_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+
+namespace {
+
+    // Mixes translated and called instructions in a loop
+    const uint32_t jit_test_program[] =
+    {
+        0xE3A0000A,     // 0x00: mov   r0, #10
+        0xE3E01000,     // 0x04: mvn   r1, #0
+        0xE3A02C01,     // 0x08: mov   r2, #0x100
+        0xE0833001,     // 0x0C: add   r3, r3, r1
+        0xE0444121,     // 0x10: sub   r4, r4, r1, lsr #2
+        0xE02554C1,     // 0x14: eor   r5, r5, r1, asr #9
+        0xE1866361,     // 0x18: orr   r6, r6, r1, ror #6
+        0xE2277C0F,     // 0x1C: eor   r7, r7, #0xF00
+        0xE1C78080,     // 0x20: bic   r8, r7, r0, lsl #1
+        0xE0889060,     // 0x24: add   r9, r8, r0, rrx
+        0xE4829004,     // 0x28: str   r9, [r2], #4
+        0xE1A0A003,     // 0x2C: mov   r10, r3
+        0xE28AA0FF,     // 0x30: add   r10, r10, #0xFF
+        0xE0011000,     // 0x34: and   r1, r1, r0
+        0xE0B11000,     // 0x38: adds  r1, r1, r0
+        0xE2500001,     // 0x3C: subs  r0, r0, #1
+        0x1AFFFFF1,     // 0x40: bne   0x0C
+        0xEF000000      // 0x44: svc   #0
+    };
+
+    // Three blocks of 64 calls, which do not fit in 4 KB together
+    void InitJitFullTestProc( test_proc& proc, uint32_t* R )
+    {
+        uint32_t program[195];
+        for( int i = 0; i < 192; ++i )
+        {
+            program[i] = 0xE5820000;            // str  r0, [r2]
+        }
+        program[192] = 0xE2500001;              // subs r0, r0, #1
+        program[193] = 0x1AFFFF3D;              // bne  0x00
+        program[194] = 0xEF000000;              // svc  #0
+
+        LoadTestProgram( proc, R, program );
+        R[0] = 3;
+        R[2] = 0x100;
+    }
+
+    // Returns the permissions ("rwxp") of the host mapping holding
+    // "p", or an empty string
+    std::string JitTestProtection( const void* p )
+    {
+        std::string result;
+        FILE* maps = fopen( "/proc/self/maps", "r" );
+        if( maps == 0 )
+        {
+            return result;
+        }
+
+        unsigned long first, last;
+        char perms[8];
+        char line[512];
+        while( fgets( line, sizeof( line ), maps ) != 0 )
+        {
+            if( sscanf( line, "%lx-%lx %7s", &first, &last, perms ) == 3 &&
+                (unsigned long)p >= first && (unsigned long)p < last )
+            {
+                result = perms;
+                break;
+            }
+        }
+
+        fclose( maps );
+        return result;
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE( x86_64_emitter_test )
+{
+    uint8_t code[64];
+    arm::x86_64_emitter e( code, code + sizeof( code ) );
+
+    e.load_eax( 1 );
+    e.alu_eax_imm( arm::x86_64_emitter::alu_add, 0x10 );
+    e.store_eax( 2 );
+
+    const uint8_t expected[] =
+    {
+        0x41, 0x8B, 0x85, 0x04, 0x00, 0x00, 0x00,   // mov eax, [r13+4]
+        0x05, 0x10, 0x00, 0x00, 0x00,               // add eax, 0x10
+        0x41, 0x89, 0x85, 0x08, 0x00, 0x00, 0x00    // mov [r13+8], eax
+    };
+
+    BOOST_CHECK_EQUAL( e.current() - code, (int)sizeof( expected ) );
+    BOOST_CHECK( memcmp( code, expected, sizeof( expected ) ) == 0 );
+    BOOST_CHECK( !e.overflow() );
+
+    arm::x86_64_emitter small( code, code + 4 );
+    small.load_eax( 1 );
+    BOOST_CHECK( small.overflow() );
+}
+
+
+BOOST_AUTO_TEST_CASE( code_buffer_test )
+{
+#ifdef ARMV7_JIT
+    // The buffer is never writable and executable at once
+    arm::code_buffer buffer( 1 << 16 );
+    uint8_t* code = buffer.begin();
+    BOOST_CHECK_EQUAL( JitTestProtection( code ), "r-xp" );
+
+    buffer.open();
+    BOOST_CHECK_EQUAL( JitTestProtection( code ), "rw-p" );
+    code[0] = 0xC3;                                 // ret
+    buffer.commit( code + 1 );
+    BOOST_CHECK_EQUAL( JitTestProtection( code ), "r-xp" );
+    BOOST_CHECK( buffer.begin() == code + 1 );
+
+    reinterpret_cast< void (*)() >( code )();
+#endif
+}
+
+BOOST_AUTO_TEST_CASE( jit_compiler_test )
+{
+    test_proc expected, actual;
+    uint32_t  expected_R[16], actual_R[16];
+    LoadTestProgram( expected, expected_R, jit_test_program );
+    LoadTestProgram(   actual,   actual_R, jit_test_program );
+
+    arm::jit_compiler< test_proc > jit( 1 << 16, 2 );
+    arm::block_cache< test_proc > cache( &jit );
+
+    BOOST_CHECK_EQUAL( arm::run( expected, 1000 ),
+                       cache.run( actual, 1000 ) );
+    BOOST_CHECK_EQUAL( expected.PC, actual.PC );
+    BOOST_CHECK( memcmp( expected_R, actual_R, sizeof( expected_R ) ) == 0 );
+    BOOST_CHECK( memcmp( expected.dMem.bytes, actual.dMem.bytes,
+                         sizeof( expected.dMem.bytes ) ) == 0 );
+    BOOST_CHECK( expected.CPSR.N == actual.CPSR.N &&
+                 expected.CPSR.Z == actual.CPSR.Z &&
+                 expected.CPSR.C == actual.CPSR.C &&
+                 expected.CPSR.V == actual.CPSR.V );
+
+    const arm::basic_block< test_proc >* loop = cache.lookup( actual, 0x0C );
+    BOOST_CHECK_EQUAL( loop->executions, 9u );
+    BOOST_CHECK_EQUAL( loop->native != 0, arm::JitAvailable() );
+
+    cache.flush();
+    BOOST_CHECK_EQUAL( cache.size(), 0u );
+}
+
+
+BOOST_AUTO_TEST_CASE( jit_compiler_full_test )
+{
+    test_proc expected, actual;
+    uint32_t  expected_R[16], actual_R[16];
+    InitJitFullTestProc( expected, expected_R );
+    InitJitFullTestProc(   actual,   actual_R );
+
+    arm::jit_compiler< test_proc > jit( 1 << 12, 2 );
+    arm::block_cache< test_proc > cache( &jit );
+
+    BOOST_CHECK_EQUAL( arm::run( expected, 1000 ),
+                       cache.run( actual, 1000 ) );
+    BOOST_CHECK_EQUAL( expected.PC, actual.PC );
+    BOOST_CHECK( memcmp( expected_R, actual_R, sizeof( expected_R ) ) == 0 );
+
+    // The third block filled the buffer on the second iteration and
+    // the counts of the others restarted
+    BOOST_CHECK( cache.lookup( actual, 0x000 )->native == 0 );
+    BOOST_CHECK( cache.lookup( actual, 0x100 )->native == 0 );
+    BOOST_CHECK_EQUAL( cache.lookup( actual, 0x200 )->native != 0,
+                       arm::JitAvailable() );
+    BOOST_CHECK_EQUAL( cache.lookup( actual, 0x300 )->native != 0,
+                       arm::JitAvailable() );
+}
+
+#endif // __ARMV7_JIT_TEST_HPP__
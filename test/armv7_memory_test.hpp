@@ -0,0 +1,413 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the memory types.
+ */
+
+#ifndef __ARMV7_MEMORY_TEST_HPP__
+#define __ARMV7_MEMORY_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+#include <new>
+
+
+BOOST_AUTO_TEST_CASE( paged_mem_test )
+{
+    arm::paged_mem mem;
+
+    // Pages read as zeros until written
+    BOOST_CHECK_EQUAL( mem.read_word( 0x80000000 ), 0u );
+    BOOST_CHECK_EQUAL( mem.read_dword( 0xFFFFFFF8 ), 0u );
+    BOOST_CHECK_EQUAL( mem.pages(), 0u );
+
+    mem.write_word( 0x80000000, 0x44332211 );
+    BOOST_CHECK_EQUAL( mem.pages(), 1u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x80000000 ), 0x44332211u );
+    BOOST_CHECK_EQUAL( mem.read_half( 0x80000002 ), 0x4433u );
+    BOOST_CHECK_EQUAL( mem.read_byte( 0x80000001 ), 0x22u );
+
+    mem.write_byte ( 0x80000FFF, 0x55 );
+    mem.write_half ( 0x80000004, 0x6655 );
+    mem.write_dword( 0x80000008, 0x0123456789ABCDEFull );
+    BOOST_CHECK_EQUAL( mem.pages(), 1u );
+    BOOST_CHECK_EQUAL( mem.read_byte ( 0x80000FFF ), 0x55u );
+    BOOST_CHECK_EQUAL( mem.read_word ( 0x80000004 ), 0x6655u );
+    BOOST_CHECK_EQUAL( mem.read_dword( 0x80000008 ), 0x0123456789ABCDEFull );
+
+    // Far apart addresses
+    mem.write_word( 0x00001000, 1 );
+    mem.write_word( 0xFFFFF000, 2 );
+    BOOST_CHECK_EQUAL( mem.pages(), 3u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00001000 ), 1u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0xFFFFF000 ), 2u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x80000000 ), 0x44332211u );
+
+    mem.clear();
+    BOOST_CHECK_EQUAL( mem.pages(), 0u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x80000000 ), 0u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0xFFFFF000 ), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( paged_mem_cache_test )
+{
+    arm::paged_mem mem;
+
+    // The zero page read first is not read again once written
+    BOOST_CHECK_EQUAL( mem.read_word( 0x2000 ), 0u );
+    BOOST_CHECK_EQUAL( mem.read_byte( 0x2004 ), 0u );
+    mem.write_byte( 0x2000, 0xAA );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x2000 ), 0xAAu );
+    mem.write_byte( 0x2004, 0xBB );
+    BOOST_CHECK_EQUAL( mem.read_byte( 0x2004 ), 0xBBu );
+
+    // Alternating pages
+    for( uint32_t i = 0; i < 16; ++i )
+    {
+        mem.write_word( 0x3000 + ( i & 1 ) * 0x10000 + i * 4, i );
+    }
+    for( uint32_t i = 0; i < 16; ++i )
+    {
+        BOOST_CHECK_EQUAL(
+            mem.read_word( 0x3000 + ( i & 1 ) * 0x10000 + i * 4 ), i );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( paged_mem_page_caches_test )
+{
+    arm::paged_mem              mem;
+    arm::paged_mem::page_caches a, b;
+
+    // A page allocated through other caches is seen at once
+    BOOST_CHECK_EQUAL( mem.read_word( 0x5000, a ), 0u );
+    mem.write_word( 0x5000, 0x11, b );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x5000, a ), 0x11u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x5000 ), 0x11u );
+
+    // Caches filled with zeros are empty
+    memset( static_cast< void* >( &a ), 0, sizeof( a ) );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x0000, a ), 0u );
+    mem.write_word( 0x0000, 0x22, b );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x0000, a ), 0x22u );
+
+    // Across pages
+    uint32_t data[2];
+    mem.write_dword( 0x5FFC, 0x0000003300000044ull, a );
+    mem.read_words( 0x5FFC, data, 2, b );
+    BOOST_CHECK_EQUAL( data[0], 0x44u );
+    BOOST_CHECK_EQUAL( data[1], 0x33u );
+    BOOST_CHECK_EQUAL( mem.pages(), 3u );
+
+    mem.clear();
+    a.reset();
+    BOOST_CHECK_EQUAL( mem.read_word( 0x5000, a ), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( paged_mem_unaligned_test )
+{
+    arm::paged_mem mem;
+
+    mem.write_word( 0x1001, 0x44332211 );
+    BOOST_CHECK_EQUAL( mem.read_byte( 0x1001 ), 0x11u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x1001 ), 0x44332211u );
+
+    // Across a page boundary
+    mem.write_dword( 0x1FFD, 0x0123456789ABCDEFull );
+    BOOST_CHECK_EQUAL( mem.pages(), 2u );
+    BOOST_CHECK_EQUAL( mem.read_dword( 0x1FFD ), 0x0123456789ABCDEFull );
+    BOOST_CHECK_EQUAL( mem.read_half( 0x1FFF ), 0x89ABu );
+    BOOST_CHECK_EQUAL( mem.read_byte( 0x2000 ), 0x89u );
+
+    // Across the end of the address space
+    mem.write_word( 0xFFFFFFFE, 0xDDCCBBAA );
+    BOOST_CHECK_EQUAL( mem.read_half( 0xFFFFFFFE ), 0xBBAAu );
+    BOOST_CHECK_EQUAL( mem.read_half( 0x00000000 ), 0xDDCCu );
+    BOOST_CHECK_EQUAL( mem.read_word( 0xFFFFFFFE ), 0xDDCCBBAAu );
+
+    const char text[] = "paged memory";
+    char       copy[ sizeof( text ) ];
+    mem.write( 0x3FFA, text, sizeof( text ) );
+    mem.read ( 0x3FFA, copy, sizeof( copy ) );
+    BOOST_CHECK_EQUAL( copy, text );
+}
+
+BOOST_AUTO_TEST_CASE( paged_mem_run_test )
+{
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             arm::shared_mem< arm::paged_mem > > proc_type;
+
+    // Sums the words at r1 until a zero one, at a high address
+    const uint32_t program[] =
+    {
+        0xE3A00000,     // 0x00: mov   r0, #0
+        0xE4912004,     // 0x04: ldr   r2, [r1], #4
+        0xE0800002,     // 0x08: add   r0, r0, r2
+        0xE3520000,     // 0x0C: cmp   r2, #0
+        0x1AFFFFFB,     // 0x10: bne   0x04
+        0xEF000000      // 0x14: svc   #0
+    };
+
+    arm::paged_mem mem;
+    mem.write( 0xC0000000, program, sizeof( program ) );
+    for( uint32_t i = 1; i <= 10; ++i )
+    {
+        mem.write_word( 0x00010000 + 4 * ( i - 1 ), i );
+    }
+
+    proc_type proc;
+    uint32_t  R[16];
+    memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+    memset( R, 0, sizeof( R ) );
+    proc.R = R;
+    proc.iMem.mem = &mem;
+    proc.dMem.mem = &mem;
+    proc.PC = 0xC0000000;
+    R[1]    = 0x00010000;
+
+    BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 1u + 11 * 4 );
+    BOOST_CHECK_EQUAL( R[0], 55u );
+    BOOST_CHECK_EQUAL( proc.PC, 0xC0000014u );
+    BOOST_CHECK_EQUAL( mem.pages(), 2u );
+}
+
+BOOST_AUTO_TEST_CASE( paged_mem_smp_test )
+{
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             arm::shared_mem< arm::paged_mem > > proc_type;
+
+    // Stores r3 to r1 and moves r1 to the next page, r3 times
+    const uint32_t program[] =
+    {
+        0xE5813000,     // 0x00: str   r3, [r1]
+        0xE2811A01,     // 0x04: add   r1, r1, #0x1000
+        0xE2533001,     // 0x08: subs  r3, r3, #1
+        0x1AFFFFFB,     // 0x0C: bne   0x00
+        0xEF000000      // 0x10: svc   #0
+    };
+
+    arm::paged_mem mem;
+    mem.write( 0xC0000000, program, sizeof( program ) );
+
+    // All cores allocate the same pages at the same time
+    proc_type cores[4];
+    uint32_t  R[4][16];
+    for( int i = 0; i < 4; ++i )
+    {
+        memset( static_cast< void* >( &cores[i] ), 0, sizeof( cores[i] ) );
+        memset( R[i], 0, sizeof( R[i] ) );
+        cores[i].R = R[i];
+        cores[i].iMem.mem = &mem;
+        cores[i].dMem.mem = &mem;
+        cores[i].PC = 0xC0000000;
+        R[i][1] = 0x00100000 + 4 * i;
+        R[i][3] = 256;
+    }
+
+    arm::smp_system< proc_type > smp( cores, 4, 64 );
+    BOOST_CHECK_EQUAL( smp.run( 10000 ), 4u * 4 * 256 );
+    BOOST_CHECK_EQUAL( mem.pages(), 1u + 256 );
+    for( uint32_t k = 0; k < 256; ++k )
+    {
+        for( uint32_t i = 0; i < 4; ++i )
+        {
+            BOOST_CHECK_EQUAL(
+                mem.read_word( 0x00100000 + 0x1000 * k + 4 * i ), 256 - k );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( paged_mem_words_test )
+{
+    arm::paged_mem mem;
+    const uint32_t words[4] = { 0x11, 0x22, 0x33, 0x44 };
+    uint32_t       data[4];
+
+    // Within a page and across two
+    arm::WriteWords( mem, 0x00010000, words, 4 );
+    arm::WriteWords( mem, 0x00011FF8, words, 4 );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x0001000C ), 0x44u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00011FFC ), 0x22u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00012000 ), 0x33u );
+
+    arm::ReadWords( mem, 0x00011FF8, data, 4 );
+    BOOST_CHECK_EQUAL_COLLECTIONS( data, data + 4, words, words + 4 );
+
+    // Around the end of the address space
+    arm::WriteWords( mem, 0xFFFFFFF8, words, 4 );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00000004 ), 0x44u );
+    arm::ReadWords( mem, 0xFFFFFFF8, data, 4 );
+    BOOST_CHECK_EQUAL_COLLECTIONS( data, data + 4, words, words + 4 );
+
+    // More than a page
+    static uint32_t many[ 2000 ];
+    static uint32_t copy[ 2000 ];
+    for( uint32_t i = 0; i < 2000; ++i )
+    {
+        many[i] = i;
+    }
+    arm::WriteWords( mem, 0x00020010, many, 2000 );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00021000 ), 0x3FCu );
+    arm::ReadWords( mem, 0x00020010, copy, 2000 );
+    BOOST_CHECK_EQUAL_COLLECTIONS( copy, copy + 2000, many, many + 2000 );
+
+    // Memory types without bulk accesses are accessed word by word
+    static test_mem< 0x100 > small;
+    memset( &small, 0, sizeof( small ) );
+    arm::WriteWords( small, 0x10, words, 4 );
+    BOOST_CHECK_EQUAL( small.read_word( 0x18 ), 0x33u );
+    arm::ReadWords( small, 0x10, data, 4 );
+    BOOST_CHECK_EQUAL_COLLECTIONS( data, data + 4, words, words + 4 );
+}
+
+BOOST_AUTO_TEST_CASE( paged_mem_push_pop_test )
+{
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             arm::shared_mem< arm::paged_mem > > proc_type;
+
+    // Saves and restores registers on a stack across two pages
+    const uint32_t program[] =
+    {
+        0xE3A04001,     // 0x00: mov   r4, #1
+        0xE3A05002,     // 0x04: mov   r5, #2
+        0xE3A06003,     // 0x08: mov   r6, #3
+        0xE28FE008,     // 0x0C: add   lr, pc, #8
+        0xE92D4070,     // 0x10: push  {r4-r6, lr}
+        0xE3A04000,     // 0x14: mov   r4, #0
+        0xE8BD8070,     // 0x18: pop   {r4-r6, pc}
+        0xEF000000      // 0x1C: svc   #0
+    };
+
+    arm::paged_mem mem;
+    mem.write( 0xC0000000, program, sizeof( program ) );
+
+    proc_type proc;
+    uint32_t  R[16];
+    memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+    memset( R, 0, sizeof( R ) );
+    proc.R = R;
+    proc.iMem.mem = &mem;
+    proc.dMem.mem = &mem;
+    proc.PC = 0xC0000000;
+    R[13]   = 0x00012008;
+
+    BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 7u );
+    BOOST_CHECK_EQUAL( proc.PC, 0xC000001Cu );
+    BOOST_CHECK_EQUAL( R[4], 1u );
+    BOOST_CHECK_EQUAL( R[13], 0x00012008u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00011FF8 ), 1u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00012004 ), 0xC000001Cu );
+}
+
+BOOST_AUTO_TEST_CASE( reserved_mem_test )
+{
+    if( !arm::ReservedMemAvailable() )
+    {
+        BOOST_CHECK_THROW( arm::reserved_mem(), std::bad_alloc );
+        return;
+    }
+
+    arm::reserved_mem mem;
+    arm::reserved_mem other;
+
+    // Pages read as zeros until written
+    BOOST_CHECK_EQUAL( mem.read_word( 0x80000000 ), 0u );
+    BOOST_CHECK_EQUAL( mem.read_dword( 0xFFFFFFF8 ), 0u );
+
+    mem.write_word( 0x80000000, 0x44332211 );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x80000000 ), 0x44332211u );
+    BOOST_CHECK_EQUAL( mem.read_half( 0x80000002 ), 0x4433u );
+    BOOST_CHECK_EQUAL( mem.read_byte( 0x80000001 ), 0x22u );
+    BOOST_CHECK_EQUAL( other.read_word( 0x80000000 ), 0u );
+
+    mem.write_byte ( 0x00000000, 0x55 );
+    mem.write_half ( 0x12345678, 0x6655 );
+    mem.write_dword( 0xFFFFFFF8, 0x0123456789ABCDEFull );
+    BOOST_CHECK_EQUAL( mem.read_byte ( 0x00000000 ), 0x55u );
+    BOOST_CHECK_EQUAL( mem.read_word ( 0x12345678 ), 0x6655u );
+    BOOST_CHECK_EQUAL( mem.read_dword( 0xFFFFFFF8 ), 0x0123456789ABCDEFull );
+
+    // Unaligned, across a page boundary
+    mem.write_dword( 0x1FFD, 0x0123456789ABCDEFull );
+    BOOST_CHECK_EQUAL( mem.read_dword( 0x1FFD ), 0x0123456789ABCDEFull );
+    BOOST_CHECK_EQUAL( mem.read_byte( 0x2000 ), 0x89u );
+
+    // Across the end of the address space
+    const char text[] = "reserved memory";
+    char       copy[ sizeof( text ) ];
+    mem.write( 0xFFFFFFFA, text, sizeof( text ) );
+    mem.read ( 0xFFFFFFFA, copy, sizeof( copy ) );
+    BOOST_CHECK_EQUAL( copy, text );
+    BOOST_CHECK_EQUAL( mem.read_byte( 0x00000000 ), 'e' );
+
+    mem.clear();
+    BOOST_CHECK_EQUAL( mem.read_word( 0x80000000 ), 0u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x1FFD ), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( reserved_mem_run_test )
+{
+    if( !arm::ReservedMemAvailable() )
+    {
+        return;
+    }
+
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             arm::shared_mem< arm::reserved_mem > >
+        proc_type;
+
+    // Copies the words at r1 to r2 until a zero one, then stops
+    const uint32_t program[] =
+    {
+        0xE4913004,     // 0x00: ldr   r3, [r1], #4
+        0xE4823004,     // 0x04: str   r3, [r2], #4
+        0xE3530000,     // 0x08: cmp   r3, #0
+        0x1AFFFFFB,     // 0x0C: bne   0x00
+        0xEF000000      // 0x10: svc   #0
+    };
+
+    arm::reserved_mem mem;
+    mem.write( 0xC0000000, program, sizeof( program ) );
+    for( uint32_t i = 1; i <= 4; ++i )
+    {
+        mem.write_word( 0x00010000 + 4 * ( i - 1 ), i );
+    }
+
+    proc_type proc;
+    uint32_t  R[16];
+    memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+    memset( R, 0, sizeof( R ) );
+    proc.R = R;
+    proc.iMem.mem = &mem;
+    proc.dMem.mem = &mem;
+    proc.PC = 0xC0000000;
+    R[1]    = 0x00010000;
+    R[2]    = 0x7FFFFFF8;
+
+    BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 5u * 4 );
+    BOOST_CHECK_EQUAL( proc.PC, 0xC0000010u );
+    for( uint32_t i = 1; i <= 4; ++i )
+    {
+        BOOST_CHECK_EQUAL( mem.read_word( 0x7FFFFFF8 + 4 * ( i - 1 ) ), i );
+    }
+}
+
+#endif // __ARMV7_MEMORY_TEST_HPP__
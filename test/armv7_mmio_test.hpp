@@ -0,0 +1,199 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the memory-mapped I/O bus.
+ */
+
+#ifndef __ARMV7_MMIO_TEST_HPP__
+#define __ARMV7_MMIO_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+#include <stdexcept>
+
+
+namespace {
+
+    // Remembers its last write, and reads as the offset and size of
+    // the access
+    struct mmio_test_device
+    {
+        uint32_t     offset;
+        uint32_t     data;
+        unsigned int size;
+        unsigned int reads;
+        unsigned int writes;
+
+        static uint32_t read( void* device, uint32_t offset,
+                              unsigned int size )
+        {
+            ++static_cast< mmio_test_device* >( device )->reads;
+            return offset | size << 16;
+        }
+
+        static void write( void* device, uint32_t offset, uint32_t data,
+                           unsigned int size )
+        {
+            mmio_test_device* self = static_cast< mmio_test_device* >( device );
+            self->offset = offset;
+            self->data   = data;
+            self->size   = size;
+            ++self->writes;
+        }
+    };
+
+    // Writes r0 to the device at 0x10000000 and reads it back
+    const uint32_t mmio_test_program[] =
+    {
+        0xE59F1008,     // 0x00: ldr   r1, [pc, #8]
+        0xE5810004,     // 0x04: str   r0, [r1, #4]
+        0xE5912008,     // 0x08: ldr   r2, [r1, #8]
+        0xEF000000,     // 0x0C: svc   #0
+        0x10000000      // 0x10: .word 0x10000000
+    };
+
+}
+
+
+BOOST_AUTO_TEST_CASE( mmio_bus_test )
+{
+    static uint32_t  ram[ 0x2000 / 4 ];
+    mmio_test_device device;
+    memset( ram, 0, sizeof( ram ) );
+    memset( &device, 0, sizeof( device ) );
+
+    arm::mmio_bus bus;
+    bus.map_ram( 0x8000, 0x2000, ram );
+    bus.map_device( 0xA000, 0x2000, &device, mmio_test_device::read,
+                    mmio_test_device::write );
+
+    // RAM is accessed in place
+    bus.write_word( 0x8004, 0x11223344 );
+    BOOST_CHECK_EQUAL( ram[1], 0x11223344u );
+    BOOST_CHECK_EQUAL( bus.read_half( 0x8006 ), 0x1122u );
+    BOOST_CHECK_EQUAL( bus.read_dword( 0x8000 ), 0x1122334400000000ull );
+    BOOST_CHECK( arm::HostPage( bus, 0x9123 ) ==
+                 reinterpret_cast< uint8_t* >( ram ) + 0x1000 );
+    BOOST_CHECK( arm::HostPage( bus, 0xA000 ) == 0 );
+
+    // Devices see offsets from the start of their range
+    BOOST_CHECK_EQUAL( bus.read_word( 0xB010 ), 0x00041010u );
+    BOOST_CHECK_EQUAL( bus.read_byte( 0xA003 ), 0x03u );
+    bus.write_half( 0xA006, 0xBEEF );
+    BOOST_CHECK_EQUAL( device.offset, 6u );
+    BOOST_CHECK_EQUAL( device.data, 0xBEEFu );
+    BOOST_CHECK_EQUAL( device.size, 2u );
+
+    // Doublewords are two words
+    BOOST_CHECK_EQUAL( bus.read_dword( 0xA010 ), 0x0004001400040010ull );
+    bus.write_dword( 0xA020, 0x5566778899AABBCCull );
+    BOOST_CHECK_EQUAL( device.offset, 0x24u );
+    BOOST_CHECK_EQUAL( device.data, 0x55667788u );
+    BOOST_CHECK_EQUAL( device.writes, 3u );
+
+    // Crossing from RAM to the device, one byte at a time
+    bus.write_word( 0x9FFE, 0xCAFEF00D );
+    BOOST_CHECK_EQUAL( ram[ 0x7FF ] >> 16, 0xF00Du );
+    BOOST_CHECK_EQUAL( device.offset, 1u );
+    BOOST_CHECK_EQUAL( device.data, 0xCAu );
+    BOOST_CHECK_EQUAL( device.size, 1u );
+    BOOST_CHECK_EQUAL( bus.read_word( 0x9FFE ), 0x0100F00Du );
+
+    // Bulk accesses
+    uint32_t data[3] = { 1, 2, 3 };
+    bus.write_words( 0x8100, data, 3 );
+    BOOST_CHECK_EQUAL( ram[ 0x42 ], 3u );
+    device.reads = 0;
+    bus.read_words( 0xA100, data, 2 );
+    BOOST_CHECK_EQUAL( data[1], 0x00040104u );
+    BOOST_CHECK_EQUAL( device.reads, 2u );
+
+    // Longer than a page, from RAM to the device
+    static uint32_t many[ 1030 ];
+    memset( many, 0, sizeof( many ) );
+    device.writes = 0;
+    bus.write_words( 0x9000, many, 1030 );
+    BOOST_CHECK_EQUAL( device.writes, 6u );
+    device.reads = 0;
+    bus.read_words( 0x9000, many, 1030 );
+    BOOST_CHECK_EQUAL( device.reads, 6u );
+
+    // Unmapped pages
+    BOOST_CHECK_EQUAL( bus.read_word( 0x7000 ), 0u );
+    bus.write_word( 0x7000, 1 );
+    BOOST_CHECK_EQUAL( bus.read_word( 0x7000 ), 0u );
+    bus.unmap( 0x9000, 0x1000 );
+    BOOST_CHECK_EQUAL( bus.read_word( 0x9000 ), 0u );
+    BOOST_CHECK_EQUAL( bus.read_word( 0x8004 ), 0x11223344u );
+    bus.map_ram( 0x9000, 0x1000, ram );
+    BOOST_CHECK_EQUAL( bus.read_word( 0x9004 ), 0x11223344u );
+
+    // Invalid ranges
+    BOOST_CHECK_THROW( bus.map_ram( 0x10800, 0x1000, ram ),
+                       std::invalid_argument );
+    BOOST_CHECK_THROW( bus.map_ram( 0x10000, 0, ram ),
+                       std::invalid_argument );
+    BOOST_CHECK_THROW( bus.map_ram( 0xFFFFF000, 0x2000, ram ),
+                       std::invalid_argument );
+    BOOST_CHECK_THROW( bus.map_device( 0xB000, 0x1000, &device,
+                                       mmio_test_device::read,
+                                       mmio_test_device::write ),
+                       std::invalid_argument );
+    BOOST_CHECK_THROW( bus.unmap( 0x8800, 0x800 ), std::invalid_argument );
+    bus.map_ram( 0xFFFFF000, 0x1000, ram );
+    BOOST_CHECK_EQUAL( bus.read_word( 0xFFFFF004 ), 0x11223344u );
+}
+
+BOOST_AUTO_TEST_CASE( mmio_bus_run_test )
+{
+    static uint32_t  ram[ 0x1000 / 4 ];
+    mmio_test_device device;
+    memset( ram, 0, sizeof( ram ) );
+    memset( &device, 0, sizeof( device ) );
+    memcpy( ram, mmio_test_program, sizeof( mmio_test_program ) );
+
+    arm::mmio_bus bus;
+    bus.map_ram( 0, sizeof( ram ), ram );
+    bus.map_device( 0x10000000, 0x1000, &device, mmio_test_device::read,
+                    mmio_test_device::write );
+
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             arm::shared_mem< arm::mmio_bus > >
+        proc_type;
+
+    proc_type proc;
+    uint32_t  R[16];
+    memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+    memset( R, 0, sizeof( R ) );
+    proc.R = R;
+    proc.iMem.mem = &bus;
+    proc.dMem.mem = &bus;
+    R[0] = 42;
+
+    BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 3u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x0Cu );
+    BOOST_CHECK_EQUAL( device.offset, 4u );
+    BOOST_CHECK_EQUAL( device.data, 42u );
+    BOOST_CHECK_EQUAL( R[2], 0x00040008u );
+}
+
+#endif // __ARMV7_MMIO_TEST_HPP__
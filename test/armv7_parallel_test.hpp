@@ -0,0 +1,231 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the lane operations of the parallel addition and
+ * subtraction instructions.
+ */
+
+#ifndef __ARMV7_PARALLEL_TEST_HPP__
+#define __ARMV7_PARALLEL_TEST_HPP__
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+
+
+namespace {
+
+    enum parallel_test_op
+    {
+        op_add, op_sub, op_hadd, op_hsub, op_shadd, op_shsub,
+        op_qadd, op_qsub, op_uqadd, op_uqsub
+    };
+
+    int64_t Clamp( int64_t x, int64_t min, int64_t max )
+    {
+        return x < min ? min : ( x > max ? max : x );
+    }
+
+    // Computes each lane separately, as the manual does
+    uint32_t ReferenceParallel( parallel_test_op op, uint32_t a, uint32_t b,
+                                int width )
+    {
+        const uint32_t mask = width == 8 ? 0xFF : 0xFFFF;
+        const int64_t  smax = mask >> 1;
+
+        uint32_t result = 0;
+        for( int i = 0; i < 32; i += width )
+        {
+            const int64_t ua = ( a >> i ) & mask;
+            const int64_t ub = ( b >> i ) & mask;
+            const int64_t sa = ua > smax ? ua - mask - 1 : ua;
+            const int64_t sb = ub > smax ? ub - mask - 1 : ub;
+
+            int64_t lane = 0;
+            switch( op )
+            {
+            case op_add:   lane = ua + ub;                              break;
+            case op_sub:   lane = ua - ub;                              break;
+            case op_hadd:  lane = ( ua + ub ) >> 1;                     break;
+            case op_hsub:  lane = ( ua - ub ) >> 1;                     break;
+            case op_shadd: lane = ( sa + sb ) >> 1;                     break;
+            case op_shsub: lane = ( sa - sb ) >> 1;                     break;
+            case op_qadd:  lane = Clamp( sa + sb, -smax - 1, smax );    break;
+            case op_qsub:  lane = Clamp( sa - sb, -smax - 1, smax );    break;
+            case op_uqadd: lane = Clamp( ua + ub, 0, mask );            break;
+            case op_uqsub: lane = Clamp( ua - ub, 0, mask );            break;
+            }
+            result |= ( (uint32_t)lane & mask ) << i;
+        }
+        return result;
+    }
+
+    uint32_t SWARParallel( parallel_test_op op, uint32_t a, uint32_t b,
+                           int width )
+    {
+        if( width == 8 )
+        {
+            switch( op )
+            {
+            case op_add:   return arm::ParallelAdd< 8 >( a, b );
+            case op_sub:   return arm::ParallelSub< 8 >( a, b );
+            case op_hadd:  return arm::ParallelHalvingAdd< 8 >( a, b );
+            case op_hsub:  return arm::ParallelHalvingSub< 8 >( a, b );
+            case op_shadd: return arm::ParallelSignedHalvingAdd< 8 >( a, b );
+            case op_shsub: return arm::ParallelSignedHalvingSub< 8 >( a, b );
+            case op_qadd:  return arm::ParallelSatAdd< 8 >( a, b );
+            case op_qsub:  return arm::ParallelSatSub< 8 >( a, b );
+            case op_uqadd: return arm::ParallelUnsignedSatAdd< 8 >( a, b );
+            case op_uqsub: return arm::ParallelUnsignedSatSub< 8 >( a, b );
+            }
+        }
+
+        switch( op )
+        {
+        case op_add:   return arm::ParallelAdd< 16 >( a, b );
+        case op_sub:   return arm::ParallelSub< 16 >( a, b );
+        case op_hadd:  return arm::ParallelHalvingAdd< 16 >( a, b );
+        case op_hsub:  return arm::ParallelHalvingSub< 16 >( a, b );
+        case op_shadd: return arm::ParallelSignedHalvingAdd< 16 >( a, b );
+        case op_shsub: return arm::ParallelSignedHalvingSub< 16 >( a, b );
+        case op_qadd:  return arm::ParallelSatAdd< 16 >( a, b );
+        case op_qsub:  return arm::ParallelSatSub< 16 >( a, b );
+        case op_uqadd: return arm::ParallelUnsignedSatAdd< 16 >( a, b );
+        case op_uqsub: return arm::ParallelUnsignedSatSub< 16 >( a, b );
+        }
+        return 0;
+    }
+
+    // Random words whose bytes are often at the lane bounds
+    uint32_t NextParallelTestValue( uint32_t& seed )
+    {
+        const uint8_t bounds[] = { 0x00, 0x01, 0x7F, 0x80, 0xFF };
+
+        uint32_t value = 0;
+        for( int i = 0; i < 32; i += 8 )
+        {
+            seed = seed * 1103515245 + 12345;
+            const uint32_t r = seed >> 16;
+            value |= (uint32_t)( r % 3 == 0 ? bounds[ ( r >> 2 ) % 5 ] :
+                                              ( r >> 4 ) & 0xFF ) << i;
+        }
+        return value;
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE( parallel_lanes_test )
+{
+    uint32_t seed = 13;
+    for( int n = 0; n < 20000; ++n )
+    {
+        const uint32_t a = NextParallelTestValue( seed );
+        const uint32_t b = NextParallelTestValue( seed );
+
+        for( int op = op_add; op <= op_uqsub; ++op )
+        {
+            const parallel_test_op o = static_cast< parallel_test_op >( op );
+            BOOST_CHECK_EQUAL( SWARParallel( o, a, b, 8 ),
+                               ReferenceParallel( o, a, b, 8 ) );
+            BOOST_CHECK_EQUAL( SWARParallel( o, a, b, 16 ),
+                               ReferenceParallel( o, a, b, 16 ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( parallel_ge_test )
+{
+    uint32_t seed = 17;
+    for( int n = 0; n < 20000; ++n )
+    {
+        const uint32_t a = NextParallelTestValue( seed );
+        const uint32_t b = NextParallelTestValue( seed );
+
+        // GE bits of SADD8, SSUB8, UADD8 and USUB8
+        uint32_t sadd = 0, ssub = 0, uadd = 0, usub = 0;
+        for( int i = 0; i < 4; ++i )
+        {
+            const int32_t ua = ( a >> 8 * i ) & 0xFF;
+            const int32_t ub = ( b >> 8 * i ) & 0xFF;
+            const int32_t sa = (int8_t)ua;
+            const int32_t sb = (int8_t)ub;
+            sadd |= ( sa + sb >= 0     ? 1 : 0 ) << i;
+            ssub |= ( sa - sb >= 0     ? 1 : 0 ) << i;
+            uadd |= ( ua + ub >= 0x100 ? 1 : 0 ) << i;
+            usub |= ( ua - ub >= 0     ? 1 : 0 ) << i;
+        }
+        BOOST_CHECK_EQUAL( arm::GEFromSigns< 8 >(
+                               ~arm::ParallelSignedHalvingAdd< 8 >( a, b ) ),
+                           sadd );
+        BOOST_CHECK_EQUAL( arm::GEFromSigns< 8 >(
+                               ~arm::ParallelSignedHalvingSub< 8 >( a, b ) ),
+                           ssub );
+        BOOST_CHECK_EQUAL( arm::GEFromSigns< 8 >(
+                               arm::ParallelHalvingAdd< 8 >( a, b ) ),
+                           uadd );
+        BOOST_CHECK_EQUAL( arm::GEFromSigns< 8 >(
+                               ~arm::ParallelHalvingSub< 8 >( a, b ) ),
+                           usub );
+
+        // 16-bit lanes set two bits each
+        const int32_t  lo = (int16_t)a + (int16_t)b;
+        const int32_t  hi = (int16_t)( a >> 16 ) + (int16_t)( b >> 16 );
+        const uint32_t ge = ( lo >= 0 ? 0x3 : 0 ) | ( hi >= 0 ? 0xC : 0 );
+        BOOST_CHECK_EQUAL( arm::GEFromSigns< 16 >(
+                               ~arm::ParallelSignedHalvingAdd< 16 >( a, b ) ),
+                           ge );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( GEByteMask_test )
+{
+    for( uint32_t ge = 0; ge < 16; ++ge )
+    {
+        uint32_t mask = 0;
+        for( int i = 0; i < 4; ++i )
+        {
+            mask |= ( ( ge >> i ) & 1 ) ? 0xFFu << 8 * i : 0;
+        }
+        BOOST_CHECK_EQUAL( arm::GEByteMask( ge ), mask );
+        BOOST_CHECK_EQUAL( arm::GEFromSigns< 8 >( mask ), ge );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( SumAbsDiff8_test )
+{
+    uint32_t seed = 19;
+    for( int n = 0; n < 20000; ++n )
+    {
+        const uint32_t a = NextParallelTestValue( seed );
+        const uint32_t b = NextParallelTestValue( seed );
+
+        uint32_t sum = 0;
+        for( int i = 0; i < 32; i += 8 )
+        {
+            const int32_t diff = (int32_t)( ( a >> i ) & 0xFF ) -
+                                 (int32_t)( ( b >> i ) & 0xFF );
+            sum += diff < 0 ? -diff : diff;
+        }
+        BOOST_CHECK_EQUAL( arm::SumAbsDiff8( a, b ), sum );
+    }
+
+    BOOST_STATIC_ASSERT( arm::SumAbsDiff8( 0x01020304, 0xFEFDFCFB ) == 0x3E8 );
+}
+
+#endif // __ARMV7_PARALLEL_TEST_HPP__
@@ -0,0 +1,204 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the ARMv7 predecoded instructions.
+ */
+
+#ifndef __ARMV7_PREDECODE_TEST_HPP__
+#define __ARMV7_PREDECODE_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    // Initial register values. Low registers are valid addresses in
+    // the test memory, the others exercise the flags.
+    const uint32_t predecode_test_regs[16] =
+    {
+        0x00000010, 0x00000040, 0x00000080, 0x80000001,
+        0xFFFFFFFF, 0x7FFFFFFF, 0x00000000, 0x000000C0,
+        0x00000001, 0x00000100, 0xF0000000, 0x0000001F,
+        0x00000004, 0x00000200, 0x00000000, 0x00000008
+    };
+
+    void InitPredecodeTestProc( test_proc& proc, uint32_t* R, bool carry )
+    {
+        memset( &proc, 0, sizeof( proc ) );
+        memcpy( R, predecode_test_regs, sizeof( predecode_test_regs ) );
+        proc.R      = R;
+        proc.PC     = 0x100;
+        proc.CPSR.C = carry ? 1 : 0;
+        proc.CPSR.Z = 1;
+
+        for( uint32_t i = 0; i < 1024; ++i )
+        {
+            proc.dMem.bytes[i] = i * 7;
+        }
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE( Predecode_fields_test )
+{
+    // adds r2, r1, r3, lsl #4
+    arm::Predecoded p = arm::Predecode( 0xE0912203 );
+    BOOST_CHECK_EQUAL( p.encoding, arm::Encoding_ADD_reg_A1 );
+    BOOST_CHECK( p.simple );
+    BOOST_CHECK( p.setflags );
+    BOOST_CHECK_EQUAL( p.n, 1 );
+    BOOST_CHECK_EQUAL( p.d, 2 );
+    BOOST_CHECK_EQUAL( p.m, 3 );
+    BOOST_CHECK_EQUAL( p.shift_t, arm::SRType_LSL );
+    BOOST_CHECK_EQUAL( p.shift_n, 4u );
+
+    // ldr r0, [r1, #-4]!
+    p = arm::Predecode( 0xE5310004 );
+    BOOST_CHECK_EQUAL( p.encoding, arm::Encoding_LDR_imm_A1 );
+    BOOST_CHECK( p.simple );
+    BOOST_CHECK( p.index );
+    BOOST_CHECK( !p.add );
+    BOOST_CHECK( p.wback );
+    BOOST_CHECK_EQUAL( p.imm32, 4u );
+
+    // b .-4
+    p = arm::Predecode( 0xEAFFFFFD );
+    BOOST_CHECK_EQUAL( p.encoding, arm::Encoding_B_A1 );
+    BOOST_CHECK_EQUAL( p.imm32, 0xFFFFFFF4u );
+
+    // Special cases are not simple: mov pc, lr and ldr r1, [r1, #4]!
+    BOOST_CHECK( !arm::Predecode( 0xE1A0F00E ).simple );
+    BOOST_CHECK( !arm::Predecode( 0xE5B11004 ).simple );
+
+    // Encodings without a predecoded behavior function
+    BOOST_CHECK( !arm::Predecode( 0xE0000291 ).simple );
+}
+
+
+BOOST_AUTO_TEST_CASE( PredecodeInstr_equivalence_test )
+{
+    const uint32_t instrs[] =
+    {
+        0xE2810001, 0xE2910001, 0xE0812003, 0xE0912203, 0xE0945004,
+        0xE2411001, 0xE2541001, 0xE0412003, 0xE0542363, 0xE0563004,
+        0xE20100FF, 0xE21340FF, 0xE0012003, 0xE01320A4, 0xE01420C4,
+        0xE38114FF, 0xE3930102, 0xE1812003, 0xE1932E63, 0xE1942064,
+        0xE22114FF, 0xE2330102, 0xE0212003, 0xE0332FE4, 0xE0342024,
+        0xE3C114FF, 0xE3D30102, 0xE1C12003, 0xE1D32FA3, 0xE1D42084,
+        0xE3A004FF, 0xE3B00102, 0xE3B00000, 0xE1A02003, 0xE1B02004,
+        0xE1B06006, 0xE3E00000, 0xE3F00102, 0xE3F000FF,
+        0xE3530001, 0xE3540102, 0xE1530004, 0xE1550104, 0xE1560007,
+        0xE3730001, 0xE3750001, 0xE1730004, 0xE17302C4,
+        0xE3130001, 0xE3160102, 0xE1130004, 0xE11400A4,
+        0xE3330001, 0xE3340102, 0xE1330004, 0xE1340FE4,
+        0xE5910004, 0xE5110004, 0xE5B10004, 0xE4920008, 0xE5920000,
+        0xE5D10001, 0xE5510003, 0xE4D20003, 0xE5F20002,
+        0xE5810004, 0xE5010004, 0xE5A1000C, 0xE4820008,
+        0xE5C10001, 0xE5410003, 0xE4C20003, 0xE5E20002,
+        0xEA000004, 0xEAFFFFFD, 0x0A000004, 0x1A000004, 0xEB000010,
+        0x1B000010, 0xE0000291, 0xE1A0F00E, 0xE6BF0F31
+    };
+
+    for( uint32_t i = 0; i < sizeof( instrs ) / sizeof( instrs[0] ); ++i )
+    {
+        for( int carry = 0; carry < 2; ++carry )
+        {
+            test_proc expected, actual;
+            uint32_t  expected_R[16], actual_R[16];
+            InitPredecodeTestProc( expected, expected_R, carry );
+            InitPredecodeTestProc(   actual,   actual_R, carry );
+
+            arm::decode< test_proc >( instrs[i] ).handler( expected,
+                                                           instrs[i] );
+
+            arm::predecoded_instr< test_proc > p =
+                arm::PredecodeInstr< test_proc >( instrs[i] );
+            p.exec( actual, p );
+
+            BOOST_CHECK_MESSAGE( memcmp( expected_R, actual_R,
+                                         sizeof( expected_R ) ) == 0,
+                                 std::hex << instrs[i] );
+            BOOST_CHECK_MESSAGE( expected.PC     == actual.PC &&
+                                 expected.CPSR.N == actual.CPSR.N &&
+                                 expected.CPSR.Z == actual.CPSR.Z &&
+                                 expected.CPSR.C == actual.CPSR.C &&
+                                 expected.CPSR.V == actual.CPSR.V &&
+                                 expected.CPSR.T == actual.CPSR.T,
+                                 std::hex << instrs[i] );
+            BOOST_CHECK_MESSAGE( memcmp( expected.dMem.bytes,
+                                         actual.dMem.bytes, 1024 ) == 0,
+                                 std::hex << instrs[i] );
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE( predecode_cache_test )
+{
+    test_proc proc;
+    uint32_t  R[16];
+    InitPredecodeTestProc( proc, R, false );
+
+    proc.iMem.words[0] = 0xE2811001;    // add r1, r1, #1
+    proc.iMem.words[1] = 0xE2522001;    // subs r2, r2, #1
+
+    arm::predecode_cache< test_proc, 4 >* cache =
+        new arm::predecode_cache< test_proc, 4 >;
+
+    const arm::predecoded_instr< test_proc >& e0 = cache->lookup( proc, 0 );
+    BOOST_CHECK_EQUAL( e0.address, 0u );
+    BOOST_CHECK_EQUAL( e0.encoding, arm::Encoding_ADD_imm_A1 );
+    arm::predecoded_instr< test_proc >::exec_type exec =
+        &arm::ADD_imm_A1< test_proc >;
+    BOOST_CHECK( e0.exec == exec );
+
+    e0.exec( proc, e0 );
+    BOOST_CHECK_EQUAL( R[1], 0x41u );
+
+    // A hit does not fetch the instruction again
+    proc.iMem.words[0] = 0xE2811002;    // add r1, r1, #2
+    BOOST_CHECK_EQUAL( cache->lookup( proc, 0 ).imm32, 1u );
+
+    cache->invalidate( 0 );
+    BOOST_CHECK_EQUAL( cache->lookup( proc, 0 ).imm32, 2u );
+
+    // Addresses 0x4 and 0x44 map to the same entry
+    BOOST_CHECK_EQUAL( cache->lookup( proc, 4 ).encoding,
+                       arm::Encoding_SUB_imm_A1 );
+    proc.iMem.words[17] = 0xE1A00000;   // mov r0, r0
+    BOOST_CHECK_EQUAL( cache->lookup( proc, 0x44 ).encoding,
+                       arm::Encoding_MOV_reg_A1 );
+    BOOST_CHECK_EQUAL( cache->lookup( proc, 4 ).encoding,
+                       arm::Encoding_SUB_imm_A1 );
+
+    proc.iMem.words[1] = 0xE0000291;    // mul r0, r1, r2
+    cache->flush();
+    const arm::predecoded_instr< test_proc >& e1 = cache->lookup( proc, 4 );
+    BOOST_CHECK_EQUAL( e1.encoding, arm::Encoding_MUL_A1 );
+    BOOST_CHECK( e1.exec == &arm::ExecuteInstrWord< test_proc > );
+
+    delete cache;
+}
+
+#endif // __ARMV7_PREDECODE_TEST_HPP__
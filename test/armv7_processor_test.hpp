@@ -0,0 +1,252 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the processor structures.
+ */
+
+#ifndef __ARMV7_PROCESSOR_TEST_HPP__
+#define __ARMV7_PROCESSOR_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    typedef arm::lazy_cpsr_adaptor< test_field > lazy_test_cpsr;
+    typedef arm::armv7_core< lazy_test_cpsr, test_reg,
+                             test_bank, test_mem<1024> > lazy_test_proc;
+    typedef arm::armv7_core< arm::packed_cpsr, test_reg,
+                             test_bank, test_mem<1024> > packed_test_proc;
+
+    // Flag-setting and flag-reading instructions on r0 to r4
+    const uint32_t lazy_test_instrs[] =
+    {
+        0xE0910002, // adds  r0, r1, r2
+        0xE0B10002, // adcs  r0, r1, r2
+        0xE0510002, // subs  r0, r1, r2
+        0xE0D10002, // sbcs  r0, r1, r2
+        0xE0710002, // rsbs  r0, r1, r2
+        0xE0F10002, // rscs  r0, r1, r2
+        0xE1510002, // cmp   r1, r2
+        0xE1710002, // cmn   r1, r2
+        0xE2910001, // adds  r0, r1, #1
+        0xE2510001, // subs  r0, r1, #1
+        0xE0110002, // ands  r0, r1, r2
+        0xE0310082, // eors  r0, r1, r2, lsl #1
+        0xE1B000A1, // movs  r0, r1, lsr #1
+        0xE1F00002, // mvns  r0, r2
+        0xE1110002, // tst   r1, r2
+        0xE3310102, // teq   r1, #0x80000000
+        0xE0A11002, // adc   r1, r1, r2
+        0x02833001, // addeq r3, r3, #1
+        0xC2833001, // addgt r3, r3, #1
+        0x82833001, // addhi r3, r3, #1
+        0x62833001, // addvs r3, r3, #1
+        0x42833001, // addmi r3, r3, #1
+        0xE128F003, // msr   apsr_nzcvq, r3
+        0xE10F4000  // mrs   r4, apsr
+    };
+
+    const uint32_t lazy_test_values[] =
+    {
+        0x00000000, 0x00000001, 0x7FFFFFFF, 0x80000000,
+        0x80000001, 0xFFFFFFFF, 0x12345678, 0xFFFFFFFE
+    };
+
+}
+
+
+BOOST_AUTO_TEST_CASE( LazyCPSR_equivalence_test )
+{
+    const uint32_t instr_count  = sizeof( lazy_test_instrs ) /
+                                  sizeof( lazy_test_instrs[0] );
+    const uint32_t value_count  = sizeof( lazy_test_values ) /
+                                  sizeof( lazy_test_values[0] );
+    uint32_t seed = 1;
+
+    for( int run = 0; run < 2000; ++run )
+    {
+        uint32_t R[16] = { 0 };
+        uint32_t L[16] = { 0 };
+        test_proc      proc;
+        lazy_test_proc lazy;
+        memset( &proc, 0, sizeof( proc ) );
+        memset( static_cast< void* >( &lazy ), 0, sizeof( lazy ) );
+        proc.R = R;
+        lazy.R = L;
+
+        for( int i = 0; i < 3; ++i )
+        {
+            seed = seed * 1103515245 + 12345;
+            R[i] = L[i] = lazy_test_values[( seed >> 16 ) % value_count];
+        }
+
+        for( int i = 0; i < 4; ++i )
+        {
+            seed = seed * 1103515245 + 12345;
+            const uint32_t instr = lazy_test_instrs[( seed >> 16 ) %
+                                                    instr_count];
+
+            arm::DecodeResult< test_proc > d =
+                arm::decode< test_proc >( instr );
+            arm::DecodeResult< lazy_test_proc > l =
+                arm::decode< lazy_test_proc >( instr );
+            BOOST_REQUIRE( d.handler && l.handler );
+            d.handler( proc, instr );
+            l.handler( lazy, instr );
+
+            for( int r = 0; r < 5; ++r )
+            {
+                BOOST_CHECK_EQUAL( R[r], L[r] );
+            }
+        }
+
+        BOOST_CHECK_EQUAL( proc.CPSR.N, (uint32_t)lazy.CPSR.N );
+        BOOST_CHECK_EQUAL( proc.CPSR.Z, (uint32_t)lazy.CPSR.Z );
+        BOOST_CHECK_EQUAL( proc.CPSR.C, (uint32_t)lazy.CPSR.C );
+        BOOST_CHECK_EQUAL( proc.CPSR.V, (uint32_t)lazy.CPSR.V );
+        BOOST_CHECK_EQUAL( arm::ConditionFlags( proc.CPSR ),
+                           arm::ConditionFlags( lazy.CPSR ) );
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE( LazyCPSR_materialize_test )
+{
+    lazy_test_cpsr cpsr;
+    memset( static_cast< void* >( &cpsr ), 0, sizeof( cpsr ) );
+
+    // 0x7FFFFFFF + 1: N and V set
+    arm::SetAddFlags( cpsr, 0x7FFFFFFF, 1, 0 );
+    BOOST_CHECK_EQUAL( cpsr.op, (uint32_t)arm::FlagsOp_Add );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.N, 1u );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.Z, 0u );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.C, 0u );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.V, 1u );
+
+    // Logical operations keep V
+    arm::SetLogicalFlags( cpsr, 0, 1 );
+    BOOST_CHECK_EQUAL( cpsr.op, (uint32_t)arm::FlagsOp_Logical );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.N, 0u );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.Z, 1u );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.C, 1u );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.V, 1u );
+
+    // Writing a flag stores the other ones first
+    cpsr.Z = 0;
+    BOOST_CHECK_EQUAL( cpsr.op, (uint32_t)arm::FlagsOp_None );
+    BOOST_CHECK_EQUAL( cpsr.N.value, 0u );
+    BOOST_CHECK_EQUAL( cpsr.Z.value, 0u );
+    BOOST_CHECK_EQUAL( cpsr.C.value, 1u );
+    BOOST_CHECK_EQUAL( cpsr.V.value, 1u );
+
+    // Copies keep the record
+    arm::SetAddFlags( cpsr, 0xFFFFFFFF, 0, 1 );
+    lazy_test_cpsr copy = cpsr;
+    BOOST_CHECK_EQUAL( (uint32_t)copy.Z, 1u );
+    BOOST_CHECK_EQUAL( (uint32_t)copy.C, 1u );
+    BOOST_CHECK_EQUAL( (uint32_t)copy.V, 0u );
+}
+
+BOOST_AUTO_TEST_CASE( PackedCPSR_fields_test )
+{
+    arm::packed_cpsr cpsr;
+    cpsr.word = 0;
+    BOOST_CHECK_EQUAL( sizeof( cpsr ), 4u );
+
+    cpsr.N  = 1;
+    cpsr.GE = 0xA;
+    cpsr.M  = 0x13;
+    BOOST_CHECK_EQUAL( cpsr.word, 0x800A0013u );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.GE, 0xAu );
+
+    // Fields keep their width
+    cpsr.Z  = 2;
+    cpsr.GE |= 0x15;
+    BOOST_CHECK_EQUAL( cpsr.word, 0x800F0013u );
+
+    // Integer operators, as used by CPSRWriteByInstr()
+    cpsr &= ~0xF0000000;
+    cpsr |= 0x60000000;
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr, 0x600F0013u );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.Z, 1u );
+    BOOST_CHECK_EQUAL( (uint32_t)cpsr.C, 1u );
+    BOOST_CHECK_EQUAL( arm::ConditionFlags( cpsr ), 0x6u );
+
+    arm::WriteAPSR( cpsr, 0x9FF5FFFF, true, false );
+    BOOST_CHECK_EQUAL( arm::CPSRValue( cpsr ), 0x980F0013u );
+    arm::WriteAPSR( cpsr, 0x00050000, false, true );
+    BOOST_CHECK_EQUAL( arm::CPSRValue( cpsr ), 0x98050013u );
+}
+
+
+BOOST_AUTO_TEST_CASE( PackedCPSR_equivalence_test )
+{
+    const uint32_t instr_count  = sizeof( lazy_test_instrs ) /
+                                  sizeof( lazy_test_instrs[0] );
+    const uint32_t value_count  = sizeof( lazy_test_values ) /
+                                  sizeof( lazy_test_values[0] );
+    uint32_t seed = 7;
+
+    for( int run = 0; run < 2000; ++run )
+    {
+        uint32_t R[16] = { 0 };
+        uint32_t P[16] = { 0 };
+        test_proc proc;
+        memset( &proc, 0, sizeof( proc ) );
+        proc.R = R;
+        packed_test_proc packed = { arm::packed_cpsr(), 0, P, {}, {} };
+        packed.CPSR.word = 0;
+
+        for( int i = 0; i < 4; ++i )
+        {
+            seed = seed * 1103515245 + 12345;
+            R[i] = P[i] = lazy_test_values[( seed >> 16 ) % value_count];
+        }
+
+        for( int i = 0; i < 4; ++i )
+        {
+            seed = seed * 1103515245 + 12345;
+            const uint32_t instr = lazy_test_instrs[( seed >> 16 ) %
+                                                    instr_count];
+
+            arm::DecodeResult< test_proc > d =
+                arm::decode< test_proc >( instr );
+            arm::DecodeResult< packed_test_proc > p =
+                arm::decode< packed_test_proc >( instr );
+            BOOST_REQUIRE( d.handler && p.handler );
+            d.handler( proc, instr );
+            p.handler( packed, instr );
+
+            for( int r = 0; r < 5; ++r )
+            {
+                BOOST_CHECK_EQUAL( R[r], P[r] );
+            }
+        }
+
+        BOOST_CHECK_EQUAL( arm::CPSRValue( proc.CPSR ),
+                           arm::CPSRValue( packed.CPSR ) );
+    }
+}
+
+#endif // __ARMV7_PROCESSOR_TEST_HPP__
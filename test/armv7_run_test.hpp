@@ -0,0 +1,117 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the ARMv7 interpreter loop.
+ */
+
+#ifndef __ARMV7_RUN_TEST_HPP__
+#define __ARMV7_RUN_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    // Copies a word-aligned string between two buffers, then returns
+    // through a branch to the instruction after the next one.
+    const uint32_t run_test_program[] =
+    {
+        0xE3A01C01,     // 0x00: mov   r1, #0x100
+        0xE3A02C02,     // 0x04: mov   r2, #0x200
+        0xEB000002,     // 0x08: bl    0x18
+        0xEA000000,     // 0x0C: b     0x14
+        0xE3A07007,     // 0x10: mov   r7, #7
+        0xEF000000,     // 0x14: svc   #0
+        0xE4913004,     // 0x18: ldr   r3, [r1], #4
+        0xE4823004,     // 0x1C: str   r3, [r2], #4
+        0xE3530000,     // 0x20: cmp   r3, #0
+        0x1AFFFFFB,     // 0x24: bne   0x18
+        0xE12FFF1E      // 0x28: bx    lr
+    };
+
+    void InitRunTestProc( test_proc& proc, uint32_t* R )
+    {
+        LoadTestProgram( proc, R, run_test_program );
+
+        proc.dMem.words[ 0x100 / 4 ] = 0x64636261;
+        proc.dMem.words[ 0x104 / 4 ] = 0x00676665;
+        proc.dMem.words[ 0x108 / 4 ] = 0;
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE( run_test )
+{
+    test_proc proc;
+    uint32_t  R[16];
+    InitRunTestProc( proc, R );
+
+    // 3 + 3 loop iterations of 4 instructions + bx + b
+    BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 17u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x14u );
+    BOOST_CHECK_EQUAL( R[7], 0u );
+    BOOST_CHECK_EQUAL( R[14], 0x0Cu );
+    BOOST_CHECK_EQUAL( proc.dMem.words[ 0x200 / 4 ], 0x64636261u );
+    BOOST_CHECK_EQUAL( proc.dMem.words[ 0x204 / 4 ], 0x00676665u );
+
+    // Stopped at the svc
+    BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 0u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x14u );
+}
+
+
+BOOST_AUTO_TEST_CASE( run_max_instrs_test )
+{
+    test_proc proc;
+    uint32_t  R[16];
+    InitRunTestProc( proc, R );
+
+    BOOST_CHECK_EQUAL( arm::run( proc, 4 ), 4u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x1Cu );
+    BOOST_CHECK_EQUAL( R[3], 0x64636261u );
+
+    BOOST_CHECK_EQUAL( arm::run( proc, 0 ), 0u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x1Cu );
+
+    BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 13u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x14u );
+}
+
+
+BOOST_AUTO_TEST_CASE( run_block_cache_test )
+{
+    test_proc expected, actual;
+    uint32_t  expected_R[16], actual_R[16];
+    InitRunTestProc( expected, expected_R );
+    InitRunTestProc(   actual,   actual_R );
+
+    arm::block_cache< test_proc > cache;
+    BOOST_CHECK_EQUAL( arm::run( expected, 1000 ), cache.run( actual, 1000 ) );
+    BOOST_CHECK_EQUAL( expected.PC, actual.PC );
+    BOOST_CHECK( memcmp( expected_R, actual_R, sizeof( expected_R ) ) == 0 );
+    BOOST_CHECK( memcmp( expected.dMem.bytes, actual.dMem.bytes,
+                         sizeof( expected.dMem.bytes ) ) == 0 );
+}
+
+#endif // __ARMV7_RUN_TEST_HPP__
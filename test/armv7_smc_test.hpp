@@ -0,0 +1,234 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the detection of self-modifying code.
+ */
+
+#ifndef __ARMV7_SMC_TEST_HPP__
+#define __ARMV7_SMC_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    // Patches the instruction at 0x14 before branching to it, then
+    // overwrites its own first instruction while it runs
+    const uint32_t smc_test_program[] =
+    {
+        0xE3A00000,     // 0x00: mov  r0, #0
+        0xE59F1010,     // 0x04: ldr  r1, [pc, #16]
+        0xE58F1004,     // 0x08: str  r1, [pc, #4]
+        0xEA000000,     // 0x0C: b    0x14
+        0xE7F000F0,     // 0x10: udf
+        0xE3A00001,     // 0x14: mov  r0, #1
+        0xE7F000F0,     // 0x18: udf
+        0xE3A00002,     // 0x1C: .word mov r0, #2
+        0xE59F1008,     // 0x20: ldr  r1, [pc, #8]
+        0xE50F100C,     // 0x24: str  r1, [pc, #-12]
+        0xE3A00003,     // 0x28: mov  r0, #3
+        0xE7F000F0,     // 0x2C: udf
+        0xE3A00005      // 0x30: .word mov r0, #5
+    };
+
+    typedef test_mem< 0x2000 > smc_test_mem;
+
+    typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                             arm::unified_mem< smc_test_mem > >
+        smc_test_proc;
+
+    void InitSmcTestProc( smc_test_proc& proc, uint32_t* R,
+                          smc_test_mem& mem, arm::code_map& code )
+    {
+        memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+        memset( R, 0, sizeof( uint32_t ) * 16 );
+        memset( &mem, 0, sizeof( mem ) );
+        memcpy( mem.words, smc_test_program, sizeof( smc_test_program ) );
+        proc.R = R;
+        proc.iMem.mem  = &mem;
+        proc.iMem.code = &code;
+        proc.dMem.mem  = &mem;
+        proc.dMem.code = &code;
+    }
+
+    struct smc_test_cache
+    {
+        uint32_t address;
+        uint32_t size;
+        unsigned calls;
+
+        static void invalidate( void* cache, uint32_t address,
+                                uint32_t size )
+        {
+            smc_test_cache* self = static_cast< smc_test_cache* >( cache );
+            self->address = address;
+            self->size    = size;
+            ++self->calls;
+        }
+    };
+
+}
+
+
+BOOST_AUTO_TEST_CASE( code_map_test )
+{
+    arm::code_map  map;
+    smc_test_cache cache = { 0, 0, 0 };
+    map.attach( &cache, &smc_test_cache::invalidate );
+
+    map.mark( 0x12345678 );
+    BOOST_CHECK(  map.marked( 0x12345000 ) );
+    BOOST_CHECK(  map.marked( 0x12345FFF ) );
+    BOOST_CHECK( !map.marked( 0x12344FFF ) );
+    BOOST_CHECK( !map.marked( 0x12346000 ) );
+
+    // Writes to other pages are not reported
+    map.written( 0x12344FF8, 8 );
+    BOOST_CHECK_EQUAL( cache.calls, 0u );
+
+    // A write ending in a marked page unmarks it
+    map.written( 0x12344FFE, 4 );
+    BOOST_CHECK_EQUAL( cache.calls,   1u );
+    BOOST_CHECK_EQUAL( cache.address, 0x12344FFEu );
+    BOOST_CHECK_EQUAL( cache.size,    4u );
+    BOOST_CHECK( !map.marked( 0x12345000 ) );
+
+    map.written( 0x12345000, 4 );
+    BOOST_CHECK_EQUAL( cache.calls, 1u );
+
+    // Including across the end of the address space
+    map.mark( 0 );
+    map.written( 0xFFFFFFFE, 4 );
+    BOOST_CHECK_EQUAL( cache.calls, 2u );
+
+    map.mark( 0xFFFFF000 );
+    map.clear();
+    BOOST_CHECK( !map.marked( 0xFFFFF000 ) );
+
+    map.detach( &cache );
+    map.mark( 0 );
+    map.written( 0, 4 );
+    BOOST_CHECK_EQUAL( cache.calls, 2u );
+}
+
+
+BOOST_AUTO_TEST_CASE( unified_mem_words_test )
+{
+    static test_mem< 0x4000 > mem;
+    static uint32_t           words[ 0x3000 / 4 ];
+    memset( &mem, 0, sizeof( mem ) );
+    memset( words, 0, sizeof( words ) );
+
+    arm::code_map  code;
+    smc_test_cache cache = { 0, 0, 0 };
+    code.attach( &cache, &smc_test_cache::invalidate );
+
+    arm::unified_mem< test_mem< 0x4000 > > umem;
+    umem.mem  = &mem;
+    umem.code = &code;
+
+    // A write of three pages reaches the code in the middle one
+    code.mark( 0x1000 );
+    umem.write_words( 0x0000, words, 0x3000 / 4 );
+    BOOST_CHECK( !code.marked( 0x1000 ) );
+    BOOST_CHECK_EQUAL( cache.calls, 1u );
+    BOOST_CHECK_EQUAL( cache.address, 0x1000u );
+}
+
+BOOST_AUTO_TEST_CASE( block_cache_smc_test )
+{
+    static smc_test_mem mem;
+    smc_test_proc proc;
+    uint32_t      R[16];
+    arm::code_map code;
+    InitSmcTestProc( proc, R, mem, code );
+
+    arm::block_cache< smc_test_proc > cache( 0, &code );
+
+    // Translates the blocks at 0x14 and 0x18
+    proc.PC = 0x14;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 1u );
+    BOOST_CHECK_EQUAL( R[0], 1u );
+    BOOST_CHECK( code.marked( 0x14 ) );
+
+    // The store drops the block at 0x14 only
+    proc.PC = 0;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 5u );
+    BOOST_CHECK_EQUAL( R[0], 2u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x18u );
+    BOOST_CHECK_EQUAL( cache.size(), 3u );
+    BOOST_CHECK( code.marked( 0x14 ) );
+
+    // Data stores to a code page leave the blocks alone
+    proc.dMem.write_word( 0x1C, 0 );
+    BOOST_CHECK_EQUAL( cache.size(), 3u );
+
+    // Writing the instruction ending a block drops the block
+    proc.dMem.write_word( 0x18, 0xE320F000 );    // nop
+    BOOST_CHECK_EQUAL( cache.size(), 1u );
+
+    cache.flush();
+    BOOST_CHECK_EQUAL( cache.size(), 0u );
+}
+
+
+BOOST_AUTO_TEST_CASE( block_cache_smc_running_test )
+{
+    static smc_test_mem mem;
+    smc_test_proc proc;
+    uint32_t      R[16];
+    arm::code_map code;
+    InitSmcTestProc( proc, R, mem, code );
+
+    arm::block_cache< smc_test_proc > cache( 0, &code );
+
+    // The block completes as it was translated
+    proc.PC = 0x20;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 3u );
+    BOOST_CHECK_EQUAL( R[0], 3u );
+    BOOST_CHECK_EQUAL( cache.size(), 1u );
+
+    proc.PC = 0x20;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1 ), 1u );
+    BOOST_CHECK_EQUAL( R[0], 5u );
+}
+
+
+BOOST_AUTO_TEST_CASE( block_cache_smc_untracked_test )
+{
+    static smc_test_mem mem;
+    smc_test_proc proc;
+    uint32_t      R[16];
+    arm::code_map code;
+    InitSmcTestProc( proc, R, mem, code );
+
+    // Without the code map, the stale block at 0x14 is run
+    arm::block_cache< smc_test_proc > cache;
+    proc.PC = 0x14;
+    cache.run( proc, 1000 );
+    proc.PC = 0;
+    BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 5u );
+    BOOST_CHECK_EQUAL( R[0], 1u );
+}
+
+#endif // __ARMV7_SMC_TEST_HPP__
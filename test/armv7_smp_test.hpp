@@ -0,0 +1,246 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the multi-core system.
+ */
+
+#ifndef __ARMV7_SMP_TEST_HPP__
+#define __ARMV7_SMP_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    typedef arm::shared_mem< test_mem<1024> > smp_test_mem;
+    typedef arm::armv7_core< test_cpsr, test_reg,
+                             test_bank, smp_test_mem > smp_test_proc;
+
+    // Each core adds 1 to the word at r1, r3 times
+    const uint32_t smp_test_count_program[] =
+    {
+        0xE5912000,     // 0x00: ldr   r2, [r1]
+        0xE2822001,     // 0x04: add   r2, r2, #1
+        0xE5812000,     // 0x08: str   r2, [r1]
+        0xE2533001,     // 0x0C: subs  r3, r3, #1
+        0x1AFFFFFA,     // 0x10: bne   0x00
+        0xEF000000      // 0x14: svc   #0
+    };
+
+    // Each core stores r0 to the word at r1, r3 times
+    const uint32_t smp_test_store_program[] =
+    {
+        0xE5810000,     // 0x00: str   r0, [r1]
+        0xE2533001,     // 0x04: subs  r3, r3, #1
+        0x1AFFFFFC,     // 0x08: bne   0x00
+        0xEF000000      // 0x0C: svc   #0
+    };
+
+    // The core starting at 0x00 adds 1 to the word at r1, r3 times,
+    // with a load and store exclusive loop. The core starting at 0x20
+    // adds 1 to the byte at r1 + 3, r3 times, with ordinary loads and
+    // stores.
+    const uint32_t smp_test_mixed_program[] =
+    {
+        0xE1912F9F,     // 0x00: ldrex r2, [r1]
+        0xE2822001,     // 0x04: add   r2, r2, #1
+        0xE1814F92,     // 0x08: strex r4, r2, [r1]
+        0xE3540000,     // 0x0C: cmp   r4, #0
+        0x1AFFFFFA,     // 0x10: bne   0x00
+        0xE2533001,     // 0x14: subs  r3, r3, #1
+        0x1AFFFFF8,     // 0x18: bne   0x00
+        0xEF000000,     // 0x1C: svc   #0
+        0xE5D12003,     // 0x20: ldrb  r2, [r1, #3]
+        0xE2822001,     // 0x24: add   r2, r2, #1
+        0xE5C12003,     // 0x28: strb  r2, [r1, #3]
+        0xE2533001,     // 0x2C: subs  r3, r3, #1
+        0x1AFFFFFA,     // 0x30: bne   0x20
+        0xEF000000      // 0x34: svc   #0
+    };
+
+    struct smp_test_system
+    {
+        test_mem<1024> memory;
+        smp_test_proc  cores[4];
+        uint32_t       R[4][16];
+
+        template< size_t size >
+        smp_test_system( const uint32_t ( &program )[ size ] )
+        {
+            memset( &memory, 0, sizeof( memory ) );
+            memcpy( memory.words, program, sizeof( program ) );
+
+            for( int i = 0; i < 4; ++i )
+            {
+                memset( static_cast< void* >( &cores[i] ), 0,
+                        sizeof( cores[i] ) );
+                memset( R[i], 0, sizeof( R[i] ) );
+                cores[i].R = R[i];
+                cores[i].iMem.mem = &memory;
+                cores[i].dMem.mem = &memory;
+                R[i][0] = i + 1;
+            }
+        }
+    };
+
+}
+
+
+BOOST_AUTO_TEST_CASE( smp_barrier_test )
+{
+    arm::smp_barrier barrier( 1 );
+    BOOST_CHECK( barrier.wait( true ) );
+    BOOST_CHECK( !barrier.wait( false ) );
+    BOOST_CHECK( barrier.wait( true ) );
+}
+
+BOOST_AUTO_TEST_CASE( smp_system_run_test )
+{
+    for( int deterministic = 0; deterministic < 2; ++deterministic )
+    {
+        // Each core has its own counter
+        smp_test_system s( smp_test_count_program );
+        for( int i = 0; i < 4; ++i )
+        {
+            s.R[i][1] = 0x200 + 4 * i;
+            s.R[i][3] = 100 * ( i + 1 );
+        }
+
+        arm::smp_system< smp_test_proc > smp( s.cores, 4, 64,
+                                              deterministic );
+        BOOST_CHECK_EQUAL( smp.run( 100000 ), 5u * 1000 );
+
+        for( int i = 0; i < 4; ++i )
+        {
+            BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 + 4 * i ),
+                               100u * ( i + 1 ) );
+            BOOST_CHECK_EQUAL( smp.executed( i ), 500u * ( i + 1 ) );
+            BOOST_CHECK( smp.stopped( i ) );
+            BOOST_CHECK_EQUAL( s.cores[i].PC, 0x14u );
+        }
+
+        // The last core needs 31 full rounds and a partial one
+        BOOST_CHECK_EQUAL( smp.rounds(), 2000u / 64 + 1 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( smp_system_max_instrs_test )
+{
+    smp_test_system s( smp_test_count_program );
+    for( int i = 0; i < 4; ++i )
+    {
+        s.R[i][1] = 0x200 + 4 * i;
+        s.R[i][3] = 100;
+    }
+
+    arm::smp_system< smp_test_proc > smp( s.cores, 4, 64 );
+    BOOST_CHECK_EQUAL( smp.run( 100 ), 400u );
+    for( int i = 0; i < 4; ++i )
+    {
+        BOOST_CHECK_EQUAL( smp.executed( i ), 100u );
+        BOOST_CHECK( !smp.stopped( i ) );
+        BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 + 4 * i ), 20u );
+    }
+
+    // Cores resume where they stopped
+    BOOST_CHECK_EQUAL( smp.run( 1000 ), 4u * 400 );
+    for( int i = 0; i < 4; ++i )
+    {
+        BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 + 4 * i ), 100u );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( smp_system_deterministic_test )
+{
+    // All cores store to the same word. The first core stores 10 times,
+    // the others 3 times, so that the last store depends on the
+    // quantum.
+    const uint64_t quanta[] = { 4, 100 };
+    const uint32_t last[]   = { 1, 4 };
+
+    for( int q = 0; q < 2; ++q )
+    {
+        for( int repeat = 0; repeat < 2; ++repeat )
+        {
+            smp_test_system s( smp_test_store_program );
+            for( int i = 0; i < 4; ++i )
+            {
+                s.R[i][1] = 0x200;
+                s.R[i][3] = i == 0 ? 10 : 3;
+            }
+
+            arm::smp_system< smp_test_proc > smp( s.cores, 4, quanta[q],
+                                                  true );
+            BOOST_CHECK_EQUAL( smp.run( 1000 ), 30u + 3 * 9 );
+            BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), last[q] );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( shared_mem_clears_exclusive_test )
+{
+    smp_test_system s( smp_test_store_program );
+    s.R[0][1] = s.R[1][1] = 0x200;
+    s.R[0][2] = 0x12345678;
+
+    // A store from another core makes the store exclusive fail
+    arm::LDREX_A1( s.cores[0], 0xE1912F9F );    // ldrex r2, [r1]
+    arm::STR_imm_A1( s.cores[1], 0xE5810000 );  // str   r0, [r1]
+    s.R[0][2] = 0x12345678;
+    arm::STREX_A1( s.cores[0], 0xE1814F92 );    // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 1u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 2u );
+
+    // A store to another granule does not
+    s.R[1][1] = 0x208;
+    arm::LDREX_A1( s.cores[0], 0xE1912F9F );    // ldrex r2, [r1]
+    arm::STR_imm_A1( s.cores[1], 0xE5810000 );  // str   r0, [r1]
+    s.R[0][2] = 0x12345678;
+    arm::STREX_A1( s.cores[0], 0xE1814F92 );    // strex r4, r2, [r1]
+    BOOST_CHECK_EQUAL( s.R[0][4], 0u );
+    BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ), 0x12345678u );
+}
+
+BOOST_AUTO_TEST_CASE( shared_mem_store_exclusive_race_test )
+{
+    // A store exclusive that would write back a stale byte 3 over the
+    // ordinary store of the other core must fail
+    for( int repeat = 0; repeat < 10; ++repeat )
+    {
+        smp_test_system s( smp_test_mixed_program );
+        s.R[0][1] = s.R[1][1] = 0x200;
+        s.R[0][3] = 20000;
+        s.R[1][3] = 20000;
+        s.cores[1].PC = 0x20;
+
+        arm::smp_system< smp_test_proc > smp( s.cores, 2, 1000 );
+        smp.run( 1000000 );
+
+        BOOST_CHECK( smp.stopped( 0 ) );
+        BOOST_CHECK( smp.stopped( 1 ) );
+        BOOST_CHECK_EQUAL( s.memory.read_word( 0x200 ),
+                           ( ( 20000u & 0xFF ) << 24 ) | 20000u );
+    }
+}
+
+#endif // __ARMV7_SMP_TEST_HPP__
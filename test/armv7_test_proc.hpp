@@ -25,8 +25,13 @@
 
 #include <armv7/isa.hpp>
 #include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstring>
 
 
+/**
+ * Flat memory of mem_size bytes. Accesses may be unaligned.
+ */
 template< uint32_t mem_size >
 struct test_mem
 {
@@ -38,18 +43,53 @@ struct test_mem
         uint8_t  bytes [mem_size];
     };
 
-    uint64_t read_dword( uint32_t addr ) const { return dwords[addr/8]; }
-    uint32_t read_word ( uint32_t addr ) const { return  words[addr/4]; }
-    uint16_t read_half ( uint32_t addr ) const { return halves[addr/2]; }
-    uint8_t  read_byte ( uint32_t addr ) const { return  bytes[addr];   }
+    uint64_t read_dword( uint32_t addr ) const {
+        return load< uint64_t >( addr );
+    }
+    uint32_t read_word ( uint32_t addr ) const {
+        return load< uint32_t >( addr );
+    }
+    uint16_t read_half ( uint32_t addr ) const {
+        return load< uint16_t >( addr );
+    }
+    uint8_t  read_byte ( uint32_t addr ) const { return bytes[addr]; }
+
+    void write_dword( uint32_t addr, uint64_t data ) { store( addr, data ); }
+    void write_word ( uint32_t addr, uint32_t data ) { store( addr, data ); }
+    void write_half ( uint32_t addr, uint16_t data ) { store( addr, data ); }
+    void write_byte ( uint32_t addr,  uint8_t data ) { bytes[addr] = data; }
 
-    void write_dword( uint32_t addr, uint64_t data ) { dwords[addr/8] = data; }
-    void write_word ( uint32_t addr, uint32_t data ) {  words[addr/4] = data; }
-    void write_half ( uint32_t addr, uint16_t data ) { halves[addr/2] = data; }
-    void write_byte ( uint32_t addr,  uint8_t data ) {  bytes[addr]   = data; }
+    template< typename data_type >
+    data_type load( uint32_t addr ) const
+    {
+        data_type data;
+        memcpy( &data, bytes + addr, sizeof( data ) );
+        return data;
+    }
+
+    template< typename data_type >
+    void store( uint32_t addr, data_type data )
+    {
+        memcpy( bytes + addr, &data, sizeof( data ) );
+    }
 };
 
 
+/**
+ * Clears the processor and its register bank R[16], points proc.R to R
+ * and copies "program" to the start of the instruction memory.
+ */
+template< typename proc_type, size_t N >
+void LoadTestProgram( proc_type& proc, uint32_t* R,
+                      const uint32_t (&program)[N] )
+{
+    memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+    memset( R, 0, sizeof( uint32_t ) * 16 );
+    proc.R = R;
+    memcpy( proc.iMem.words, program, sizeof( program ) );
+}
+
+
 typedef uint32_t  test_field;
 typedef uint32_t  test_reg;
 typedef uint32_t* test_bank;
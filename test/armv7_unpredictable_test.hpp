@@ -0,0 +1,216 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the UNPREDICTABLE policies.
+ */
+
+#ifndef __ARMV7_UNPREDICTABLE_TEST_HPP__
+#define __ARMV7_UNPREDICTABLE_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    template< typename policy >
+    struct unpredictable_test_proc
+    {
+        typedef arm::armv7_core< test_cpsr, test_reg, test_bank,
+                                 test_mem<1024>, arm::armv7a_profile,
+                                 policy > type;
+    };
+
+    // mul r0, pc, r1 is UNPREDICTABLE (n == 15)
+    const uint32_t unpredictable_test_mul = 0xE000019F;
+
+    const uint32_t unpredictable_test_program[] =
+    {
+        0xE3A01003,     // 0x00: mov   r1, #3
+        0xE3A02002,     // 0x04: mov   r2, #2
+        0xE000019F,     // 0x08: mul   r0, pc, r1
+        0xE3A03001,     // 0x0C: mov   r3, #1
+        0xE3A04001      // 0x10: mov   r4, #1
+    };
+
+}
+
+
+BOOST_AUTO_TEST_CASE( unpredictable_ignore_test )
+{
+    typedef unpredictable_test_proc<
+        arm::unpredictable_ignore >::type proc_type;
+    proc_type proc;
+    uint32_t  R[16];
+    LoadTestProgram( proc, R, unpredictable_test_program );
+
+    // The instruction still executes
+    R[1] = 3;
+    R[15] = 8;
+    arm::MUL_A1( proc, unpredictable_test_mul );
+    BOOST_CHECK_EQUAL( R[0], 24u );
+    BOOST_CHECK( !arm::UnpredictableRaised( proc ) );
+}
+
+BOOST_AUTO_TEST_CASE( unpredictable_count_test )
+{
+    typedef unpredictable_test_proc<
+        arm::unpredictable_count >::type proc_type;
+    proc_type proc;
+    uint32_t  R[16];
+    LoadTestProgram( proc, R, unpredictable_test_program );
+
+    arm::unpredictable_count::reset();
+    arm::MUL_A1( proc, unpredictable_test_mul );
+    arm::MUL_A1( proc, unpredictable_test_mul );
+    arm::MUL_A1( proc, 0xE0000291 );    // mul r0, r1, r2
+
+    BOOST_CHECK_EQUAL( arm::unpredictable_count::count( arm::Encoding_MUL_A1 ),
+                       2u );
+    BOOST_CHECK_EQUAL( arm::unpredictable_count::count( arm::Encoding_MLA_A1 ),
+                       0u );
+    BOOST_CHECK( !arm::UnpredictableRaised( proc ) );
+
+    arm::unpredictable_count::reset();
+    BOOST_CHECK_EQUAL( arm::unpredictable_count::count( arm::Encoding_MUL_A1 ),
+                       0u );
+}
+
+BOOST_AUTO_TEST_CASE( unpredictable_record_test )
+{
+    typedef unpredictable_test_proc<
+        arm::unpredictable_record >::type proc_type;
+    proc_type proc;
+    uint32_t  R[16];
+    LoadTestProgram( proc, R, unpredictable_test_program );
+
+    arm::unpredictable_record::reset();
+    for( uint32_t i = 0; i < arm::unpredictable_record::size + 2; ++i )
+    {
+        proc.PC = 4 * i + 8;
+        arm::MUL_A1( proc, unpredictable_test_mul );
+    }
+
+    BOOST_CHECK_EQUAL( arm::unpredictable_record::total(),
+                       arm::unpredictable_record::size + 2u );
+
+    // The first two events were overwritten
+    arm::unpredictable_event events[ arm::unpredictable_record::size ];
+    BOOST_CHECK_EQUAL( arm::unpredictable_record::events(
+                           events, arm::unpredictable_record::size ),
+                       (size_t)arm::unpredictable_record::size );
+    BOOST_CHECK_EQUAL( events[0].encoding, arm::Encoding_MUL_A1 );
+    BOOST_CHECK_EQUAL( events[0].pc, 16u );
+    BOOST_CHECK_EQUAL( events[ arm::unpredictable_record::size - 1 ].pc,
+                       4u * ( arm::unpredictable_record::size + 1 ) + 8 );
+
+    // Only the last ones are copied
+    BOOST_CHECK_EQUAL( arm::unpredictable_record::events( events, 1 ), 1u );
+    BOOST_CHECK_EQUAL( events[0].pc,
+                       4u * ( arm::unpredictable_record::size + 1 ) + 8 );
+
+    arm::unpredictable_record::reset();
+    BOOST_CHECK_EQUAL( arm::unpredictable_record::events( events, 1 ), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( unpredictable_status_test )
+{
+    typedef unpredictable_test_proc<
+        arm::unpredictable_status >::type proc_type;
+    proc_type proc;
+    uint32_t  R[16];
+
+    // arm::run() stops after the mul
+    LoadTestProgram( proc, R, unpredictable_test_program );
+    BOOST_CHECK_EQUAL( arm::run( proc, 100 ), 3u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x0Cu );
+    BOOST_CHECK_EQUAL( R[3], 0u );
+    BOOST_CHECK( arm::UnpredictableRaised( proc ) );
+    BOOST_CHECK_EQUAL( arm::unpredictable_status::take( proc ),
+                       arm::Encoding_MUL_A1 );
+    BOOST_CHECK( !arm::UnpredictableRaised( proc ) );
+    BOOST_CHECK_EQUAL( arm::unpredictable_status::take( proc ),
+                       arm::Encoding_Unknown );
+
+    // It resumes after it
+    BOOST_CHECK_EQUAL( arm::run( proc, 2 ), 2u );
+    BOOST_CHECK_EQUAL( R[3], 1u );
+    BOOST_CHECK_EQUAL( R[4], 1u );
+
+    // So does the block cache
+    LoadTestProgram( proc, R, unpredictable_test_program );
+    arm::block_cache< proc_type > cache;
+    BOOST_CHECK_EQUAL( cache.run( proc, 100 ), 3u );
+    BOOST_CHECK_EQUAL( proc.PC, 0x0Cu );
+    BOOST_CHECK_EQUAL( R[3], 0u );
+    BOOST_CHECK_EQUAL( arm::unpredictable_status::take( proc ),
+                       arm::Encoding_MUL_A1 );
+
+    BOOST_CHECK_EQUAL( cache.run( proc, 2 ), 2u );
+    BOOST_CHECK_EQUAL( R[3], 1u );
+    BOOST_CHECK_EQUAL( R[4], 1u );
+}
+
+BOOST_AUTO_TEST_CASE( unpredictable_status_jit_test )
+{
+    typedef unpredictable_test_proc<
+        arm::unpredictable_status >::type proc_type;
+    proc_type proc;
+    uint32_t  R[16];
+
+    // The block calls the behavior function of the mul, so it is not
+    // translated and still stops right after it
+    arm::jit_compiler< proc_type > jit( 1 << 16, 1 );
+    arm::block_cache< proc_type >  cache( &jit );
+    for( int i = 0; i < 2; ++i )
+    {
+        LoadTestProgram( proc, R, unpredictable_test_program );
+        BOOST_CHECK_EQUAL( cache.run( proc, 100 ), 3u );
+        BOOST_CHECK_EQUAL( proc.PC, 0x0Cu );
+        BOOST_CHECK_EQUAL( R[3], 0u );
+        BOOST_CHECK_EQUAL( arm::unpredictable_status::take( proc ),
+                           arm::Encoding_MUL_A1 );
+    }
+    BOOST_CHECK( cache.lookup( proc, 0 )->native == 0 );
+}
+
+BOOST_AUTO_TEST_CASE( unpredictable_status_per_core_test )
+{
+    typedef unpredictable_test_proc<
+        arm::unpredictable_status >::type proc_type;
+    proc_type procs[2];
+    uint32_t  R[2][16];
+    LoadTestProgram( procs[0], R[0], unpredictable_test_program );
+    LoadTestProgram( procs[1], R[1], unpredictable_test_program );
+
+    // Only the core that executed the mul is stopped
+    arm::MUL_A1( procs[0], unpredictable_test_mul );
+    BOOST_CHECK( arm::UnpredictableRaised( procs[0] ) );
+    BOOST_CHECK( !arm::UnpredictableRaised( procs[1] ) );
+    BOOST_CHECK_EQUAL( arm::run( procs[1], 2 ), 2u );
+    BOOST_CHECK_EQUAL( arm::unpredictable_status::take( procs[1] ),
+                       arm::Encoding_Unknown );
+    BOOST_CHECK_EQUAL( arm::unpredictable_status::take( procs[0] ),
+                       arm::Encoding_MUL_A1 );
+}
+
+#endif // __ARMV7_UNPREDICTABLE_TEST_HPP__
@@ -0,0 +1,383 @@
+/*
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ * Unit tests for the virtual memory system architecture.
+ */
+
+#ifndef __ARMV7_VMSA_TEST_HPP__
+#define __ARMV7_VMSA_TEST_HPP__
+
+#include "armv7_test_proc.hpp"
+
+#include <armv7/isa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+
+namespace {
+
+    typedef arm::vmsa_mmu< arm::paged_mem > vmsa_test_mmu;
+
+    /**
+     * Builds translation tables at physical address 0x4000:
+     * - VA 0x80000000, section to PA 0x00100000, full access;
+     * - VA 0x90000000, section to PA 0x00400000 in domain 1;
+     * - VA 0x00001000, small page to PA 0x00200000, full access;
+     * - VA 0x00002000, small page to PA 0x00201000, privileged only;
+     * - VA 0x00003000, small page to PA 0x00202000, execute never;
+     * - VA 0x00005000, small non-global page to PA 0x00260000;
+     * - VA 0x00010000, large page to PA 0x00300000, full access.
+     */
+    void InitVMSATestTables( arm::paged_mem& mem )
+    {
+        mem.write_word( 0x4000 + ( 0x800 << 2 ), 0x00100C02 );
+        mem.write_word( 0x4000 + ( 0x900 << 2 ), 0x00400C22 );
+        mem.write_word( 0x4000 + ( 0x000 << 2 ), 0x00008001 );
+
+        mem.write_word( 0x8000 + ( 1 << 2 ), 0x00200032 );
+        mem.write_word( 0x8000 + ( 2 << 2 ), 0x00201012 );
+        mem.write_word( 0x8000 + ( 3 << 2 ), 0x00202033 );
+        mem.write_word( 0x8000 + ( 5 << 2 ), 0x00260832 );
+        for( int i = 16; i < 32; ++i )
+        {
+            mem.write_word( 0x8000 + ( i << 2 ), 0x00300031 );
+        }
+    }
+
+    void EnableVMSATestMMU( vmsa_test_mmu& mmu )
+    {
+        arm::vmsa_registers regs = mmu.registers();
+        regs.SCTLR      = 1;
+        regs.TTBR0      = 0x4000;
+        regs.DACR       = 1;   // Domain 0 is a client, domain 1 no access
+        regs.CONTEXTIDR = 1;
+        mmu.write_registers( regs );
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE( vmsa_disabled_test )
+{
+    arm::paged_mem mem;
+    vmsa_test_mmu  mmu( mem );
+
+    mmu.write< uint32_t >( 0x12345678, 0xCAFE );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x12345678 ), 0xCAFEu );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x12345678,
+                                             arm::VMSAAccess_Fetch ),
+                       0xCAFEu );
+
+    const arm::CheckTLBRecord check = mmu.CheckTLB( 0x12345000 );
+    BOOST_CHECK( check.tlbhit );
+    BOOST_CHECK_EQUAL( check.tlbrecord.type, arm::TLBRecType_MMUDisabled );
+    BOOST_CHECK( !mmu.fault().faulted );
+}
+
+BOOST_AUTO_TEST_CASE( vmsa_translation_test )
+{
+    arm::paged_mem mem;
+    vmsa_test_mmu  mmu( mem );
+    InitVMSATestTables( mem );
+    EnableVMSATestMMU( mmu );
+
+    // Section
+    mmu.write< uint32_t >( 0x80012344, 0x11223344 );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00112344 ), 0x11223344u );
+    BOOST_CHECK_EQUAL( mmu.read< uint16_t >( 0x80012346,
+                                             arm::VMSAAccess_Read ),
+                       0x1122u );
+
+    // Small and large pages
+    mem.write_word( 0x00200010, 1 );
+    mem.write_word( 0x00305004, 2 );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00001010,
+                                             arm::VMSAAccess_Read ), 1u );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00015004,
+                                             arm::VMSAAccess_Read ), 2u );
+
+    arm::AddressDescriptor desc;
+    BOOST_CHECK( mmu.TranslateAddress( 0x0001A123, arm::VMSAAccess_Read,
+                                       desc ) );
+    BOOST_CHECK_EQUAL( desc.paddress.physicaladdress, 0x0030A123u );
+
+    arm::TLBRecord record;
+    BOOST_CHECK( mmu.TranslationTableWalk( 0x00010000,
+                                           arm::VMSAAccess_Read, record ) );
+    BOOST_CHECK_EQUAL( record.type, arm::TLBRecType_LargePage );
+    BOOST_CHECK_EQUAL( record.perms.ap, 3 );
+
+    // Across two pages
+    mmu.write< uint32_t >( 0x00001FFE, 0xDDCCBBAA );
+    BOOST_CHECK_EQUAL( mem.read_half( 0x00200FFE ), 0xBBAAu );
+    BOOST_CHECK_EQUAL( mem.read_half( 0x00201000 ), 0xDDCCu );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00001FFE,
+                                             arm::VMSAAccess_Read ),
+                       0xDDCCBBAAu );
+    BOOST_CHECK( !mmu.fault().faulted );
+}
+
+BOOST_AUTO_TEST_CASE( vmsa_fault_test )
+{
+    arm::paged_mem mem;
+    vmsa_test_mmu  mmu( mem );
+    InitVMSATestTables( mem );
+    EnableVMSATestMMU( mmu );
+    mem.write_word( 0x00201000, 5 );
+
+    // Translation faults
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x10000000,
+                                             arm::VMSAAccess_Read ), 0u );
+    BOOST_CHECK( mmu.fault().faulted );
+    BOOST_CHECK_EQUAL( mmu.fault().type, arm::DAbort_Translation );
+    BOOST_CHECK_EQUAL( mmu.fault().address, 0x10000000u );
+    BOOST_CHECK_EQUAL( mmu.fault().level, 1 );
+
+    mmu.clear_fault();
+    mmu.write< uint32_t >( 0x00004000, 1 );
+    BOOST_CHECK( mmu.fault().faulted );
+    BOOST_CHECK_EQUAL( mmu.fault().type, arm::DAbort_Translation );
+    BOOST_CHECK_EQUAL( mmu.fault().access, uint32_t( arm::VMSAAccess_Write ) );
+    BOOST_CHECK_EQUAL( mmu.fault().level, 2 );
+
+    // Domain fault
+    mmu.clear_fault();
+    mmu.read< uint32_t >( 0x90000000, arm::VMSAAccess_Read );
+    BOOST_CHECK_EQUAL( mmu.fault().type, arm::DAbort_Domain );
+    BOOST_CHECK_EQUAL( mmu.fault().domain, 1 );
+
+    // Privileged only page
+    mmu.clear_fault();
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00002000,
+                                             arm::VMSAAccess_Read ), 5u );
+    mmu.set_privileged( false );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00002000,
+                                             arm::VMSAAccess_Read ), 0u );
+    BOOST_CHECK_EQUAL( mmu.fault().type, arm::DAbort_Permission );
+    mmu.write< uint32_t >( 0x00002000, 6 );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00201000 ), 5u );
+
+    // A faulting write across two pages writes nothing
+    mmu.write< uint32_t >( 0x00001FFE, 0xFFFFFFFF );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00200FFC ), 0u );
+    mmu.set_privileged( true );
+
+    // Execute never
+    mmu.clear_fault();
+    mmu.read< uint32_t >( 0x00003000, arm::VMSAAccess_Read );
+    BOOST_CHECK( !mmu.fault().faulted );
+    mmu.read< uint32_t >( 0x00003000, arm::VMSAAccess_Fetch );
+    BOOST_CHECK( mmu.fault().faulted );
+    BOOST_CHECK_EQUAL( mmu.fault().type, arm::DAbort_Permission );
+
+    // A manager domain is not checked
+    arm::vmsa_registers regs = mmu.registers();
+    regs.DACR = 0xF;
+    mmu.write_registers( regs );
+    mmu.clear_fault();
+    mmu.read< uint32_t >( 0x90000000, arm::VMSAAccess_Read );
+    mmu.read< uint32_t >( 0x00003000, arm::VMSAAccess_Fetch );
+    BOOST_CHECK( !mmu.fault().faulted );
+}
+
+BOOST_AUTO_TEST_CASE( vmsa_tlb_test )
+{
+    arm::paged_mem mem;
+    vmsa_test_mmu  mmu( mem );
+    InitVMSATestTables( mem );
+    EnableVMSATestMMU( mmu );
+    mem.write_word( 0x00200000, 1 );
+    mem.write_word( 0x00250000, 2 );
+
+    BOOST_CHECK( !mmu.CheckTLB( 0x00001000 ).tlbhit );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00001000,
+                                             arm::VMSAAccess_Read ), 1u );
+    BOOST_CHECK( mmu.CheckTLB( 0x00001000 ).tlbhit );
+
+    // The TLB keeps the old translation until it is invalidated
+    mem.write_word( 0x8000 + ( 1 << 2 ), 0x00250032 );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00001000,
+                                             arm::VMSAAccess_Read ), 1u );
+    mmu.TLBIMVA( 0x00001234 );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00001000,
+                                             arm::VMSAAccess_Read ), 2u );
+
+    mem.write_word( 0x8000 + ( 1 << 2 ), 0x00200032 );
+    mmu.TLBIMVAA( 0x00001000 );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00001000,
+                                             arm::VMSAAccess_Read ), 1u );
+
+    // Non-global entries belong to the current ASID
+    mmu.read< uint32_t >( 0x00005000, arm::VMSAAccess_Read );
+    BOOST_CHECK( mmu.CheckTLB( 0x00005000 ).tlbhit );
+    BOOST_CHECK( mmu.CheckTLB( 0x00005000 ).tlbrecord.nG );
+
+    arm::vmsa_registers regs = mmu.registers();
+    regs.CONTEXTIDR = 2;
+    mmu.write_registers( regs );
+    BOOST_CHECK( !mmu.CheckTLB( 0x00005000 ).tlbhit );
+    BOOST_CHECK( mmu.CheckTLB( 0x00001000 ).tlbhit );
+
+    regs.CONTEXTIDR = 1;
+    mmu.write_registers( regs );
+    BOOST_CHECK( mmu.CheckTLB( 0x00005000 ).tlbhit );
+    mmu.TLBIASID( 1 );
+    BOOST_CHECK( !mmu.CheckTLB( 0x00005000 ).tlbhit );
+    BOOST_CHECK( mmu.CheckTLB( 0x00001000 ).tlbhit );
+
+    // TLBIMVA takes the ASID from its operand, not CONTEXTIDR
+    mmu.read< uint32_t >( 0x00005000, arm::VMSAAccess_Read );
+    regs.CONTEXTIDR = 2;
+    mmu.write_registers( regs );
+    mmu.TLBIMVA( 0x00005000 | 2 );
+    regs.CONTEXTIDR = 1;
+    mmu.write_registers( regs );
+    BOOST_CHECK( mmu.CheckTLB( 0x00005000 ).tlbhit );
+
+    regs.CONTEXTIDR = 2;
+    mmu.write_registers( regs );
+    mmu.TLBIMVA( 0x00005000 | 1 );
+    regs.CONTEXTIDR = 1;
+    mmu.write_registers( regs );
+    BOOST_CHECK( !mmu.CheckTLB( 0x00005000 ).tlbhit );
+
+    mmu.TLBIALL();
+    BOOST_CHECK( !mmu.CheckTLB( 0x00001000 ).tlbhit );
+}
+
+BOOST_AUTO_TEST_CASE( vmsa_no_host_page_test )
+{
+    // Physical memory without host pages, with one small page at
+    // VA 0x80000000
+    static test_mem< 0x10000 > mem;
+    memset( &mem, 0, sizeof( mem ) );
+    mem.write_word( 0x4000 + ( 0x800 << 2 ), 0x00008001 );
+    mem.write_word( 0x8000, 0x0000C032 );
+
+    arm::vmsa_mmu< test_mem< 0x10000 >, 16 > mmu( mem );
+    arm::vmsa_registers regs = mmu.registers();
+    regs.SCTLR = 1;
+    regs.TTBR0 = 0x4000;
+    regs.DACR  = 1;
+    mmu.write_registers( regs );
+
+    mmu.write< uint32_t >( 0x80000010, 0x12345678 );
+    mmu.write< uint8_t  >( 0x80000014, 0x9A );
+    BOOST_CHECK_EQUAL( mem.read_word( 0xC010 ), 0x12345678u );
+    BOOST_CHECK_EQUAL( mem.read_byte( 0xC014 ), 0x9Au );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x80000010,
+                                             arm::VMSAAccess_Read ),
+                       0x12345678u );
+    BOOST_CHECK( !mmu.fault().faulted );
+}
+
+BOOST_AUTO_TEST_CASE( vmsa_run_test )
+{
+    typedef arm::vmsa_mem< vmsa_test_mmu > vmsa_test_mem;
+    typedef arm::armv7_core< test_cpsr, test_reg,
+                             test_bank, vmsa_test_mem > proc_type;
+
+    // Copies the words at r1 to r2 until a zero one, then stops
+    const uint32_t program[] =
+    {
+        0xE4913004,     // 0x00: ldr   r3, [r1], #4
+        0xE4823004,     // 0x04: str   r3, [r2], #4
+        0xE3530000,     // 0x08: cmp   r3, #0
+        0x1AFFFFFB,     // 0x0C: bne   0x00
+        0xEF000000      // 0x10: svc   #0
+    };
+
+    arm::paged_mem mem;
+    vmsa_test_mmu  mmu( mem );
+    InitVMSATestTables( mem );
+    EnableVMSATestMMU( mmu );
+    mem.write( 0x00100000, program, sizeof( program ) );
+    mem.write_word( 0x00300000, 7 );
+    mem.write_word( 0x00300004, 8 );
+
+    proc_type proc;
+    uint32_t  R[16];
+    memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+    memset( R, 0, sizeof( R ) );
+    proc.R = R;
+    proc.iMem.mmu   = &mmu;
+    proc.iMem.fetch = true;
+    proc.dMem.mmu   = &mmu;
+    proc.PC = 0x80000000;
+    R[1]    = 0x00010000;
+    R[2]    = 0x00001100;
+
+    BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 3u * 4 );
+    BOOST_CHECK_EQUAL( proc.PC, 0x80000010u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00200100 ), 7u );
+    BOOST_CHECK_EQUAL( mem.read_word( 0x00200104 ), 8u );
+    BOOST_CHECK( !mmu.fault().faulted );
+}
+
+BOOST_AUTO_TEST_CASE( vmsa_fetch_fault_test )
+{
+    typedef arm::vmsa_mem< vmsa_test_mmu > vmsa_test_mem;
+    typedef arm::armv7_core< test_cpsr, test_reg,
+                             test_bank, vmsa_test_mem > proc_type;
+
+    arm::paged_mem mem;
+    vmsa_test_mmu  mmu( mem );
+    InitVMSATestTables( mem );
+    EnableVMSATestMMU( mmu );
+
+    // Faulting fetches return an undefined instruction
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00003000,
+                                             arm::VMSAAccess_Fetch ),
+                       arm::VMSAFetchFault );
+    BOOST_CHECK_EQUAL( mmu.read< uint16_t >( 0x00004000,
+                                             arm::VMSAAccess_Fetch ),
+                       arm::VMSAFetchFault & 0xFFFF );
+    BOOST_CHECK_EQUAL( mmu.read< uint32_t >( 0x00004000,
+                                             arm::VMSAAccess_Read ), 0u );
+    BOOST_CHECK_EQUAL( arm::DecodeEncoding( arm::VMSAFetchFault ),
+                       arm::Encoding_Unknown );
+
+    proc_type proc;
+    uint32_t  R[16];
+    memset( static_cast< void* >( &proc ), 0, sizeof( proc ) );
+    memset( R, 0, sizeof( R ) );
+    proc.R = R;
+    proc.iMem.mmu   = &mmu;
+    proc.iMem.fetch = true;
+    proc.dMem.mmu   = &mmu;
+
+    // The engines stop before an unmapped or execute-never page
+    const uint32_t pages[] = { 0x00004000, 0x00003000 };
+    for( int i = 0; i < 2; ++i )
+    {
+        mmu.clear_fault();
+        proc.PC = pages[i];
+        BOOST_CHECK_EQUAL( arm::run( proc, 1000 ), 0u );
+        BOOST_CHECK_EQUAL( proc.PC, pages[i] );
+        BOOST_CHECK( mmu.fault().faulted );
+        BOOST_CHECK_EQUAL( mmu.fault().access,
+                           uint32_t( arm::VMSAAccess_Fetch ) );
+
+        arm::block_cache< proc_type > cache;
+        BOOST_CHECK_EQUAL( cache.run( proc, 1000 ), 0u );
+        BOOST_CHECK_EQUAL( proc.PC, pages[i] );
+    }
+}
+
+#endif // __ARMV7_VMSA_TEST_HPP__
@@ -5,6 +5,16 @@ my %funcs;         # All functions found
 
 parse_gcov( "gcov -n main.cpp -f | c++filt" );
 parse_gcov( "gcov -o ../armv7 -n function-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n decoder-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n elf-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n exclusive-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n jit-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n memory-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n mmio-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n predecode-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n smc-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n smp-dbg.gcno -f | c++filt" );
+parse_gcov( "gcov -o ../armv7 -n unpredictable-dbg.gcno -f | c++filt" );
 print_results();
 
 # Print coverage statistics in columns and in alphabetical order
@@ -22,5 +22,22 @@
 #define BOOST_TEST_MODULE libarmisa_test
 #include <boost/test/unit_test.hpp>
 
+#include "armv7_batch_test.hpp"
+#include "armv7_block_test.hpp"
+#include "armv7_decoder_test.hpp"
+#include "armv7_elf_test.hpp"
+#include "armv7_endian_test.hpp"
+#include "armv7_exclusive_test.hpp"
 #include "armv7_function_test.hpp"
 #include "armv7_instruction_test.hpp"
+#include "armv7_jit_test.hpp"
+#include "armv7_memory_test.hpp"
+#include "armv7_mmio_test.hpp"
+#include "armv7_parallel_test.hpp"
+#include "armv7_predecode_test.hpp"
+#include "armv7_processor_test.hpp"
+#include "armv7_run_test.hpp"
+#include "armv7_smc_test.hpp"
+#include "armv7_smp_test.hpp"
+#include "armv7_unpredictable_test.hpp"
+#include "armv7_vmsa_test.hpp"